@@ -138,10 +138,20 @@ TA_LIB_API TA_RetCode TA_GroupTableFree ( TA_StringTable *table );
 TA_LIB_API TA_RetCode TA_FuncTableAlloc( const char *group, TA_StringTable **table );
 TA_LIB_API TA_RetCode TA_FuncTableFree ( TA_StringTable *table );
 
+/* Same content as TA_GroupTableAlloc/TA_FuncTableAlloc, but returns
+ * an immutable table owned by TA-Lib. Nothing is allocated and the
+ * table must NOT be freed. It remains valid for the life of the process
+ * and can be shared between threads.
+ */
+TA_LIB_API TA_RetCode TA_GroupTableGet( const TA_StringTable **table );
+TA_LIB_API TA_RetCode TA_FuncTableGet ( const char *group, const TA_StringTable **table );
+
 /* Using the name, you can obtain an handle unique to this function.
  * This handle is further used for obtaining information on the
  * parameters needed and also for potentially calling this TA function.
  *
+ * The name is case-insensitive ("rsi" and "RSI" are the same function).
+ *
  * For convenience, this handle can also be found in
  * the TA_FuncInfo structure (see below).
  */
@@ -471,6 +481,41 @@ TA_LIB_API TA_RetCode TA_ParamHolderAlloc( const TA_FuncHandle *handle,
 
 TA_LIB_API TA_RetCode TA_ParamHolderFree( TA_ParamHolder *params );
 
+/* Same as TA_ParamHolderAlloc, but the TA_ParamHolder is placed in a
+ * buffer provided by the caller (stack, arena etc.). Nothing is allocated.
+ *
+ * TA_ParamHolderSize returns the minimum 'bufferSize' for this function.
+ * The buffer does not need to be aligned.
+ *
+ * The buffer must remain valid while the TA_ParamHolder is used. Calling
+ * TA_ParamHolderFree is optional, it does not free the buffer.
+ *
+ * Example:
+ *    char buffer[1024];
+ *    TA_ParamHolder *params;
+ *    size_t size;
+ *
+ *    TA_ParamHolderSize( handle, &size );
+ *    if( size <= sizeof(buffer) )
+ *       TA_ParamHolderInit( handle, buffer, sizeof(buffer), &params );
+ */
+TA_LIB_API TA_RetCode TA_ParamHolderSize( const TA_FuncHandle *handle, size_t *size );
+
+TA_LIB_API TA_RetCode TA_ParamHolderInit( const TA_FuncHandle *handle,
+                                          void *buffer, size_t bufferSize,
+                                          TA_ParamHolder **params );
+
+/* Make a copy of a TA_ParamHolder with all its parameters
+ * (typically to use the same configured function from many threads).
+ *
+ * If 'buffer' is NULL, the copy is allocated and must be freed
+ * with TA_ParamHolderFree. Otherwise, it is placed in the buffer
+ * like with TA_ParamHolderInit.
+ */
+TA_LIB_API TA_RetCode TA_ParamHolderClone( const TA_ParamHolder *params,
+                                           void *buffer, size_t bufferSize,
+                                           TA_ParamHolder **clone );
+
 /* Setup the values of the data input parameters.
  *
  * paramIndex is zero for the first input.
@@ -492,6 +537,38 @@ TA_LIB_API TA_RetCode TA_SetInputParamPricePtr( TA_ParamHolder *params,
                                                 const TA_Real      *volume,
                                                 const TA_Real      *openInterest );
 
+/* Same as TA_SetInputParamRealPtr/TA_SetInputParamPricePtr, but the
+ * values are 'stride' bytes apart instead of being contiguous. This
+ * allows to use directly an array of records, like:
+ *
+ *    typedef struct { double time, open, high, low, close, volume; } Bar;
+ *    Bar bar[1000];
+ *
+ *    TA_SetInputParamPriceStride( params, 0, &bar[0].open, &bar[0].high,
+ *                                 &bar[0].low, &bar[0].close, NULL, NULL,
+ *                                 sizeof(Bar) );
+ *
+ * 'stride' must be a multiple of sizeof(TA_Real). Each TA_CallFunc then
+ * costs one gather: the values from startIdx minus the lookback up to
+ * endIdx are copied in temporary contiguous arrays (TRIX is gathered
+ * from index 0). Prefer contiguous inputs when calling repeatedly on
+ * the same data.
+ */
+TA_LIB_API TA_RetCode TA_SetInputParamRealStride( TA_ParamHolder *params,
+                                                  unsigned int paramIndex,
+                                                  const TA_Real *value,
+                                                  size_t stride );
+
+TA_LIB_API TA_RetCode TA_SetInputParamPriceStride( TA_ParamHolder *params,
+                                                   unsigned int paramIndex,
+                                                   const TA_Real      *open,
+                                                   const TA_Real      *high,
+                                                   const TA_Real      *low,
+                                                   const TA_Real      *close,
+                                                   const TA_Real      *volume,
+                                                   const TA_Real      *openInterest,
+                                                   size_t              stride );
+
 /* Setup the values of the optional input parameters.
  * If an optional input is not set, a default value will be used.
  *
@@ -521,6 +598,17 @@ TA_LIB_API TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *params,
                                                 unsigned int paramIndex,
                                                 TA_Real        *out );
 
+/* Attach a TA_Context (see ta_common.h) to the parameters.
+ *
+ * TA_GetLookback, TA_CallFunc and TA_CallFuncParallel will then use
+ * the unstable periods and compatibility of that context, instead of
+ * the settings of the calling thread. NULL detaches the context.
+ *
+ * The context must stay allocated while attached.
+ */
+TA_LIB_API TA_RetCode TA_SetParamHolderContext( TA_ParamHolder   *params,
+                                                const TA_Context *context );
+
 /* Once the optional parameter are set, it is possible to
  * get the lookback for this call. This information can be
  * used to calculate the optimal size for the output buffers.
@@ -529,6 +617,42 @@ TA_LIB_API TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *params,
 TA_LIB_API TA_RetCode TA_GetLookback( const TA_ParamHolder *params,
                                       TA_Integer *lookback );
 
+/* Number of elements written in each output by TA_CallFunc for the
+ * range startIdx..endIdx, that is endIdx-max(startIdx,lookback)+1
+ * (zero when the range is entirely in the lookback).
+ *
+ * The optional inputs must be set first, since they change the lookback.
+ */
+TA_LIB_API TA_RetCode TA_GetOutputSize( const TA_ParamHolder *params,
+                                        TA_Integer            startIdx,
+                                        TA_Integer            endIdx,
+                                        TA_Integer           *outputSize );
+
+/* Instead of calling TA_SetOutputParamXXXXPtr, the outputs can be
+ * allocated by TA-Lib for the range startIdx..endIdx.
+ *
+ * All the outputs are allocated with exactly TA_GetOutputSize elements
+ * (at least one), each starting on a 64 bytes boundary. The memory comes
+ * from the allocator specified with TA_SetAllocator and belongs to the
+ * TA_ParamHolder: it is freed by TA_ParamHolderFree or by the next call
+ * to TA_AllocOutputParam (a clone made with TA_ParamHolderClone uses the
+ * same outputs, but does not own them).
+ *
+ * TA_GetOutputParamXXXXPtr return the outputs, whether they were
+ * allocated by TA-Lib or provided by the caller.
+ */
+TA_LIB_API TA_RetCode TA_AllocOutputParam( TA_ParamHolder *params,
+                                           TA_Integer      startIdx,
+                                           TA_Integer      endIdx );
+
+TA_LIB_API TA_RetCode TA_GetOutputParamIntegerPtr( const TA_ParamHolder *params,
+                                                   unsigned int          paramIndex,
+                                                   TA_Integer          **out );
+
+TA_LIB_API TA_RetCode TA_GetOutputParamRealPtr( const TA_ParamHolder *params,
+                                                unsigned int          paramIndex,
+                                                TA_Real             **out );
+
 /* Finally, call the TA function with the parameters.
  *
  * The TA function who is going to be called was specified
@@ -540,6 +664,177 @@ TA_LIB_API TA_RetCode TA_CallFunc( const TA_ParamHolder *params,
                                    TA_Integer           *outBegIdx,
                                    TA_Integer           *outNbElement );
 
+/* Size of the scratch buffer (see TA_ContextSetScratch) needed to call
+ * the TA function without any heap allocation, for the given range.
+ *
+ * The size is measured by calling the function once with the current
+ * parameters (so the outputs are written).
+ */
+TA_LIB_API TA_RetCode TA_GetScratchSize( const TA_ParamHolder *params,
+                                         TA_Integer            startIdx,
+                                         TA_Integer            endIdx,
+                                         size_t               *scratchSize );
+
+/* Same as TA_CallFunc, but the range is split in up to 'nbThread'
+ * chunks evaluated concurrently.
+ *
+ * This is possible only for functions where the output at a given
+ * index depends solely on the 'lookback' previous input values
+ * (SMA, WMA, MAX/MIN, LINEARREG, STDDEV, price transforms, MOM/ROC,
+ * CORREL, BBANDS with a SMA etc.). Each chunk re-reads the 'lookback'
+ * input values preceding it, and the outputs are written directly at
+ * their final position in the output buffers.
+ *
+ * For all other functions (TA_FUNC_FLG_UNST_PER, cumulative functions
+ * like AD/OBV, recursive functions like SAR or EMA based MA types)
+ * and for small ranges, this is equivalent to TA_CallFunc. This is
+ * also the case when an output buffer overlaps an input buffer.
+ *
+ * The chunks are executed through the executor specified with
+ * TA_SetExecutor. If there is none, a temporary thread pool
+ * of 'nbThread' threads is used for the duration of the call.
+ *
+ * Note: functions using a running sum (like SMA) may differ in the
+ *       last few bits from TA_CallFunc, since the sum restarts at
+ *       each chunk. The result is the same as calling TA_CallFunc
+ *       separately for each chunk.
+ */
+TA_LIB_API TA_RetCode TA_CallFuncParallel( const TA_ParamHolder *params,
+                                           TA_Integer            startIdx,
+                                           TA_Integer            endIdx,
+                                           TA_Integer           *outBegIdx,
+                                           TA_Integer           *outNbElement,
+                                           int                   nbThread );
+
+/* Same as TA_CallFunc, for series having more than INT_MAX elements.
+ *
+ * When endIdx fits in a TA_Integer, this is exactly TA_CallFunc.
+ *
+ * Otherwise the input and output pointers are advanced so the function
+ * is called with indexes relative to startIdx-lookback, which gives
+ * the same result as a call on the whole series. When even this range
+ * does not fit in a TA_Integer, it is evaluated in consecutive chunks,
+ * each one re-reading the 'lookback' values preceding it (like
+ * TA_CallFuncParallel). This is done only for:
+ *
+ *    - functions where the output depends solely on the 'lookback'
+ *      previous values (see TA_CallFuncParallel). Running sums restart
+ *      at each chunk and may differ in the last few bits.
+ *    - functions with an unstable period (TA_FUNC_FLG_UNST_PER). Each
+ *      chunk is as if TA_CallFunc was called with its first index,
+ *      meaning the unstable period (see TA_SetUnstablePeriod) must be
+ *      large enough for the result to converge.
+ *
+ * TA_OUT_OF_RANGE_END_INDEX is returned for all other functions
+ * (cumulative ones like AD/OBV, recursive ones like SAR) when the range
+ * is too large, and for functions returning an index in the input
+ * (MAXINDEX, MININDEX...) when endIdx does not fit in a TA_Integer.
+ *
+ * The TA_XXX_64 functions in ta_func64.h call TA_CallFunc64.
+ */
+TA_LIB_API TA_RetCode TA_CallFunc64( const TA_ParamHolder *params,
+                                     TA_Integer64          startIdx,
+                                     TA_Integer64          endIdx,
+                                     TA_Integer64         *outBegIdx,
+                                     TA_Integer64         *outNbElement );
+
+/* A TA_Plan evaluates many calls at once, while computing only once
+ * the moving averages and variances they have in common.
+ *
+ * Each call is registered with TA_PlanAdd (the parameters are copied,
+ * so the TA_ParamHolder can be modified or freed afterward). On
+ * TA_PlanExecute, the calls are decomposed in nodes:
+ *
+ *    MA           -> the SMA, EMA, WMA, DEMA, TEMA, TRIMA, KAMA or T3 node.
+ *    VAR, STDDEV  -> a VAR node (nbDev only scales the final result).
+ *    BBANDS       -> the MA node and the VAR node.
+ *    Others       -> a node for the call itself.
+ *
+ * Identical nodes (same function, inputs, optional inputs, context and
+ * range) are evaluated only once. The intermediate buffers are recycled
+ * between nodes and kept allocated by the plan for the next execution.
+ *
+ * The outputs are exactly the same as calling TA_CallFunc for each call.
+ * Nothing is shared when an output buffer overlaps an input or another
+ * output buffer, all the calls are then simply done in sequence.
+ *
+ * Example:
+ *     TA_Plan *plan;
+ *     TA_CallResult result[3];
+ *     TA_PlanStats stats;
+ *
+ *     TA_PlanAlloc( &plan );
+ *     TA_PlanAdd( plan, bbandsParams, 0, 999 );
+ *     TA_PlanAdd( plan, smaParams,    0, 999 );
+ *     TA_PlanAdd( plan, stddevParams, 0, 999 );
+ *     TA_PlanExecute( plan, result, &stats );
+ *     TA_PlanFree( plan );
+ */
+typedef struct TA_Plan TA_Plan;
+
+typedef struct
+{
+   TA_RetCode retCode;
+   TA_Integer outBegIdx;
+   TA_Integer outNbElement;
+} TA_CallResult;
+
+typedef struct
+{
+   unsigned int nbRequest;  /* Calls added to the plan. */
+   unsigned int nbKernel;   /* Computations needed when calling them one by one. */
+   unsigned int nbComputed; /* Computations done by the plan. */
+   unsigned int nbBuffer;   /* Intermediate buffers allocated by the plan. */
+} TA_PlanStats;
+
+TA_LIB_API TA_RetCode TA_PlanAlloc( TA_Plan **plan );
+TA_LIB_API TA_RetCode TA_PlanFree ( TA_Plan *plan );
+
+TA_LIB_API TA_RetCode TA_PlanAdd( TA_Plan              *plan,
+                                  const TA_ParamHolder *params,
+                                  TA_Integer            startIdx,
+                                  TA_Integer            endIdx );
+
+/* 'results' must have one element per call added, in the same order.
+ * 'stats' is optional (can be NULL).
+ *
+ * TA_SUCCESS is returned even when some calls failed, see the retCode
+ * of each result.
+ */
+TA_LIB_API TA_RetCode TA_PlanExecute( TA_Plan       *plan,
+                                      TA_CallResult *results,
+                                      TA_PlanStats  *stats );
+
+/* Same as calling TA_CallFunc for each of the 'nbCall' parameters, with
+ * the range of the same index.
+ *
+ * The holders are validated once, then grouped to use the sweep and
+ * panel functions (see ta_panel.h) when possible:
+ *
+ *    SMA calls on the same input and range -> TA_SMA_Sweep
+ *    SMA, EMA or RSI calls with the same period, all starting at
+ *    index zero (on different inputs)       -> TA_XXX_Panel
+ *
+ * All other calls are done one by one, in order. This is also the case
+ * for all the calls when an output buffer overlaps an input or another
+ * output buffer.
+ *
+ * The outputs are exactly the same as calling TA_CallFunc for each call.
+ *
+ * TA_SUCCESS is returned even when some calls failed, see the retCode
+ * of each result.
+ */
+typedef struct
+{
+   TA_Integer startIdx;
+   TA_Integer endIdx;
+} TA_CallRange;
+
+TA_LIB_API TA_RetCode TA_CallFuncBatch( const TA_ParamHolder *const params[],
+                                        unsigned int                nbCall,
+                                        const TA_CallRange          ranges[],
+                                        TA_CallResult               results[] );
+
 
 /* Return XML representation of all the TA functions.
  * The returned array is the same as the ta_func_api.xml file.
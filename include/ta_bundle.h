@@ -0,0 +1,195 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TA_BUNDLE_H
+#define TA_BUNDLE_H
+
+/* Bundle functions: several related TA functions evaluated together,
+ * sharing their intermediate results.
+ *
+ * Unless specified otherwise, a bundle produces the exact same values
+ * as calling each of the corresponding TA functions with the same
+ * startIdx/endIdx. All the outputs share the same outBegIdx and
+ * outNBElement, which are the ones of the output with the largest
+ * lookback among the requested ones.
+ *
+ * Any output can be NULL when not needed (at least one is required).
+ * The outputs must not overlap the inputs.
+ *
+ * Example:
+ *      Trend filter with the directional movement family:
+ *
+ *      retCode = TA_DMI_Bundle( 0, nbBar-1, high, low, close, 14,
+ *                               &outBegIdx, &outNBElement,
+ *                               NULL, NULL, NULL,
+ *                               plusDI, minusDI, NULL, adx, adxr,
+ *                               atr, NULL );
+ */
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* TA_DMI_Bundle - Directional movement family
+ *
+ * Input  = High, Low, Close
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period, the same for all the outputs.
+ *
+ * Output = TRANGE, PLUS_DM, MINUS_DM, PLUS_DI, MINUS_DI,
+ *          DX, ADX, ADXR, ATR, NATR
+ *
+ * The true range and the +DM/-DM are calculated once per bar, and
+ * one set of Wilder accumulators feeds all the outputs. The ADXR keeps
+ * only the last 'period-1' ADX instead of re-calculating the ADX.
+ *
+ * Each function starts its accumulators at 'startIdx' minus its own
+ * lookback (unstable period included). When these starting points
+ * differ, which happens only when startIdx is past the lookback of
+ * some of the requested functions, one pass is done per starting point.
+ */
+TA_LIB_API TA_RetCode TA_DMI_Bundle( int           startIdx,
+                                     int           endIdx,
+                                     const double  inHigh[],
+                                     const double  inLow[],
+                                     const double  inClose[],
+                                     int           optInTimePeriod, /* From 2 to 100000 */
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outTRange[],
+                                     double        outPlusDM[],
+                                     double        outMinusDM[],
+                                     double        outPlusDI[],
+                                     double        outMinusDI[],
+                                     double        outDX[],
+                                     double        outADX[],
+                                     double        outADXR[],
+                                     double        outATR[],
+                                     double        outNATR[] );
+
+/* TA_BBANDS_Bundle - Bollinger Bands with their derived outputs
+ *
+ * Input  = double
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ *
+ * optInNbDevUp:(From TA_REAL_MIN to TA_REAL_MAX)
+ *    Deviation multiplier for upper band
+ *
+ * optInNbDevDn:(From TA_REAL_MIN to TA_REAL_MAX)
+ *    Deviation multiplier for lower band
+ *
+ * optInMAType:
+ *    Type of Moving Average
+ *
+ * Output = Upper, Middle, Lower band (same as TA_BBANDS),
+ *          StdDev, Variance, PercentB, Bandwidth
+ *
+ * The standard deviation is the one used for the bands (nbDev of 1.0)
+ * and the variance is its value before the square root. They are
+ * identical to TA_STDDEV/TA_VAR called with startIdx set to the
+ * outBegIdx, except with the SMA where the deviation is derived from
+ * the middle band (same as TA_BBANDS) and can differ in the last bits.
+ *
+ *    PercentB  = (inReal-Lower)/(Upper-Lower)  (0.0 when Upper==Lower)
+ *    Bandwidth = (Upper-Lower)/Middle          (0.0 when Middle is zero)
+ */
+TA_LIB_API TA_RetCode TA_BBANDS_Bundle( int           startIdx,
+                                        int           endIdx,
+                                        const double  inReal[],
+                                        int           optInTimePeriod, /* From 2 to 100000 */
+                                        double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                        double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                        TA_MAType     optInMAType,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outRealUpperBand[],
+                                        double        outRealMiddleBand[],
+                                        double        outRealLowerBand[],
+                                        double        outStdDev[],
+                                        double        outVariance[],
+                                        double        outPercentB[],
+                                        double        outBandwidth[] );
+
+/* TA_MACD_Bundle - MACD with its fast and slow EMA
+ *
+ * Input  = double
+ * Optional Parameters
+ * -------------------
+ * optInFastPeriod:(From 2 to 100000)
+ *    Number of period for the fast MA
+ *
+ * optInSlowPeriod:(From 2 to 100000)
+ *    Number of period for the slow MA
+ *
+ * optInSignalPeriod:(From 1 to 100000)
+ *    Smoothing for the signal line (nb of period). With a period of
+ *    1 the signal line is the MACD.
+ *
+ * Output = MACD, MACDSignal, MACDHist (same as TA_MACD),
+ *          FastEMA, SlowEMA
+ *
+ * The EMA lines are the ones the MACD is the difference of. They are
+ * identical to TA_EMA called with a startIdx moved back by the lookback
+ * of the signal line (this is where the MACD starts its EMA).
+ */
+TA_LIB_API TA_RetCode TA_MACD_Bundle( int           startIdx,
+                                      int           endIdx,
+                                      const double  inReal[],
+                                      int           optInFastPeriod, /* From 2 to 100000 */
+                                      int           optInSlowPeriod, /* From 2 to 100000 */
+                                      int           optInSignalPeriod, /* From 1 to 100000 */
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outMACD[],
+                                      double        outMACDSignal[],
+                                      double        outMACDHist[],
+                                      double        outFastEMA[],
+                                      double        outSlowEMA[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/***************/
+/* End of File */
+/***************/
@@ -41,7 +41,7 @@
  * use the "NEXT AVAILABLE NUMBER" and increment the
  * number in this file.
  *
- * NEXT AVAILABLE NUMBER: 181
+ * NEXT AVAILABLE NUMBER: 182
  */
 #define TA_INTERNAL_ERROR(Id) ((TA_RetCode)(TA_INTERNAL_ERROR+Id))
 
@@ -87,6 +87,11 @@ TA_LIB_API const char *TA_GetVersionExtra ( void );
 typedef double TA_Real;
 typedef int    TA_Integer;
 
+/* Index in a series that may have more than INT_MAX
+ * elements (see TA_CallFunc64 and ta_func64.h).
+ */
+typedef long long TA_Integer64;
+
 /* General purpose structure containing an array of string.
  *
  * Example of usage:
@@ -146,6 +151,200 @@ TA_LIB_API void TA_SetRetCodeInfo( TA_RetCode theRetCode, TA_RetCodeInfo *retCod
 TA_LIB_API TA_RetCode TA_Initialize( void );
 TA_LIB_API TA_RetCode TA_Shutdown( void );
 
+/* Multithreading
+ *
+ * TA-Lib does not create threads on its own. Instead, the functions
+ * processing many independent units of work (like the panel functions
+ * declared in ta_panel.h) submit that work to an "executor".
+ *
+ * An executor must call taskFunc( taskData, i ) exactly once for
+ * every 'i' from 0 to nbTask-1, in any order and from any thread,
+ * and return only once all the tasks are completed. Each task writes
+ * to its own portion of the output, so the results are identical
+ * (and in the same order) no matter how the tasks are scheduled.
+ *
+ * By default there is no executor: the tasks are executed serially
+ * by the calling thread.
+ *
+ * Example using your own executor (OpenMP, TBB, a job system...):
+ *
+ *     static void myExecutor( void *executorData, int nbTask,
+ *                             TA_TaskFunc taskFunc, void *taskData )
+ *     {
+ *        int i;
+ *        #pragma omp parallel for
+ *        for( i=0; i < nbTask; i++ )
+ *           taskFunc( taskData, i );
+ *     }
+ *
+ *     TA_SetExecutor( myExecutor, NULL );
+ *
+ * Example using the thread pool provided by TA-Lib:
+ *
+ *     TA_ThreadPool *pool;
+ *
+ *     TA_ThreadPoolAlloc( 0, TA_THREAD_POOL_PINNED, &pool );
+ *     TA_SetExecutor( TA_ThreadPoolExecutor, pool );
+ *     ... call the TA functions ...
+ *     TA_SetExecutor( NULL, NULL );
+ *     TA_ThreadPoolFree( pool );
+ *
+ * Like TA_SetUnstablePeriod and TA_SetCompatibility, the executor is
+ * a global setting and should not be changed while TA functions are
+ * running in other threads.
+ */
+typedef void (*TA_TaskFunc)( void *taskData, int taskIdx );
+
+typedef void (*TA_Executor)( void *executorData,
+                             int         nbTask,
+                             TA_TaskFunc taskFunc,
+                             void       *taskData );
+
+TA_LIB_API TA_RetCode TA_SetExecutor( TA_Executor executor, void *executorData );
+
+/* TA_ThreadPoolAlloc creates a pool of threads usable as an executor.
+ *
+ * 'nbThread' is the number of threads executing the tasks, including
+ * the thread calling the executor (which always participates). Zero
+ * selects the number of online processors.
+ *
+ * With TA_THREAD_POOL_PINNED, each worker thread is bound to its own
+ * processor. This flag is ignored on platforms not supporting it.
+ *
+ * Tasks are distributed dynamically: an idle thread grabs the next
+ * pending task, so uneven tasks are balanced among the threads.
+ *
+ * A pool executes one submission at a time. Concurrent submissions
+ * from different threads are serialized. A task must not submit work
+ * to the pool executing it.
+ *
+ * Return TA_NOT_SUPPORTED when TA-Lib is built without thread support.
+ */
+typedef struct TA_ThreadPool TA_ThreadPool;
+
+#define TA_THREAD_POOL_PINNED 0x00000001
+
+TA_LIB_API TA_RetCode TA_ThreadPoolAlloc( int nbThread, int flags, TA_ThreadPool **pool );
+TA_LIB_API TA_RetCode TA_ThreadPoolFree ( TA_ThreadPool *pool );
+
+TA_LIB_API void TA_ThreadPoolExecutor( void       *executorData, /* The TA_ThreadPool */
+                                       int         nbTask,
+                                       TA_TaskFunc taskFunc,
+                                       void       *taskData );
+
+/* Context
+ *
+ * The settings changed with TA_SetUnstablePeriod and TA_SetCompatibility
+ * are shared by all the threads. A TA_Context holds its own copy of
+ * these settings, allowing threads to use different settings without
+ * any locking.
+ *
+ * TA_ContextAlloc initializes the new context with the current global
+ * settings.
+ *
+ * TA_SetThreadContext binds a context to the calling thread: all the TA
+ * functions called afterward by that thread (including the work they
+ * submit to the executor) use the settings of that context. Binding NULL
+ * restores the global settings. The context must stay allocated and
+ * unmodified while bound.
+ *
+ * A context can also be attached to a TA_ParamHolder, see
+ * TA_SetParamHolderContext in ta_abstract.h.
+ *
+ * Example:
+ *     TA_Context *context;
+ *
+ *     TA_ContextAlloc( &context );
+ *     TA_ContextSetUnstablePeriod( context, TA_FUNC_UNST_EMA, 30 );
+ *     TA_ContextSetCompatibility( context, TA_COMPATIBILITY_METASTOCK );
+ *
+ *     TA_SetThreadContext( context );
+ *     ... call the TA functions ...
+ *     TA_SetThreadContext( NULL );
+ *
+ *     TA_ContextFree( context );
+ */
+typedef struct TA_Context TA_Context;
+
+TA_LIB_API TA_RetCode TA_ContextAlloc( TA_Context **context );
+TA_LIB_API TA_RetCode TA_ContextFree ( TA_Context *context );
+
+TA_LIB_API TA_RetCode TA_ContextSetUnstablePeriod( TA_Context    *context,
+                                                   TA_FuncUnstId  id,
+                                                   unsigned int   unstablePeriod );
+
+TA_LIB_API unsigned int TA_ContextGetUnstablePeriod( const TA_Context *context,
+                                                     TA_FuncUnstId     id );
+
+TA_LIB_API TA_RetCode TA_ContextSetCompatibility( TA_Context *context, TA_Compatibility value );
+TA_LIB_API TA_Compatibility TA_ContextGetCompatibility( const TA_Context *context );
+
+TA_LIB_API TA_RetCode TA_SetThreadContext( const TA_Context *context );
+TA_LIB_API const TA_Context *TA_GetThreadContext( void );
+
+/* Memory allocation
+ *
+ * By default, TA-Lib uses malloc/realloc/free. TA_SetAllocator replaces
+ * them for all the memory allocated by TA-Lib. It must be called after
+ * TA_Initialize and before allocating anything with TA-Lib. Passing all
+ * NULL functions restores the defaults.
+ *
+ * TA_ContextSetAllocator replaces the allocator only for the temporary
+ * buffers of the TA functions called with that context. A new context
+ * starts with the allocator specified with TA_SetAllocator.
+ *
+ * The allocator functions may be called concurrently from many threads.
+ */
+typedef void *(*TA_MallocFunc) ( void *allocatorData, size_t size );
+typedef void *(*TA_ReallocFunc)( void *allocatorData, void *ptr, size_t size );
+typedef void  (*TA_FreeFunc)   ( void *allocatorData, void *ptr );
+
+TA_LIB_API TA_RetCode TA_SetAllocator( TA_MallocFunc  mallocFunc,
+                                       TA_ReallocFunc reallocFunc,
+                                       TA_FreeFunc    freeFunc,
+                                       void          *allocatorData );
+
+TA_LIB_API TA_RetCode TA_ContextSetAllocator( TA_Context    *context,
+                                              TA_MallocFunc  mallocFunc,
+                                              TA_ReallocFunc reallocFunc,
+                                              TA_FreeFunc    freeFunc,
+                                              void          *allocatorData );
+
+/* Scratch buffer
+ *
+ * Some TA functions (DEMA, TEMA, MACD, STOCH, ADXR, NATR etc.) need
+ * temporary buffers as large as the range being processed. When the
+ * context has a scratch buffer, these temporary buffers are taken from
+ * it instead of being allocated, so repeated calls do no heap allocation
+ * at all.
+ *
+ * When the scratch buffer is too small, the remaining temporary buffers
+ * are allocated as usual. TA_ContextGetScratchPeak returns the largest
+ * size the scratch buffer would have needed, for all the calls made
+ * since TA_ContextSetScratch. Typically, the scratch size is found by
+ * calling the functions once (or with TA_GetScratchSize in ta_abstract.h)
+ * and then re-allocating the scratch buffer with the peak size.
+ *
+ * Since the scratch buffer is modified by the TA functions, a context
+ * with a scratch buffer must be bound to only one thread at the time.
+ * The work submitted by that thread to the executor does not use the
+ * scratch buffer.
+ *
+ * A NULL buffer removes the scratch buffer from the context.
+ *
+ * Example:
+ *     TA_ContextSetScratch( context, buffer, bufferSize );
+ *     TA_SetThreadContext( context );
+ *     for( ... )
+ *        TA_MACD( ... );  <- No heap allocation here.
+ *     TA_SetThreadContext( NULL );
+ */
+TA_LIB_API TA_RetCode TA_ContextSetScratch( TA_Context *context,
+                                            void       *buffer,
+                                            size_t      size );
+
+TA_LIB_API size_t TA_ContextGetScratchPeak( const TA_Context *context );
+
 /* TA_LIB_SOURCES_DIGEST helps for TA-Lib automated maintenance.
  *
  * This value is updated whenever a make, cmake or any source files
@@ -0,0 +1,974 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TA_FUNC64_H
+#define TA_FUNC64_H
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+/* This header contains the same functions as "ta_func.h", with
+ * 64 bits indexes. They allow a single call on a series having more
+ * than INT_MAX elements (like a memory-mapped column).
+ *
+ * Only the double precision inputs are supported. The lookback
+ * functions are the same (TA_XXX_Lookback).
+ *
+ * See TA_CallFunc64 in "ta_abstract.h" for how a range that does
+ * not fit in an 'int' is evaluated.
+ */
+
+/* TA-LIB Developer Note: Do not modify this file, it is automaticaly
+ *                        generated by gen_code.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TA_DEFS_H
+   #include "ta_defs.h"
+#endif
+
+
+TA_LIB_API TA_RetCode TA_ACCBANDS_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outRealUpperBand[],
+                                      double        outRealMiddleBand[],
+                                      double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_ACOS_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AD_64( TA_Integer64  startIdx,
+                                TA_Integer64  endIdx,
+                                const double  inHigh[],
+                                const double  inLow[],
+                                const double  inClose[],
+                                const double  inVolume[],
+                                TA_Integer64 *outBegIdx,
+                                TA_Integer64 *outNBElement,
+                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADD_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal0[],
+                                 const double  inReal1[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADOSC_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inHigh[],
+                                   const double  inLow[],
+                                   const double  inClose[],
+                                   const double  inVolume[],
+                                   int           optInFastPeriod,
+                                   int           optInSlowPeriod,
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADX_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 const double  inClose[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADXR_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_APO_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInFastPeriod,
+                                 int           optInSlowPeriod,
+                                 TA_MAType     optInMAType,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AROON_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inHigh[],
+                                   const double  inLow[],
+                                   int           optInTimePeriod,
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outAroonDown[],
+                                   double        outAroonUp[] );
+
+TA_LIB_API TA_RetCode TA_AROONOSC_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ASIN_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ATAN_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ATR_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 const double  inClose[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AVGPRICE_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inOpen[],
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AVGDEV_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_BBANDS_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    double        optInNbDevUp,
+                                    double        optInNbDevDn,
+                                    TA_MAType     optInMAType,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outRealUpperBand[],
+                                    double        outRealMiddleBand[],
+                                    double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_BETA_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal0[],
+                                  const double  inReal1[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_BOP_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inOpen[],
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 const double  inClose[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CCI_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 const double  inClose[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CEIL_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CMO_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CORREL_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inReal0[],
+                                    const double  inReal1[],
+                                    int           optInTimePeriod,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_COS_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_COSH_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_DEMA_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_DIV_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal0[],
+                                 const double  inReal1[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_DX_64( TA_Integer64  startIdx,
+                                TA_Integer64  endIdx,
+                                const double  inHigh[],
+                                const double  inLow[],
+                                const double  inClose[],
+                                int           optInTimePeriod,
+                                TA_Integer64 *outBegIdx,
+                                TA_Integer64 *outNBElement,
+                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_EMA_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_EXP_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_FLOOR_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inReal[],
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_DCPERIOD_64( TA_Integer64  startIdx,
+                                         TA_Integer64  endIdx,
+                                         const double  inReal[],
+                                         TA_Integer64 *outBegIdx,
+                                         TA_Integer64 *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_DCPHASE_64( TA_Integer64  startIdx,
+                                        TA_Integer64  endIdx,
+                                        const double  inReal[],
+                                        TA_Integer64 *outBegIdx,
+                                        TA_Integer64 *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_PHASOR_64( TA_Integer64  startIdx,
+                                       TA_Integer64  endIdx,
+                                       const double  inReal[],
+                                       TA_Integer64 *outBegIdx,
+                                       TA_Integer64 *outNBElement,
+                                       double        outInPhase[],
+                                       double        outQuadrature[] );
+
+TA_LIB_API TA_RetCode TA_HT_SINE_64( TA_Integer64  startIdx,
+                                     TA_Integer64  endIdx,
+                                     const double  inReal[],
+                                     TA_Integer64 *outBegIdx,
+                                     TA_Integer64 *outNBElement,
+                                     double        outSine[],
+                                     double        outLeadSine[] );
+
+TA_LIB_API TA_RetCode TA_HT_TRENDLINE_64( TA_Integer64  startIdx,
+                                          TA_Integer64  endIdx,
+                                          const double  inReal[],
+                                          TA_Integer64 *outBegIdx,
+                                          TA_Integer64 *outNBElement,
+                                          double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_TRENDMODE_64( TA_Integer64  startIdx,
+                                          TA_Integer64  endIdx,
+                                          const double  inReal[],
+                                          TA_Integer64 *outBegIdx,
+                                          TA_Integer64 *outNBElement,
+                                          int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_IMI_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inOpen[],
+                                 const double  inClose[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_JMA_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 int           optInPhase,
+                                 int           optInVolPeriods,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outRealJMA[],
+                                 double        outRealUpperBand[],
+                                 double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_KAMA_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_64( TA_Integer64  startIdx,
+                                       TA_Integer64  endIdx,
+                                       const double  inReal[],
+                                       int           optInTimePeriod,
+                                       TA_Integer64 *outBegIdx,
+                                       TA_Integer64 *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_ANGLE_64( TA_Integer64  startIdx,
+                                             TA_Integer64  endIdx,
+                                             const double  inReal[],
+                                             int           optInTimePeriod,
+                                             TA_Integer64 *outBegIdx,
+                                             TA_Integer64 *outNBElement,
+                                             double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_INTERCEPT_64( TA_Integer64  startIdx,
+                                                 TA_Integer64  endIdx,
+                                                 const double  inReal[],
+                                                 int           optInTimePeriod,
+                                                 TA_Integer64 *outBegIdx,
+                                                 TA_Integer64 *outNBElement,
+                                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_SLOPE_64( TA_Integer64  startIdx,
+                                             TA_Integer64  endIdx,
+                                             const double  inReal[],
+                                             int           optInTimePeriod,
+                                             TA_Integer64 *outBegIdx,
+                                             TA_Integer64 *outNBElement,
+                                             double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LN_64( TA_Integer64  startIdx,
+                                TA_Integer64  endIdx,
+                                const double  inReal[],
+                                TA_Integer64 *outBegIdx,
+                                TA_Integer64 *outNBElement,
+                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LOG10_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inReal[],
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MA_64( TA_Integer64  startIdx,
+                                TA_Integer64  endIdx,
+                                const double  inReal[],
+                                int           optInTimePeriod,
+                                TA_MAType     optInMAType,
+                                TA_Integer64 *outBegIdx,
+                                TA_Integer64 *outNBElement,
+                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MACD_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInFastPeriod,
+                                  int           optInSlowPeriod,
+                                  int           optInSignalPeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outMACD[],
+                                  double        outMACDSignal[],
+                                  double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_MACDEXT_64( TA_Integer64  startIdx,
+                                     TA_Integer64  endIdx,
+                                     const double  inReal[],
+                                     int           optInFastPeriod,
+                                     TA_MAType     optInFastMAType,
+                                     int           optInSlowPeriod,
+                                     TA_MAType     optInSlowMAType,
+                                     int           optInSignalPeriod,
+                                     TA_MAType     optInSignalMAType,
+                                     TA_Integer64 *outBegIdx,
+                                     TA_Integer64 *outNBElement,
+                                     double        outMACD[],
+                                     double        outMACDSignal[],
+                                     double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_MACDFIX_64( TA_Integer64  startIdx,
+                                     TA_Integer64  endIdx,
+                                     const double  inReal[],
+                                     int           optInSignalPeriod,
+                                     TA_Integer64 *outBegIdx,
+                                     TA_Integer64 *outNBElement,
+                                     double        outMACD[],
+                                     double        outMACDSignal[],
+                                     double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_MAMA_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  double        optInFastLimit,
+                                  double        optInSlowLimit,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outMAMA[],
+                                  double        outFAMA[] );
+
+TA_LIB_API TA_RetCode TA_MAVP_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  const double  inPeriods[],
+                                  int           optInMinPeriod,
+                                  int           optInMaxPeriod,
+                                  TA_MAType     optInMAType,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MAX_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MAXINDEX_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inReal[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_MEDPRICE_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MFI_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 const double  inClose[],
+                                 const double  inVolume[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MIDPOINT_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inReal[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MIDPRICE_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MIN_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MININDEX_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inReal[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_MINMAX_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outMin[],
+                                    double        outMax[] );
+
+TA_LIB_API TA_RetCode TA_MINMAXINDEX_64( TA_Integer64  startIdx,
+                                         TA_Integer64  endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         TA_Integer64 *outBegIdx,
+                                         TA_Integer64 *outNBElement,
+                                         int           outMinIdx[],
+                                         int           outMaxIdx[] );
+
+TA_LIB_API TA_RetCode TA_MINUS_DI_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MINUS_DM_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MOM_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MULT_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal0[],
+                                  const double  inReal1[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_NATR_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_OBV_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 const double  inVolume[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_PLUS_DI_64( TA_Integer64  startIdx,
+                                     TA_Integer64  endIdx,
+                                     const double  inHigh[],
+                                     const double  inLow[],
+                                     const double  inClose[],
+                                     int           optInTimePeriod,
+                                     TA_Integer64 *outBegIdx,
+                                     TA_Integer64 *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_PLUS_DM_64( TA_Integer64  startIdx,
+                                     TA_Integer64  endIdx,
+                                     const double  inHigh[],
+                                     const double  inLow[],
+                                     int           optInTimePeriod,
+                                     TA_Integer64 *outBegIdx,
+                                     TA_Integer64 *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_PPO_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInFastPeriod,
+                                 int           optInSlowPeriod,
+                                 TA_MAType     optInMAType,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROC_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROCP_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROCR_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROCR100_64( TA_Integer64  startIdx,
+                                     TA_Integer64  endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     TA_Integer64 *outBegIdx,
+                                     TA_Integer64 *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_RSI_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SAR_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 double        optInAcceleration,
+                                 double        optInMaximum,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SAREXT_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    double        optInStartValue,
+                                    double        optInOffsetOnReverse,
+                                    double        optInAccelerationInitLong,
+                                    double        optInAccelerationLong,
+                                    double        optInAccelerationMaxLong,
+                                    double        optInAccelerationInitShort,
+                                    double        optInAccelerationShort,
+                                    double        optInAccelerationMaxShort,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SIN_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SINH_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SMA_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SQRT_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_STDDEV_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    double        optInNbDev,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_STOCH_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inHigh[],
+                                   const double  inLow[],
+                                   const double  inClose[],
+                                   int           optInFastK_Period,
+                                   int           optInSlowK_Period,
+                                   TA_MAType     optInSlowK_MAType,
+                                   int           optInSlowD_Period,
+                                   TA_MAType     optInSlowD_MAType,
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outSlowK[],
+                                   double        outSlowD[] );
+
+TA_LIB_API TA_RetCode TA_STOCHF_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    int           optInFastK_Period,
+                                    int           optInFastD_Period,
+                                    TA_MAType     optInFastD_MAType,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outFastK[],
+                                    double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_STOCHRSI_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inReal[],
+                                      int           optInTimePeriod,
+                                      int           optInFastK_Period,
+                                      int           optInFastD_Period,
+                                      TA_MAType     optInFastD_MAType,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outFastK[],
+                                      double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_SUB_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal0[],
+                                 const double  inReal1[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SUM_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_T3_64( TA_Integer64  startIdx,
+                                TA_Integer64  endIdx,
+                                const double  inReal[],
+                                int           optInTimePeriod,
+                                double        optInVFactor,
+                                TA_Integer64 *outBegIdx,
+                                TA_Integer64 *outNBElement,
+                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TAN_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TANH_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TEMA_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TRANGE_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TRIMA_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inReal[],
+                                   int           optInTimePeriod,
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TRIX_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TSF_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TYPPRICE_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ULTOSC_64( TA_Integer64  startIdx,
+                                    TA_Integer64  endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    int           optInTimePeriod1,
+                                    int           optInTimePeriod2,
+                                    int           optInTimePeriod3,
+                                    TA_Integer64 *outBegIdx,
+                                    TA_Integer64 *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_VAR_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 double        optInNbDev,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_WCLPRICE_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_WILLR_64( TA_Integer64  startIdx,
+                                   TA_Integer64  endIdx,
+                                   const double  inHigh[],
+                                   const double  inLow[],
+                                   const double  inClose[],
+                                   int           optInTimePeriod,
+                                   TA_Integer64 *outBegIdx,
+                                   TA_Integer64 *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_WMA_64( TA_Integer64  startIdx,
+                                 TA_Integer64  endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 TA_Integer64 *outBegIdx,
+                                 TA_Integer64 *outNBElement,
+                                 double        outReal[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/***************/
+/* End of File */
+/***************/
@@ -43,9 +43,33 @@
     #include "ta_func.h"
 #endif
 
+#ifndef TA_FUNC64_H
+   #include "ta_func64.h"
+#endif
+
 #ifndef TA_ABSTRACT_H
    #include "ta_abstract.h"
 #endif
 
+#ifndef TA_PANEL_H
+   #include "ta_panel.h"
+#endif
+
+#ifndef TA_BUNDLE_H
+   #include "ta_bundle.h"
+#endif
+
+#ifndef TA_META_H
+   #include "ta_meta.h"
+#endif
+
+#ifndef TA_STATS_H
+   #include "ta_stats.h"
+#endif
+
+#ifndef TA_TRACE_H
+   #include "ta_trace.h"
+#endif
+
 #endif
 
@@ -0,0 +1,249 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TA_META_H
+#define TA_META_H
+
+/* Compact binary description of all the TA functions.
+ *
+ * This is the same information as TA_FunctionDescriptionXML and the
+ * TA_GetFuncInfo/TA_GetXXXXParameterInfo functions, in a format that
+ * can be used in place: there is nothing to parse or allocate, and no
+ * pointer in it. The blob is generated by gen_code, both embedded in
+ * the library (TA_MetaGet) and written to "ta_func_meta.bin", so
+ * a wrapper can mmap the file (or read it from the shared library)
+ * and access it directly, even without calling TA_Initialize.
+ *
+ * Layout (all values are little endian, records are 8 bytes aligned):
+ *
+ *    TA_MetaHeader
+ *    unsigned int[nbGroup]      Offset of the group names.
+ *    TA_MetaFunc[nbFunc]        Sorted by name (case-insensitive).
+ *    TA_MetaInput[nbInput]      All the inputs, function by function.
+ *    TA_MetaOptInput[nbOptInput]
+ *    TA_MetaOutput[nbOutput]
+ *    TA_MetaListItem[nbListItem]
+ *    Strings                    Null terminated.
+ *
+ * All the offsets are in bytes from the start of the blob. The 'first'
+ * fields are indexes in the corresponding table.
+ *
+ * Example:
+ *      Display the optional inputs of a function:
+ *
+ *      const TA_MetaHeader *meta = TA_MetaGet();
+ *      const TA_MetaFunc *func = TA_MetaFindFunc( meta, "BBANDS" );
+ *      const TA_MetaOptInput *optIn;
+ *
+ *      for( i=0; i < func->nbOptInput; i++ )
+ *      {
+ *         optIn = TA_MetaGetOptInput( meta, func, i );
+ *         printf( "%s [%g..%g]\n", TA_MetaString( meta, optIn->name ),
+ *                 optIn->min, optIn->max );
+ *      }
+ */
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+#ifndef TA_ABSTRACT_H
+   #include "ta_abstract.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TA_META_MAGIC   0x444D4154 /* "TAMD" */
+#define TA_META_VERSION 1
+
+/* How the lookback can be calculated without calling TA_GetLookback.
+ *
+ *    TA_META_LOOKBACK_CONST:  lookbackOffset
+ *    TA_META_LOOKBACK_LINEAR: lookbackScale*optIn[lookbackOptIn]+lookbackOffset
+ *    TA_META_LOOKBACK_OTHER:  call TA_GetLookback.
+ *
+ * The value of the unstable period (see TA_SetUnstablePeriod) must be
+ * added for the functions having the TA_FUNC_FLG_UNST_PER flag.
+ */
+typedef enum
+{
+   TA_META_LOOKBACK_CONST,
+   TA_META_LOOKBACK_LINEAR,
+   TA_META_LOOKBACK_OTHER
+} TA_MetaLookbackId;
+
+typedef struct TA_MetaHeader
+{
+   unsigned int magic;   /* TA_META_MAGIC */
+   unsigned int version; /* TA_META_VERSION */
+   unsigned int size;    /* Of the whole blob, in bytes. */
+
+   unsigned int nbGroup;
+   unsigned int nbFunc;
+   unsigned int nbInput;
+   unsigned int nbOptInput;
+   unsigned int nbOutput;
+   unsigned int nbListItem;
+
+   unsigned int groupOffset;
+   unsigned int funcOffset;
+   unsigned int inputOffset;
+   unsigned int optInputOffset;
+   unsigned int outputOffset;
+   unsigned int listItemOffset;
+   unsigned int stringOffset;
+} TA_MetaHeader;
+
+typedef struct TA_MetaFunc
+{
+   unsigned int name;          /* String offsets. */
+   unsigned int camelCaseName;
+   unsigned int hint;
+   unsigned int group;         /* Index of the group. */
+   unsigned int flags;         /* TA_FUNC_FLG_XXXX */
+
+   unsigned int nbInput;
+   unsigned int nbOptInput;
+   unsigned int nbOutput;
+   unsigned int firstInput;
+   unsigned int firstOptInput;
+   unsigned int firstOutput;
+
+   unsigned int lookbackId;    /* TA_MetaLookbackId */
+   unsigned int lookbackOptIn;
+   int          lookbackScale;
+   int          lookbackOffset;
+   unsigned int reserved;
+} TA_MetaFunc;
+
+typedef struct TA_MetaInput
+{
+   unsigned int name;
+   unsigned int type;  /* TA_InputParameterType */
+   unsigned int flags; /* TA_InputFlags */
+   unsigned int reserved;
+} TA_MetaInput;
+
+/* For the lists, min and max are the smallest and largest values
+ * of the list, and the suggested values are zero.
+ */
+typedef struct TA_MetaOptInput
+{
+   double       defaultValue;
+   double       min;
+   double       max;
+   double       suggestedStart;
+   double       suggestedEnd;
+   double       suggestedIncrement;
+
+   unsigned int name;
+   unsigned int displayName;
+   unsigned int hint;
+   unsigned int type;      /* TA_OptInputParameterType */
+   unsigned int flags;     /* TA_OptInputFlags */
+   int          precision; /* TA_OptInput_RealRange only */
+   unsigned int nbListItem;
+   unsigned int firstListItem;
+} TA_MetaOptInput;
+
+typedef struct TA_MetaOutput
+{
+   unsigned int name;
+   unsigned int type;  /* TA_OutputParameterType */
+   unsigned int flags; /* TA_OutputFlags */
+   unsigned int reserved;
+} TA_MetaOutput;
+
+typedef struct TA_MetaListItem
+{
+   double       value;
+   unsigned int string;
+   unsigned int reserved;
+} TA_MetaListItem;
+
+/* The blob embedded in the library, NULL if it can not be used on
+ * this platform (big endian).
+ */
+TA_LIB_API const TA_MetaHeader *TA_MetaGet( void );
+
+/* Verify a blob loaded by the caller (e.g. "ta_func_meta.bin" mapped
+ * in memory). The blob must be 8 bytes aligned and stay accessible
+ * while in use. On success, 'header' is the start of the blob.
+ */
+TA_LIB_API TA_RetCode TA_MetaCheck( const void           *blob,
+                                    size_t                size,
+                                    const TA_MetaHeader **header );
+
+/* Access to the tables. NULL is returned for an index out of range.
+ *
+ * TA_MetaFindFunc does a case-insensitive binary search of the name.
+ */
+TA_LIB_API const TA_MetaFunc *TA_MetaGetFunc ( const TA_MetaHeader *header,
+                                               unsigned int funcIndex );
+
+TA_LIB_API const TA_MetaFunc *TA_MetaFindFunc( const TA_MetaHeader *header,
+                                               const char *name );
+
+TA_LIB_API const char *TA_MetaGetGroup( const TA_MetaHeader *header,
+                                        unsigned int groupIndex );
+
+TA_LIB_API const TA_MetaInput *TA_MetaGetInput( const TA_MetaHeader *header,
+                                                const TA_MetaFunc *func,
+                                                unsigned int paramIndex );
+
+TA_LIB_API const TA_MetaOptInput *TA_MetaGetOptInput( const TA_MetaHeader *header,
+                                                      const TA_MetaFunc *func,
+                                                      unsigned int paramIndex );
+
+TA_LIB_API const TA_MetaOutput *TA_MetaGetOutput( const TA_MetaHeader *header,
+                                                  const TA_MetaFunc *func,
+                                                  unsigned int paramIndex );
+
+TA_LIB_API const TA_MetaListItem *TA_MetaGetListItem( const TA_MetaHeader *header,
+                                                      const TA_MetaOptInput *optInput,
+                                                      unsigned int itemIndex );
+
+/* String at the given offset, "" when the offset is invalid. */
+TA_LIB_API const char *TA_MetaString( const TA_MetaHeader *header,
+                                      unsigned int offset );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/***************/
+/* End of File */
+/***************/
@@ -0,0 +1,139 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TA_PANEL_H
+#define TA_PANEL_H
+
+/* Panel functions: the same TA function applied to many independent
+ * series (e.g. one series per symbol) in a single call.
+ *
+ * Calling TA_RSI once per symbol over a large universe pays the
+ * parameter validation, the lookback computation and the function
+ * call overhead for every symbol. The panel variants do these once,
+ * then advance TA_PANEL_LANES series together through the recurrence.
+ * The bars of these series are transposed in small tiles, so even
+ * serial algorithms like EMA and RSI are vectorized across symbols by
+ * the compiler (one series per vector lane).
+ *
+ * Each series 'i' is processed over its whole range, so the result
+ * is identical to:
+ *
+ *    TA_XXX( 0, inLength[i]-1, inReal[i], ...,
+ *            &outBegIdx[i], &outNBElement[i], outReal[i] );
+ *
+ * This includes the effect of TA_SetUnstablePeriod and
+ * TA_SetCompatibility.
+ *
+ * When an executor is specified with TA_SetExecutor (see ta_common.h),
+ * the blocks of TA_PANEL_LANES series are processed concurrently. The
+ * output is the same.
+ *
+ * Series may have different lengths. A series too short to
+ * produce any output (or of length zero) gets outBegIdx and
+ * outNBElement set to zero. Each outReal[i] must be large enough
+ * for inLength[i] elements and may be the same buffer as inReal[i].
+ *
+ * Example:
+ *      const double *closes[3] = { spy, qqq, iwm };
+ *      double       *rsi[3]    = { outSpy, outQqq, outIwm };
+ *      int           len[3]    = { nbSpy, nbQqq, nbIwm };
+ *      int           beg[3], nb[3];
+ *
+ *      retCode = TA_RSI_Panel( 3, len, closes, 14, beg, nb, rsi );
+ */
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of series processed together by the panel functions. */
+#define TA_PANEL_LANES 4
+
+TA_LIB_API TA_RetCode TA_SMA_Panel( int                 nSeries,
+                                    const int           inLength[],
+                                    const double *const inReal[],
+                                    int                 optInTimePeriod, /* From 2 to 100000 */
+                                    int                 outBegIdx[],
+                                    int                 outNBElement[],
+                                    double *const       outReal[] );
+
+TA_LIB_API TA_RetCode TA_EMA_Panel( int                 nSeries,
+                                    const int           inLength[],
+                                    const double *const inReal[],
+                                    int                 optInTimePeriod, /* From 2 to 100000 */
+                                    int                 outBegIdx[],
+                                    int                 outNBElement[],
+                                    double *const       outReal[] );
+
+TA_LIB_API TA_RetCode TA_RSI_Panel( int                 nSeries,
+                                    const int           inLength[],
+                                    const double *const inReal[],
+                                    int                 optInTimePeriod, /* From 2 to 100000 */
+                                    int                 outBegIdx[],
+                                    int                 outNBElement[],
+                                    double *const       outReal[] );
+
+/* Sweep functions: the same TA function applied to one series with
+ * many periods (e.g. a parameter sweep of a backtest) in a single call.
+ *
+ * The input is processed in blocks small enough to stay in the cache,
+ * and all the periods are advanced over a block before moving to the
+ * next one. The result for each period 'k' is identical to:
+ *
+ *    TA_SMA( startIdx, endIdx, inReal, optInTimePeriod[k],
+ *            &outBegIdx[k], &outNBElement[k], outReal[k] );
+ *
+ * Unlike the single period function, the outputs must not overlap
+ * the input or each other.
+ */
+TA_LIB_API TA_RetCode TA_SMA_Sweep( int                 startIdx,
+                                    int                 endIdx,
+                                    const double        inReal[],
+                                    int                 nPeriod,
+                                    const int           optInTimePeriod[], /* From 2 to 100000 */
+                                    int                 outBegIdx[],
+                                    int                 outNBElement[],
+                                    double *const       outReal[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/***************/
+/* End of File */
+/***************/
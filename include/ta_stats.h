@@ -0,0 +1,152 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_STATS_H
+#define TA_STATS_H
+
+/* Per-function call statistics.
+ *
+ * When TA-Lib is built with TA_STATS defined (CMake option BUILD_STATS),
+ * every call to a TA_XXX or TA_S_XXX function is measured: number of
+ * calls, number of output elements, time spent (monotonic clock) and
+ * the temporary memory requested during the call, either from the
+ * scratch buffer of the context (see TA_ContextSetScratch) or from the
+ * heap (see TA_SetAllocator), with the most of it in use at once. Calls done through TA_CallFunc and the other abstract functions
+ * are included, and a function calling another one is counted for both.
+ *
+ * The heap blocks then start with a small header (their size), so the
+ * allocator of TA_SetAllocator is asked for a few more bytes.
+ *
+ * The counters are kept per thread, without any locking, and are summed
+ * by TA_GetStats. When TA_STATS is not defined, nothing is measured
+ * and these functions return TA_NOT_SUPPORTED.
+ *
+ * Example:
+ *      Display the time spent in each function since the last reset:
+ *
+ *      TA_StatsTable *table;
+ *      const TA_FuncInfo *funcInfo;
+ *
+ *      if( TA_GetStats( &table ) == TA_SUCCESS )
+ *      {
+ *         for( i=0; i < table->size; i++ )
+ *         {
+ *            TA_GetFuncInfo( table->stats[i].handle, &funcInfo );
+ *            printf( "%s %lld calls %lld ns\n", funcInfo->name,
+ *                    table->stats[i].nbCall, table->stats[i].nbNanoSec );
+ *         }
+ *         TA_StatsTableFree( table );
+ *      }
+ */
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+#ifndef TA_ABSTRACT_H
+   #include "ta_abstract.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TA_FuncStats
+{
+   const TA_FuncHandle *handle;
+
+   TA_Integer64 nbCall;
+   TA_Integer64 nbElement;   /* Sum of the outNBElement. */
+   TA_Integer64 nbNanoSec;
+   TA_Integer64 nbAllocByte; /* Requested from the allocator. */
+
+   TA_Integer64 nbAlloc;      /* Number of memory requests. */
+   TA_Integer64 nbHeapAlloc;  /* Requests not served by a scratch buffer. */
+   TA_Integer64 maxLiveByte;  /* Most bytes in use at once during a call. */
+} TA_FuncStats;
+
+typedef struct TA_StatsTable
+{
+   unsigned int        size;  /* Number of functions called. */
+   const TA_FuncStats *stats; /* Sorted by function name. */
+
+   void *hiddenData; /* Hidden data for TA-Lib internal use only. */
+} TA_StatsTable;
+
+/* Allocate the table of the functions called since TA_Initialize
+ * or the last TA_ResetStats, from all the threads.
+ *
+ * The counters of a thread calling TA functions at the same time
+ * may be off by the calls in progress.
+ *
+ * On success, call TA_StatsTableFree once the table is no longer
+ * needed.
+ */
+TA_LIB_API TA_RetCode TA_GetStats( TA_StatsTable **table );
+TA_LIB_API TA_RetCode TA_StatsTableFree( TA_StatsTable *table );
+
+/* Restart all the counters from zero. */
+TA_LIB_API TA_RetCode TA_ResetStats( void );
+
+/* Strict allocation mode.
+ *
+ * Once enabled, a TA function requesting memory from the heap (that is
+ * not served by the scratch buffer of its context) fails with
+ * TA_ALLOC_FORBIDDEN. This proves which call patterns are allocation
+ * free, e.g. when running a test suite.
+ *
+ * When a hook is specified, it is called first with the function doing
+ * the request and its size. A non-zero return lets the allocation
+ * proceed, so the hook can log the allocation instead of failing.
+ *
+ * The temporary memory of the other entry points (bundles, panels,
+ * TA_CallFuncBatch, TA_PlanExecute, strided inputs of TA_CallFunc...)
+ * is denied the same way. The hook then gets the function called
+ * through the TA_ParamHolder, or NULL when there is none.
+ *
+ * Memory kept by an object (TA_ParamHolderAlloc, the buffers of a
+ * TA_Plan etc.) is never denied. Requires TA_STATS like the statistics.
+ */
+typedef int (*TA_StrictAllocFunc)( const TA_FuncHandle *handle,
+                                   size_t size,
+                                   void *userData );
+
+TA_LIB_API TA_RetCode TA_SetStrictAlloc( int enable,
+                                         TA_StrictAllocFunc hook,
+                                         void *userData );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_TRACE_H
+#define TA_TRACE_H
+
+/* Function entry/exit tracing hooks.
+ *
+ * When TA-Lib is built with TA_TRACE defined (CMake option BUILD_TRACE),
+ * the hooks set with TA_SetTraceHooks are called around every call to a
+ * TA_XXX or TA_S_XXX function, including the ones done through
+ * TA_CallFunc, and around the sub-calls of a TA function to another TA
+ * function or to an internal function (e.g. TA_INT_EMA within TA_MACD).
+ *
+ * The hooks are called on the thread doing the TA call. They must not
+ * call a TA function themselves. When TA_TRACE is not defined, nothing
+ * is traced and TA_SetTraceHooks returns TA_NOT_SUPPORTED.
+ *
+ * Example:
+ *      Emit one span per call into your own tracer:
+ *
+ *      static void onEnter( const TA_TraceCall *call, void *userData )
+ *      {
+ *         myTracerBegin( userData, call->name, call->depth );
+ *      }
+ *
+ *      static void onExit( const TA_TraceCall *call, TA_RetCode retCode,
+ *                          void *userData )
+ *      {
+ *         myTracerEnd( userData, call->name, retCode );
+ *      }
+ *
+ *      TA_SetTraceHooks( onEnter, onExit, myTracer );
+ */
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+#ifndef TA_ABSTRACT_H
+   #include "ta_abstract.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TA_TraceCall
+{
+   /* Function name without the "TA_" prefix (e.g. "MACD" or "INT_EMA").
+    * handle is NULL for an internal function.
+    */
+   const char          *name;
+   const TA_FuncHandle *handle;
+
+   /* Requested range. */
+   int startIdx;
+   int endIdx;
+
+   /* 0 for a call from the application, 1 for its sub-calls etc. */
+   unsigned int depth;
+} TA_TraceCall;
+
+typedef void (*TA_TraceEnterFunc)( const TA_TraceCall *call, void *userData );
+typedef void (*TA_TraceExitFunc) ( const TA_TraceCall *call,
+                                   TA_RetCode retCode,
+                                   void *userData );
+
+/* Set the hooks called for all the threads. Either hook can be NULL,
+ * both NULL stops the tracing.
+ *
+ * Set the hooks while no TA function is being called.
+ */
+TA_LIB_API TA_RetCode TA_SetTraceHooks( TA_TraceEnterFunc onEnter,
+                                        TA_TraceExitFunc  onExit,
+                                        void *userData );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
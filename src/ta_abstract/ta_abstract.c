@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
+ *  AG       Agent
  *
  *
  * Change history:
@@ -50,6 +51,22 @@
  *  031404 MF   Some function renaming for consistency and better
  *              Perl integration.
  *  110206 AC   Change volume and open interest to double
+ *  101926 AG   Add TA_CallFuncParallel
+ *  101926 AG   Add TA_SetParamHolderContext
+ *  101926 AG   Add TA_GetScratchSize
+ *  101926 AG   Case-insensitive binary search in TA_GetFuncHandle,
+ *              add TA_GroupTableGet and TA_FuncTableGet
+ *  101926 AG   Single block TA_ParamHolder, add TA_ParamHolderSize,
+ *              TA_ParamHolderInit and TA_ParamHolderClone
+ *  101926 AG   Add TA_SetInputParamRealStride and
+ *              TA_SetInputParamPriceStride
+ *  101926 AG   Add TA_CallFunc64
+ *  101926 AG   Add TA_GetOutputSize and TA_AllocOutputParam
+ *  101926 AG   NATR no longer depends on the absolute index.
+ *  101926 AG   The temporary memory of the calls is subject to the
+ *              strict allocation mode (TA_EntryMalloc).
+ *  101926 AG   Strided MAXINDEX/MININDEX/MINMAXINDEX are gathered
+ *              from startIdx-lookback, the indexes are offset back.
  */
 
 /* Description:
@@ -58,10 +75,13 @@
 
 /**** Headers ****/
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
+#include <stdlib.h>
 #include <ctype.h>
 #include "ta_common.h"
 #include "ta_memory.h"
+#include "ta_global.h"
 #include "ta_abstract.h"
 #include "ta_def_ui.h"
 #include "ta_frame_priv.h"
@@ -109,6 +129,9 @@ extern const unsigned int TA_DEF_TableASize, TA_DEF_TableBSize,
     */
    extern const TA_FuncDef **TA_PerGroupFuncDef[];
    extern const unsigned int TA_PerGroupSize[];
+   extern const TA_StringTable TA_PerGroupFuncTable[];
+   extern const TA_FuncDef *TA_SortedFuncDef[];
+   extern const unsigned int TA_TotalNbFunction;
 #endif
 
 /**** Global variables definitions.    ****/
@@ -124,9 +147,114 @@ typedef struct
    unsigned int magicNumber;
 } TA_StringTablePriv;
 
+/* A TA_ParamHolder is a single block:
+ *   TA_ParamHolder, TA_ParamHolderPriv, in[], optIn[], out[]
+ * Each part starts on this alignment.
+ */
+#define TA_PARAM_HOLDER_ALIGN 8
+#define TA_PARAM_HOLDER_ROUND(x) (((x)+TA_PARAM_HOLDER_ALIGN-1) & ~((size_t)TA_PARAM_HOLDER_ALIGN-1))
 
-/**** Local functions declarations.    ****/
+typedef struct
+{
+   size_t privOffset;
+   size_t inOffset;
+   size_t optInOffset;
+   size_t outOffset;
+   size_t size;
+} TA_ParamHolderLayout;
+
+/* Copy of the parameters where all the strided inputs
+ * are gathered in contiguous arrays (see gatherInput).
+ */
+typedef struct
+{
+   TA_ParamHolderPriv params;
+   void              *buffer;
+} TA_GatheredInput;
+
+/* TA_CallFuncParallel does not split a range in chunks
+ * smaller than this number of output elements.
+ */
+#define TA_PARALLEL_MIN_CHUNK 512
+
+/* One chunk of a TA_CallFuncParallel. The parameters are the same
+ * as the caller, except for the output pointers.
+ */
+typedef struct
+{
+   TA_ParamHolderPriv params;
+   TA_Integer         startIdx;
+   TA_Integer         endIdx;
+   TA_Integer         outBegIdx;
+   TA_Integer         outNbElement;
+   TA_RetCode         retCode;
+} TA_ParallelChunk;
+
+typedef struct
+{
+   TA_ParallelChunk *chunk;
+   TA_FrameFunction  function;
+} TA_ParallelJob;
 
+/* Alignment of the outputs allocated by TA_AllocOutputParam. */
+#define TA_OUTPUT_ALIGN 64
+
+/* Largest index passed to a TA function by TA_CallFunc64. */
+#ifndef TA_CALL64_MAX_INDEX
+   #define TA_CALL64_MAX_INDEX INT_MAX
+#endif
+
+
+/**** Local functions declarations.    ****/
+static void getParamHolderLayout( const TA_FuncInfo *funcInfo,
+                                  TA_ParamHolderLayout *layout );
+static char *alignParamHolder( void *buffer );
+static TA_ParamHolder *initParamHolder( const TA_FuncDef *funcDef,
+                                        void *block,
+                                        const TA_ParamHolderLayout *layout,
+                                        unsigned int isPlaced );
+static int isBoundedFunction( const TA_ParamHolderPriv *paramHolderPriv );
+static int isValidStride( size_t stride );
+static void setInputStride( TA_ParamHolder *param, unsigned int paramIndex, size_t stride );
+static int hasStridedInput( const TA_ParamHolderPriv *paramHolderPriv );
+static TA_RetCode gatherInput( const TA_ParamHolderPriv *paramHolderPriv,
+                               TA_Integer                firstIdx,
+                               TA_Integer                endIdx,
+                               TA_GatheredInput         *gathered );
+static void gatherReal( TA_Real *dest, const TA_Real *src,
+                        size_t stride, TA_Integer nbElement );
+static TA_RetCode callFuncStrided( const TA_FuncDef         *funcDef,
+                                   const TA_ParamHolderPriv *paramHolderPriv,
+                                   TA_Integer                startIdx,
+                                   TA_Integer                endIdx,
+                                   TA_Integer               *outBegIdx,
+                                   TA_Integer               *outNbElement );
+static int isOutputOverlapInput( const TA_ParamHolderPriv *paramHolderPriv,
+                                 TA_Integer endIdx,
+                                 TA_Integer nbOutElement );
+static void parallelTask( void *taskData, int taskIdx );
+static const TA_Context *bindContext( const TA_ParamHolderPriv *paramHolderPriv );
+static void shiftParams( const TA_ParamHolderPriv *paramHolderPriv,
+                         TA_Integer64              inOffset,
+                         TA_Integer64              outOffset,
+                         TA_ParamHolderPriv       *shifted );
+static TA_RetCode callFunc64( const TA_ParamHolderPriv *paramHolderPriv,
+                              TA_Integer64              startIdx,
+                              TA_Integer64              endIdx,
+                              TA_Integer                lookback,
+                              TA_Integer64             *outBegIdx,
+                              TA_Integer64             *outNbElement );
+static TA_RetCode callFuncParallel( const TA_ParamHolder     *param,
+                                    const TA_ParamHolderPriv *paramHolderPriv,
+                                    TA_Integer                startIdx,
+                                    TA_Integer                endIdx,
+                                    TA_Integer               *outBegIdx,
+                                    TA_Integer               *outNbElement,
+                                    int                       nbThread );
+static int compareFuncName( const void *key, const void *elem );
+#ifndef TA_GEN_CODE
+static int compareFuncDefNoCase( const void *key, const void *elem );
+#endif
 
 #ifdef TA_GEN_CODE
    static TA_RetCode getGroupId( const char *groupString, unsigned int *groupId );
@@ -167,6 +295,46 @@ static const unsigned int *TA_DEF_TablesSize[26] =
    &TA_DEF_TableYSize, &TA_DEF_TableZSize
 };
 
+/* Immutable table returned by TA_GroupTableGet. */
+static const TA_StringTable groupTable =
+{
+   TA_NB_GROUP_ID, &TA_GroupString[0], NULL
+};
+
+/* Functions where the output depends on the absolute position in
+ * the input (some output an index), or reading the input before
+ * startIdx-lookback (TRIX). When gathering strided inputs, the index
+ * outputs are offset back after the call, the others are gathered
+ * from index 0 (see callFuncStrided).
+ *
+ * Must be sorted (used with bsearch).
+ */
+static const char *absoluteIndexFuncName[] =
+{
+   "MAXINDEX", "MININDEX", "MINMAXINDEX", "TRIX"
+};
+
+/* Functions where the output at a given index depends solely on the
+ * 'lookback' previous input values, which allows TA_CallFuncParallel
+ * to split the range in independent chunks. Functions with a MA type
+ * parameter are bounded only for some MA types (see isBoundedFunction).
+ *
+ * Must be sorted (used with bsearch).
+ */
+static const char *boundedFuncName[] =
+{
+   "ACCBANDS", "ACOS", "ADD", "APO", "AROON", "AROONOSC", "ASIN", "ATAN",
+   "AVGDEV", "AVGPRICE", "BBANDS", "BETA", "BOP", "CCI", "CEIL", "CORREL",
+   "COS", "COSH", "DIV", "EXP", "FLOOR", "LINEARREG", "LINEARREG_ANGLE",
+   "LINEARREG_INTERCEPT", "LINEARREG_SLOPE", "LN", "LOG10", "MA",
+   "MACDEXT", "MAVP", "MAX", "MAXINDEX", "MEDPRICE", "MIDPOINT",
+   "MIDPRICE", "MIN", "MININDEX", "MINMAX", "MINMAXINDEX", "MOM", "MULT",
+   "PPO", "ROC", "ROCP", "ROCR", "ROCR100", "SIN", "SINH", "SMA", "SQRT",
+   "STDDEV", "STOCH", "STOCHF", "SUB", "SUM", "TAN", "TANH", "TRANGE",
+   "TRIMA", "TSF", "TYPPRICE", "ULTOSC", "VAR", "WCLPRICE", "WILLR",
+   "WMA"
+};
+
 /**** Global functions definitions.   ****/
 TA_RetCode TA_GroupTableAlloc( TA_StringTable **table )
 {
@@ -260,6 +428,18 @@ TA_RetCode TA_ForEachFunc( TA_CallForEachFunc functionToCall, void *opaqueData )
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_GroupTableGet( const TA_StringTable **table )
+{
+   if( table == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *table = &groupTable;
+
+   return TA_SUCCESS;
+}
+
 TA_RetCode TA_FuncTableAlloc( const char *group, TA_StringTable **table )
 {
    TA_RetCode retCode;
@@ -369,8 +549,65 @@ TA_RetCode TA_FuncTableFree( TA_StringTable *table )
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_FuncTableGet( const char *group, const TA_StringTable **table )
+{
+   TA_RetCode retCode;
+   unsigned int groupId; /* TA_GroupId */
+
+   if( (group == NULL) || (table == NULL ) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *table = NULL;
+
+   retCode = getGroupId( group, &groupId );
+   if( retCode != TA_SUCCESS )
+   {
+      return retCode;
+   }
+
+   #ifdef TA_GEN_CODE
+      /* The per-group tables are generated by gen_code itself. */
+      return TA_NOT_SUPPORTED;
+   #else
+      *table = &TA_PerGroupFuncTable[groupId];
+      return TA_SUCCESS;
+   #endif
+}
+
 TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
 {
+#ifndef TA_GEN_CODE
+   const TA_FuncDef **found;
+
+   /* A TA_FuncHandle is internally a TA_FuncDef. Binary search
+    * the table generated by gen_code (sorted case-insensitive).
+    */
+   if( (name == NULL) || (handle == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *handle = NULL;
+
+   if( name[0] == '\0' )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   found = (const TA_FuncDef **)bsearch( name, TA_SortedFuncDef,
+                                         TA_TotalNbFunction,
+                                         sizeof(const TA_FuncDef *),
+                                         compareFuncDefNoCase );
+   if( !found )
+   {
+      return TA_FUNC_NOT_FOUND;
+   }
+
+   *handle = (const TA_FuncHandle *)*found;
+   return TA_SUCCESS;
+#else
    char firstChar, tmp;
    const TA_FuncDef **funcDefTable;
    const TA_FuncDef *funcDef;
@@ -378,7 +615,8 @@ TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
    unsigned int i, funcDefTableSize;
 
    /* A TA_FuncHandle is internally a TA_FuncDef. Let's find it
-    * by using the alphabetical tables.
+    * by using the alphabetical tables (TA_SortedFuncDef is
+    * generated by gen_code itself and does not exist here).
     */
    if( (name == NULL) || (handle == NULL) )
    {
@@ -431,6 +669,7 @@ TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
    }
 
    return TA_FUNC_NOT_FOUND;
+#endif
 }
 
 TA_RetCode TA_GetFuncInfo(  const TA_FuncHandle *handle,
@@ -600,20 +839,9 @@ TA_RetCode TA_GetOutputParameterInfo( const TA_FuncHandle *handle,
 TA_RetCode TA_ParamHolderAlloc( const TA_FuncHandle *handle,
                                 TA_ParamHolder **allocatedParams )
 {
-
-   TA_FuncDef *funcDef;
-   unsigned int allocSize, i;
-   TA_ParamHolderInput    *input;
-   TA_ParamHolderOptInput *optInput;
-   TA_ParamHolderOutput   *output;
-
-   const TA_FuncInfo *funcInfo;
-   TA_ParamHolder *newParams;
-   TA_ParamHolderPriv *newParamsPriv;
-
-   const TA_InputParameterInfo    **inputInfo;
-   const TA_OptInputParameterInfo **optInputInfo;
-   const TA_OutputParameterInfo   **outputInfo;
+   const TA_FuncDef *funcDef;
+   TA_ParamHolderLayout layout;
+   void *block;
 
    /* Validate the parameters. */
    if( !handle || !allocatedParams)
@@ -621,120 +849,152 @@ TA_RetCode TA_ParamHolderAlloc( const TA_FuncHandle *handle,
       return TA_BAD_PARAM;
    }
 
+   *allocatedParams = NULL;
+
    /* Validate that this is a valid funcHandle. */
-   funcDef = (TA_FuncDef *)handle;
-   if( funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB )
+   funcDef = (const TA_FuncDef *)handle;
+   if( (funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB) || !funcDef->funcInfo )
    {
-      *allocatedParams = NULL;
       return TA_INVALID_HANDLE;
    }
 
-   /* Get the TA_FuncInfo. */
-   funcInfo = funcDef->funcInfo;
-   if( !funcInfo ) return TA_INVALID_HANDLE;
-
-   /* Allocate the TA_ParamHolder. */
-   newParams = (TA_ParamHolder *)TA_Malloc( sizeof(TA_ParamHolder) + sizeof(TA_ParamHolderPriv));
-   if( !newParams )
+   /* The TA_ParamHolder and all its parameters are in one block. */
+   getParamHolderLayout( funcDef->funcInfo, &layout );
+   block = TA_Malloc( layout.size );
+   if( !block )
    {
-      *allocatedParams = NULL;
       return TA_ALLOC_ERR;
    }
 
-   memset( newParams, 0, sizeof(TA_ParamHolder) + sizeof(TA_ParamHolderPriv) );
-   newParamsPriv = (TA_ParamHolderPriv *)(((char *)newParams)+sizeof(TA_ParamHolder));
-   newParamsPriv->magicNumber = TA_PARAM_HOLDER_PRIV_MAGIC_NB;
-   newParams->hiddenData = newParamsPriv;
+   *allocatedParams = initParamHolder( funcDef, block, &layout, 0 );
+
+   return TA_SUCCESS;
+}
 
-   /* From this point, TA_ParamHolderFree can be safely called. */
+TA_RetCode TA_ParamHolderSize( const TA_FuncHandle *handle, size_t *size )
+{
+   const TA_FuncDef *funcDef;
+   TA_ParamHolderLayout layout;
 
-   /* Allocate the array of structure holding the info
-    * for each parameter.
-    */
-   if( funcInfo->nbInput == 0 ) return TA_INTERNAL_ERROR(2);
+   if( !handle || !size )
+   {
+      return TA_BAD_PARAM;
+   }
 
-   allocSize = (funcInfo->nbInput) * sizeof(TA_ParamHolderInput);
-   input = (TA_ParamHolderInput *)TA_Malloc( allocSize );
+   *size = 0;
 
-   if( !input )
+   funcDef = (const TA_FuncDef *)handle;
+   if( (funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB) || !funcDef->funcInfo )
    {
-      TA_ParamHolderFree( newParams );
-      *allocatedParams = NULL;
-      return TA_ALLOC_ERR;
+      return TA_INVALID_HANDLE;
    }
-   memset( input, 0, allocSize );
-   newParamsPriv->in = input;
 
-   if( funcInfo->nbOptInput == 0 )
-      optInput = NULL;
-   else
+   /* Extra space allows to align a buffer provided by the caller. */
+   getParamHolderLayout( funcDef->funcInfo, &layout );
+   *size = layout.size + TA_PARAM_HOLDER_ALIGN - 1;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ParamHolderInit( const TA_FuncHandle *handle,
+                               void *buffer, size_t bufferSize,
+                               TA_ParamHolder **params )
+{
+   const TA_FuncDef *funcDef;
+   TA_ParamHolderLayout layout;
+   char *block;
+
+   if( !handle || !buffer || !params )
    {
-      allocSize = (funcInfo->nbOptInput) * sizeof(TA_ParamHolderOptInput);
-      optInput = (TA_ParamHolderOptInput *)TA_Malloc( allocSize );
+      return TA_BAD_PARAM;
+   }
 
-      if( !optInput )
-      {
-         TA_ParamHolderFree( newParams );
-         *allocatedParams = NULL;
-         return TA_ALLOC_ERR;
-      }
-      memset( optInput, 0, allocSize );
+   *params = NULL;
+
+   funcDef = (const TA_FuncDef *)handle;
+   if( (funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB) || !funcDef->funcInfo )
+   {
+      return TA_INVALID_HANDLE;
    }
-   newParamsPriv->optIn = optInput;
 
-   allocSize = (funcInfo->nbOutput) * sizeof(TA_ParamHolderOutput);
-   output = (TA_ParamHolderOutput *)TA_Malloc( allocSize );
-   if( !output )
+   getParamHolderLayout( funcDef->funcInfo, &layout );
+   block = alignParamHolder( buffer );
+   if( (size_t)(block - (char *)buffer) + layout.size > bufferSize )
    {
-      TA_ParamHolderFree( newParams );
-      *allocatedParams = NULL;
-      return TA_ALLOC_ERR;
+      return TA_BAD_PARAM;
    }
-   memset( output, 0, allocSize );
-   newParamsPriv->out = output;
 
-   newParamsPriv->funcInfo = funcInfo;
+   *params = initParamHolder( funcDef, block, &layout, 1 );
 
-   inputInfo    = (const TA_InputParameterInfo **)funcDef->input;
-   optInputInfo = (const TA_OptInputParameterInfo **)funcDef->optInput;
-   outputInfo   = (const TA_OutputParameterInfo   **)funcDef->output;
+   return TA_SUCCESS;
+}
 
-   for( i=0; i < funcInfo->nbInput; i++ )
+TA_RetCode TA_ParamHolderClone( const TA_ParamHolder *params,
+                                void *buffer, size_t bufferSize,
+                                TA_ParamHolder **clone )
+{
+   const TA_ParamHolderPriv *paramPriv;
+   TA_ParamHolderPriv *clonePriv;
+   TA_ParamHolderLayout layout;
+   char *block;
+
+   if( !params || !clone )
    {
-      input[i].inputInfo = inputInfo[i];
-      newParamsPriv->inBitmap <<= 1;
-      newParamsPriv->inBitmap |= 1;
+      return TA_BAD_PARAM;
    }
 
-   for( i=0; i < funcInfo->nbOptInput; i++ )
+   *clone = NULL;
+
+   paramPriv = (const TA_ParamHolderPriv *)params->hiddenData;
+   if( !paramPriv || (paramPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB) )
    {
-      optInput[i].optInputInfo = optInputInfo[i];
-      if( optInput[i].optInputInfo->type == TA_OptInput_RealRange )
-         optInput[i].data.optInReal = optInputInfo[i]->defaultValue;
-      else
-         optInput[i].data.optInInteger = (TA_Integer)optInputInfo[i]->defaultValue;
+      return TA_INVALID_PARAM_HOLDER;
    }
 
-   for( i=0; i < funcInfo->nbOutput; i++ )
+   getParamHolderLayout( paramPriv->funcInfo, &layout );
+
+   if( buffer )
    {
-      output[i].outputInfo = outputInfo[i];
-      newParamsPriv->outBitmap <<= 1;
-      newParamsPriv->outBitmap |= 1;
+      block = alignParamHolder( buffer );
+      if( (size_t)(block - (char *)buffer) + layout.size > bufferSize )
+      {
+         return TA_BAD_PARAM;
+      }
    }
+   else
+   {
+      block = (char *)TA_Malloc( layout.size );
+      if( !block )
+      {
+         return TA_ALLOC_ERR;
+      }
+   }
+
+   /* The whole holder is one block, only the internal
+    * pointers needs to be relocated.
+    */
+   memcpy( block, params, layout.size );
+   clonePriv = (TA_ParamHolderPriv *)(block + layout.privOffset);
+   ((TA_ParamHolder *)block)->hiddenData = clonePriv;
+   clonePriv->in = (TA_ParamHolderInput *)(block + layout.inOffset);
+   if( clonePriv->optIn )
+      clonePriv->optIn = (TA_ParamHolderOptInput *)(block + layout.optInOffset);
+   clonePriv->out = (TA_ParamHolderOutput *)(block + layout.outOffset);
+   clonePriv->isPlaced = buffer? 1 : 0;
+
+   /* The clone uses the same outputs, but only the
+    * original holder owns them.
+    */
+   clonePriv->outBuffer = NULL;
 
-   /* Succcess, return the result to the caller. */
-   *allocatedParams = newParams;
+   *clone = (TA_ParamHolder *)block;
 
    return TA_SUCCESS;
 }
 
 TA_RetCode TA_ParamHolderFree( TA_ParamHolder *paramsToFree )
 {
-   TA_ParamHolderPriv     *paramPriv;
-
-   TA_ParamHolderInput    *input;
-   TA_ParamHolderOptInput *optInput;
-   TA_ParamHolderOutput   *output;
+   TA_ParamHolderPriv *paramPriv;
 
    if( !paramsToFree )
    {
@@ -753,24 +1013,23 @@ TA_RetCode TA_ParamHolderFree( TA_ParamHolder *paramsToFree )
       return TA_INVALID_PARAM_HOLDER;
    }
 
-   optInput = paramPriv->optIn;
-   if( optInput )
-      TA_Free( optInput );
-
-   input = paramPriv->in;
-   if( input )
-      TA_Free( input );
-
-   output = paramPriv->out;
-   if( output )
-      TA_Free( output );
+   if( paramPriv->outBuffer )
+   {
+      TA_Free( paramPriv->outBuffer );
+      paramPriv->outBuffer = NULL;
+   }
 
-   TA_Free( paramsToFree );
+   if( paramPriv->isPlaced )
+   {
+      /* Memory belongs to the caller, just invalidate the holder. */
+      paramPriv->magicNumber = 0;
+   }
+   else
+      TA_Free( paramsToFree );
 
    return TA_SUCCESS;
 }
 
-
 TA_RetCode TA_SetInputParamIntegerPtr( TA_ParamHolder *param,
                                        unsigned int paramIndex,
                                        const TA_Integer *value )
@@ -810,6 +1069,7 @@ TA_RetCode TA_SetInputParamIntegerPtr( TA_ParamHolder *param,
 
    /* keep a copy of the provided parameter. */
    paramHolderPriv->in[paramIndex].data.inInteger = value;
+   paramHolderPriv->in[paramIndex].stride = 0;
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
@@ -855,6 +1115,7 @@ TA_RetCode TA_SetInputParamRealPtr( TA_ParamHolder *param,
 
    /* keep a copy of the provided parameter. */
    paramHolderPriv->in[paramIndex].data.inReal = value;
+   paramHolderPriv->in[paramIndex].stride = 0;
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
@@ -925,12 +1186,58 @@ TA_RetCode TA_SetInputParamPricePtr( TA_ParamHolder     *param,
 
    #undef SET_PARAM_INFO
 
+   paramHolderPriv->in[paramIndex].stride = 0;
+
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
 
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_SetInputParamRealStride( TA_ParamHolder *param,
+                                       unsigned int paramIndex,
+                                       const TA_Real *value,
+                                       size_t stride )
+{
+   TA_RetCode retCode;
+
+   if( !isValidStride( stride ) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   retCode = TA_SetInputParamRealPtr( param, paramIndex, value );
+   if( retCode == TA_SUCCESS )
+      setInputStride( param, paramIndex, stride );
+
+   return retCode;
+}
+
+TA_RetCode TA_SetInputParamPriceStride( TA_ParamHolder     *param,
+                                        unsigned int        paramIndex,
+                                        const TA_Real      *open,
+                                        const TA_Real      *high,
+                                        const TA_Real      *low,
+                                        const TA_Real      *close,
+                                        const TA_Real      *volume,
+                                        const TA_Real      *openInterest,
+                                        size_t              stride )
+{
+   TA_RetCode retCode;
+
+   if( !isValidStride( stride ) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   retCode = TA_SetInputParamPricePtr( param, paramIndex, open, high, low,
+                                       close, volume, openInterest );
+   if( retCode == TA_SUCCESS )
+      setInputStride( param, paramIndex, stride );
+
+   return retCode;
+}
+
 TA_RetCode TA_SetOptInputParamInteger( TA_ParamHolder *param,
                                        unsigned int paramIndex,
                                        TA_Integer value )
@@ -1109,6 +1416,32 @@ TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *param,
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_SetParamHolderContext( TA_ParamHolder   *param,
+                                     const TA_Context *context )
+{
+   TA_ParamHolderPriv *paramHolderPriv;
+
+   if( param == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   if( context && (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+   {
+      return TA_BAD_OBJECT;
+   }
+
+   paramHolderPriv->context = context;
+
+   return TA_SUCCESS;
+}
+
 TA_RetCode TA_GetLookback( const TA_ParamHolder *param, TA_Integer *lookback )
 {
    const TA_ParamHolderPriv *paramHolderPriv;
@@ -1116,6 +1449,7 @@ TA_RetCode TA_GetLookback( const TA_ParamHolder *param, TA_Integer *lookback )
    const TA_FuncDef *funcDef;
    const TA_FuncInfo *funcInfo;
    TA_FrameLookback lookbackFunction;
+   const TA_Context *savedContext;
 
    if( (param == NULL) || (lookback == NULL))
    {
@@ -1138,45 +1472,255 @@ TA_RetCode TA_GetLookback( const TA_ParamHolder *param, TA_Integer *lookback )
    if( !lookbackFunction ) return TA_INTERNAL_ERROR(2);
 
    /* Perform the function call. */
+   savedContext = bindContext( paramHolderPriv );
    *lookback = (*lookbackFunction)( paramHolderPriv );
+   TA_ThreadContext = savedContext;
 
    return TA_SUCCESS;
 }
 
-/* Finally, call a TA function with the parameters. */
-TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
-                        TA_Integer            startIdx,
-                        TA_Integer            endIdx,
-                        TA_Integer           *outBegIdx,
-                        TA_Integer           *outNbElement )
+TA_RetCode TA_GetOutputSize( const TA_ParamHolder *param,
+                             TA_Integer            startIdx,
+                             TA_Integer            endIdx,
+                             TA_Integer           *outputSize )
 {
    TA_RetCode retCode;
-   const TA_ParamHolderPriv *paramHolderPriv;
-
-   const TA_FuncDef *funcDef;
-   const TA_FuncInfo *funcInfo;
-   TA_FrameFunction function;
+   TA_Integer lookback;
 
-   if( (param == NULL) ||
-       (outBegIdx == NULL) ||
-       (outNbElement == NULL) )
+   if( outputSize == NULL )
    {
       return TA_BAD_PARAM;
    }
 
-   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
-   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   *outputSize = 0;
+
+   if( startIdx < 0 )
    {
-      return TA_INVALID_PARAM_HOLDER;
+      return TA_OUT_OF_RANGE_START_INDEX;
    }
 
-   /* Check that all parameters are initialize (except the optInput). */
-   if( paramHolderPriv->inBitmap != 0 )
+   if( (endIdx < 0) || (endIdx < startIdx) )
    {
-      return TA_INPUT_NOT_ALL_INITIALIZE;
+      return TA_OUT_OF_RANGE_END_INDEX;
    }
 
-   if( paramHolderPriv->outBitmap != 0 )
+   retCode = TA_GetLookback( param, &lookback );
+   if( retCode != TA_SUCCESS )
+   {
+      return retCode;
+   }
+
+   /* Same adjustment of startIdx as done by all the TA functions. */
+   if( startIdx < lookback )
+   {
+      startIdx = lookback;
+   }
+
+   if( startIdx <= endIdx )
+   {
+      *outputSize = endIdx-startIdx+1;
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_AllocOutputParam( TA_ParamHolder *param,
+                                TA_Integer      startIdx,
+                                TA_Integer      endIdx )
+{
+   TA_RetCode retCode;
+   TA_ParamHolderPriv *paramHolderPriv;
+   const TA_FuncInfo *funcInfo;
+   TA_Integer outputSize;
+   size_t elementSize, outputBytes, totalBytes;
+   unsigned int i;
+   char *buffer, *ptr;
+
+   retCode = TA_GetOutputSize( param, startIdx, endIdx, &outputSize );
+   if( retCode != TA_SUCCESS )
+   {
+      return retCode;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   funcInfo = paramHolderPriv->funcInfo;
+
+   /* Keep at least one element, the TA functions
+    * do not accept NULL outputs.
+    */
+   if( outputSize < 1 )
+   {
+      outputSize = 1;
+   }
+
+   /* One block for all the outputs, each one starting
+    * on a TA_OUTPUT_ALIGN boundary.
+    */
+   outputBytes = 0;
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      if( paramHolderPriv->out[i].outputInfo->type == TA_Output_Real )
+         elementSize = sizeof(TA_Real);
+      else
+         elementSize = sizeof(TA_Integer);
+
+      if( (size_t)outputSize > (SIZE_MAX-TA_OUTPUT_ALIGN)/elementSize/funcInfo->nbOutput )
+      {
+         return TA_ALLOC_ERR;
+      }
+
+      outputBytes += ((size_t)outputSize*elementSize+TA_OUTPUT_ALIGN-1) & ~(size_t)(TA_OUTPUT_ALIGN-1);
+   }
+   totalBytes = outputBytes + TA_OUTPUT_ALIGN-1;
+
+   buffer = (char *)TA_Malloc( totalBytes );
+   if( !buffer )
+   {
+      return TA_ALLOC_ERR;
+   }
+
+   if( paramHolderPriv->outBuffer )
+   {
+      TA_Free( paramHolderPriv->outBuffer );
+   }
+   paramHolderPriv->outBuffer = buffer;
+
+   ptr = (char *)(((uintptr_t)buffer+TA_OUTPUT_ALIGN-1) & ~(uintptr_t)(TA_OUTPUT_ALIGN-1));
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      if( paramHolderPriv->out[i].outputInfo->type == TA_Output_Real )
+      {
+         paramHolderPriv->out[i].data.outReal = (TA_Real *)ptr;
+         elementSize = sizeof(TA_Real);
+      }
+      else
+      {
+         paramHolderPriv->out[i].data.outInteger = (TA_Integer *)ptr;
+         elementSize = sizeof(TA_Integer);
+      }
+      ptr += ((size_t)outputSize*elementSize+TA_OUTPUT_ALIGN-1) & ~(size_t)(TA_OUTPUT_ALIGN-1);
+   }
+
+   paramHolderPriv->outBitmap = 0;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GetOutputParamRealPtr( const TA_ParamHolder *param,
+                                     unsigned int          paramIndex,
+                                     TA_Real             **out )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+
+   if( (param == NULL) || (out == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *out = NULL;
+
+   paramHolderPriv = (const TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   if( !paramHolderPriv->funcInfo ) return TA_INVALID_HANDLE;
+   if( paramIndex >= paramHolderPriv->funcInfo->nbOutput )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   if( paramHolderPriv->out[paramIndex].outputInfo->type != TA_Output_Real )
+   {
+      return TA_INVALID_PARAM_HOLDER_TYPE;
+   }
+
+   if( paramHolderPriv->outBitmap & (1<<paramIndex) )
+   {
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+   }
+
+   *out = paramHolderPriv->out[paramIndex].data.outReal;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GetOutputParamIntegerPtr( const TA_ParamHolder *param,
+                                        unsigned int          paramIndex,
+                                        TA_Integer          **out )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+
+   if( (param == NULL) || (out == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *out = NULL;
+
+   paramHolderPriv = (const TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   if( !paramHolderPriv->funcInfo ) return TA_INVALID_HANDLE;
+   if( paramIndex >= paramHolderPriv->funcInfo->nbOutput )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   if( paramHolderPriv->out[paramIndex].outputInfo->type != TA_Output_Integer )
+   {
+      return TA_INVALID_PARAM_HOLDER_TYPE;
+   }
+
+   if( paramHolderPriv->outBitmap & (1<<paramIndex) )
+   {
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+   }
+
+   *out = paramHolderPriv->out[paramIndex].data.outInteger;
+
+   return TA_SUCCESS;
+}
+
+/* Finally, call a TA function with the parameters. */
+TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
+                        TA_Integer            startIdx,
+                        TA_Integer            endIdx,
+                        TA_Integer           *outBegIdx,
+                        TA_Integer           *outNbElement )
+{
+   TA_RetCode retCode;
+   const TA_ParamHolderPriv *paramHolderPriv;
+
+   const TA_FuncDef *funcDef;
+   const TA_FuncInfo *funcInfo;
+   TA_FrameFunction function;
+   const TA_Context *savedContext;
+
+   if( (param == NULL) ||
+       (outBegIdx == NULL) ||
+       (outNbElement == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Check that all parameters are initialize (except the optInput). */
+   if( paramHolderPriv->inBitmap != 0 )
+   {
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+   }
+
+   if( paramHolderPriv->outBitmap != 0 )
    {
       return TA_OUTPUT_NOT_ALL_INITIALIZE;
    }
@@ -1190,12 +1734,923 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
    if( !function ) return TA_INTERNAL_ERROR(2);
 
    /* Perform the function call. */
-   retCode = (*function)( paramHolderPriv, startIdx, endIdx,
-                          outBegIdx, outNbElement );
+   savedContext = bindContext( paramHolderPriv );
+   if( hasStridedInput( paramHolderPriv ) && (startIdx >= 0) && (endIdx >= startIdx) )
+      retCode = callFuncStrided( funcDef, paramHolderPriv, startIdx, endIdx,
+                                 outBegIdx, outNbElement );
+   else
+      retCode = (*function)( paramHolderPriv, startIdx, endIdx,
+                             outBegIdx, outNbElement );
+   TA_ThreadContext = savedContext;
+
+   return retCode;
+}
+
+TA_RetCode TA_GetScratchSize( const TA_ParamHolder *param,
+                              TA_Integer            startIdx,
+                              TA_Integer            endIdx,
+                              size_t               *scratchSize )
+{
+   TA_RetCode retCode;
+   const TA_ParamHolderPriv *paramHolderPriv;
+   const TA_Context *savedContext;
+   TA_Context measureContext;
+   TA_Integer outBegIdx, outNbElement;
+
+   if( (param == NULL) || (scratchSize == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *scratchSize = 0;
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Same settings as the real call, with an empty scratch buffer
+    * measuring the temporary buffers.
+    */
+   savedContext = bindContext( paramHolderPriv );
+   measureContext = *TA_CURRENT_CONTEXT;
+   memset( &measureContext.arena, 0, sizeof(TA_ScratchArena) );
+   measureContext.scratch = &measureContext.arena;
+   TA_ThreadContext = &measureContext;
+
+   retCode = TA_CallFunc( param, startIdx, endIdx, &outBegIdx, &outNbElement );
+
+   TA_ThreadContext = savedContext;
+
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   *scratchSize = measureContext.arena.peak;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_CallFuncParallel( const TA_ParamHolder *param,
+                                TA_Integer            startIdx,
+                                TA_Integer            endIdx,
+                                TA_Integer           *outBegIdx,
+                                TA_Integer           *outNbElement,
+                                int                   nbThread )
+{
+   TA_RetCode retCode;
+   const TA_ParamHolderPriv *paramHolderPriv;
+   const TA_Context *savedContext;
+
+   if( (param == NULL) ||
+       (outBegIdx == NULL) ||
+       (outNbElement == NULL) ||
+       (nbThread < 1) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+      return TA_INVALID_PARAM_HOLDER;
+
+   /* The context stays bound while the chunks are executed, which
+    * makes it visible to all of them (see TA_ExecuteTasks).
+    */
+   savedContext = bindContext( paramHolderPriv );
+   retCode = callFuncParallel( param, paramHolderPriv, startIdx, endIdx,
+                               outBegIdx, outNbElement, nbThread );
+   TA_ThreadContext = savedContext;
+
    return retCode;
 }
 
+TA_RetCode TA_CallFunc64( const TA_ParamHolder *param,
+                          TA_Integer64          startIdx,
+                          TA_Integer64          endIdx,
+                          TA_Integer64         *outBegIdx,
+                          TA_Integer64         *outNbElement )
+{
+   TA_RetCode retCode;
+   const TA_ParamHolderPriv *paramHolderPriv;
+   TA_Integer begIdx, nbElement, lookback;
+
+   if( (param == NULL) ||
+       (outBegIdx == NULL) ||
+       (outNbElement == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *outBegIdx    = 0;
+   *outNbElement = 0;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   /* Nothing special when all the indexes fit in a TA_Integer. */
+   if( endIdx <= TA_CALL64_MAX_INDEX )
+   {
+      retCode = TA_CallFunc( param, (TA_Integer)startIdx, (TA_Integer)endIdx,
+                             &begIdx, &nbElement );
+      if( retCode == TA_SUCCESS )
+      {
+         *outBegIdx    = begIdx;
+         *outNbElement = nbElement;
+      }
+      return retCode;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+      return TA_INVALID_PARAM_HOLDER;
+
+   if( paramHolderPriv->inBitmap != 0 )
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+
+   if( paramHolderPriv->outBitmap != 0 )
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+
+   if( !paramHolderPriv->funcInfo ) return TA_INVALID_HANDLE;
+
+   /* An index in the input can't be returned in a TA_Integer. */
+   if( bsearch( paramHolderPriv->funcInfo->name, absoluteIndexFuncName,
+                sizeof(absoluteIndexFuncName)/sizeof(absoluteIndexFuncName[0]),
+                sizeof(absoluteIndexFuncName[0]), compareFuncName ) )
+   {
+      return TA_OUT_OF_RANGE_END_INDEX;
+   }
+
+   retCode = TA_GetLookback( param, &lookback );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Invalid optional inputs are reported by the function. */
+   if( lookback < 0 )
+      lookback = 0;
+   if( lookback >= TA_CALL64_MAX_INDEX )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( startIdx < lookback )
+      startIdx = lookback;
+
+   /* Only some functions can be evaluated in many chunks. */
+   if( (endIdx-startIdx >= TA_CALL64_MAX_INDEX-lookback) &&
+       !(paramHolderPriv->funcInfo->flags & TA_FUNC_FLG_UNST_PER) &&
+       !isBoundedFunction( paramHolderPriv ) )
+   {
+      return TA_OUT_OF_RANGE_END_INDEX;
+   }
+
+   return callFunc64( paramHolderPriv, startIdx, endIdx, lookback,
+                      outBegIdx, outNbElement );
+}
+
 /**** Local functions definitions.     ****/
+static const TA_Context *bindContext( const TA_ParamHolderPriv *paramHolderPriv )
+{
+   const TA_Context *savedContext;
+
+   savedContext = TA_ThreadContext;
+   if( paramHolderPriv->context )
+      TA_ThreadContext = paramHolderPriv->context;
+
+   return savedContext;
+}
+
+static TA_RetCode callFuncParallel( const TA_ParamHolder     *param,
+                                    const TA_ParamHolderPriv *paramHolderPriv,
+                                    TA_Integer                startIdx,
+                                    TA_Integer                endIdx,
+                                    TA_Integer               *outBegIdx,
+                                    TA_Integer               *outNbElement,
+                                    int                       nbThread )
+{
+   TA_RetCode retCode;
+   const TA_FuncDef *funcDef;
+   TA_ParallelJob job;
+   TA_ParallelChunk *chunk;
+   TA_ParamHolderOutput *chunkOut;
+   TA_ThreadPool *pool;
+   TA_GatheredInput gathered;
+   TA_Integer lookback, nbOutElement, offset;
+   unsigned int nbOutput, j;
+   int i, nbChunk;
+
+   /* Any error or special case is handled by TA_CallFunc. */
+   if( (nbThread == 1) || (startIdx < 0) || (endIdx < startIdx) ||
+       (paramHolderPriv->inBitmap != 0) || (paramHolderPriv->outBitmap != 0) ||
+       !isBoundedFunction( paramHolderPriv ) )
+   {
+      return TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+   }
+
+   retCode = TA_GetLookback( param, &lookback );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( startIdx < lookback )
+      startIdx = lookback;
+
+   nbOutElement = endIdx-startIdx+1;
+   nbChunk = nbOutElement/TA_PARALLEL_MIN_CHUNK;
+   if( nbChunk > nbThread )
+      nbChunk = nbThread;
+
+   if( nbChunk <= 1 )
+      return TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+
+   funcDef = (const TA_FuncDef *)paramHolderPriv->funcInfo->handle;
+   job.function = funcDef->function;
+   if( !job.function ) return TA_INTERNAL_ERROR(2);
+
+   /* Strided inputs are made contiguous once, before the chunks are
+    * dispatched (no shift, the chunks keep their indexes).
+    */
+   gathered.buffer = NULL;
+   if( hasStridedInput( paramHolderPriv ) )
+   {
+      retCode = gatherInput( paramHolderPriv, 0, endIdx, &gathered );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+      paramHolderPriv = &gathered.params;
+   }
+   else if( isOutputOverlapInput( paramHolderPriv, endIdx, nbOutElement ) )
+      return TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+
+   /* Allocate all the chunks (and their output pointers) at once. */
+   nbOutput = paramHolderPriv->funcInfo->nbOutput;
+   job.chunk = (TA_ParallelChunk *)TA_EntryMalloc( funcDef,
+                                                   nbChunk*(sizeof(TA_ParallelChunk)+nbOutput*sizeof(TA_ParamHolderOutput)),
+                                                   &retCode );
+   if( !job.chunk )
+   {
+      TA_TempFree( gathered.buffer );
+      return retCode;
+   }
+   chunkOut = (TA_ParamHolderOutput *)&job.chunk[nbChunk];
+
+   for( i=0; i < nbChunk; i++ )
+   {
+      chunk = &job.chunk[i];
+      chunk->params   = *paramHolderPriv;
+      chunk->startIdx = startIdx + (TA_Integer)(((long long)nbOutElement*i)/nbChunk);
+      chunk->endIdx   = startIdx + (TA_Integer)(((long long)nbOutElement*(i+1))/nbChunk) - 1;
+      chunk->retCode  = TA_INTERNAL_ERROR(181);
+
+      /* Each chunk writes directly at its final position. */
+      offset = chunk->startIdx-startIdx;
+      for( j=0; j < nbOutput; j++ )
+      {
+         chunkOut[j] = paramHolderPriv->out[j];
+         if( chunkOut[j].outputInfo->type == TA_Output_Integer )
+            chunkOut[j].data.outInteger += offset;
+         else
+            chunkOut[j].data.outReal += offset;
+      }
+      chunk->params.out = chunkOut;
+      chunkOut += nbOutput;
+   }
+
+   if( TA_Globals->executor )
+      TA_RunTasks( nbChunk, parallelTask, &job );
+   else if( TA_ThreadPoolAlloc( nbChunk, 0, &pool ) == TA_SUCCESS )
+   {
+      TA_ExecuteTasks( TA_ThreadPoolExecutor, pool, nbChunk, parallelTask, &job );
+      TA_ThreadPoolFree( pool );
+   }
+   else
+      TA_ExecuteTasks( NULL, NULL, nbChunk, parallelTask, &job );
+
+   /* Verify that the chunks are contiguous. */
+   retCode = TA_SUCCESS;
+   for( i=0; (i < nbChunk) && (retCode == TA_SUCCESS); i++ )
+   {
+      chunk = &job.chunk[i];
+      if( chunk->retCode != TA_SUCCESS )
+         retCode = chunk->retCode;
+      else if( (chunk->outBegIdx != chunk->startIdx) ||
+               (chunk->outNbElement != chunk->endIdx-chunk->startIdx+1) )
+         retCode = TA_INTERNAL_ERROR(181);
+   }
+
+   TA_Free( job.chunk );
+   TA_TempFree( gathered.buffer );
+
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx    = 0;
+      *outNbElement = 0;
+      return retCode;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNbElement = nbOutElement;
+
+   return TA_SUCCESS;
+}
+
+/* Make a copy of the parameters where the inputs start at index
+ * 'inOffset' of the caller inputs (strided or not), and the outputs
+ * at index 'outOffset'. 'shifted' must already point to its own
+ * input and output arrays.
+ */
+static void shiftParams( const TA_ParamHolderPriv *paramHolderPriv,
+                         TA_Integer64              inOffset,
+                         TA_Integer64              outOffset,
+                         TA_ParamHolderPriv       *shifted )
+{
+   #define NB_PRICE_FIELD 6
+   const TA_ParamHolderInput *in;
+   TA_ParamHolderInput *shiftedIn;
+   TA_ParamHolderOutput *shiftedOut;
+   const TA_Real **field[NB_PRICE_FIELD];
+   unsigned int i, j, nbField;
+   TA_Integer64 step;
+
+   shiftedIn  = shifted->in;
+   shiftedOut = shifted->out;
+   *shifted = *paramHolderPriv;
+   shifted->in  = shiftedIn;
+   shifted->out = shiftedOut;
+
+   for( i=0; i < paramHolderPriv->funcInfo->nbInput; i++ )
+   {
+      in = &paramHolderPriv->in[i];
+      shiftedIn[i] = *in;
+      step = in->stride? (TA_Integer64)in->stride : (TA_Integer64)sizeof(TA_Real);
+
+      switch( in->inputInfo->type )
+      {
+      case TA_Input_Price:
+         field[0] = &shiftedIn[i].data.inPrice.open;
+         field[1] = &shiftedIn[i].data.inPrice.high;
+         field[2] = &shiftedIn[i].data.inPrice.low;
+         field[3] = &shiftedIn[i].data.inPrice.close;
+         field[4] = &shiftedIn[i].data.inPrice.volume;
+         field[5] = &shiftedIn[i].data.inPrice.openInterest;
+         nbField = NB_PRICE_FIELD;
+         break;
+      case TA_Input_Real:
+         field[0] = &shiftedIn[i].data.inReal;
+         nbField = 1;
+         break;
+      default:
+         /* Integer inputs are never strided. */
+         if( in->data.inInteger )
+            shiftedIn[i].data.inInteger += inOffset;
+         nbField = 0;
+         break;
+      }
+
+      for( j=0; j < nbField; j++ )
+      {
+         if( *field[j] )
+            *field[j] = (const TA_Real *)((const char *)*field[j] + inOffset*step);
+      }
+   }
+
+   for( i=0; i < paramHolderPriv->funcInfo->nbOutput; i++ )
+   {
+      shiftedOut[i] = paramHolderPriv->out[i];
+      if( shiftedOut[i].outputInfo->type == TA_Output_Integer )
+         shiftedOut[i].data.outInteger += outOffset;
+      else
+         shiftedOut[i].data.outReal += outOffset;
+   }
+   #undef NB_PRICE_FIELD
+}
+
+/* Evaluate [startIdx..endIdx] in consecutive chunks, each one called
+ * with indexes relative to its first index minus the lookback.
+ * startIdx must be at least 'lookback'.
+ */
+static TA_RetCode callFunc64( const TA_ParamHolderPriv *paramHolderPriv,
+                              TA_Integer64              startIdx,
+                              TA_Integer64              endIdx,
+                              TA_Integer                lookback,
+                              TA_Integer64             *outBegIdx,
+                              TA_Integer64             *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_ParamHolderPriv shifted;
+   TA_ParamHolder shiftedParam;
+   TA_Integer64 chunkStart, chunkEnd, base, outIdx;
+   TA_Integer begIdx, nbElement;
+   unsigned int nbInput, nbOutput;
+
+   nbInput  = paramHolderPriv->funcInfo->nbInput;
+   nbOutput = paramHolderPriv->funcInfo->nbOutput;
+   shifted.in = (TA_ParamHolderInput *)TA_EntryMalloc( paramHolderPriv->funcInfo->handle,
+                                                       nbInput*sizeof(TA_ParamHolderInput) +
+                                                       nbOutput*sizeof(TA_ParamHolderOutput),
+                                                       &retCode );
+   if( !shifted.in )
+      return retCode;
+   shifted.out = (TA_ParamHolderOutput *)&shifted.in[nbInput];
+   shiftedParam.hiddenData = &shifted;
+
+   retCode = TA_SUCCESS;
+   outIdx = 0;
+   for( chunkStart=startIdx; (chunkStart <= endIdx) && (retCode == TA_SUCCESS); chunkStart=chunkEnd+1 )
+   {
+      chunkEnd = endIdx;
+      if( chunkEnd-chunkStart > TA_CALL64_MAX_INDEX-lookback )
+         chunkEnd = chunkStart+(TA_CALL64_MAX_INDEX-lookback);
+
+      base = chunkStart-lookback;
+      shiftParams( paramHolderPriv, base, outIdx, &shifted );
+      retCode = TA_CallFunc( &shiftedParam,
+                             (TA_Integer)(chunkStart-base), (TA_Integer)(chunkEnd-base),
+                             &begIdx, &nbElement );
+      if( (retCode != TA_SUCCESS) || (nbElement == 0) )
+         continue;
+
+      /* The chunks must follow each other. */
+      if( outIdx == 0 )
+         *outBegIdx = begIdx+base;
+      else if( begIdx+base != *outBegIdx+outIdx )
+         retCode = TA_INTERNAL_ERROR(184);
+      outIdx += nbElement;
+   }
+
+   TA_Free( shifted.in );
+
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx = 0;
+      outIdx = 0;
+   }
+   *outNbElement = outIdx;
+
+   return retCode;
+}
+
+static int compareFuncName( const void *key, const void *elem )
+{
+   return strcmp( (const char *)key, *(const char * const *)elem );
+}
+
+#ifndef TA_GEN_CODE
+/* Must match the ordering used by gen_code for TA_SortedFuncDef. */
+static int compareFuncDefNoCase( const void *key, const void *elem )
+{
+   const char *s1 = (const char *)key;
+   const char *s2 = (*(const TA_FuncDef * const *)elem)->funcInfo->name;
+   int c1, c2;
+
+   do
+   {
+      c1 = toupper( (unsigned char)*s1++ );
+      c2 = toupper( (unsigned char)*s2++ );
+   } while( c1 && (c1 == c2) );
+
+   return c1 - c2;
+}
+#endif
+
+static void getParamHolderLayout( const TA_FuncInfo *funcInfo,
+                                  TA_ParamHolderLayout *layout )
+{
+   layout->privOffset  = TA_PARAM_HOLDER_ROUND( sizeof(TA_ParamHolder) );
+   layout->inOffset    = layout->privOffset +
+                         TA_PARAM_HOLDER_ROUND( sizeof(TA_ParamHolderPriv) );
+   layout->optInOffset = layout->inOffset +
+                         TA_PARAM_HOLDER_ROUND( funcInfo->nbInput*sizeof(TA_ParamHolderInput) );
+   layout->outOffset   = layout->optInOffset +
+                         TA_PARAM_HOLDER_ROUND( funcInfo->nbOptInput*sizeof(TA_ParamHolderOptInput) );
+   layout->size        = layout->outOffset +
+                         TA_PARAM_HOLDER_ROUND( funcInfo->nbOutput*sizeof(TA_ParamHolderOutput) );
+}
+
+static char *alignParamHolder( void *buffer )
+{
+   uintptr_t address = (uintptr_t)buffer;
+
+   address = (address + TA_PARAM_HOLDER_ALIGN - 1) & ~((uintptr_t)TA_PARAM_HOLDER_ALIGN - 1);
+   return (char *)buffer + (address - (uintptr_t)buffer);
+}
+
+static TA_ParamHolder *initParamHolder( const TA_FuncDef *funcDef,
+                                        void *block,
+                                        const TA_ParamHolderLayout *layout,
+                                        unsigned int isPlaced )
+{
+   unsigned int i;
+   TA_ParamHolderInput    *input;
+   TA_ParamHolderOptInput *optInput;
+   TA_ParamHolderOutput   *output;
+
+   const TA_FuncInfo *funcInfo;
+   TA_ParamHolder *newParams;
+   TA_ParamHolderPriv *newParamsPriv;
+
+   const TA_InputParameterInfo    **inputInfo;
+   const TA_OptInputParameterInfo **optInputInfo;
+   const TA_OutputParameterInfo   **outputInfo;
+
+   funcInfo = funcDef->funcInfo;
+
+   memset( block, 0, layout->size );
+   newParams     = (TA_ParamHolder *)block;
+   newParamsPriv = (TA_ParamHolderPriv *)((char *)block + layout->privOffset);
+   input         = (TA_ParamHolderInput *)((char *)block + layout->inOffset);
+   optInput      = (TA_ParamHolderOptInput *)((char *)block + layout->optInOffset);
+   output        = (TA_ParamHolderOutput *)((char *)block + layout->outOffset);
+
+   newParamsPriv->magicNumber = TA_PARAM_HOLDER_PRIV_MAGIC_NB;
+   newParamsPriv->isPlaced    = isPlaced;
+   newParamsPriv->funcInfo    = funcInfo;
+   newParamsPriv->in          = input;
+   newParamsPriv->optIn       = funcInfo->nbOptInput? optInput : NULL;
+   newParamsPriv->out         = output;
+   newParams->hiddenData      = newParamsPriv;
+
+   inputInfo    = (const TA_InputParameterInfo **)funcDef->input;
+   optInputInfo = (const TA_OptInputParameterInfo **)funcDef->optInput;
+   outputInfo   = (const TA_OutputParameterInfo   **)funcDef->output;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      input[i].inputInfo = inputInfo[i];
+      newParamsPriv->inBitmap <<= 1;
+      newParamsPriv->inBitmap |= 1;
+   }
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      optInput[i].optInputInfo = optInputInfo[i];
+      if( optInput[i].optInputInfo->type == TA_OptInput_RealRange )
+         optInput[i].data.optInReal = optInputInfo[i]->defaultValue;
+      else
+         optInput[i].data.optInInteger = (TA_Integer)optInputInfo[i]->defaultValue;
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      output[i].outputInfo = outputInfo[i];
+      newParamsPriv->outBitmap <<= 1;
+      newParamsPriv->outBitmap |= 1;
+   }
+
+   return newParams;
+}
+
+static int isValidStride( size_t stride )
+{
+   /* Each value must be aligned like a TA_Real. */
+   return (stride >= sizeof(TA_Real)) && ((stride % sizeof(TA_Real)) == 0);
+}
+
+static void setInputStride( TA_ParamHolder *param, unsigned int paramIndex, size_t stride )
+{
+   TA_ParamHolderPriv *paramHolderPriv;
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   paramHolderPriv->in[paramIndex].stride = (stride == sizeof(TA_Real))? 0 : stride;
+}
+
+static int hasStridedInput( const TA_ParamHolderPriv *paramHolderPriv )
+{
+   unsigned int i;
+
+   for( i=0; i < paramHolderPriv->funcInfo->nbInput; i++ )
+   {
+      if( paramHolderPriv->in[i].stride != 0 )
+         return 1;
+   }
+
+   return 0;
+}
+
+static void gatherReal( TA_Real *dest, const TA_Real *src,
+                        size_t stride, TA_Integer nbElement )
+{
+   TA_Integer i;
+   size_t step;
+
+   /* The usual bar records (6 or 8 fields of 8 bytes) have their
+    * own loop with a constant stride, which the compiler can unroll
+    * and vectorize.
+    */
+   switch( stride )
+   {
+   case 6*sizeof(TA_Real):
+      for( i=0; i < nbElement; i++ )
+         dest[i] = src[i*6];
+      break;
+   case 8*sizeof(TA_Real):
+      for( i=0; i < nbElement; i++ )
+         dest[i] = src[i*8];
+      break;
+   default:
+      step = stride/sizeof(TA_Real);
+      for( i=0; i < nbElement; i++ )
+         dest[i] = src[i*step];
+      break;
+   }
+}
+
+/* Make a copy of the parameters where all the inputs start at
+ * index 'firstIdx' of the caller inputs and are contiguous up to
+ * 'endIdx'. Only the strided inputs are copied, the others are
+ * simply offset. gathered->buffer must be freed with TA_TempFree.
+ */
+static TA_RetCode gatherInput( const TA_ParamHolderPriv *paramHolderPriv,
+                               TA_Integer                firstIdx,
+                               TA_Integer                endIdx,
+                               TA_GatheredInput         *gathered )
+{
+   #define NB_PRICE_FIELD 6
+   const TA_ParamHolderInput *in;
+   TA_ParamHolderInput *gatheredIn;
+   const TA_Real **field[NB_PRICE_FIELD];
+   TA_Real *dest;
+   TA_Integer nbElement;
+   unsigned int i, j, nbInput, nbField, nbArray;
+   size_t inSize;
+   TA_RetCode retCode;
+
+   nbInput   = paramHolderPriv->funcInfo->nbInput;
+   nbElement = endIdx-firstIdx+1;
+
+   /* One block for the TA_ParamHolderInput and all the arrays. */
+   nbArray = 0;
+   for( i=0; i < nbInput; i++ )
+   {
+      in = &paramHolderPriv->in[i];
+      if( in->stride == 0 )
+         continue;
+      if( in->inputInfo->type == TA_Input_Price )
+      {
+         for( j=0; j < NB_PRICE_FIELD; j++ )
+            if( in->inputInfo->flags & (TA_IN_PRICE_OPEN<<j) )
+               nbArray++;
+      }
+      else
+         nbArray++;
+   }
+
+   inSize = nbInput*sizeof(TA_ParamHolderInput);
+   inSize = (inSize+sizeof(TA_Real)-1) & ~(sizeof(TA_Real)-1);
+   gathered->buffer = TA_EntryTempMalloc( paramHolderPriv->funcInfo->handle,
+                                          inSize + nbArray*nbElement*sizeof(TA_Real),
+                                          &retCode );
+   if( !gathered->buffer )
+      return retCode;
+
+   gathered->params = *paramHolderPriv;
+   gatheredIn = (TA_ParamHolderInput *)gathered->buffer;
+   gathered->params.in = gatheredIn;
+   dest = (TA_Real *)((char *)gathered->buffer + inSize);
+
+   for( i=0; i < nbInput; i++ )
+   {
+      gatheredIn[i] = paramHolderPriv->in[i];
+      gatheredIn[i].stride = 0;
+
+      switch( gatheredIn[i].inputInfo->type )
+      {
+      case TA_Input_Price:
+         field[0] = &gatheredIn[i].data.inPrice.open;
+         field[1] = &gatheredIn[i].data.inPrice.high;
+         field[2] = &gatheredIn[i].data.inPrice.low;
+         field[3] = &gatheredIn[i].data.inPrice.close;
+         field[4] = &gatheredIn[i].data.inPrice.volume;
+         field[5] = &gatheredIn[i].data.inPrice.openInterest;
+         nbField = NB_PRICE_FIELD;
+         break;
+      case TA_Input_Real:
+         field[0] = &gatheredIn[i].data.inReal;
+         nbField = 1;
+         break;
+      default:
+         /* Integer inputs are never strided. */
+         gatheredIn[i].data.inInteger += firstIdx;
+         nbField = 0;
+         break;
+      }
+
+      for( j=0; j < nbField; j++ )
+      {
+         if( !*field[j] )
+            continue;
+
+         if( paramHolderPriv->in[i].stride == 0 )
+            *field[j] += firstIdx;
+         else
+         {
+            gatherReal( dest,
+                        (const TA_Real *)((const char *)*field[j] + firstIdx*paramHolderPriv->in[i].stride),
+                        paramHolderPriv->in[i].stride, nbElement );
+            *field[j] = dest;
+            dest += nbElement;
+         }
+      }
+   }
+
+   return TA_SUCCESS;
+   #undef NB_PRICE_FIELD
+}
+
+/* Call a function having strided inputs. Only the values needed
+ * for the requested range (from startIdx-lookback) are gathered, the
+ * call is then shifted to start at that index.
+ *
+ * For the functions in absoluteIndexFuncName, the integer outputs
+ * (an index in the input) are offset by the same amount after the
+ * call. Those without such output (TRIX) are gathered from index 0.
+ */
+static TA_RetCode callFuncStrided( const TA_FuncDef         *funcDef,
+                                   const TA_ParamHolderPriv *paramHolderPriv,
+                                   TA_Integer                startIdx,
+                                   TA_Integer                endIdx,
+                                   TA_Integer               *outBegIdx,
+                                   TA_Integer               *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_GatheredInput gathered;
+   TA_Integer lookback, firstIdx, i;
+   unsigned int j;
+   int isIndexOutput;
+   const TA_ParamHolderOutput *out;
+
+   lookback = (TA_Integer)(*funcDef->lookback)( paramHolderPriv );
+   firstIdx = startIdx-lookback;
+   if( (lookback < 0) || (firstIdx < 0) )
+      firstIdx = 0;
+
+   isIndexOutput = 0;
+   if( bsearch( paramHolderPriv->funcInfo->name, absoluteIndexFuncName,
+                sizeof(absoluteIndexFuncName)/sizeof(absoluteIndexFuncName[0]),
+                sizeof(absoluteIndexFuncName[0]), compareFuncName ) )
+   {
+      for( j=0; j < paramHolderPriv->funcInfo->nbOutput; j++ )
+      {
+         if( paramHolderPriv->out[j].outputInfo->type == TA_Output_Integer )
+            isIndexOutput = 1;
+      }
+      if( !isIndexOutput )
+         firstIdx = 0;
+   }
+
+   retCode = gatherInput( paramHolderPriv, firstIdx, endIdx, &gathered );
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx    = 0;
+      *outNbElement = 0;
+      return retCode;
+   }
+
+   retCode = (*funcDef->function)( &gathered.params,
+                                   startIdx-firstIdx, endIdx-firstIdx,
+                                   outBegIdx, outNbElement );
+   if( (retCode == TA_SUCCESS) && (*outNbElement != 0) )
+   {
+      *outBegIdx += firstIdx;
+      if( isIndexOutput && (firstIdx != 0) )
+      {
+         out = paramHolderPriv->out;
+         for( j=0; j < paramHolderPriv->funcInfo->nbOutput; j++ )
+         {
+            if( out[j].outputInfo->type != TA_Output_Integer )
+               continue;
+            for( i=0; i < *outNbElement; i++ )
+               out[j].data.outInteger[i] += firstIdx;
+         }
+      }
+   }
+
+   TA_TempFree( gathered.buffer );
+
+   return retCode;
+}
+
+static int isBoundedFunction( const TA_ParamHolderPriv *paramHolderPriv )
+{
+   const TA_FuncInfo *funcInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   TA_Integer maType;
+   unsigned int i;
+
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo || !funcInfo->name )
+      return 0;
+
+   if( funcInfo->flags & TA_FUNC_FLG_UNST_PER )
+      return 0;
+
+   if( !bsearch( funcInfo->name, boundedFuncName,
+                 sizeof(boundedFuncName)/sizeof(boundedFuncName[0]),
+                 sizeof(boundedFuncName[0]), compareFuncName ) )
+      return 0;
+
+   /* Only the moving averages of a fixed window are bounded. */
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      optInputInfo = paramHolderPriv->optIn[i].optInputInfo;
+      if( optInputInfo->dataSet == (const void *)&TA_MA_TypeList )
+      {
+         maType = paramHolderPriv->optIn[i].data.optInInteger;
+         if( (maType != TA_MAType_SMA) &&
+             (maType != TA_MAType_WMA) &&
+             (maType != TA_MAType_TRIMA) )
+            return 0;
+      }
+   }
+
+   return 1;
+}
+
+static int isBufferOverlap( const void *buffer1, size_t size1,
+                            const void *buffer2, size_t size2 )
+{
+   uintptr_t begin1, begin2;
+
+   if( !buffer1 || !buffer2 )
+      return 0;
+
+   begin1 = (uintptr_t)buffer1;
+   begin2 = (uintptr_t)buffer2;
+
+   return (begin1 < begin2+size2) && (begin2 < begin1+size1);
+}
+
+static int isOutputOverlapInput( const TA_ParamHolderPriv *paramHolderPriv,
+                                 TA_Integer endIdx,
+                                 TA_Integer nbOutElement )
+{
+   const TA_FuncInfo *funcInfo;
+   const TA_ParamHolderInput *in;
+   const void *outBuffer;
+   const TA_Real *price[6];
+   size_t outSize, inSize;
+   unsigned int i, j, k;
+
+   funcInfo = paramHolderPriv->funcInfo;
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      if( paramHolderPriv->out[i].outputInfo->type == TA_Output_Integer )
+      {
+         outBuffer = paramHolderPriv->out[i].data.outInteger;
+         outSize   = sizeof(TA_Integer)*nbOutElement;
+      }
+      else
+      {
+         outBuffer = paramHolderPriv->out[i].data.outReal;
+         outSize   = sizeof(TA_Real)*nbOutElement;
+      }
+
+      for( j=0; j < funcInfo->nbInput; j++ )
+      {
+         in = &paramHolderPriv->in[j];
+         switch( in->inputInfo->type )
+         {
+         case TA_Input_Price:
+            price[0] = in->data.inPrice.open;
+            price[1] = in->data.inPrice.high;
+            price[2] = in->data.inPrice.low;
+            price[3] = in->data.inPrice.close;
+            price[4] = in->data.inPrice.volume;
+            price[5] = in->data.inPrice.openInterest;
+            inSize = sizeof(TA_Real)*(endIdx+1);
+            for( k=0; k < 6; k++ )
+            {
+               if( isBufferOverlap( outBuffer, outSize, price[k], inSize ) )
+                  return 1;
+            }
+            break;
+         case TA_Input_Integer:
+            inSize = sizeof(TA_Integer)*(endIdx+1);
+            if( isBufferOverlap( outBuffer, outSize, in->data.inInteger, inSize ) )
+               return 1;
+            break;
+         default:
+            inSize = sizeof(TA_Real)*(endIdx+1);
+            if( isBufferOverlap( outBuffer, outSize, in->data.inReal, inSize ) )
+               return 1;
+            break;
+         }
+      }
+   }
+
+   return 0;
+}
+
+static void parallelTask( void *taskData, int taskIdx )
+{
+   TA_ParallelJob *job;
+   TA_ParallelChunk *chunk;
+
+   job = (TA_ParallelJob *)taskData;
+   chunk = &job->chunk[taskIdx];
+   chunk->retCode = (*job->function)( &chunk->params,
+                                      chunk->startIdx, chunk->endIdx,
+                                      &chunk->outBegIdx, &chunk->outNbElement );
+}
+
 static TA_RetCode getGroupId( const char *groupString, unsigned int *groupId )
 {
    unsigned int i;
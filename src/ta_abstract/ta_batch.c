@@ -0,0 +1,614 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *  101926 AG   Reject a holder without function even on the first call.
+ *  101926 AG   The temporary memory is subject to the strict allocation
+ *              mode (TA_EntryMalloc).
+ */
+
+/* Description:
+ *   Evaluate many TA_ParamHolder calls (see TA_CallFuncBatch).
+ *
+ *   The calls are validated, then the ones that can be done by a
+ *   sweep or a panel function are sorted to bring together the calls
+ *   sharing the same input (sweep) or the same period (panel). Each
+ *   group of at least two calls is done with a single call of the
+ *   sweep/panel function, and the other calls are done one by one.
+ *
+ *   The sweep and panel functions give the exact same values as the
+ *   single series functions, so only the order in which the outputs
+ *   are written differs. This is why everything is done in order when
+ *   an output overlaps an input or another output.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_global.h"
+#include "ta_abstract.h"
+#include "ta_panel.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_BATCH_KERNEL_NONE,
+   TA_BATCH_KERNEL_SMA,
+   TA_BATCH_KERNEL_EMA,
+   TA_BATCH_KERNEL_RSI
+} TA_BatchKernel;
+
+typedef struct
+{
+   const TA_ParamHolder     *params;
+   const TA_ParamHolderPriv *priv;
+   TA_BatchKernel kernel;
+   TA_Integer     startIdx;
+   TA_Integer     endIdx;
+   unsigned int   callIdx;
+   int            isDone;
+} TA_BatchCall;
+
+typedef struct
+{
+   const char *start;
+   const char *end;
+   int isOutput;
+} TA_BatchRegion;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode validateCall( const TA_ParamHolder *params,
+                                const TA_FuncInfo   **lastFuncInfo,
+                                TA_BatchKernel       *lastKernel,
+                                TA_BatchKernel       *kernel );
+static int isOverlapFree( const TA_BatchCall *call, unsigned int nbCall );
+static unsigned int addRegions( const TA_BatchCall *call, TA_BatchRegion *region );
+static int compareRegion( const void *elem1, const void *elem2 );
+static int compareSweep( const void *elem1, const void *elem2 );
+static int comparePanel( const void *elem1, const void *elem2 );
+static void runSweep( TA_BatchCall **group, unsigned int nbGroup,
+                      TA_CallResult results[] );
+static void runPanel( TA_BatchCall **group, unsigned int nbGroup,
+                      TA_CallResult results[] );
+static void runSingle( const TA_BatchCall *call, TA_CallResult *result );
+
+#define INPUT_PTR(call)  ((const char *)(call)->priv->in[0].data.inReal)
+#define OUTPUT_PTR(call) ((const char *)(call)->priv->out[0].data.outReal)
+#define PERIOD(call)     ((call)->priv->optIn[0].data.optInInteger)
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_CallFuncBatch( const TA_ParamHolder *const params[],
+                             unsigned int                nbCall,
+                             const TA_CallRange          ranges[],
+                             TA_CallResult               results[] )
+{
+   TA_BatchCall *call, **group;
+   const TA_FuncInfo *lastFuncInfo;
+   TA_BatchKernel lastKernel, kernel;
+   TA_RetCode retCode;
+   unsigned int i, j, nbValid, nbCandidate, nbGroup;
+   int isGrouping;
+
+   if( nbCall == 0 )
+      return TA_SUCCESS;
+
+   if( !params || !ranges || !results )
+      return TA_BAD_PARAM;
+
+   call  = (TA_BatchCall *)TA_EntryMalloc( NULL, nbCall*(sizeof(TA_BatchCall)+sizeof(TA_BatchCall *)), &retCode );
+   if( !call )
+      return retCode;
+   group = (TA_BatchCall **)&call[nbCall];
+
+   /* Validate all the holders. The function is identified only
+    * once for consecutive calls of the same function.
+    */
+   lastFuncInfo = NULL;
+   lastKernel   = TA_BATCH_KERNEL_NONE;
+   nbValid = 0;
+   nbCandidate = 0;
+   for( i=0; i < nbCall; i++ )
+   {
+      results[i].outBegIdx    = 0;
+      results[i].outNbElement = 0;
+
+      retCode = validateCall( params[i], &lastFuncInfo, &lastKernel, &kernel );
+      results[i].retCode = retCode;
+      if( retCode != TA_SUCCESS )
+         continue;
+
+      call[nbValid].params   = params[i];
+      call[nbValid].priv     = (const TA_ParamHolderPriv *)params[i]->hiddenData;
+      call[nbValid].startIdx = ranges[i].startIdx;
+      call[nbValid].endIdx   = ranges[i].endIdx;
+      call[nbValid].callIdx  = i;
+      call[nbValid].isDone   = 0;
+
+      /* Only the simple cases are handled by the sweep/panel. */
+      if( (kernel != TA_BATCH_KERNEL_NONE) &&
+          (call[nbValid].priv->in[0].stride == 0) &&
+          (ranges[i].startIdx >= 0) && (ranges[i].endIdx >= ranges[i].startIdx) &&
+          (PERIOD(&call[nbValid]) >= 2) && (PERIOD(&call[nbValid]) <= 100000) )
+      {
+         call[nbValid].kernel = kernel;
+         nbCandidate++;
+      }
+      else
+         call[nbValid].kernel = TA_BATCH_KERNEL_NONE;
+
+      nbValid++;
+   }
+
+   isGrouping = (nbCandidate > 1) && isOverlapFree( call, nbValid );
+
+   if( isGrouping )
+   {
+      /* Sweep: SMA calls on the same input and range. */
+      nbGroup = 0;
+      for( i=0; i < nbValid; i++ )
+      {
+         if( call[i].kernel == TA_BATCH_KERNEL_SMA )
+            group[nbGroup++] = &call[i];
+      }
+      qsort( group, nbGroup, sizeof(TA_BatchCall *), compareSweep );
+
+      for( i=0; i < nbGroup; i=j )
+      {
+         for( j=i+1; (j < nbGroup) && (compareSweep( &group[i], &group[j] ) == 0); j++ )
+         {
+            /* Group ends at the first call with a different key. */
+         }
+         if( j-i > 1 )
+            runSweep( &group[i], j-i, results );
+      }
+
+      /* Panel: calls of the same function and period, all starting
+       * at index zero.
+       */
+      nbGroup = 0;
+      for( i=0; i < nbValid; i++ )
+      {
+         if( (call[i].kernel != TA_BATCH_KERNEL_NONE) && !call[i].isDone &&
+             (call[i].startIdx == 0) )
+            group[nbGroup++] = &call[i];
+      }
+      qsort( group, nbGroup, sizeof(TA_BatchCall *), comparePanel );
+
+      for( i=0; i < nbGroup; i=j )
+      {
+         for( j=i+1; (j < nbGroup) && (comparePanel( &group[i], &group[j] ) == 0); j++ )
+         {
+            /* Group ends at the first call with a different key. */
+         }
+         if( j-i > 1 )
+            runPanel( &group[i], j-i, results );
+      }
+   }
+
+   /* Everything else, in order. */
+   for( i=0; i < nbValid; i++ )
+   {
+      if( !call[i].isDone )
+         runSingle( &call[i], &results[call[i].callIdx] );
+   }
+
+   TA_Free( call );
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode validateCall( const TA_ParamHolder *params,
+                                const TA_FuncInfo   **lastFuncInfo,
+                                TA_BatchKernel       *lastKernel,
+                                TA_BatchKernel       *kernel )
+{
+   const TA_ParamHolderPriv *priv;
+   const TA_FuncInfo *funcInfo;
+   const TA_FuncDef *funcDef;
+
+   if( !params )
+      return TA_BAD_PARAM;
+
+   priv = (const TA_ParamHolderPriv *)params->hiddenData;
+   if( priv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+      return TA_INVALID_PARAM_HOLDER;
+
+   if( priv->inBitmap != 0 )
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+
+   if( priv->outBitmap != 0 )
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+
+   /* Checked first, the cache starts at NULL. */
+   funcInfo = priv->funcInfo;
+   if( !funcInfo )
+      return TA_INVALID_HANDLE;
+
+   if( funcInfo != *lastFuncInfo )
+   {
+      funcDef = (const TA_FuncDef *)funcInfo->handle;
+      if( !funcDef || !funcDef->function )
+         return TA_INTERNAL_ERROR(2);
+
+      if( strcmp( funcInfo->name, "SMA" ) == 0 )
+         *lastKernel = TA_BATCH_KERNEL_SMA;
+      else if( strcmp( funcInfo->name, "EMA" ) == 0 )
+         *lastKernel = TA_BATCH_KERNEL_EMA;
+      else if( strcmp( funcInfo->name, "RSI" ) == 0 )
+         *lastKernel = TA_BATCH_KERNEL_RSI;
+      else
+         *lastKernel = TA_BATCH_KERNEL_NONE;
+
+      *lastFuncInfo = funcInfo;
+   }
+
+   *kernel = *lastKernel;
+
+   return TA_SUCCESS;
+}
+
+static int isOverlapFree( const TA_BatchCall *call, unsigned int nbCall )
+{
+   TA_BatchRegion *region;
+   const char *endAny, *endOutput;
+   unsigned int i, nbRegion;
+   int isFree;
+   TA_RetCode retCode;
+
+   /* Up to 6 buffers per input (price components). */
+   nbRegion = 0;
+   for( i=0; i < nbCall; i++ )
+      nbRegion += call[i].priv->funcInfo->nbInput*6 + call[i].priv->funcInfo->nbOutput;
+
+   region = (TA_BatchRegion *)TA_EntryMalloc( NULL, nbRegion*sizeof(TA_BatchRegion), &retCode );
+   if( !region )
+      return 0;
+
+   nbRegion = 0;
+   for( i=0; i < nbCall; i++ )
+      nbRegion += addRegions( &call[i], &region[nbRegion] );
+
+   /* Sorted by their start, a region overlaps a previous one only
+    * if it starts before the end of one of them. Inputs can overlap
+    * each other, outputs cannot overlap anything.
+    */
+   qsort( region, nbRegion, sizeof(TA_BatchRegion), compareRegion );
+
+   isFree    = 1;
+   endAny    = NULL;
+   endOutput = NULL;
+   for( i=0; (i < nbRegion) && isFree; i++ )
+   {
+      if( region[i].isOutput )
+      {
+         if( endAny && (region[i].start < endAny) )
+            isFree = 0;
+         if( !endOutput || (region[i].end > endOutput) )
+            endOutput = region[i].end;
+      }
+      else if( endOutput && (region[i].start < endOutput) )
+         isFree = 0;
+
+      if( !endAny || (region[i].end > endAny) )
+         endAny = region[i].end;
+   }
+
+   TA_Free( region );
+
+   return isFree;
+}
+
+static unsigned int addRegions( const TA_BatchCall *call, TA_BatchRegion *region )
+{
+   const TA_ParamHolderPriv *priv;
+   const TA_ParamHolderInput *input;
+   const TA_ParamHolderOutput *output;
+   const TA_Real *price[6];
+   const char *data;
+   unsigned int i, j, nbRegion;
+   size_t size, stride;
+
+   if( (call->startIdx < 0) || (call->endIdx < call->startIdx) )
+   {
+      /* The call will fail without touching any buffer. */
+      return 0;
+   }
+
+   priv = call->priv;
+   nbRegion = 0;
+   for( i=0; i < priv->funcInfo->nbInput; i++ )
+   {
+      input = &priv->in[i];
+      if( input->inputInfo->type == TA_Input_Price )
+      {
+         price[0] = input->data.inPrice.open;
+         price[1] = input->data.inPrice.high;
+         price[2] = input->data.inPrice.low;
+         price[3] = input->data.inPrice.close;
+         price[4] = input->data.inPrice.volume;
+         price[5] = input->data.inPrice.openInterest;
+         size = sizeof(TA_Real);
+      }
+      else
+      {
+         price[0] = input->data.inReal;
+         for( j=1; j < 6; j++ )
+            price[j] = NULL;
+         size = (input->inputInfo->type == TA_Input_Integer)? sizeof(TA_Integer) : sizeof(TA_Real);
+      }
+
+      stride = input->stride? input->stride : size;
+      for( j=0; j < 6; j++ )
+      {
+         if( price[j] )
+         {
+            data = (const char *)price[j];
+            region[nbRegion].start    = data;
+            region[nbRegion].end      = data + (size_t)call->endIdx*stride + size;
+            region[nbRegion].isOutput = 0;
+            nbRegion++;
+         }
+      }
+   }
+
+   for( i=0; i < priv->funcInfo->nbOutput; i++ )
+   {
+      output = &priv->out[i];
+      size = (output->outputInfo->type == TA_Output_Integer)? sizeof(TA_Integer) : sizeof(TA_Real);
+      data = (const char *)output->data.outReal;
+      region[nbRegion].start    = data;
+      region[nbRegion].end      = data + (size_t)(call->endIdx-call->startIdx+1)*size;
+      region[nbRegion].isOutput = 1;
+      nbRegion++;
+   }
+
+   return nbRegion;
+}
+
+static int compareRegion( const void *elem1, const void *elem2 )
+{
+   const TA_BatchRegion *region1 = (const TA_BatchRegion *)elem1;
+   const TA_BatchRegion *region2 = (const TA_BatchRegion *)elem2;
+
+   if( region1->start != region2->start )
+      return (region1->start < region2->start)? -1 : 1;
+
+   return 0;
+}
+
+/* Same context, input and range. The call index keeps the
+ * groups in a deterministic order.
+ */
+static int compareSweep( const void *elem1, const void *elem2 )
+{
+   const TA_BatchCall *call1 = *(const TA_BatchCall *const *)elem1;
+   const TA_BatchCall *call2 = *(const TA_BatchCall *const *)elem2;
+
+   if( call1->priv->context != call2->priv->context )
+      return (call1->priv->context < call2->priv->context)? -1 : 1;
+   if( INPUT_PTR(call1) != INPUT_PTR(call2) )
+      return (INPUT_PTR(call1) < INPUT_PTR(call2))? -1 : 1;
+   if( call1->startIdx != call2->startIdx )
+      return (call1->startIdx < call2->startIdx)? -1 : 1;
+   if( call1->endIdx != call2->endIdx )
+      return (call1->endIdx < call2->endIdx)? -1 : 1;
+
+   return 0;
+}
+
+/* Same function, context and period. */
+static int comparePanel( const void *elem1, const void *elem2 )
+{
+   const TA_BatchCall *call1 = *(const TA_BatchCall *const *)elem1;
+   const TA_BatchCall *call2 = *(const TA_BatchCall *const *)elem2;
+
+   if( call1->kernel != call2->kernel )
+      return (call1->kernel < call2->kernel)? -1 : 1;
+   if( call1->priv->context != call2->priv->context )
+      return (call1->priv->context < call2->priv->context)? -1 : 1;
+   if( PERIOD(call1) != PERIOD(call2) )
+      return (PERIOD(call1) < PERIOD(call2))? -1 : 1;
+
+   return 0;
+}
+
+static void runSweep( TA_BatchCall **group, unsigned int nbGroup,
+                      TA_CallResult results[] )
+{
+   const TA_Context *savedContext;
+   TA_RetCode retCode;
+   int *period, *outBegIdx, *outNBElement;
+   double **outReal;
+   unsigned int i;
+
+   period = (int *)TA_EntryMalloc( NULL, nbGroup*(3*sizeof(int)+sizeof(double *)), &retCode );
+   if( !period )
+      return; /* Done one by one. */
+   outReal      = (double **)&period[nbGroup];
+   outBegIdx    = (int *)&outReal[nbGroup];
+   outNBElement = &outBegIdx[nbGroup];
+
+   for( i=0; i < nbGroup; i++ )
+   {
+      period[i]  = PERIOD(group[i]);
+      outReal[i] = group[i]->priv->out[0].data.outReal;
+   }
+
+   savedContext = TA_ThreadContext;
+   if( group[0]->priv->context )
+      TA_ThreadContext = group[0]->priv->context;
+
+   retCode = TA_SMA_Sweep( group[0]->startIdx, group[0]->endIdx,
+                           group[0]->priv->in[0].data.inReal,
+                           (int)nbGroup, period, outBegIdx, outNBElement, outReal );
+
+   TA_ThreadContext = savedContext;
+
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < nbGroup; i++ )
+      {
+         results[group[i]->callIdx].outBegIdx    = outBegIdx[i];
+         results[group[i]->callIdx].outNbElement = outNBElement[i];
+         group[i]->isDone = 1;
+      }
+   }
+
+   TA_Free( period );
+}
+
+static void runPanel( TA_BatchCall **group, unsigned int nbGroup,
+                      TA_CallResult results[] )
+{
+   const TA_Context *savedContext;
+   TA_RetCode retCode;
+   int *inLength, *outBegIdx, *outNBElement;
+   const double **inReal;
+   double **outReal;
+   unsigned int i;
+
+   inLength = (int *)TA_EntryMalloc( NULL, nbGroup*(3*sizeof(int)+2*sizeof(double *)), &retCode );
+   if( !inLength )
+      return; /* Done one by one. */
+   inReal       = (const double **)&inLength[nbGroup];
+   outReal      = (double **)&inReal[nbGroup];
+   outBegIdx    = (int *)&outReal[nbGroup];
+   outNBElement = &outBegIdx[nbGroup];
+
+   for( i=0; i < nbGroup; i++ )
+   {
+      inLength[i] = group[i]->endIdx+1;
+      inReal[i]   = group[i]->priv->in[0].data.inReal;
+      outReal[i]  = group[i]->priv->out[0].data.outReal;
+   }
+
+   savedContext = TA_ThreadContext;
+   if( group[0]->priv->context )
+      TA_ThreadContext = group[0]->priv->context;
+
+   switch( group[0]->kernel )
+   {
+   case TA_BATCH_KERNEL_SMA:
+      retCode = TA_SMA_Panel( (int)nbGroup, inLength, inReal, PERIOD(group[0]),
+                              outBegIdx, outNBElement, outReal );
+      break;
+   case TA_BATCH_KERNEL_EMA:
+      retCode = TA_EMA_Panel( (int)nbGroup, inLength, inReal, PERIOD(group[0]),
+                              outBegIdx, outNBElement, outReal );
+      break;
+   case TA_BATCH_KERNEL_RSI:
+      retCode = TA_RSI_Panel( (int)nbGroup, inLength, inReal, PERIOD(group[0]),
+                              outBegIdx, outNBElement, outReal );
+      break;
+   default:
+      retCode = TA_INTERNAL_ERROR(183);
+      break;
+   }
+
+   TA_ThreadContext = savedContext;
+
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < nbGroup; i++ )
+      {
+         results[group[i]->callIdx].outBegIdx    = outBegIdx[i];
+         results[group[i]->callIdx].outNbElement = outNBElement[i];
+         group[i]->isDone = 1;
+      }
+   }
+
+   TA_Free( inLength );
+}
+
+static void runSingle( const TA_BatchCall *call, TA_CallResult *result )
+{
+   const TA_Context *savedContext;
+   TA_FrameFunction function;
+   unsigned int i;
+
+   /* The strided inputs are gathered by TA_CallFunc. */
+   for( i=0; i < call->priv->funcInfo->nbInput; i++ )
+   {
+      if( call->priv->in[i].stride != 0 )
+      {
+         result->retCode = TA_CallFunc( call->params, call->startIdx, call->endIdx,
+                                        &result->outBegIdx, &result->outNbElement );
+         return;
+      }
+   }
+
+   function = ((const TA_FuncDef *)call->priv->funcInfo->handle)->function;
+
+   savedContext = TA_ThreadContext;
+   if( call->priv->context )
+      TA_ThreadContext = call->priv->context;
+
+   result->retCode = (*function)( call->priv, call->startIdx, call->endIdx,
+                                  &result->outBegIdx, &result->outNbElement );
+
+   TA_ThreadContext = savedContext;
+}
+
+/***************/
+/* End of File */
+/***************/
@@ -72,6 +72,11 @@ typedef struct
 
    const TA_InputParameterInfo *inputInfo;
 
+   /* Bytes between two consecutive values, 0 when contiguous
+    * (see TA_SetInputParamRealStride).
+    */
+   size_t stride;
+
 } TA_ParamHolderInput;
 
 typedef struct
@@ -115,6 +120,21 @@ typedef struct
    unsigned int outBitmap;
 
    const TA_FuncInfo *funcInfo;
+
+   /* Memory provided by the caller (TA_ParamHolderInit or
+    * TA_ParamHolderClone), not freed by TA_ParamHolderFree.
+    */
+   unsigned int isPlaced;
+
+   /* Settings used for the call, NULL for the ones of the
+    * calling thread (see TA_SetParamHolderContext).
+    */
+   const TA_Context *context;
+
+   /* Outputs allocated by TA_AllocOutputParam, owned by the
+    * holder (NULL when the caller provides all the outputs).
+    */
+   void *outBuffer;
 } TA_ParamHolderPriv;
 
 typedef TA_RetCode (*TA_FrameFunction)( const TA_ParamHolderPriv *params,
@@ -0,0 +1,2595 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Note: This file is generated by gencode, do not
+ *       modify directly.
+ */
+
+/* The TA_XXX_64 functions (see "ta_func64.h") are all calling
+ * TA_CallFunc64 with the TA_ParamHolderPriv built on the stack.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#ifndef TA_FUNC64_H
+   #include "ta_func64.h"
+#endif
+
+#ifndef TA_ABSTRACT_H
+   #include "ta_abstract.h"
+#endif
+
+#ifndef TA_DEF_UI_H
+   #include "ta_def_ui.h"
+#endif
+
+#ifndef TA_FRAME_PRIV_H
+   #include "ta_frame_priv.h"
+#endif
+
+/* Complete the parameters of which only the data pointers were
+ * set by the caller, then call TA_CallFunc64.
+ */
+static TA_RetCode callFunc64( const TA_FuncDef       *funcDef,
+                              TA_ParamHolderInput    *in,
+                              TA_ParamHolderOptInput *optIn,
+                              TA_ParamHolderOutput   *out,
+                              TA_Integer64            startIdx,
+                              TA_Integer64            endIdx,
+                              TA_Integer64           *outBegIdx,
+                              TA_Integer64           *outNBElement )
+{
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo    **inputInfo;
+   const TA_OptInputParameterInfo **optInputInfo;
+   const TA_OutputParameterInfo   **outputInfo;
+   TA_ParamHolderPriv params;
+   TA_ParamHolder param;
+   unsigned int i;
+
+   funcInfo     = funcDef->funcInfo;
+   inputInfo    = (const TA_InputParameterInfo **)funcDef->input;
+   optInputInfo = (const TA_OptInputParameterInfo **)funcDef->optInput;
+   outputInfo   = (const TA_OutputParameterInfo   **)funcDef->output;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      in[i].inputInfo = inputInfo[i];
+      in[i].stride    = 0;
+   }
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+      optIn[i].optInputInfo = optInputInfo[i];
+
+   /* The outputs are offset when the range is split. */
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      out[i].outputInfo = outputInfo[i];
+      if( (outputInfo[i]->type == TA_Output_Integer)? !out[i].data.outInteger : !out[i].data.outReal )
+         return TA_BAD_PARAM;
+   }
+
+   memset( &params, 0, sizeof(params) );
+   params.magicNumber = TA_PARAM_HOLDER_PRIV_MAGIC_NB;
+   params.in          = in;
+   params.optIn       = optIn;
+   params.out         = out;
+   params.funcInfo    = funcInfo;
+   param.hiddenData   = &params;
+
+   return TA_CallFunc64( &param, startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+
+extern const TA_FuncDef TA_DEF_ACCBANDS;
+
+TA_RetCode TA_ACCBANDS_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           const double  inClose[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outRealUpperBand[],
+                           double        outRealMiddleBand[],
+                           double        outRealLowerBand[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[3];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outRealUpperBand;
+   out[1].data.outReal = outRealMiddleBand;
+   out[2].data.outReal = outRealLowerBand;
+
+   return callFunc64( &TA_DEF_ACCBANDS, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ACOS;
+
+TA_RetCode TA_ACOS_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ACOS, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_AD;
+
+TA_RetCode TA_AD_64( TA_Integer64  startIdx,
+                     TA_Integer64  endIdx,
+                     const double  inHigh[],
+                     const double  inLow[],
+                     const double  inClose[],
+                     const double  inVolume[],
+                     TA_Integer64 *outBegIdx,
+                     TA_Integer64 *outNBElement,
+                     double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = inVolume;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_AD, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ADD;
+
+TA_RetCode TA_ADD_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal0[],
+                      const double  inReal1[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal0;
+   in[1].data.inReal = inReal1;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ADD, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ADOSC;
+
+TA_RetCode TA_ADOSC_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inHigh[],
+                        const double  inLow[],
+                        const double  inClose[],
+                        const double  inVolume[],
+                        int           optInFastPeriod,
+                        int           optInSlowPeriod,
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = inVolume;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastPeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInSlowPeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ADOSC, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ADX;
+
+TA_RetCode TA_ADX_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inHigh[],
+                      const double  inLow[],
+                      const double  inClose[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ADX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ADXR;
+
+TA_RetCode TA_ADXR_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inHigh[],
+                       const double  inLow[],
+                       const double  inClose[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ADXR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_APO;
+
+TA_RetCode TA_APO_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInFastPeriod,
+                      int           optInSlowPeriod,
+                      TA_MAType     optInMAType,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastPeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInSlowPeriod;
+   optIn[2].data.optInInteger = (TA_Integer)optInMAType;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_APO, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_AROON;
+
+TA_RetCode TA_AROON_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inHigh[],
+                        const double  inLow[],
+                        int           optInTimePeriod,
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outAroonDown[],
+                        double        outAroonUp[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outAroonDown;
+   out[1].data.outReal = outAroonUp;
+
+   return callFunc64( &TA_DEF_AROON, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_AROONOSC;
+
+TA_RetCode TA_AROONOSC_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_AROONOSC, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ASIN;
+
+TA_RetCode TA_ASIN_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ASIN, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ATAN;
+
+TA_RetCode TA_ATAN_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ATAN, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ATR;
+
+TA_RetCode TA_ATR_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inHigh[],
+                      const double  inLow[],
+                      const double  inClose[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ATR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_AVGPRICE;
+
+TA_RetCode TA_AVGPRICE_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inOpen[],
+                           const double  inHigh[],
+                           const double  inLow[],
+                           const double  inClose[],
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = inOpen;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_AVGPRICE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_AVGDEV;
+
+TA_RetCode TA_AVGDEV_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inReal[],
+                         int           optInTimePeriod,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_AVGDEV, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_BBANDS;
+
+TA_RetCode TA_BBANDS_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inReal[],
+                         int           optInTimePeriod,
+                         double        optInNbDevUp,
+                         double        optInNbDevDn,
+                         TA_MAType     optInMAType,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outRealUpperBand[],
+                         double        outRealMiddleBand[],
+                         double        outRealLowerBand[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[4];
+   TA_ParamHolderOutput   out[3];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInReal = optInNbDevUp;
+   optIn[2].data.optInReal = optInNbDevDn;
+   optIn[3].data.optInInteger = (TA_Integer)optInMAType;
+   out[0].data.outReal = outRealUpperBand;
+   out[1].data.outReal = outRealMiddleBand;
+   out[2].data.outReal = outRealLowerBand;
+
+   return callFunc64( &TA_DEF_BBANDS, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_BETA;
+
+TA_RetCode TA_BETA_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal0[],
+                       const double  inReal1[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal0;
+   in[1].data.inReal = inReal1;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_BETA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_BOP;
+
+TA_RetCode TA_BOP_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inOpen[],
+                      const double  inHigh[],
+                      const double  inLow[],
+                      const double  inClose[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = inOpen;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_BOP, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_CCI;
+
+TA_RetCode TA_CCI_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inHigh[],
+                      const double  inLow[],
+                      const double  inClose[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_CCI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_CEIL;
+
+TA_RetCode TA_CEIL_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_CEIL, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_CMO;
+
+TA_RetCode TA_CMO_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_CMO, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_CORREL;
+
+TA_RetCode TA_CORREL_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inReal0[],
+                         const double  inReal1[],
+                         int           optInTimePeriod,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal0;
+   in[1].data.inReal = inReal1;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_CORREL, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_COS;
+
+TA_RetCode TA_COS_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_COS, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_COSH;
+
+TA_RetCode TA_COSH_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_COSH, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_DEMA;
+
+TA_RetCode TA_DEMA_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_DEMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_DIV;
+
+TA_RetCode TA_DIV_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal0[],
+                      const double  inReal1[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal0;
+   in[1].data.inReal = inReal1;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_DIV, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_DX;
+
+TA_RetCode TA_DX_64( TA_Integer64  startIdx,
+                     TA_Integer64  endIdx,
+                     const double  inHigh[],
+                     const double  inLow[],
+                     const double  inClose[],
+                     int           optInTimePeriod,
+                     TA_Integer64 *outBegIdx,
+                     TA_Integer64 *outNBElement,
+                     double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_DX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_EMA;
+
+TA_RetCode TA_EMA_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_EMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_EXP;
+
+TA_RetCode TA_EXP_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_EXP, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_FLOOR;
+
+TA_RetCode TA_FLOOR_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inReal[],
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_FLOOR, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_HT_DCPERIOD;
+
+TA_RetCode TA_HT_DCPERIOD_64( TA_Integer64  startIdx,
+                              TA_Integer64  endIdx,
+                              const double  inReal[],
+                              TA_Integer64 *outBegIdx,
+                              TA_Integer64 *outNBElement,
+                              double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_HT_DCPERIOD, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_HT_DCPHASE;
+
+TA_RetCode TA_HT_DCPHASE_64( TA_Integer64  startIdx,
+                             TA_Integer64  endIdx,
+                             const double  inReal[],
+                             TA_Integer64 *outBegIdx,
+                             TA_Integer64 *outNBElement,
+                             double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_HT_DCPHASE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_HT_PHASOR;
+
+TA_RetCode TA_HT_PHASOR_64( TA_Integer64  startIdx,
+                            TA_Integer64  endIdx,
+                            const double  inReal[],
+                            TA_Integer64 *outBegIdx,
+                            TA_Integer64 *outNBElement,
+                            double        outInPhase[],
+                            double        outQuadrature[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outInPhase;
+   out[1].data.outReal = outQuadrature;
+
+   return callFunc64( &TA_DEF_HT_PHASOR, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_HT_SINE;
+
+TA_RetCode TA_HT_SINE_64( TA_Integer64  startIdx,
+                          TA_Integer64  endIdx,
+                          const double  inReal[],
+                          TA_Integer64 *outBegIdx,
+                          TA_Integer64 *outNBElement,
+                          double        outSine[],
+                          double        outLeadSine[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outSine;
+   out[1].data.outReal = outLeadSine;
+
+   return callFunc64( &TA_DEF_HT_SINE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_HT_TRENDLINE;
+
+TA_RetCode TA_HT_TRENDLINE_64( TA_Integer64  startIdx,
+                               TA_Integer64  endIdx,
+                               const double  inReal[],
+                               TA_Integer64 *outBegIdx,
+                               TA_Integer64 *outNBElement,
+                               double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_HT_TRENDLINE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_HT_TRENDMODE;
+
+TA_RetCode TA_HT_TRENDMODE_64( TA_Integer64  startIdx,
+                               TA_Integer64  endIdx,
+                               const double  inReal[],
+                               TA_Integer64 *outBegIdx,
+                               TA_Integer64 *outNBElement,
+                               int           outInteger[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outInteger = outInteger;
+
+   return callFunc64( &TA_DEF_HT_TRENDMODE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_IMI;
+
+TA_RetCode TA_IMI_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inOpen[],
+                      const double  inClose[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = inOpen;
+   in[0].data.inPrice.high = NULL;
+   in[0].data.inPrice.low = NULL;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_IMI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_JMA;
+
+TA_RetCode TA_JMA_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      int           optInPhase,
+                      int           optInVolPeriods,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outRealJMA[],
+                      double        outRealUpperBand[],
+                      double        outRealLowerBand[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[3];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInPhase;
+   optIn[2].data.optInInteger = (TA_Integer)optInVolPeriods;
+   out[0].data.outReal = outRealJMA;
+   out[1].data.outReal = outRealUpperBand;
+   out[2].data.outReal = outRealLowerBand;
+
+   return callFunc64( &TA_DEF_JMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_KAMA;
+
+TA_RetCode TA_KAMA_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_KAMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_LINEARREG;
+
+TA_RetCode TA_LINEARREG_64( TA_Integer64  startIdx,
+                            TA_Integer64  endIdx,
+                            const double  inReal[],
+                            int           optInTimePeriod,
+                            TA_Integer64 *outBegIdx,
+                            TA_Integer64 *outNBElement,
+                            double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_LINEARREG, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_LINEARREG_ANGLE;
+
+TA_RetCode TA_LINEARREG_ANGLE_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_LINEARREG_ANGLE, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_LINEARREG_INTERCEPT;
+
+TA_RetCode TA_LINEARREG_INTERCEPT_64( TA_Integer64  startIdx,
+                                      TA_Integer64  endIdx,
+                                      const double  inReal[],
+                                      int           optInTimePeriod,
+                                      TA_Integer64 *outBegIdx,
+                                      TA_Integer64 *outNBElement,
+                                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_LINEARREG_INTERCEPT, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_LINEARREG_SLOPE;
+
+TA_RetCode TA_LINEARREG_SLOPE_64( TA_Integer64  startIdx,
+                                  TA_Integer64  endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  TA_Integer64 *outBegIdx,
+                                  TA_Integer64 *outNBElement,
+                                  double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_LINEARREG_SLOPE, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_LN;
+
+TA_RetCode TA_LN_64( TA_Integer64  startIdx,
+                     TA_Integer64  endIdx,
+                     const double  inReal[],
+                     TA_Integer64 *outBegIdx,
+                     TA_Integer64 *outNBElement,
+                     double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_LN, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_LOG10;
+
+TA_RetCode TA_LOG10_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inReal[],
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_LOG10, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MA;
+
+TA_RetCode TA_MA_64( TA_Integer64  startIdx,
+                     TA_Integer64  endIdx,
+                     const double  inReal[],
+                     int           optInTimePeriod,
+                     TA_MAType     optInMAType,
+                     TA_Integer64 *outBegIdx,
+                     TA_Integer64 *outNBElement,
+                     double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInMAType;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MACD;
+
+TA_RetCode TA_MACD_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInFastPeriod,
+                       int           optInSlowPeriod,
+                       int           optInSignalPeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outMACD[],
+                       double        outMACDSignal[],
+                       double        outMACDHist[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[3];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastPeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInSlowPeriod;
+   optIn[2].data.optInInteger = (TA_Integer)optInSignalPeriod;
+   out[0].data.outReal = outMACD;
+   out[1].data.outReal = outMACDSignal;
+   out[2].data.outReal = outMACDHist;
+
+   return callFunc64( &TA_DEF_MACD, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MACDEXT;
+
+TA_RetCode TA_MACDEXT_64( TA_Integer64  startIdx,
+                          TA_Integer64  endIdx,
+                          const double  inReal[],
+                          int           optInFastPeriod,
+                          TA_MAType     optInFastMAType,
+                          int           optInSlowPeriod,
+                          TA_MAType     optInSlowMAType,
+                          int           optInSignalPeriod,
+                          TA_MAType     optInSignalMAType,
+                          TA_Integer64 *outBegIdx,
+                          TA_Integer64 *outNBElement,
+                          double        outMACD[],
+                          double        outMACDSignal[],
+                          double        outMACDHist[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[6];
+   TA_ParamHolderOutput   out[3];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastPeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInFastMAType;
+   optIn[2].data.optInInteger = (TA_Integer)optInSlowPeriod;
+   optIn[3].data.optInInteger = (TA_Integer)optInSlowMAType;
+   optIn[4].data.optInInteger = (TA_Integer)optInSignalPeriod;
+   optIn[5].data.optInInteger = (TA_Integer)optInSignalMAType;
+   out[0].data.outReal = outMACD;
+   out[1].data.outReal = outMACDSignal;
+   out[2].data.outReal = outMACDHist;
+
+   return callFunc64( &TA_DEF_MACDEXT, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MACDFIX;
+
+TA_RetCode TA_MACDFIX_64( TA_Integer64  startIdx,
+                          TA_Integer64  endIdx,
+                          const double  inReal[],
+                          int           optInSignalPeriod,
+                          TA_Integer64 *outBegIdx,
+                          TA_Integer64 *outNBElement,
+                          double        outMACD[],
+                          double        outMACDSignal[],
+                          double        outMACDHist[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[3];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInSignalPeriod;
+   out[0].data.outReal = outMACD;
+   out[1].data.outReal = outMACDSignal;
+   out[2].data.outReal = outMACDHist;
+
+   return callFunc64( &TA_DEF_MACDFIX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MAMA;
+
+TA_RetCode TA_MAMA_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       double        optInFastLimit,
+                       double        optInSlowLimit,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outMAMA[],
+                       double        outFAMA[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInReal = optInFastLimit;
+   optIn[1].data.optInReal = optInSlowLimit;
+   out[0].data.outReal = outMAMA;
+   out[1].data.outReal = outFAMA;
+
+   return callFunc64( &TA_DEF_MAMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MAVP;
+
+TA_RetCode TA_MAVP_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       const double  inPeriods[],
+                       int           optInMinPeriod,
+                       int           optInMaxPeriod,
+                       TA_MAType     optInMAType,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   in[1].data.inReal = inPeriods;
+   optIn[0].data.optInInteger = (TA_Integer)optInMinPeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInMaxPeriod;
+   optIn[2].data.optInInteger = (TA_Integer)optInMAType;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MAVP, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MAX;
+
+TA_RetCode TA_MAX_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MAX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MAXINDEX;
+
+TA_RetCode TA_MAXINDEX_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inReal[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           int           outInteger[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outInteger = outInteger;
+
+   return callFunc64( &TA_DEF_MAXINDEX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MEDPRICE;
+
+TA_RetCode TA_MEDPRICE_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MEDPRICE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MFI;
+
+TA_RetCode TA_MFI_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inHigh[],
+                      const double  inLow[],
+                      const double  inClose[],
+                      const double  inVolume[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = inVolume;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MFI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MIDPOINT;
+
+TA_RetCode TA_MIDPOINT_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inReal[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MIDPOINT, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MIDPRICE;
+
+TA_RetCode TA_MIDPRICE_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MIDPRICE, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MIN;
+
+TA_RetCode TA_MIN_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MIN, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MININDEX;
+
+TA_RetCode TA_MININDEX_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inReal[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           int           outInteger[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outInteger = outInteger;
+
+   return callFunc64( &TA_DEF_MININDEX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MINMAX;
+
+TA_RetCode TA_MINMAX_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inReal[],
+                         int           optInTimePeriod,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outMin[],
+                         double        outMax[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outMin;
+   out[1].data.outReal = outMax;
+
+   return callFunc64( &TA_DEF_MINMAX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MINMAXINDEX;
+
+TA_RetCode TA_MINMAXINDEX_64( TA_Integer64  startIdx,
+                              TA_Integer64  endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              TA_Integer64 *outBegIdx,
+                              TA_Integer64 *outNBElement,
+                              int           outMinIdx[],
+                              int           outMaxIdx[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outInteger = outMinIdx;
+   out[1].data.outInteger = outMaxIdx;
+
+   return callFunc64( &TA_DEF_MINMAXINDEX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MINUS_DI;
+
+TA_RetCode TA_MINUS_DI_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           const double  inClose[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MINUS_DI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MINUS_DM;
+
+TA_RetCode TA_MINUS_DM_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           int           optInTimePeriod,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MINUS_DM, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MOM;
+
+TA_RetCode TA_MOM_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MOM, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_MULT;
+
+TA_RetCode TA_MULT_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal0[],
+                       const double  inReal1[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal0;
+   in[1].data.inReal = inReal1;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_MULT, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_NATR;
+
+TA_RetCode TA_NATR_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inHigh[],
+                       const double  inLow[],
+                       const double  inClose[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_NATR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_OBV;
+
+TA_RetCode TA_OBV_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      const double  inVolume[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   in[1].data.inPrice.open = NULL;
+   in[1].data.inPrice.high = NULL;
+   in[1].data.inPrice.low = NULL;
+   in[1].data.inPrice.close = NULL;
+   in[1].data.inPrice.volume = inVolume;
+   in[1].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_OBV, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_PLUS_DI;
+
+TA_RetCode TA_PLUS_DI_64( TA_Integer64  startIdx,
+                          TA_Integer64  endIdx,
+                          const double  inHigh[],
+                          const double  inLow[],
+                          const double  inClose[],
+                          int           optInTimePeriod,
+                          TA_Integer64 *outBegIdx,
+                          TA_Integer64 *outNBElement,
+                          double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_PLUS_DI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_PLUS_DM;
+
+TA_RetCode TA_PLUS_DM_64( TA_Integer64  startIdx,
+                          TA_Integer64  endIdx,
+                          const double  inHigh[],
+                          const double  inLow[],
+                          int           optInTimePeriod,
+                          TA_Integer64 *outBegIdx,
+                          TA_Integer64 *outNBElement,
+                          double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_PLUS_DM, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_PPO;
+
+TA_RetCode TA_PPO_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInFastPeriod,
+                      int           optInSlowPeriod,
+                      TA_MAType     optInMAType,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastPeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInSlowPeriod;
+   optIn[2].data.optInInteger = (TA_Integer)optInMAType;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_PPO, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ROC;
+
+TA_RetCode TA_ROC_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ROC, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ROCP;
+
+TA_RetCode TA_ROCP_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ROCP, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ROCR;
+
+TA_RetCode TA_ROCR_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ROCR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ROCR100;
+
+TA_RetCode TA_ROCR100_64( TA_Integer64  startIdx,
+                          TA_Integer64  endIdx,
+                          const double  inReal[],
+                          int           optInTimePeriod,
+                          TA_Integer64 *outBegIdx,
+                          TA_Integer64 *outNBElement,
+                          double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ROCR100, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_RSI;
+
+TA_RetCode TA_RSI_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_RSI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SAR;
+
+TA_RetCode TA_SAR_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inHigh[],
+                      const double  inLow[],
+                      double        optInAcceleration,
+                      double        optInMaximum,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInReal = optInAcceleration;
+   optIn[1].data.optInReal = optInMaximum;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SAR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SAREXT;
+
+TA_RetCode TA_SAREXT_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inHigh[],
+                         const double  inLow[],
+                         double        optInStartValue,
+                         double        optInOffsetOnReverse,
+                         double        optInAccelerationInitLong,
+                         double        optInAccelerationLong,
+                         double        optInAccelerationMaxLong,
+                         double        optInAccelerationInitShort,
+                         double        optInAccelerationShort,
+                         double        optInAccelerationMaxShort,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[8];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = NULL;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInReal = optInStartValue;
+   optIn[1].data.optInReal = optInOffsetOnReverse;
+   optIn[2].data.optInReal = optInAccelerationInitLong;
+   optIn[3].data.optInReal = optInAccelerationLong;
+   optIn[4].data.optInReal = optInAccelerationMaxLong;
+   optIn[5].data.optInReal = optInAccelerationInitShort;
+   optIn[6].data.optInReal = optInAccelerationShort;
+   optIn[7].data.optInReal = optInAccelerationMaxShort;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SAREXT, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SIN;
+
+TA_RetCode TA_SIN_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SIN, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SINH;
+
+TA_RetCode TA_SINH_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SINH, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SMA;
+
+TA_RetCode TA_SMA_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SQRT;
+
+TA_RetCode TA_SQRT_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SQRT, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_STDDEV;
+
+TA_RetCode TA_STDDEV_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inReal[],
+                         int           optInTimePeriod,
+                         double        optInNbDev,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInReal = optInNbDev;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_STDDEV, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_STOCH;
+
+TA_RetCode TA_STOCH_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inHigh[],
+                        const double  inLow[],
+                        const double  inClose[],
+                        int           optInFastK_Period,
+                        int           optInSlowK_Period,
+                        TA_MAType     optInSlowK_MAType,
+                        int           optInSlowD_Period,
+                        TA_MAType     optInSlowD_MAType,
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outSlowK[],
+                        double        outSlowD[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[5];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastK_Period;
+   optIn[1].data.optInInteger = (TA_Integer)optInSlowK_Period;
+   optIn[2].data.optInInteger = (TA_Integer)optInSlowK_MAType;
+   optIn[3].data.optInInteger = (TA_Integer)optInSlowD_Period;
+   optIn[4].data.optInInteger = (TA_Integer)optInSlowD_MAType;
+   out[0].data.outReal = outSlowK;
+   out[1].data.outReal = outSlowD;
+
+   return callFunc64( &TA_DEF_STOCH, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_STOCHF;
+
+TA_RetCode TA_STOCHF_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inHigh[],
+                         const double  inLow[],
+                         const double  inClose[],
+                         int           optInFastK_Period,
+                         int           optInFastD_Period,
+                         TA_MAType     optInFastD_MAType,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outFastK[],
+                         double        outFastD[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInFastK_Period;
+   optIn[1].data.optInInteger = (TA_Integer)optInFastD_Period;
+   optIn[2].data.optInInteger = (TA_Integer)optInFastD_MAType;
+   out[0].data.outReal = outFastK;
+   out[1].data.outReal = outFastD;
+
+   return callFunc64( &TA_DEF_STOCHF, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_STOCHRSI;
+
+TA_RetCode TA_STOCHRSI_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inReal[],
+                           int           optInTimePeriod,
+                           int           optInFastK_Period,
+                           int           optInFastD_Period,
+                           TA_MAType     optInFastD_MAType,
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outFastK[],
+                           double        outFastD[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[4];
+   TA_ParamHolderOutput   out[2];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInInteger = (TA_Integer)optInFastK_Period;
+   optIn[2].data.optInInteger = (TA_Integer)optInFastD_Period;
+   optIn[3].data.optInInteger = (TA_Integer)optInFastD_MAType;
+   out[0].data.outReal = outFastK;
+   out[1].data.outReal = outFastD;
+
+   return callFunc64( &TA_DEF_STOCHRSI, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SUB;
+
+TA_RetCode TA_SUB_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal0[],
+                      const double  inReal1[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal0;
+   in[1].data.inReal = inReal1;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SUB, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_SUM;
+
+TA_RetCode TA_SUM_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_SUM, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_T3;
+
+TA_RetCode TA_T3_64( TA_Integer64  startIdx,
+                     TA_Integer64  endIdx,
+                     const double  inReal[],
+                     int           optInTimePeriod,
+                     double        optInVFactor,
+                     TA_Integer64 *outBegIdx,
+                     TA_Integer64 *outNBElement,
+                     double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInReal = optInVFactor;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_T3, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TAN;
+
+TA_RetCode TA_TAN_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TAN, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TANH;
+
+TA_RetCode TA_TANH_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TANH, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TEMA;
+
+TA_RetCode TA_TEMA_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TEMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TRANGE;
+
+TA_RetCode TA_TRANGE_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inHigh[],
+                         const double  inLow[],
+                         const double  inClose[],
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TRANGE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TRIMA;
+
+TA_RetCode TA_TRIMA_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inReal[],
+                        int           optInTimePeriod,
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TRIMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TRIX;
+
+TA_RetCode TA_TRIX_64( TA_Integer64  startIdx,
+                       TA_Integer64  endIdx,
+                       const double  inReal[],
+                       int           optInTimePeriod,
+                       TA_Integer64 *outBegIdx,
+                       TA_Integer64 *outNBElement,
+                       double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TRIX, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TSF;
+
+TA_RetCode TA_TSF_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TSF, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_TYPPRICE;
+
+TA_RetCode TA_TYPPRICE_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           const double  inClose[],
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_TYPPRICE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_ULTOSC;
+
+TA_RetCode TA_ULTOSC_64( TA_Integer64  startIdx,
+                         TA_Integer64  endIdx,
+                         const double  inHigh[],
+                         const double  inLow[],
+                         const double  inClose[],
+                         int           optInTimePeriod1,
+                         int           optInTimePeriod2,
+                         int           optInTimePeriod3,
+                         TA_Integer64 *outBegIdx,
+                         TA_Integer64 *outNBElement,
+                         double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[3];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod1;
+   optIn[1].data.optInInteger = (TA_Integer)optInTimePeriod2;
+   optIn[2].data.optInInteger = (TA_Integer)optInTimePeriod3;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_ULTOSC, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_VAR;
+
+TA_RetCode TA_VAR_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      double        optInNbDev,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[2];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   optIn[1].data.optInReal = optInNbDev;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_VAR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_WCLPRICE;
+
+TA_RetCode TA_WCLPRICE_64( TA_Integer64  startIdx,
+                           TA_Integer64  endIdx,
+                           const double  inHigh[],
+                           const double  inLow[],
+                           const double  inClose[],
+                           TA_Integer64 *outBegIdx,
+                           TA_Integer64 *outNBElement,
+                           double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_WCLPRICE, in, NULL, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_WILLR;
+
+TA_RetCode TA_WILLR_64( TA_Integer64  startIdx,
+                        TA_Integer64  endIdx,
+                        const double  inHigh[],
+                        const double  inLow[],
+                        const double  inClose[],
+                        int           optInTimePeriod,
+                        TA_Integer64 *outBegIdx,
+                        TA_Integer64 *outNBElement,
+                        double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inPrice.open = NULL;
+   in[0].data.inPrice.high = inHigh;
+   in[0].data.inPrice.low = inLow;
+   in[0].data.inPrice.close = inClose;
+   in[0].data.inPrice.volume = NULL;
+   in[0].data.inPrice.openInterest = NULL;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_WILLR, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+extern const TA_FuncDef TA_DEF_WMA;
+
+TA_RetCode TA_WMA_64( TA_Integer64  startIdx,
+                      TA_Integer64  endIdx,
+                      const double  inReal[],
+                      int           optInTimePeriod,
+                      TA_Integer64 *outBegIdx,
+                      TA_Integer64 *outNBElement,
+                      double        outReal[] )
+{
+   TA_ParamHolderInput    in[1];
+   TA_ParamHolderOptInput optIn[1];
+   TA_ParamHolderOutput   out[1];
+
+   in[0].data.inReal = inReal;
+   optIn[0].data.optInInteger = (TA_Integer)optInTimePeriod;
+   out[0].data.outReal = outReal;
+
+   return callFunc64( &TA_DEF_WMA, in, optIn, out,
+                      startIdx, endIdx, outBegIdx, outNBElement );
+}
+
+/***************/
+/* End of File */
+/***************/
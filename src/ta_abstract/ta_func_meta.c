@@ -0,0 +1,1473 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Important: This file is automatically generated by gen_code.
+ *            Any modification will be lost on next execution
+ *            of gen_code.
+ *
+ * This file is the binary description of the TA functions
+ * (see ta_meta.h), same content as ta_func_meta.bin.
+ */
+
+#include "ta_meta.h"
+
+static const union
+{
+   unsigned char byte[28128];
+   double        align;
+} TA_FuncMetaArray =
+{
+{
+0x54,0x41,0x4D,0x44,0x01,0x00,0x00,0x00,0xE0,0x6D,0x00,0x00,0x0A,0x00,0x00,0x00,0x65,0x00,0x00,0x00
+,0x6D,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x40,0x00,0x00,0x00
+,0x68,0x00,0x00,0x00,0xA8,0x19,0x00,0x00,0x78,0x20,0x00,0x00,0x28,0x43,0x00,0x00,0xC8,0x4A,0x00,0x00
+,0x88,0x51,0x00,0x00,0x88,0x51,0x00,0x00,0x97,0x51,0x00,0x00,0xA6,0x51,0x00,0x00,0xB6,0x51,0x00,0x00
+,0xCC,0x51,0x00,0x00,0xE0,0x51,0x00,0x00,0xF1,0x51,0x00,0x00,0x03,0x52,0x00,0x00,0x17,0x52,0x00,0x00
+,0x2B,0x52,0x00,0x00,0x3B,0x52,0x00,0x00,0x44,0x52,0x00,0x00,0x4D,0x52,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x52,0x00,0x00,0xD1,0x52,0x00,0x00,0xD6,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x52,0x00,0x00,0x02,0x53,0x00,0x00
+,0x05,0x53,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x53,0x00,0x00
+,0x26,0x53,0x00,0x00,0x2A,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x50,0x53,0x00,0x00,0x56,0x53,0x00,0x00,0x5C,0x53,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xED,0x53,0x00,0x00,0xF1,0x53,0x00,0x00,0xF5,0x53,0x00,0x00,0x04,0x00,0x00,0x00
+,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00
+,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x18,0x54,0x00,0x00,0x1D,0x54,0x00,0x00,0x22,0x54,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x54,0x00,0x00,0x50,0x54,0x00,0x00
+,0x54,0x54,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x54,0x00,0x00
+,0xC8,0x54,0x00,0x00,0xC8,0x54,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x0A,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x54,0x00,0x00,0xF9,0x54,0x00,0x00,0x02,0x55,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x09,0x00,0x00,0x00
+,0x0C,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x13,0x55,0x00,0x00,0x18,0x55,0x00,0x00,0x1D,0x55,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0B,0x00,0x00,0x00
+,0x0A,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x55,0x00,0x00,0x3C,0x55,0x00,0x00,0x41,0x55,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x0C,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x55,0x00,0x00,0x5F,0x55,0x00,0x00
+,0x63,0x55,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x55,0x00,0x00
+,0x7D,0x55,0x00,0x00,0x84,0x55,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,0x10,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00
+,0x96,0x55,0x00,0x00,0x9F,0x55,0x00,0x00,0xA8,0x55,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x01
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x0C,0x00,0x00,0x00
+,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xC2,0x55,0x00,0x00,0xC9,0x55,0x00,0x00,0xD0,0x55,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00
+,0x0C,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x56,0x00,0x00,0x65,0x56,0x00,0x00,0x65,0x56,0x00,0x00
+,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x11,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x56,0x00,0x00,0x6E,0x56,0x00,0x00
+,0x72,0x56,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x56,0x00,0x00
+,0x87,0x56,0x00,0x00,0x8B,0x56,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x17,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00
+,0xA3,0x56,0x00,0x00,0xA8,0x56,0x00,0x00,0xAD,0x56,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x12,0x00,0x00,0x00
+,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xB9,0x56,0x00,0x00,0xBD,0x56,0x00,0x00,0xC1,0x56,0x00,0x00,0x04,0x00,0x00,0x00
+,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00
+,0x12,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0x56,0x00,0x00,0xE3,0x56,0x00,0x00,0xEA,0x56,0x00,0x00
+,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x17,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x10,0x57,0x00,0x00,0x14,0x57,0x00,0x00
+,0x18,0x57,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x57,0x00,0x00
+,0x36,0x57,0x00,0x00,0x3B,0x57,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x1C,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xA5,0x54,0x00,0x00,0x55,0x57,0x00,0x00,0x5A,0x57,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x14,0x00,0x00,0x00
+,0x1D,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x7C,0x57,0x00,0x00,0x80,0x57,0x00,0x00,0x84,0x57,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1C,0x00,0x00,0x00
+,0x15,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0x57,0x00,0x00,0x9D,0x57,0x00,0x00,0xA0,0x57,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x1E,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x54,0x00,0x00,0xBB,0x57,0x00,0x00
+,0xBF,0x57,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xDA,0x57,0x00,0x00
+,0xDE,0x57,0x00,0x00,0xE2,0x57,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x21,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF8,0x57,0x00,0x00,0xFE,0x57,0x00,0x00,0x04,0x58,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x17,0x00,0x00,0x00
+,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x11,0x58,0x00,0x00,0x1D,0x58,0x00,0x00,0x28,0x58,0x00,0x00,0x05,0x00,0x00,0x00
+,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x00,0x00
+,0x17,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x58,0x00,0x00,0x5D,0x58,0x00,0x00,0x67,0x58,0x00,0x00
+,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x23,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x58,0x00,0x00,0x9A,0x58,0x00,0x00
+,0xA3,0x58,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x58,0x00,0x00
+,0xEA,0x58,0x00,0x00,0xF1,0x58,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x27,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x22,0x59,0x00,0x00,0x2F,0x59,0x00,0x00,0x3B,0x59,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x09
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x17,0x00,0x00,0x00
+,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x67,0x59,0x00,0x00,0x74,0x59,0x00,0x00,0x80,0x59,0x00,0x00,0x05,0x00,0x00,0x00
+,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x00,0x00,0x00
+,0x17,0x00,0x00,0x00,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB3,0x59,0x00,0x00,0xB7,0x59,0x00,0x00,0xBB,0x59,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x28,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xDD,0x59,0x00,0x00,0xE1,0x59,0x00,0x00
+,0xE5,0x59,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00
+,0x03,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0x54,0x00,0x00
+,0xC4,0x5A,0x00,0x00,0xC9,0x5A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2A,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x2F,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xE9,0x5A,0x00,0x00,0xF3,0x5A,0x00,0x00,0xFD,0x5A,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x01
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x1C,0x00,0x00,0x00
+,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF
+,0x00,0x00,0x00,0x00,0x0F,0x5B,0x00,0x00,0x1F,0x5B,0x00,0x00,0x2E,0x5B,0x00,0x00,0x08,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2C,0x00,0x00,0x00
+,0x1D,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x46,0x5B,0x00,0x00,0x5A,0x5B,0x00,0x00,0x6D,0x5B,0x00,0x00
+,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x2D,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x89,0x5B,0x00,0x00,0x99,0x5B,0x00,0x00
+,0xA8,0x5B,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xC0,0x5B,0x00,0x00
+,0xC3,0x5B,0x00,0x00,0xC6,0x5B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2F,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x34,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xD9,0x5B,0x00,0x00,0xDF,0x5B,0x00,0x00,0xE5,0x5B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x20,0x00,0x00,0x00
+,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF2,0x5B,0x00,0x00,0xF5,0x5B,0x00,0x00,0x03,0x5C,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x00,0x00
+,0x20,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x5C,0x00,0x00,0x17,0x5C,0x00,0x00,0x1C,0x5C,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00
+,0x32,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB1,0x5C,0x00,0x00,0xB9,0x5C,0x00,0x00
+,0xC1,0x5C,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00
+,0x03,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3A,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x5D,0x00,0x00
+,0xA1,0x5D,0x00,0x00,0xA9,0x5D,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x3D,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xBA,0x54,0x00,0x00,0xD9,0x5D,0x00,0x00,0xDE,0x5D,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x09
+,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x2C,0x00,0x00,0x00
+,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x93,0x5E,0x00,0x00,0x98,0x5E,0x00,0x00,0xB4,0x5E,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x00,0x00,0x00
+,0x2E,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x5F,0x00,0x00,0x98,0x5F,0x00,0x00,0x9C,0x5F,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x38,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xC2,0x5F,0x00,0x00,0xCB,0x5F,0x00,0x00
+,0xD4,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x03,0x60,0x00,0x00
+,0x0C,0x60,0x00,0x00,0x15,0x60,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3A,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x45,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x22,0x60,0x00,0x00,0x26,0x60,0x00,0x00,0x2A,0x60,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3B,0x00,0x00,0x00,0x33,0x00,0x00,0x00
+,0x46,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x3B,0x60,0x00,0x00,0x44,0x60,0x00,0x00,0x4D,0x60,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3C,0x00,0x00,0x00
+,0x34,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x62,0x60,0x00,0x00,0x6B,0x60,0x00,0x00,0x74,0x60,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x3D,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x8F,0x60,0x00,0x00,0x93,0x60,0x00,0x00
+,0x97,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xBC,0x60,0x00,0x00
+,0xC5,0x60,0x00,0x00,0xCE,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x4A,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00
+,0xFC,0x60,0x00,0x00,0x03,0x61,0x00,0x00,0x0A,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x38,0x00,0x00,0x00
+,0x4B,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF
+,0x00,0x00,0x00,0x00,0x4A,0x61,0x00,0x00,0x56,0x61,0x00,0x00,0x62,0x61,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x41,0x00,0x00,0x00
+,0x39,0x00,0x00,0x00,0x4D,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xB3,0x61,0x00,0x00,0xBC,0x61,0x00,0x00,0xC4,0x61,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x42,0x00,0x00,0x00,0x3A,0x00,0x00,0x00,0x4F,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0x00,0xE9,0x61,0x00,0x00
+,0xF1,0x61,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x3B,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x62,0x00,0x00
+,0x10,0x62,0x00,0x00,0x14,0x62,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x51,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x1D,0x62,0x00,0x00,0x22,0x62,0x00,0x00,0x27,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x3D,0x00,0x00,0x00
+,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x3E,0x62,0x00,0x00,0x43,0x62,0x00,0x00,0x48,0x62,0x00,0x00,0x03,0x00,0x00,0x00
+,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00
+,0x3D,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x62,0x00,0x00,0x6A,0x62,0x00,0x00,0x6E,0x62,0x00,0x00
+,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x48,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x62,0x00,0x00,0x91,0x62,0x00,0x00
+,0x98,0x62,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x4A,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB3,0x62,0x00,0x00
+,0xBB,0x62,0x00,0x00,0xC2,0x62,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4B,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x56,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xDC,0x62,0x00,0x00,0xE0,0x62,0x00,0x00,0xE4,0x62,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4C,0x00,0x00,0x00,0x40,0x00,0x00,0x00
+,0x57,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x04,0x63,0x00,0x00,0x08,0x63,0x00,0x00,0x04,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4D,0x00,0x00,0x00
+,0x43,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x63,0x00,0x00,0x38,0x63,0x00,0x00,0x3D,0x63,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x4E,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x63,0x00,0x00,0x79,0x63,0x00,0x00
+,0x7E,0x63,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x4F,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x63,0x00,0x00
+,0xAE,0x63,0x00,0x00,0xB6,0x63,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x5B,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xEC,0x63,0x00,0x00,0xF0,0x63,0x00,0x00,0xF4,0x63,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x47,0x00,0x00,0x00
+,0x5C,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x0C,0x64,0x00,0x00,0x10,0x64,0x00,0x00,0x14,0x64,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x52,0x00,0x00,0x00
+,0x48,0x00,0x00,0x00,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB3,0x64,0x00,0x00,0xBA,0x64,0x00,0x00,0xC1,0x64,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x53,0x00,0x00,0x00,0x4A,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB9,0x67,0x00,0x00,0xBD,0x67,0x00,0x00
+,0xC1,0x67,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x67,0x00,0x00
+,0xDF,0x67,0x00,0x00,0xE4,0x67,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x60,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x99,0x54,0x00,0x00,0xFE,0x67,0x00,0x00,0x02,0x68,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x52,0x00,0x00,0x00
+,0x61,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF
+,0x00,0x00,0x00,0x00,0x18,0x68,0x00,0x00,0x1D,0x68,0x00,0x00,0x22,0x68,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x57,0x00,0x00,0x00
+,0x53,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x68,0x00,0x00,0x3C,0x68,0x00,0x00,0x43,0x68,0x00,0x00
+,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x58,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0x68,0x00,0x00,0x83,0x68,0x00,0x00
+,0x89,0x68,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x6A,0x00,0x00
+,0x0E,0x6A,0x00,0x00,0x15,0x6A,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x66,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xCC,0x6A,0x00,0x00,0xD5,0x6A,0x00,0x00,0xDE,0x6A,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08
+,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x5B,0x00,0x00,0x00,0x5D,0x00,0x00,0x00
+,0x68,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x6B,0x00,0x00,0x05,0x6B,0x00,0x00,0x09,0x6B,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5C,0x00,0x00,0x00
+,0x61,0x00,0x00,0x00,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x6B,0x00,0x00,0x2B,0x6B,0x00,0x00,0x2F,0x6B,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x5E,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xBF,0x54,0x00,0x00,0xBF,0x54,0x00,0x00
+,0x39,0x6B,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x5F,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xFA,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x7B,0x6B,0x00,0x00
+,0x7F,0x6B,0x00,0x00,0x83,0x6B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x6D,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x9C,0x6B,0x00,0x00,0xA1,0x6B,0x00,0x00,0xA6,0x6B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x64,0x00,0x00,0x00
+,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xAA,0x54,0x00,0x00,0xC0,0x6B,0x00,0x00,0xC5,0x6B,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x62,0x00,0x00,0x00
+,0x64,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x6B,0x00,0x00,0xEE,0x6B,0x00,0x00,0xF8,0x6B,0x00,0x00
+,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x63,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0x54,0x00,0x00,0x03,0x6C,0x00,0x00
+,0x09,0x6C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x23,0x6C,0x00,0x00
+,0x28,0x6C,0x00,0x00,0x2D,0x6C,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x72,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x5F,0x6C,0x00,0x00,0x63,0x6C,0x00,0x00,0x67,0x6C,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x01
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x67,0x00,0x00,0x00
+,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF
+,0x00,0x00,0x00,0x00,0x7C,0x6C,0x00,0x00,0x85,0x6C,0x00,0x00,0x8E,0x6C,0x00,0x00,0x09,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x67,0x00,0x00,0x00
+,0x68,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0x6C,0x00,0x00,0xA3,0x6C,0x00,0x00,0xAA,0x6C,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x68,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x6D,0x00,0x00,0x78,0x6D,0x00,0x00
+,0x78,0x6D,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x81,0x6D,0x00,0x00
+,0x8A,0x6D,0x00,0x00,0x93,0x6D,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6A,0x00,0x00,0x00,0x6D,0x00,0x00,0x00,0x77,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xA8,0x6D,0x00,0x00,0xAE,0x6D,0x00,0x00,0xB4,0x6D,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,0x6D,0x00,0x00,0x00
+,0x78,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF
+,0x00,0x00,0x00,0x00,0xA1,0x54,0x00,0x00,0xC1,0x6D,0x00,0x00,0xC5,0x6D,0x00,0x00,0x02,0x00,0x00,0x00
+,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6C,0x00,0x00,0x00
+,0x6E,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x16,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x53,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x53,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x40,0x53,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x53,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x55,0x00,0x00,0x00,0x00,0x00,0x00
+,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x53,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x53,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x53,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x53,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x5E,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x53,0x00,0x00,0x00,0x00,0x00,0x00
+,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xCE,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xCE,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x53,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x53,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x62,0x00,0x00
+,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xCE,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x40,0x53,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x53,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x60,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x52,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x73,0x53,0x00,0x00,0x83,0x53,0x00,0x00,0x8F,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xB0,0x53,0x00,0x00,0xC0,0x53,0x00,0x00,0xCC,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x73,0x53,0x00,0x00,0x83,0x53,0x00,0x00,0x8F,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xB0,0x53,0x00,0x00,0xC0,0x53,0x00,0x00,0xCC,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x6E,0x54,0x00,0x00,0x7A,0x54,0x00,0x00,0x82,0x54,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40
+,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0xC7,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0xE0,0x55,0x00,0x00,0xED,0x55,0x00,0x00,0xFB,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40
+,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0xC7,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0x1F,0x56,0x00,0x00,0x2C,0x56,0x00,0x00,0x3C,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x6E,0x54,0x00,0x00,0x7A,0x54,0x00,0x00,0x82,0x54,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x2C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0xFA,0x59,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x1F,0x5A,0x00,0x00,0x2A,0x5A,0x00,0x00,0x30,0x5A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x50,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x40,0x50,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x50,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6C,0x5A,0x00,0x00,0x7C,0x5A,0x00,0x00,0x8F,0x5A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x6E,0x54,0x00,0x00,0x7A,0x54,0x00,0x00,0x82,0x54,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x73,0x53,0x00,0x00,0x83,0x53,0x00,0x00,0x8F,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xB0,0x53,0x00,0x00,0xC0,0x53,0x00,0x00,0xCC,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x42,0x5C,0x00,0x00,0x54,0x5C,0x00,0x00,0x62,0x5C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x73,0x53,0x00,0x00,0x83,0x53,0x00,0x00,0x8F,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xE0,0x5C,0x00,0x00,0xF0,0x5C,0x00,0x00,0xF8,0x5C,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xB0,0x53,0x00,0x00,0xC0,0x53,0x00,0x00,0xCC,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x1B,0x5D,0x00,0x00,0x2B,0x5D,0x00,0x00,0x33,0x5D,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x42,0x5C,0x00,0x00,0x54,0x5C,0x00,0x00,0x62,0x5C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x56,0x5D,0x00,0x00,0x68,0x5D,0x00,0x00,0x72,0x5D,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x42,0x5C,0x00,0x00,0x54,0x5C,0x00,0x00,0x62,0x5C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x3F
+,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F,0xAE,0x47,0xE1,0x7A,0x14,0xAE,0xEF,0x3F,0xE1,0x7A,0x14,0xAE
+,0x47,0xE1,0xCA,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xE9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0xFB,0x5D,0x00,0x00,0x0A,0x5E,0x00,0x00,0x15,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x9A,0x99,0x99,0x99,0x99,0x99,0xA9,0x3F
+,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F,0xAE,0x47,0xE1,0x7A,0x14,0xAE,0xEF,0x3F,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x33,0x33,0x33,0x33,0x33,0x33,0xE3,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x3F,0x5E,0x00,0x00,0x4E,0x5E,0x00,0x00,0x59,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xE2,0x5E,0x00,0x00,0xF1,0x5E,0x00,0x00,0x00,0x5F,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x3A,0x5F,0x00,0x00,0x49,0x5F,0x00,0x00,0x58,0x5F,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x6E,0x54,0x00,0x00,0x7A,0x54,0x00,0x00,0x82,0x54,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x73,0x53,0x00,0x00,0x83,0x53,0x00,0x00,0x8F,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xB0,0x53,0x00,0x00,0xC0,0x53,0x00,0x00,0xCC,0x53,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x6E,0x54,0x00,0x00,0x7A,0x54,0x00,0x00,0x82,0x54,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x94,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x22,0x64,0x00,0x00,0x34,0x64,0x00,0x00,0x48,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x9A,0x99,0x99,0x99
+,0x99,0x99,0xC9,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xD9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x79,0x64,0x00,0x00,0x86,0x64,0x00,0x00,0x91,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0xC7,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xDA,0x64,0x00,0x00,0xEA,0x64,0x00,0x00,0xF6,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x33,0x33,0x33,0x33,0x33,0x33,0xC3,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x37,0x65,0x00,0x00,0x4C,0x65,0x00,0x00,0x5E,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x94,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x52,0xB8,0x1E,0x85,0xEB,0x51,0xC8,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0xA2,0x65,0x00,0x00,0xBC,0x65,0x00,0x00,0xC9,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x94,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x02,0x66,0x00,0x00,0x18,0x66,0x00,0x00,0x20,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x9A,0x99,0x99,0x99
+,0x99,0x99,0xC9,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xD9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x4B,0x66,0x00,0x00,0x64,0x66,0x00,0x00,0x70,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x94,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x52,0xB8,0x1E,0x85,0xEB,0x51,0xC8,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0xA9,0x66,0x00,0x00,0xC4,0x66,0x00,0x00,0xD2,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x94,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x0C,0x67,0x00,0x00,0x23,0x67,0x00,0x00,0x2C,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x9A,0x99,0x99,0x99
+,0x99,0x99,0xC9,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xD9,0x3F,0x7B,0x14,0xAE,0x47,0xE1,0x7A,0x84,0x3F
+,0x58,0x67,0x00,0x00,0x72,0x67,0x00,0x00,0x7F,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0xC7,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0x56,0x68,0x00,0x00,0x61,0x68,0x00,0x00,0x6C,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x94,0x68,0x00,0x00,0xA6,0x68,0x00,0x00,0xB4,0x68,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xDD,0x68,0x00,0x00,0xEF,0x68,0x00,0x00,0xFD,0x68,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x34,0x69,0x00,0x00,0x46,0x69,0x00,0x00,0x50,0x69,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x72,0x69,0x00,0x00,0x84,0x69,0x00,0x00,0x92,0x69,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xB7,0x69,0x00,0x00,0xC9,0x69,0x00,0x00,0xD3,0x69,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x94,0x68,0x00,0x00,0xA6,0x68,0x00,0x00,0xB4,0x68,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x25,0x6A,0x00,0x00,0x37,0x6A,0x00,0x00,0x45,0x6A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x7C,0x6A,0x00,0x00,0x8E,0x6A,0x00,0x00,0x98,0x6A,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x94,0x68,0x00,0x00,0xA6,0x68,0x00,0x00,0xB4,0x68,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x25,0x6A,0x00,0x00,0x37,0x6A,0x00,0x00,0x45,0x6A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x7C,0x6A,0x00,0x00,0x8E,0x6A,0x00,0x00,0x98,0x6A,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x66,0x66,0x66,0x66,0x66,0x66,0xE6,0x3F
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x7B,0x14,0xAE,0x47
+,0xE1,0x7A,0x84,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9A,0x99,0x99,0x99,0x99,0x99,0xA9,0x3F
+,0x60,0x6B,0x00,0x00,0x6D,0x6B,0x00,0x00,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xBE,0x6C,0x00,0x00,0xCF,0x6C,0x00,0x00,0xDC,0x6C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xFB,0x6C,0x00,0x00,0x0C,0x6D,0x00,0x00,0x1A,0x6D,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x38,0x6D,0x00,0x00,0x49,0x6D,0x00,0x00,0x56,0x6D,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0xC7,0xD5,0x8E,0x81,0x32,0xCA,0x91,0xB6,0x47,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9A,0x99,0x99,0x99,0x99,0x99,0xC9,0x3F
+,0x56,0x68,0x00,0x00,0x61,0x68,0x00,0x00,0x6C,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x6A,0xF8,0x40,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x6B,0x52,0x00,0x00,0x7B,0x52,0x00,0x00,0x87,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x98,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xBB,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x98,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xC9,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xD4,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x59,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x59,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xA8,0x59,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB9,0x5A,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0x5C,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x97,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xA5,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x8F,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x97,0x5C,0x00,0x00
+,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x5C,0x00,0x00,0x00,0x00,0x00,0x00
+,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x97,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xA5,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x5E,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0x5E,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xA8,0x59,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x59,0x00,0x00
+,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x61,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x9F,0x61,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xA9,0x61,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF5,0x69,0x00,0x00,0x00,0x00,0x00,0x00
+,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xBA,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xC3,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0x6A,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x6A,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00
+,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00
+,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40
+,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40
+,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40
+,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40
+,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40
+,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40
+,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40
+,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40
+,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F
+,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40
+,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40
+,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40
+,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40
+,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0xAA,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40
+,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0x9D,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA1,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x08,0x40,0xA5,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40
+,0xAA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x40,0xAF,0x54,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0xB5,0x54,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x40,0xBA,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+,0x00,0x00,0x20,0x40,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65
+,0x72,0x61,0x74,0x6F,0x72,0x73,0x00,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72
+,0x6D,0x00,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x00,0x56,0x6F
+,0x6C,0x61,0x74,0x69,0x6C,0x69,0x74,0x79,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x00
+,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x00
+,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x00,0x56,0x6F,0x6C
+,0x75,0x6D,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x00,0x50,0x61,0x74,0x74,0x65
+,0x72,0x6E,0x20,0x52,0x65,0x63,0x6F,0x67,0x6E,0x69,0x74,0x69,0x6F,0x6E,0x00,0x53,0x74,0x61,0x74,0x69
+,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x00,0x50,0x72,0x69,0x63,0x65
+,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x00,0x41,0x43,0x43,0x42,0x41,0x4E,0x44,0x53,0x00
+,0x41,0x63,0x63,0x62,0x61,0x6E,0x64,0x73,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F
+,0x6E,0x20,0x42,0x61,0x6E,0x64,0x73,0x00,0x69,0x6E,0x50,0x72,0x69,0x63,0x65,0x48,0x4C,0x43,0x00,0x6F
+,0x70,0x74,0x49,0x6E,0x54,0x69,0x6D,0x65,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x54,0x69,0x6D,0x65,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
+,0x69,0x6F,0x64,0x00,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x55,0x70,0x70,0x65,0x72,0x42,0x61,0x6E,0x64
+,0x00,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x4D,0x69,0x64,0x64,0x6C,0x65,0x42,0x61,0x6E,0x64,0x00,0x6F
+,0x75,0x74,0x52,0x65,0x61,0x6C,0x4C,0x6F,0x77,0x65,0x72,0x42,0x61,0x6E,0x64,0x00,0x41,0x43,0x4F,0x53
+,0x00,0x41,0x63,0x6F,0x73,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F
+,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x41,0x43,0x6F,0x73,0x00,0x69,0x6E,0x52,0x65,0x61,0x6C,0x00,0x6F
+,0x75,0x74,0x52,0x65,0x61,0x6C,0x00,0x41,0x44,0x00,0x41,0x64,0x00,0x43,0x68,0x61,0x69,0x6B,0x69,0x6E
+,0x20,0x41,0x2F,0x44,0x20,0x4C,0x69,0x6E,0x65,0x00,0x69,0x6E,0x50,0x72,0x69,0x63,0x65,0x48,0x4C,0x43
+,0x56,0x00,0x41,0x44,0x44,0x00,0x41,0x64,0x64,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69
+,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x41,0x64,0x64,0x00,0x69,0x6E,0x52,0x65,0x61,0x6C,0x30,0x00
+,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x00,0x41,0x44,0x4F,0x53,0x43,0x00,0x41,0x64,0x4F,0x73,0x63,0x00
+,0x43,0x68,0x61,0x69,0x6B,0x69,0x6E,0x20,0x41,0x2F,0x44,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74
+,0x6F,0x72,0x00,0x6F,0x70,0x74,0x49,0x6E,0x46,0x61,0x73,0x74,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x46
+,0x61,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x73,0x74
+,0x20,0x4D,0x41,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53,0x6C,0x6F,0x77,0x50,0x65,0x72,0x69,0x6F,0x64,0x00
+,0x53,0x6C,0x6F,0x77,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F
+,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x6C,0x6F
+,0x77,0x20,0x4D,0x41,0x00,0x41,0x44,0x58,0x00,0x41,0x64,0x78,0x00,0x41,0x76,0x65,0x72,0x61,0x67,0x65
+,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E
+,0x74,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x41,0x44,0x58,0x52,0x00,0x41,0x64,0x78,0x72,0x00,0x41,0x76
+,0x65,0x72,0x61,0x67,0x65,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F
+,0x76,0x65,0x6D,0x65,0x6E,0x74,0x20,0x49,0x6E,0x64,0x65,0x78,0x20,0x52,0x61,0x74,0x69,0x6E,0x67,0x00
+,0x41,0x50,0x4F,0x00,0x41,0x70,0x6F,0x00,0x41,0x62,0x73,0x6F,0x6C,0x75,0x74,0x65,0x20,0x50,0x72,0x69
+,0x63,0x65,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74,0x6F,0x72,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4D
+,0x41,0x54,0x79,0x70,0x65,0x00,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x00,0x54,0x79,0x70,0x65,0x20,0x6F
+,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x53,0x4D,0x41
+,0x00,0x45,0x4D,0x41,0x00,0x57,0x4D,0x41,0x00,0x44,0x45,0x4D,0x41,0x00,0x54,0x45,0x4D,0x41,0x00,0x54
+,0x52,0x49,0x4D,0x41,0x00,0x4B,0x41,0x4D,0x41,0x00,0x4D,0x41,0x4D,0x41,0x00,0x54,0x33,0x00,0x41,0x52
+,0x4F,0x4F,0x4E,0x00,0x41,0x72,0x6F,0x6F,0x6E,0x00,0x69,0x6E,0x50,0x72,0x69,0x63,0x65,0x48,0x4C,0x00
+,0x6F,0x75,0x74,0x41,0x72,0x6F,0x6F,0x6E,0x44,0x6F,0x77,0x6E,0x00,0x6F,0x75,0x74,0x41,0x72,0x6F,0x6F
+,0x6E,0x55,0x70,0x00,0x41,0x52,0x4F,0x4F,0x4E,0x4F,0x53,0x43,0x00,0x41,0x72,0x6F,0x6F,0x6E,0x4F,0x73
+,0x63,0x00,0x41,0x72,0x6F,0x6F,0x6E,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74,0x6F,0x72,0x00,0x41
+,0x53,0x49,0x4E,0x00,0x41,0x73,0x69,0x6E,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67
+,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x41,0x53,0x69,0x6E,0x00,0x41,0x54,0x41,0x4E,0x00
+,0x41,0x74,0x61,0x6E,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D
+,0x65,0x74,0x72,0x69,0x63,0x20,0x41,0x54,0x61,0x6E,0x00,0x41,0x54,0x52,0x00,0x41,0x74,0x72,0x00,0x41
+,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x54,0x72,0x75,0x65,0x20,0x52,0x61,0x6E,0x67,0x65,0x00,0x41,0x56
+,0x47,0x44,0x45,0x56,0x00,0x41,0x76,0x67,0x44,0x65,0x76,0x00,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20
+,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x00,0x41,0x56,0x47,0x50,0x52,0x49,0x43,0x45,0x00,0x41
+,0x76,0x67,0x50,0x72,0x69,0x63,0x65,0x00,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x50,0x72,0x69,0x63
+,0x65,0x00,0x69,0x6E,0x50,0x72,0x69,0x63,0x65,0x4F,0x48,0x4C,0x43,0x00,0x42,0x42,0x41,0x4E,0x44,0x53
+,0x00,0x42,0x62,0x61,0x6E,0x64,0x73,0x00,0x42,0x6F,0x6C,0x6C,0x69,0x6E,0x67,0x65,0x72,0x20,0x42,0x61
+,0x6E,0x64,0x73,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4E,0x62,0x44,0x65,0x76,0x55,0x70,0x00,0x44,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x20,0x75,0x70,0x00,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x20,0x6D,0x75,0x6C,0x74,0x69,0x70,0x6C,0x69,0x65,0x72,0x20,0x66,0x6F,0x72,0x20,0x75,0x70,0x70,0x65
+,0x72,0x20,0x62,0x61,0x6E,0x64,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4E,0x62,0x44,0x65,0x76,0x44,0x6E,0x00
+,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x20,0x64,0x6F,0x77,0x6E,0x00,0x44,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x20,0x6D,0x75,0x6C,0x74,0x69,0x70,0x6C,0x69,0x65,0x72,0x20,0x66,0x6F,0x72
+,0x20,0x6C,0x6F,0x77,0x65,0x72,0x20,0x62,0x61,0x6E,0x64,0x00,0x42,0x45,0x54,0x41,0x00,0x42,0x65,0x74
+,0x61,0x00,0x42,0x4F,0x50,0x00,0x42,0x6F,0x70,0x00,0x42,0x61,0x6C,0x61,0x6E,0x63,0x65,0x20,0x4F,0x66
+,0x20,0x50,0x6F,0x77,0x65,0x72,0x00,0x43,0x43,0x49,0x00,0x43,0x63,0x69,0x00,0x43,0x6F,0x6D,0x6D,0x6F
+,0x64,0x69,0x74,0x79,0x20,0x43,0x68,0x61,0x6E,0x6E,0x65,0x6C,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x43
+,0x45,0x49,0x4C,0x00,0x43,0x65,0x69,0x6C,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x43,0x65,0x69,0x6C
+,0x00,0x43,0x4D,0x4F,0x00,0x43,0x6D,0x6F,0x00,0x43,0x68,0x61,0x6E,0x64,0x65,0x20,0x4D,0x6F,0x6D,0x65
+,0x6E,0x74,0x75,0x6D,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74,0x6F,0x72,0x00,0x43,0x4F,0x52,0x52
+,0x45,0x4C,0x00,0x43,0x6F,0x72,0x72,0x65,0x6C,0x00,0x50,0x65,0x61,0x72,0x73,0x6F,0x6E,0x27,0x73,0x20
+,0x43,0x6F,0x72,0x72,0x65,0x6C,0x61,0x74,0x69,0x6F,0x6E,0x20,0x43,0x6F,0x65,0x66,0x66,0x69,0x63,0x69
+,0x65,0x6E,0x74,0x20,0x28,0x72,0x29,0x00,0x43,0x4F,0x53,0x00,0x43,0x6F,0x73,0x00,0x56,0x65,0x63,0x74
+,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x43,0x6F,0x73
+,0x00,0x43,0x4F,0x53,0x48,0x00,0x43,0x6F,0x73,0x68,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72
+,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x43,0x6F,0x73,0x68,0x00,0x44,0x65,0x6D
+,0x61,0x00,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C
+,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x44,0x49,0x56,0x00
+,0x44,0x69,0x76,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69
+,0x63,0x20,0x44,0x69,0x76,0x00,0x44,0x58,0x00,0x44,0x78,0x00,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x45
+,0x6D,0x61,0x00,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E
+,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x45,0x58,0x50,0x00,0x45,0x78,0x70,0x00,0x56,0x65
+,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x45,0x78,0x70,0x00
+,0x46,0x4C,0x4F,0x4F,0x52,0x00,0x46,0x6C,0x6F,0x6F,0x72,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x46
+,0x6C,0x6F,0x6F,0x72,0x00,0x48,0x54,0x5F,0x44,0x43,0x50,0x45,0x52,0x49,0x4F,0x44,0x00,0x48,0x74,0x44
+,0x63,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E
+,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x44,0x6F,0x6D,0x69,0x6E,0x61,0x6E,0x74,0x20,0x43,0x79,0x63
+,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x48,0x54,0x5F,0x44,0x43,0x50,0x48,0x41,0x53,0x45
+,0x00,0x48,0x74,0x44,0x63,0x50,0x68,0x61,0x73,0x65,0x00,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54
+,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x44,0x6F,0x6D,0x69,0x6E,0x61,0x6E,0x74,0x20
+,0x43,0x79,0x63,0x6C,0x65,0x20,0x50,0x68,0x61,0x73,0x65,0x00,0x48,0x54,0x5F,0x50,0x48,0x41,0x53,0x4F
+,0x52,0x00,0x48,0x74,0x50,0x68,0x61,0x73,0x6F,0x72,0x00,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54
+,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x50,0x68,0x61,0x73,0x6F,0x72,0x20,0x43,0x6F
+,0x6D,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x73,0x00,0x6F,0x75,0x74,0x49,0x6E,0x50,0x68,0x61,0x73,0x65,0x00
+,0x6F,0x75,0x74,0x51,0x75,0x61,0x64,0x72,0x61,0x74,0x75,0x72,0x65,0x00,0x48,0x54,0x5F,0x53,0x49,0x4E
+,0x45,0x00,0x48,0x74,0x53,0x69,0x6E,0x65,0x00,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61
+,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x53,0x69,0x6E,0x65,0x57,0x61,0x76,0x65,0x00,0x6F,0x75
+,0x74,0x53,0x69,0x6E,0x65,0x00,0x6F,0x75,0x74,0x4C,0x65,0x61,0x64,0x53,0x69,0x6E,0x65,0x00,0x48,0x54
+,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4C,0x49,0x4E,0x45,0x00,0x48,0x74,0x54,0x72,0x65,0x6E,0x64,0x6C,0x69
+,0x6E,0x65,0x00,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D
+,0x20,0x2D,0x20,0x49,0x6E,0x73,0x74,0x61,0x6E,0x74,0x61,0x6E,0x65,0x6F,0x75,0x73,0x20,0x54,0x72,0x65
+,0x6E,0x64,0x6C,0x69,0x6E,0x65,0x00,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4D,0x4F,0x44,0x45,0x00
+,0x48,0x74,0x54,0x72,0x65,0x6E,0x64,0x4D,0x6F,0x64,0x65,0x00,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20
+,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x54,0x72,0x65,0x6E,0x64,0x20,0x76,0x73
+,0x20,0x43,0x79,0x63,0x6C,0x65,0x20,0x4D,0x6F,0x64,0x65,0x00,0x6F,0x75,0x74,0x49,0x6E,0x74,0x65,0x67
+,0x65,0x72,0x00,0x49,0x4D,0x49,0x00,0x49,0x6D,0x69,0x00,0x49,0x6E,0x74,0x72,0x61,0x64,0x61,0x79,0x20
+,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x69,0x6E,0x50,0x72,0x69
+,0x63,0x65,0x4F,0x43,0x00,0x4A,0x4D,0x41,0x00,0x4A,0x6D,0x61,0x00,0x4A,0x75,0x72,0x69,0x6B,0x20,0x4D
+,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x50,0x65,0x72,0x69,0x6F,0x64
+,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x6D,0x6F,0x76,0x69
+,0x6E,0x67,0x20,0x61,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x6F,0x70,0x74,0x49,0x6E,0x50,0x68,0x61,0x73
+,0x65,0x00,0x50,0x68,0x61,0x73,0x65,0x00,0x50,0x68,0x61,0x73,0x65,0x20,0x70,0x61,0x72,0x61,0x6D,0x65
+,0x74,0x65,0x72,0x20,0x28,0x74,0x79,0x70,0x69,0x63,0x61,0x6C,0x6C,0x79,0x20,0x30,0x2D,0x31,0x30,0x30
+,0x29,0x2E,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x68,0x61,0x73
+,0x65,0x20,0x72,0x61,0x74,0x69,0x6F,0x00,0x6F,0x70,0x74,0x49,0x6E,0x56,0x6F,0x6C,0x50,0x65,0x72,0x69
+,0x6F,0x64,0x73,0x00,0x56,0x6F,0x6C,0x61,0x74,0x69,0x6C,0x69,0x74,0x79,0x20,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x73,0x00,0x50,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x61,0x76,0x65,0x72,0x61,0x67
+,0x65,0x20,0x76,0x6F,0x6C,0x61,0x74,0x69,0x6C,0x69,0x74,0x79,0x20,0x63,0x61,0x6C,0x63,0x75,0x6C,0x61
+,0x74,0x69,0x6F,0x6E,0x00,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x4A,0x4D,0x41,0x00,0x4B,0x61,0x6D,0x61
+,0x00,0x4B,0x61,0x75,0x66,0x6D,0x61,0x6E,0x20,0x41,0x64,0x61,0x70,0x74,0x69,0x76,0x65,0x20,0x4D,0x6F
+,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52
+,0x45,0x47,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20
+,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x00,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47
+,0x5F,0x41,0x4E,0x47,0x4C,0x45,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x41,0x6E,0x67,0x6C
+,0x65,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x20
+,0x41,0x6E,0x67,0x6C,0x65,0x00,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x49,0x4E,0x54,0x45
+,0x52,0x43,0x45,0x50,0x54,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x49,0x6E,0x74,0x65,0x72
+,0x63,0x65,0x70,0x74,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69
+,0x6F,0x6E,0x20,0x49,0x6E,0x74,0x65,0x72,0x63,0x65,0x70,0x74,0x00,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52
+,0x45,0x47,0x5F,0x53,0x4C,0x4F,0x50,0x45,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x53,0x6C
+,0x6F,0x70,0x65,0x00,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F
+,0x6E,0x20,0x53,0x6C,0x6F,0x70,0x65,0x00,0x4C,0x4E,0x00,0x4C,0x6E,0x00,0x56,0x65,0x63,0x74,0x6F,0x72
+,0x20,0x4C,0x6F,0x67,0x20,0x4E,0x61,0x74,0x75,0x72,0x61,0x6C,0x00,0x4C,0x4F,0x47,0x31,0x30,0x00,0x4C
+,0x6F,0x67,0x31,0x30,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x4C,0x6F,0x67,0x31,0x30,0x00,0x4D,0x41
+,0x00,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x4D,0x6F,0x76,0x69,0x6E
+,0x67,0x20,0x61,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x4D,0x41,0x43,0x44,0x00,0x4D,0x61,0x63,0x64,0x00
+,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x43,0x6F,0x6E,0x76,0x65
+,0x72,0x67,0x65,0x6E,0x63,0x65,0x2F,0x44,0x69,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x00,0x6F,0x70
+,0x74,0x49,0x6E,0x53,0x69,0x67,0x6E,0x61,0x6C,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x53,0x69,0x67,0x6E
+,0x61,0x6C,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20
+,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65,0x20
+,0x28,0x6E,0x62,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x29,0x00,0x6F,0x75,0x74,0x4D,0x41
+,0x43,0x44,0x00,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53,0x69,0x67,0x6E,0x61,0x6C,0x00,0x6F,0x75,0x74
+,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74,0x00,0x4D,0x41,0x43,0x44,0x45,0x58,0x54,0x00,0x4D,0x61,0x63
+,0x64,0x45,0x78,0x74,0x00,0x4D,0x41,0x43,0x44,0x20,0x77,0x69,0x74,0x68,0x20,0x63,0x6F,0x6E,0x74,0x72
+,0x6F,0x6C,0x6C,0x61,0x62,0x6C,0x65,0x20,0x4D,0x41,0x20,0x74,0x79,0x70,0x65,0x00,0x6F,0x70,0x74,0x49
+,0x6E,0x46,0x61,0x73,0x74,0x4D,0x41,0x54,0x79,0x70,0x65,0x00,0x46,0x61,0x73,0x74,0x20,0x4D,0x41,0x00
+,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61
+,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x00,0x6F,0x70,0x74,0x49,0x6E
+,0x53,0x6C,0x6F,0x77,0x4D,0x41,0x54,0x79,0x70,0x65,0x00,0x53,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x00,0x54
+,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67
+,0x65,0x20,0x66,0x6F,0x72,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53
+,0x69,0x67,0x6E,0x61,0x6C,0x4D,0x41,0x54,0x79,0x70,0x65,0x00,0x53,0x69,0x67,0x6E,0x61,0x6C,0x20,0x4D
+,0x41,0x00,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65
+,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65
+,0x00,0x4D,0x41,0x43,0x44,0x46,0x49,0x58,0x00,0x4D,0x61,0x63,0x64,0x46,0x69,0x78,0x00,0x4D,0x6F,0x76
+,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x43,0x6F,0x6E,0x76,0x65,0x72,0x67,0x65
+,0x6E,0x63,0x65,0x2F,0x44,0x69,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x20,0x46,0x69,0x78,0x20,0x31
+,0x32,0x2F,0x32,0x36,0x00,0x4D,0x61,0x6D,0x61,0x00,0x4D,0x45,0x53,0x41,0x20,0x41,0x64,0x61,0x70,0x74
+,0x69,0x76,0x65,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x6F
+,0x70,0x74,0x49,0x6E,0x46,0x61,0x73,0x74,0x4C,0x69,0x6D,0x69,0x74,0x00,0x46,0x61,0x73,0x74,0x20,0x4C
+,0x69,0x6D,0x69,0x74,0x00,0x55,0x70,0x70,0x65,0x72,0x20,0x6C,0x69,0x6D,0x69,0x74,0x20,0x75,0x73,0x65
+,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x61,0x70,0x74,0x69,0x76,0x65,0x20,0x61,0x6C,0x67
+,0x6F,0x72,0x69,0x74,0x68,0x6D,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53,0x6C,0x6F,0x77,0x4C,0x69,0x6D,0x69
+,0x74,0x00,0x53,0x6C,0x6F,0x77,0x20,0x4C,0x69,0x6D,0x69,0x74,0x00,0x4C,0x6F,0x77,0x65,0x72,0x20,0x6C
+,0x69,0x6D,0x69,0x74,0x20,0x75,0x73,0x65,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x61,0x70
+,0x74,0x69,0x76,0x65,0x20,0x61,0x6C,0x67,0x6F,0x72,0x69,0x74,0x68,0x6D,0x00,0x6F,0x75,0x74,0x4D,0x41
+,0x4D,0x41,0x00,0x6F,0x75,0x74,0x46,0x41,0x4D,0x41,0x00,0x4D,0x41,0x56,0x50,0x00,0x4D,0x6F,0x76,0x69
+,0x6E,0x67,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x56,0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x50,0x65,0x72
+,0x69,0x6F,0x64,0x00,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x61,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x77
+,0x69,0x74,0x68,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00
+,0x69,0x6E,0x50,0x65,0x72,0x69,0x6F,0x64,0x73,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4D,0x69,0x6E,0x50,0x65
+,0x72,0x69,0x6F,0x64,0x00,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00
+,0x56,0x61,0x6C,0x75,0x65,0x20,0x6C,0x65,0x73,0x73,0x20,0x74,0x68,0x61,0x6E,0x20,0x6D,0x69,0x6E,0x69
+,0x6D,0x75,0x6D,0x20,0x77,0x69,0x6C,0x6C,0x20,0x62,0x65,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x64,0x20
+,0x74,0x6F,0x20,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x6F,0x70
+,0x74,0x49,0x6E,0x4D,0x61,0x78,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x56,0x61,0x6C,0x75,0x65,0x20,0x68,0x69,0x67,0x68,0x65,0x72
+,0x20,0x74,0x68,0x61,0x6E,0x20,0x6D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x77,0x69,0x6C,0x6C,0x20,0x62
+,0x65,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D,0x41,0x58,0x00,0x4D,0x61,0x78,0x00,0x48,0x69,0x67,0x68
+,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65
+,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D,0x41,0x58,0x49,0x4E,0x44
+,0x45,0x58,0x00,0x4D,0x61,0x78,0x49,0x6E,0x64,0x65,0x78,0x00,0x49,0x6E,0x64,0x65,0x78,0x20,0x6F,0x66
+,0x20,0x68,0x69,0x67,0x68,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20
+,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D
+,0x45,0x44,0x50,0x52,0x49,0x43,0x45,0x00,0x4D,0x65,0x64,0x50,0x72,0x69,0x63,0x65,0x00,0x4D,0x65,0x64
+,0x69,0x61,0x6E,0x20,0x50,0x72,0x69,0x63,0x65,0x00,0x4D,0x46,0x49,0x00,0x4D,0x66,0x69,0x00,0x4D,0x6F
+,0x6E,0x65,0x79,0x20,0x46,0x6C,0x6F,0x77,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x4D,0x49,0x44,0x50,0x4F
+,0x49,0x4E,0x54,0x00,0x4D,0x69,0x64,0x50,0x6F,0x69,0x6E,0x74,0x00,0x4D,0x69,0x64,0x50,0x6F,0x69,0x6E
+,0x74,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D,0x49,0x44,0x50,0x52,0x49
+,0x43,0x45,0x00,0x4D,0x69,0x64,0x50,0x72,0x69,0x63,0x65,0x00,0x4D,0x69,0x64,0x70,0x6F,0x69,0x6E,0x74
+,0x20,0x50,0x72,0x69,0x63,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D
+,0x49,0x4E,0x00,0x4D,0x69,0x6E,0x00,0x4C,0x6F,0x77,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20
+,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72
+,0x69,0x6F,0x64,0x00,0x4D,0x49,0x4E,0x49,0x4E,0x44,0x45,0x58,0x00,0x4D,0x69,0x6E,0x49,0x6E,0x64,0x65
+,0x78,0x00,0x49,0x6E,0x64,0x65,0x78,0x20,0x6F,0x66,0x20,0x6C,0x6F,0x77,0x65,0x73,0x74,0x20,0x76,0x61
+,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x00,0x4D,0x69,0x6E,0x4D,0x61
+,0x78,0x00,0x4C,0x6F,0x77,0x65,0x73,0x74,0x20,0x61,0x6E,0x64,0x20,0x68,0x69,0x67,0x68,0x65,0x73,0x74
+,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69
+,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x6F,0x75,0x74,0x4D,0x69,0x6E,0x00,0x6F
+,0x75,0x74,0x4D,0x61,0x78,0x00,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x00,0x4D,0x69
+,0x6E,0x4D,0x61,0x78,0x49,0x6E,0x64,0x65,0x78,0x00,0x49,0x6E,0x64,0x65,0x78,0x65,0x73,0x20,0x6F,0x66
+,0x20,0x6C,0x6F,0x77,0x65,0x73,0x74,0x20,0x61,0x6E,0x64,0x20,0x68,0x69,0x67,0x68,0x65,0x73,0x74,0x20
+,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66
+,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00,0x6F,0x75,0x74,0x4D,0x69,0x6E,0x49,0x64,0x78
+,0x00,0x6F,0x75,0x74,0x4D,0x61,0x78,0x49,0x64,0x78,0x00,0x4D,0x49,0x4E,0x55,0x53,0x5F,0x44,0x49,0x00
+,0x4D,0x69,0x6E,0x75,0x73,0x44,0x49,0x00,0x4D,0x69,0x6E,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x00,0x4D,0x49,0x4E,0x55
+,0x53,0x5F,0x44,0x4D,0x00,0x4D,0x69,0x6E,0x75,0x73,0x44,0x4D,0x00,0x4D,0x69,0x6E,0x75,0x73,0x20,0x44
+,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x00
+,0x4D,0x4F,0x4D,0x00,0x4D,0x6F,0x6D,0x00,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x00,0x4D,0x55,0x4C
+,0x54,0x00,0x4D,0x75,0x6C,0x74,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D
+,0x65,0x74,0x69,0x63,0x20,0x4D,0x75,0x6C,0x74,0x00,0x4E,0x41,0x54,0x52,0x00,0x4E,0x61,0x74,0x72,0x00
+,0x4E,0x6F,0x72,0x6D,0x61,0x6C,0x69,0x7A,0x65,0x64,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x54
+,0x72,0x75,0x65,0x20,0x52,0x61,0x6E,0x67,0x65,0x00,0x4F,0x42,0x56,0x00,0x4F,0x62,0x76,0x00,0x4F,0x6E
+,0x20,0x42,0x61,0x6C,0x61,0x6E,0x63,0x65,0x20,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x00,0x69,0x6E,0x50,0x72
+,0x69,0x63,0x65,0x56,0x00,0x50,0x4C,0x55,0x53,0x5F,0x44,0x49,0x00,0x50,0x6C,0x75,0x73,0x44,0x49,0x00
+,0x50,0x6C,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x49,0x6E,0x64
+,0x69,0x63,0x61,0x74,0x6F,0x72,0x00,0x50,0x4C,0x55,0x53,0x5F,0x44,0x4D,0x00,0x50,0x6C,0x75,0x73,0x44
+,0x4D,0x00,0x50,0x6C,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D
+,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x00,0x50,0x50,0x4F,0x00,0x50,0x70,0x6F,0x00,0x50,0x65,0x72,0x63
+,0x65,0x6E,0x74,0x61,0x67,0x65,0x20,0x50,0x72,0x69,0x63,0x65,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61
+,0x74,0x6F,0x72,0x00,0x52,0x4F,0x43,0x00,0x52,0x6F,0x63,0x00,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20
+,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x3A,0x20,0x28,0x28,0x70,0x72,0x69,0x63,0x65,0x2F,0x70,0x72,0x65
+,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2D,0x31,0x29,0x2A,0x31,0x30,0x30,0x00,0x52,0x4F,0x43,0x50,0x00
+,0x52,0x6F,0x63,0x50,0x00,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20
+,0x50,0x65,0x72,0x63,0x65,0x6E,0x74,0x61,0x67,0x65,0x3A,0x20,0x28,0x70,0x72,0x69,0x63,0x65,0x2D,0x70
+,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x00
+,0x52,0x4F,0x43,0x52,0x00,0x52,0x6F,0x63,0x52,0x00,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20,0x63,0x68
+,0x61,0x6E,0x67,0x65,0x20,0x72,0x61,0x74,0x69,0x6F,0x3A,0x20,0x28,0x70,0x72,0x69,0x63,0x65,0x2F,0x70
+,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x00,0x52,0x4F,0x43,0x52,0x31,0x30,0x30,0x00,0x52,0x6F
+,0x63,0x52,0x31,0x30,0x30,0x00,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65
+,0x20,0x72,0x61,0x74,0x69,0x6F,0x20,0x31,0x30,0x30,0x20,0x73,0x63,0x61,0x6C,0x65,0x3A,0x20,0x28,0x70
+,0x72,0x69,0x63,0x65,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2A,0x31,0x30,0x30,0x00
+,0x52,0x53,0x49,0x00,0x52,0x73,0x69,0x00,0x52,0x65,0x6C,0x61,0x74,0x69,0x76,0x65,0x20,0x53,0x74,0x72
+,0x65,0x6E,0x67,0x74,0x68,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x53,0x41,0x52,0x00,0x53,0x61,0x72,0x00
+,0x50,0x61,0x72,0x61,0x62,0x6F,0x6C,0x69,0x63,0x20,0x53,0x41,0x52,0x00,0x6F,0x70,0x74,0x49,0x6E,0x41
+,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61
+,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61
+,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x75,0x73,0x65,0x64,0x20,0x75,0x70,0x20
+,0x74,0x6F,0x20,0x74,0x68,0x65,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65
+,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x00,0x41,0x46,0x20,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61
+,0x63,0x74,0x6F,0x72,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x00,0x53
+,0x41,0x52,0x45,0x58,0x54,0x00,0x53,0x61,0x72,0x45,0x78,0x74,0x00,0x50,0x61,0x72,0x61,0x62,0x6F,0x6C
+,0x69,0x63,0x20,0x53,0x41,0x52,0x20,0x2D,0x20,0x45,0x78,0x74,0x65,0x6E,0x64,0x65,0x64,0x00,0x6F,0x70
+,0x74,0x49,0x6E,0x53,0x74,0x61,0x72,0x74,0x56,0x61,0x6C,0x75,0x65,0x00,0x53,0x74,0x61,0x72,0x74,0x20
+,0x56,0x61,0x6C,0x75,0x65,0x00,0x53,0x74,0x61,0x72,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x61,0x6E
+,0x64,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x2E,0x20,0x30,0x20,0x66,0x6F,0x72,0x20,0x41
+,0x75,0x74,0x6F,0x2C,0x20,0x3E,0x30,0x20,0x66,0x6F,0x72,0x20,0x4C,0x6F,0x6E,0x67,0x2C,0x20,0x3C,0x30
+,0x20,0x66,0x6F,0x72,0x20,0x53,0x68,0x6F,0x72,0x74,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4F,0x66,0x66,0x73
+,0x65,0x74,0x4F,0x6E,0x52,0x65,0x76,0x65,0x72,0x73,0x65,0x00,0x4F,0x66,0x66,0x73,0x65,0x74,0x20,0x6F
+,0x6E,0x20,0x52,0x65,0x76,0x65,0x72,0x73,0x65,0x00,0x50,0x65,0x72,0x63,0x65,0x6E,0x74,0x20,0x6F,0x66
+,0x66,0x73,0x65,0x74,0x20,0x61,0x64,0x64,0x65,0x64,0x2F,0x72,0x65,0x6D,0x6F,0x76,0x65,0x64,0x20,0x74
+,0x6F,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x6C,0x20,0x73,0x74,0x6F,0x70,0x20,0x6F,0x6E,0x20,0x73,0x68
+,0x6F,0x72,0x74,0x2F,0x6C,0x6F,0x6E,0x67,0x20,0x72,0x65,0x76,0x65,0x72,0x73,0x61,0x6C,0x00,0x6F,0x70
+,0x74,0x49,0x6E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x49,0x6E,0x69,0x74,0x4C
+,0x6F,0x6E,0x67,0x00,0x41,0x46,0x20,0x49,0x6E,0x69,0x74,0x20,0x4C,0x6F,0x6E,0x67,0x00,0x41,0x63,0x63
+,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x69,0x6E,0x69
+,0x74,0x69,0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x4C
+,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x00,0x6F,0x70,0x74,0x49,0x6E,0x41
+,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x4C,0x6F,0x6E,0x67,0x00,0x41,0x46,0x20,0x4C
+,0x6F,0x6E,0x67,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63
+,0x74,0x6F,0x72,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72
+,0x65,0x63,0x74,0x69,0x6F,0x6E,0x00,0x6F,0x70,0x74,0x49,0x6E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61
+,0x74,0x69,0x6F,0x6E,0x4D,0x61,0x78,0x4C,0x6F,0x6E,0x67,0x00,0x41,0x46,0x20,0x4D,0x61,0x78,0x20,0x4C
+,0x6F,0x6E,0x67,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63
+,0x74,0x6F,0x72,0x20,0x6D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F
+,0x72,0x20,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E
+,0x00,0x6F,0x70,0x74,0x49,0x6E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x49,0x6E
+,0x69,0x74,0x53,0x68,0x6F,0x72,0x74,0x00,0x41,0x46,0x20,0x49,0x6E,0x69,0x74,0x20,0x53,0x68,0x6F,0x72
+,0x74,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F
+,0x72,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20
+,0x74,0x68,0x65,0x20,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x00
+,0x6F,0x70,0x74,0x49,0x6E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x53,0x68,0x6F
+,0x72,0x74,0x00,0x41,0x46,0x20,0x53,0x68,0x6F,0x72,0x74,0x00,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61
+,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20
+,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x00,0x6F,0x70,0x74,0x49
+,0x6E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x4D,0x61,0x78,0x53,0x68,0x6F,0x72
+,0x74,0x00,0x41,0x46,0x20,0x4D,0x61,0x78,0x20,0x53,0x68,0x6F,0x72,0x74,0x00,0x41,0x63,0x63,0x65,0x6C
+,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x6D,0x61,0x78,0x69,0x6D
+,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x68,0x6F
+,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x00,0x53,0x49,0x4E,0x00,0x53,0x69,0x6E
+,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69
+,0x63,0x20,0x53,0x69,0x6E,0x00,0x53,0x49,0x4E,0x48,0x00,0x53,0x69,0x6E,0x68,0x00,0x56,0x65,0x63,0x74
+,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x53,0x69,0x6E
+,0x68,0x00,0x53,0x6D,0x61,0x00,0x53,0x69,0x6D,0x70,0x6C,0x65,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20
+,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x00,0x53,0x51,0x52,0x54,0x00,0x53,0x71,0x72,0x74,0x00,0x56,0x65
+,0x63,0x74,0x6F,0x72,0x20,0x53,0x71,0x75,0x61,0x72,0x65,0x20,0x52,0x6F,0x6F,0x74,0x00,0x53,0x54,0x44
+,0x44,0x45,0x56,0x00,0x53,0x74,0x64,0x44,0x65,0x76,0x00,0x53,0x74,0x61,0x6E,0x64,0x61,0x72,0x64,0x20
+,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x00,0x6F,0x70,0x74,0x49,0x6E,0x4E,0x62,0x44,0x65,0x76
+,0x00,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x00,0x4E,0x62,0x20,0x6F,0x66,0x20,0x64,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x00,0x53,0x54,0x4F,0x43,0x48,0x00,0x53,0x74,0x6F,0x63,0x68
+,0x00,0x53,0x74,0x6F,0x63,0x68,0x61,0x73,0x74,0x69,0x63,0x00,0x6F,0x70,0x74,0x49,0x6E,0x46,0x61,0x73
+,0x74,0x4B,0x5F,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20,0x50,0x65,0x72
+,0x69,0x6F,0x64,0x00,0x54,0x69,0x6D,0x65,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20
+,0x62,0x75,0x69,0x6C,0x64,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20
+,0x6C,0x69,0x6E,0x65,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53,0x6C,0x6F,0x77,0x4B,0x5F,0x50,0x65,0x72,0x69
+,0x6F,0x64,0x00,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x53,0x6D,0x6F
+,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68
+,0x65,0x20,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x6C,0x69,0x6E,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C
+,0x6C,0x79,0x20,0x73,0x65,0x74,0x20,0x74,0x6F,0x20,0x33,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53,0x6C,0x6F
+,0x77,0x4B,0x5F,0x4D,0x41,0x54,0x79,0x70,0x65,0x00,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x4D,0x41,0x00
+,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61
+,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53
+,0x6C,0x6F,0x77,0x44,0x5F,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x00,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20
+,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20,0x6C,0x69
+,0x6E,0x65,0x00,0x6F,0x70,0x74,0x49,0x6E,0x53,0x6C,0x6F,0x77,0x44,0x5F,0x4D,0x41,0x54,0x79,0x70,0x65
+,0x00,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20,0x4D,0x41,0x00,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D
+,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x53,0x6C
+,0x6F,0x77,0x2D,0x44,0x00,0x6F,0x75,0x74,0x53,0x6C,0x6F,0x77,0x4B,0x00,0x6F,0x75,0x74,0x53,0x6C,0x6F
+,0x77,0x44,0x00,0x53,0x54,0x4F,0x43,0x48,0x46,0x00,0x53,0x74,0x6F,0x63,0x68,0x46,0x00,0x53,0x74,0x6F
+,0x63,0x68,0x61,0x73,0x74,0x69,0x63,0x20,0x46,0x61,0x73,0x74,0x00,0x6F,0x70,0x74,0x49,0x6E,0x46,0x61
+,0x73,0x74,0x44,0x5F,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x50,0x65
+,0x72,0x69,0x6F,0x64,0x00,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x6D
+,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x6C,0x69,0x6E
+,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74,0x20,0x74,0x6F,0x20,0x33,0x00
+,0x6F,0x70,0x74,0x49,0x6E,0x46,0x61,0x73,0x74,0x44,0x5F,0x4D,0x41,0x54,0x79,0x70,0x65,0x00,0x46,0x61
+,0x73,0x74,0x2D,0x44,0x20,0x4D,0x41,0x00,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69
+,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x46,0x61,0x73,0x74,0x2D
+,0x44,0x00,0x6F,0x75,0x74,0x46,0x61,0x73,0x74,0x4B,0x00,0x6F,0x75,0x74,0x46,0x61,0x73,0x74,0x44,0x00
+,0x53,0x54,0x4F,0x43,0x48,0x52,0x53,0x49,0x00,0x53,0x74,0x6F,0x63,0x68,0x52,0x73,0x69,0x00,0x53,0x74
+,0x6F,0x63,0x68,0x61,0x73,0x74,0x69,0x63,0x20,0x52,0x65,0x6C,0x61,0x74,0x69,0x76,0x65,0x20,0x53,0x74
+,0x72,0x65,0x6E,0x67,0x74,0x68,0x20,0x49,0x6E,0x64,0x65,0x78,0x00,0x53,0x55,0x42,0x00,0x53,0x75,0x62
+,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x53
+,0x75,0x62,0x74,0x72,0x61,0x63,0x74,0x69,0x6F,0x6E,0x00,0x53,0x55,0x4D,0x00,0x53,0x75,0x6D,0x00,0x53
+,0x75,0x6D,0x6D,0x61,0x74,0x69,0x6F,0x6E,0x00,0x54,0x72,0x69,0x70,0x6C,0x65,0x20,0x45,0x78,0x70,0x6F
+,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61
+,0x67,0x65,0x20,0x28,0x54,0x33,0x29,0x00,0x6F,0x70,0x74,0x49,0x6E,0x56,0x46,0x61,0x63,0x74,0x6F,0x72
+,0x00,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x00,0x54,0x41,0x4E,0x00,0x54
+,0x61,0x6E,0x00,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74
+,0x72,0x69,0x63,0x20,0x54,0x61,0x6E,0x00,0x54,0x41,0x4E,0x48,0x00,0x54,0x61,0x6E,0x68,0x00,0x56,0x65
+,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x54
+,0x61,0x6E,0x68,0x00,0x54,0x65,0x6D,0x61,0x00,0x54,0x72,0x69,0x70,0x6C,0x65,0x20,0x45,0x78,0x70,0x6F
+,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61
+,0x67,0x65,0x00,0x54,0x52,0x41,0x4E,0x47,0x45,0x00,0x54,0x72,0x75,0x65,0x52,0x61,0x6E,0x67,0x65,0x00
+,0x54,0x72,0x75,0x65,0x20,0x52,0x61,0x6E,0x67,0x65,0x00,0x54,0x72,0x69,0x6D,0x61,0x00,0x54,0x72,0x69
+,0x61,0x6E,0x67,0x75,0x6C,0x61,0x72,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61
+,0x67,0x65,0x00,0x54,0x52,0x49,0x58,0x00,0x54,0x72,0x69,0x78,0x00,0x31,0x2D,0x64,0x61,0x79,0x20,0x52
+,0x61,0x74,0x65,0x2D,0x4F,0x66,0x2D,0x43,0x68,0x61,0x6E,0x67,0x65,0x20,0x28,0x52,0x4F,0x43,0x29,0x20
+,0x6F,0x66,0x20,0x61,0x20,0x54,0x72,0x69,0x70,0x6C,0x65,0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x20,0x45
+,0x4D,0x41,0x00,0x54,0x53,0x46,0x00,0x54,0x73,0x66,0x00,0x54,0x69,0x6D,0x65,0x20,0x53,0x65,0x72,0x69
+,0x65,0x73,0x20,0x46,0x6F,0x72,0x65,0x63,0x61,0x73,0x74,0x00,0x54,0x59,0x50,0x50,0x52,0x49,0x43,0x45
+,0x00,0x54,0x79,0x70,0x50,0x72,0x69,0x63,0x65,0x00,0x54,0x79,0x70,0x69,0x63,0x61,0x6C,0x20,0x50,0x72
+,0x69,0x63,0x65,0x00,0x55,0x4C,0x54,0x4F,0x53,0x43,0x00,0x55,0x6C,0x74,0x4F,0x73,0x63,0x00,0x55,0x6C
+,0x74,0x69,0x6D,0x61,0x74,0x65,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74,0x6F,0x72,0x00,0x6F,0x70
+,0x74,0x49,0x6E,0x54,0x69,0x6D,0x65,0x50,0x65,0x72,0x69,0x6F,0x64,0x31,0x00,0x46,0x69,0x72,0x73,0x74
+,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61
+,0x72,0x73,0x20,0x66,0x6F,0x72,0x20,0x31,0x73,0x74,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x2E,0x00,0x6F
+,0x70,0x74,0x49,0x6E,0x54,0x69,0x6D,0x65,0x50,0x65,0x72,0x69,0x6F,0x64,0x32,0x00,0x53,0x65,0x63,0x6F
+,0x6E,0x64,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20
+,0x62,0x61,0x72,0x73,0x20,0x66,0x72,0x6F,0x20,0x32,0x6E,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00
+,0x6F,0x70,0x74,0x49,0x6E,0x54,0x69,0x6D,0x65,0x50,0x65,0x72,0x69,0x6F,0x64,0x33,0x00,0x54,0x68,0x69
+,0x72,0x64,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x00,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20
+,0x62,0x61,0x72,0x73,0x20,0x66,0x6F,0x72,0x20,0x33,0x72,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x00
+,0x56,0x41,0x52,0x00,0x56,0x61,0x72,0x69,0x61,0x6E,0x63,0x65,0x00,0x57,0x43,0x4C,0x50,0x52,0x49,0x43
+,0x45,0x00,0x57,0x63,0x6C,0x50,0x72,0x69,0x63,0x65,0x00,0x57,0x65,0x69,0x67,0x68,0x74,0x65,0x64,0x20
+,0x43,0x6C,0x6F,0x73,0x65,0x20,0x50,0x72,0x69,0x63,0x65,0x00,0x57,0x49,0x4C,0x4C,0x52,0x00,0x57,0x69
+,0x6C,0x6C,0x52,0x00,0x57,0x69,0x6C,0x6C,0x69,0x61,0x6D,0x73,0x27,0x20,0x25,0x52,0x00,0x57,0x6D,0x61
+,0x00,0x57,0x65,0x69,0x67,0x68,0x74,0x65,0x64,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65
+,0x72,0x61,0x67,0x65,0x00,0x00,0x00,0x00
+}
+};
+
+const TA_MetaHeader *TA_MetaGet( void )
+{
+   const TA_MetaHeader *header;
+
+   if( TA_MetaCheck( TA_FuncMetaArray.byte, sizeof(TA_FuncMetaArray.byte), &header ) != TA_SUCCESS )
+      return NULL;
+
+   return header;
+}
+
+/***************/
+/* End of File */
+/***************/
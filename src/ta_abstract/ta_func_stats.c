@@ -0,0 +1,5691 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Note: This file is generated by gencode, do not
+ *       modify directly.
+ */
+
+/* When TA-Lib is built with TA_STATS or TA_TRACE, the kernels of the
+ * TA functions are renamed TA_XXX_Kernel and TA_S_XXX_Kernel, and the
+ * TA_XXX and TA_S_XXX functions are these wrappers measuring and
+ * tracing each call (see "ta_stats.h" and "ta_trace.h").
+ */
+
+#if defined( TA_STATS ) || defined( TA_TRACE )
+
+#ifndef TA_FUNC_H
+   #include "ta_func.h"
+#endif
+
+#ifndef TA_STATS_PRIV_H
+   #include "ta_stats_priv.h"
+#endif
+
+
+TA_LIB_API TA_RetCode TA_ACCBANDS_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         const double  inClose[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outRealUpperBand[],
+                                         double        outRealMiddleBand[],
+                                         double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_ACCBANDS( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outRealUpperBand[],
+                                  double        outRealMiddleBand[],
+                                  double        outRealLowerBand[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 0, startIdx, endIdx );
+   retCode = TA_ACCBANDS_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ACCBANDS_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           const float   inClose[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outRealUpperBand[],
+                                           double        outRealMiddleBand[],
+                                           double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_S_ACCBANDS( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    const float   inClose[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outRealUpperBand[],
+                                    double        outRealMiddleBand[],
+                                    double        outRealLowerBand[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 0, startIdx, endIdx );
+   retCode = TA_S_ACCBANDS_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ACOS_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ACOS( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 1, startIdx, endIdx );
+   retCode = TA_ACOS_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ACOS_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ACOS( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 1, startIdx, endIdx );
+   retCode = TA_S_ACOS_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_AD_Kernel( int           startIdx,
+                                   int           endIdx,
+                                   const double  inHigh[],
+                                   const double  inLow[],
+                                   const double  inClose[],
+                                   const double  inVolume[],
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AD( int           startIdx,
+                            int           endIdx,
+                            const double  inHigh[],
+                            const double  inLow[],
+                            const double  inClose[],
+                            const double  inVolume[],
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 2, startIdx, endIdx );
+   retCode = TA_AD_Kernel( startIdx, endIdx, inHigh, inLow, inClose, inVolume, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_AD_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const float   inHigh[],
+                                     const float   inLow[],
+                                     const float   inClose[],
+                                     const float   inVolume[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_AD( int           startIdx,
+                              int           endIdx,
+                              const float   inHigh[],
+                              const float   inLow[],
+                              const float   inClose[],
+                              const float   inVolume[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 2, startIdx, endIdx );
+   retCode = TA_S_AD_Kernel( startIdx, endIdx, inHigh, inLow, inClose, inVolume, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ADD_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal0[],
+                                    const double  inReal1[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADD( int           startIdx,
+                             int           endIdx,
+                             const double  inReal0[],
+                             const double  inReal1[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 3, startIdx, endIdx );
+   retCode = TA_ADD_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ADD_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal0[],
+                                      const float   inReal1[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ADD( int           startIdx,
+                               int           endIdx,
+                               const float   inReal0[],
+                               const float   inReal1[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 3, startIdx, endIdx );
+   retCode = TA_S_ADD_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ADOSC_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      const double  inVolume[],
+                                      int           optInFastPeriod,
+                                      int           optInSlowPeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADOSC( int           startIdx,
+                               int           endIdx,
+                               const double  inHigh[],
+                               const double  inLow[],
+                               const double  inClose[],
+                               const double  inVolume[],
+                               int           optInFastPeriod,
+                               int           optInSlowPeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 4, startIdx, endIdx );
+   retCode = TA_ADOSC_Kernel( startIdx, endIdx, inHigh, inLow, inClose, inVolume, optInFastPeriod, optInSlowPeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ADOSC_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inHigh[],
+                                        const float   inLow[],
+                                        const float   inClose[],
+                                        const float   inVolume[],
+                                        int           optInFastPeriod,
+                                        int           optInSlowPeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ADOSC( int           startIdx,
+                                 int           endIdx,
+                                 const float   inHigh[],
+                                 const float   inLow[],
+                                 const float   inClose[],
+                                 const float   inVolume[],
+                                 int           optInFastPeriod,
+                                 int           optInSlowPeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 4, startIdx, endIdx );
+   retCode = TA_S_ADOSC_Kernel( startIdx, endIdx, inHigh, inLow, inClose, inVolume, optInFastPeriod, optInSlowPeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ADX_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADX( int           startIdx,
+                             int           endIdx,
+                             const double  inHigh[],
+                             const double  inLow[],
+                             const double  inClose[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 5, startIdx, endIdx );
+   retCode = TA_ADX_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ADX_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inHigh[],
+                                      const float   inLow[],
+                                      const float   inClose[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ADX( int           startIdx,
+                               int           endIdx,
+                               const float   inHigh[],
+                               const float   inLow[],
+                               const float   inClose[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 5, startIdx, endIdx );
+   retCode = TA_S_ADX_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ADXR_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inHigh[],
+                                     const double  inLow[],
+                                     const double  inClose[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ADXR( int           startIdx,
+                              int           endIdx,
+                              const double  inHigh[],
+                              const double  inLow[],
+                              const double  inClose[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 6, startIdx, endIdx );
+   retCode = TA_ADXR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ADXR_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inHigh[],
+                                       const float   inLow[],
+                                       const float   inClose[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ADXR( int           startIdx,
+                                int           endIdx,
+                                const float   inHigh[],
+                                const float   inLow[],
+                                const float   inClose[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 6, startIdx, endIdx );
+   retCode = TA_S_ADXR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_APO_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInFastPeriod,
+                                    int           optInSlowPeriod,
+                                    TA_MAType     optInMAType,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_APO( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInFastPeriod,
+                             int           optInSlowPeriod,
+                             TA_MAType     optInMAType,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 7, startIdx, endIdx );
+   retCode = TA_APO_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_APO_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInFastPeriod,
+                                      int           optInSlowPeriod,
+                                      TA_MAType     optInMAType,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_APO( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInFastPeriod,
+                               int           optInSlowPeriod,
+                               TA_MAType     optInMAType,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 7, startIdx, endIdx );
+   retCode = TA_S_APO_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_AROON_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outAroonDown[],
+                                      double        outAroonUp[] );
+
+TA_LIB_API TA_RetCode TA_AROON( int           startIdx,
+                               int           endIdx,
+                               const double  inHigh[],
+                               const double  inLow[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outAroonDown[],
+                               double        outAroonUp[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 8, startIdx, endIdx );
+   retCode = TA_AROON_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outAroonDown, outAroonUp );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_AROON_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inHigh[],
+                                        const float   inLow[],
+                                        int           optInTimePeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outAroonDown[],
+                                        double        outAroonUp[] );
+
+TA_LIB_API TA_RetCode TA_S_AROON( int           startIdx,
+                                 int           endIdx,
+                                 const float   inHigh[],
+                                 const float   inLow[],
+                                 int           optInTimePeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outAroonDown[],
+                                 double        outAroonUp[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 8, startIdx, endIdx );
+   retCode = TA_S_AROON_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outAroonDown, outAroonUp );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_AROONOSC_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AROONOSC( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 9, startIdx, endIdx );
+   retCode = TA_AROONOSC_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_AROONOSC_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_AROONOSC( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 9, startIdx, endIdx );
+   retCode = TA_S_AROONOSC_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ASIN_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ASIN( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 10, startIdx, endIdx );
+   retCode = TA_ASIN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ASIN_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ASIN( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 10, startIdx, endIdx );
+   retCode = TA_S_ASIN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ATAN_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ATAN( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 11, startIdx, endIdx );
+   retCode = TA_ATAN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ATAN_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ATAN( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 11, startIdx, endIdx );
+   retCode = TA_S_ATAN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ATR_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ATR( int           startIdx,
+                             int           endIdx,
+                             const double  inHigh[],
+                             const double  inLow[],
+                             const double  inClose[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 12, startIdx, endIdx );
+   retCode = TA_ATR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ATR_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inHigh[],
+                                      const float   inLow[],
+                                      const float   inClose[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ATR( int           startIdx,
+                               int           endIdx,
+                               const float   inHigh[],
+                               const float   inLow[],
+                               const float   inClose[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 12, startIdx, endIdx );
+   retCode = TA_S_ATR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_AVGDEV_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AVGDEV( int           startIdx,
+                                int           endIdx,
+                                const double  inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 13, startIdx, endIdx );
+   retCode = TA_AVGDEV_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_AVGDEV_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_AVGDEV( int           startIdx,
+                                  int           endIdx,
+                                  const float   inReal[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 13, startIdx, endIdx );
+   retCode = TA_S_AVGDEV_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_AVGPRICE_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inOpen[],
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         const double  inClose[],
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_AVGPRICE( int           startIdx,
+                                  int           endIdx,
+                                  const double  inOpen[],
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 14, startIdx, endIdx );
+   retCode = TA_AVGPRICE_Kernel( startIdx, endIdx, inOpen, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_AVGPRICE_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inOpen[],
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           const float   inClose[],
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_AVGPRICE( int           startIdx,
+                                    int           endIdx,
+                                    const float   inOpen[],
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    const float   inClose[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 14, startIdx, endIdx );
+   retCode = TA_S_AVGPRICE_Kernel( startIdx, endIdx, inOpen, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_BBANDS_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inReal[],
+                                       int           optInTimePeriod,
+                                       double        optInNbDevUp,
+                                       double        optInNbDevDn,
+                                       TA_MAType     optInMAType,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outRealUpperBand[],
+                                       double        outRealMiddleBand[],
+                                       double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_BBANDS( int           startIdx,
+                                int           endIdx,
+                                const double  inReal[],
+                                int           optInTimePeriod,
+                                double        optInNbDevUp,
+                                double        optInNbDevDn,
+                                TA_MAType     optInMAType,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outRealUpperBand[],
+                                double        outRealMiddleBand[],
+                                double        outRealLowerBand[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 15, startIdx, endIdx );
+   retCode = TA_BBANDS_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType, outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_BBANDS_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inReal[],
+                                         int           optInTimePeriod,
+                                         double        optInNbDevUp,
+                                         double        optInNbDevDn,
+                                         TA_MAType     optInMAType,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outRealUpperBand[],
+                                         double        outRealMiddleBand[],
+                                         double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_S_BBANDS( int           startIdx,
+                                  int           endIdx,
+                                  const float   inReal[],
+                                  int           optInTimePeriod,
+                                  double        optInNbDevUp,
+                                  double        optInNbDevDn,
+                                  TA_MAType     optInMAType,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outRealUpperBand[],
+                                  double        outRealMiddleBand[],
+                                  double        outRealLowerBand[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 15, startIdx, endIdx );
+   retCode = TA_S_BBANDS_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType, outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_BETA_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal0[],
+                                     const double  inReal1[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_BETA( int           startIdx,
+                              int           endIdx,
+                              const double  inReal0[],
+                              const double  inReal1[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 16, startIdx, endIdx );
+   retCode = TA_BETA_Kernel( startIdx, endIdx, inReal0, inReal1, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_BETA_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal0[],
+                                       const float   inReal1[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_BETA( int           startIdx,
+                                int           endIdx,
+                                const float   inReal0[],
+                                const float   inReal1[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 16, startIdx, endIdx );
+   retCode = TA_S_BETA_Kernel( startIdx, endIdx, inReal0, inReal1, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_BOP_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inOpen[],
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_BOP( int           startIdx,
+                             int           endIdx,
+                             const double  inOpen[],
+                             const double  inHigh[],
+                             const double  inLow[],
+                             const double  inClose[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 17, startIdx, endIdx );
+   retCode = TA_BOP_Kernel( startIdx, endIdx, inOpen, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_BOP_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inOpen[],
+                                      const float   inHigh[],
+                                      const float   inLow[],
+                                      const float   inClose[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_BOP( int           startIdx,
+                               int           endIdx,
+                               const float   inOpen[],
+                               const float   inHigh[],
+                               const float   inLow[],
+                               const float   inClose[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 17, startIdx, endIdx );
+   retCode = TA_S_BOP_Kernel( startIdx, endIdx, inOpen, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_CCI_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CCI( int           startIdx,
+                             int           endIdx,
+                             const double  inHigh[],
+                             const double  inLow[],
+                             const double  inClose[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 18, startIdx, endIdx );
+   retCode = TA_CCI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_CCI_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inHigh[],
+                                      const float   inLow[],
+                                      const float   inClose[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_CCI( int           startIdx,
+                               int           endIdx,
+                               const float   inHigh[],
+                               const float   inLow[],
+                               const float   inClose[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 18, startIdx, endIdx );
+   retCode = TA_S_CCI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_CEIL_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CEIL( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 19, startIdx, endIdx );
+   retCode = TA_CEIL_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_CEIL_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_CEIL( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 19, startIdx, endIdx );
+   retCode = TA_S_CEIL_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_CMO_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CMO( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 20, startIdx, endIdx );
+   retCode = TA_CMO_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_CMO_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_CMO( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 20, startIdx, endIdx );
+   retCode = TA_S_CMO_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_CORREL_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inReal0[],
+                                       const double  inReal1[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_CORREL( int           startIdx,
+                                int           endIdx,
+                                const double  inReal0[],
+                                const double  inReal1[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 21, startIdx, endIdx );
+   retCode = TA_CORREL_Kernel( startIdx, endIdx, inReal0, inReal1, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_CORREL_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inReal0[],
+                                         const float   inReal1[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_CORREL( int           startIdx,
+                                  int           endIdx,
+                                  const float   inReal0[],
+                                  const float   inReal1[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 21, startIdx, endIdx );
+   retCode = TA_S_CORREL_Kernel( startIdx, endIdx, inReal0, inReal1, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_COS_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_COS( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 22, startIdx, endIdx );
+   retCode = TA_COS_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_COS_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_COS( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 22, startIdx, endIdx );
+   retCode = TA_S_COS_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_COSH_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_COSH( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 23, startIdx, endIdx );
+   retCode = TA_COSH_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_COSH_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_COSH( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 23, startIdx, endIdx );
+   retCode = TA_S_COSH_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_DEMA_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_DEMA( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 24, startIdx, endIdx );
+   retCode = TA_DEMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_DEMA_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_DEMA( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 24, startIdx, endIdx );
+   retCode = TA_S_DEMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_DIV_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal0[],
+                                    const double  inReal1[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_DIV( int           startIdx,
+                             int           endIdx,
+                             const double  inReal0[],
+                             const double  inReal1[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 25, startIdx, endIdx );
+   retCode = TA_DIV_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_DIV_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal0[],
+                                      const float   inReal1[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_DIV( int           startIdx,
+                               int           endIdx,
+                               const float   inReal0[],
+                               const float   inReal1[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 25, startIdx, endIdx );
+   retCode = TA_S_DIV_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_DX_Kernel( int           startIdx,
+                                   int           endIdx,
+                                   const double  inHigh[],
+                                   const double  inLow[],
+                                   const double  inClose[],
+                                   int           optInTimePeriod,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_DX( int           startIdx,
+                            int           endIdx,
+                            const double  inHigh[],
+                            const double  inLow[],
+                            const double  inClose[],
+                            int           optInTimePeriod,
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 26, startIdx, endIdx );
+   retCode = TA_DX_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_DX_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const float   inHigh[],
+                                     const float   inLow[],
+                                     const float   inClose[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_DX( int           startIdx,
+                              int           endIdx,
+                              const float   inHigh[],
+                              const float   inLow[],
+                              const float   inClose[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 26, startIdx, endIdx );
+   retCode = TA_S_DX_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_EMA_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_EMA( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 27, startIdx, endIdx );
+   retCode = TA_EMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_EMA_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_EMA( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 27, startIdx, endIdx );
+   retCode = TA_S_EMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_EXP_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_EXP( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 28, startIdx, endIdx );
+   retCode = TA_EXP_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_EXP_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_EXP( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 28, startIdx, endIdx );
+   retCode = TA_S_EXP_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_FLOOR_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_FLOOR( int           startIdx,
+                               int           endIdx,
+                               const double  inReal[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 29, startIdx, endIdx );
+   retCode = TA_FLOOR_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_FLOOR_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inReal[],
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_FLOOR( int           startIdx,
+                                 int           endIdx,
+                                 const float   inReal[],
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 29, startIdx, endIdx );
+   retCode = TA_S_FLOOR_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_HT_DCPERIOD_Kernel( int           startIdx,
+                                            int           endIdx,
+                                            const double  inReal[],
+                                            int          *outBegIdx,
+                                            int          *outNBElement,
+                                            double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_DCPERIOD( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 30, startIdx, endIdx );
+   retCode = TA_HT_DCPERIOD_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_HT_DCPERIOD_Kernel( int           startIdx,
+                                              int           endIdx,
+                                              const float   inReal[],
+                                              int          *outBegIdx,
+                                              int          *outNBElement,
+                                              double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_DCPERIOD( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 30, startIdx, endIdx );
+   retCode = TA_S_HT_DCPERIOD_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_HT_DCPHASE_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const double  inReal[],
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_DCPHASE( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 31, startIdx, endIdx );
+   retCode = TA_HT_DCPHASE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_HT_DCPHASE_Kernel( int           startIdx,
+                                             int           endIdx,
+                                             const float   inReal[],
+                                             int          *outBegIdx,
+                                             int          *outNBElement,
+                                             double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_DCPHASE( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 31, startIdx, endIdx );
+   retCode = TA_S_HT_DCPHASE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_HT_PHASOR_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const double  inReal[],
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outInPhase[],
+                                          double        outQuadrature[] );
+
+TA_LIB_API TA_RetCode TA_HT_PHASOR( int           startIdx,
+                                   int           endIdx,
+                                   const double  inReal[],
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outInPhase[],
+                                   double        outQuadrature[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 32, startIdx, endIdx );
+   retCode = TA_HT_PHASOR_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outInPhase, outQuadrature );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_HT_PHASOR_Kernel( int           startIdx,
+                                            int           endIdx,
+                                            const float   inReal[],
+                                            int          *outBegIdx,
+                                            int          *outNBElement,
+                                            double        outInPhase[],
+                                            double        outQuadrature[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_PHASOR( int           startIdx,
+                                     int           endIdx,
+                                     const float   inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outInPhase[],
+                                     double        outQuadrature[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 32, startIdx, endIdx );
+   retCode = TA_S_HT_PHASOR_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outInPhase, outQuadrature );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_HT_SINE_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const double  inReal[],
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outSine[],
+                                        double        outLeadSine[] );
+
+TA_LIB_API TA_RetCode TA_HT_SINE( int           startIdx,
+                                 int           endIdx,
+                                 const double  inReal[],
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outSine[],
+                                 double        outLeadSine[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 33, startIdx, endIdx );
+   retCode = TA_HT_SINE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outSine, outLeadSine );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_HT_SINE_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const float   inReal[],
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outSine[],
+                                          double        outLeadSine[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_SINE( int           startIdx,
+                                   int           endIdx,
+                                   const float   inReal[],
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outSine[],
+                                   double        outLeadSine[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 33, startIdx, endIdx );
+   retCode = TA_S_HT_SINE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outSine, outLeadSine );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_HT_TRENDLINE_Kernel( int           startIdx,
+                                             int           endIdx,
+                                             const double  inReal[],
+                                             int          *outBegIdx,
+                                             int          *outNBElement,
+                                             double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_HT_TRENDLINE( int           startIdx,
+                                      int           endIdx,
+                                      const double  inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 34, startIdx, endIdx );
+   retCode = TA_HT_TRENDLINE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_HT_TRENDLINE_Kernel( int           startIdx,
+                                               int           endIdx,
+                                               const float   inReal[],
+                                               int          *outBegIdx,
+                                               int          *outNBElement,
+                                               double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_TRENDLINE( int           startIdx,
+                                        int           endIdx,
+                                        const float   inReal[],
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 34, startIdx, endIdx );
+   retCode = TA_S_HT_TRENDLINE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_HT_TRENDMODE_Kernel( int           startIdx,
+                                             int           endIdx,
+                                             const double  inReal[],
+                                             int          *outBegIdx,
+                                             int          *outNBElement,
+                                             int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_HT_TRENDMODE( int           startIdx,
+                                      int           endIdx,
+                                      const double  inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      int           outInteger[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 35, startIdx, endIdx );
+   retCode = TA_HT_TRENDMODE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outInteger );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_HT_TRENDMODE_Kernel( int           startIdx,
+                                               int           endIdx,
+                                               const float   inReal[],
+                                               int          *outBegIdx,
+                                               int          *outNBElement,
+                                               int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_TRENDMODE( int           startIdx,
+                                        int           endIdx,
+                                        const float   inReal[],
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        int           outInteger[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 35, startIdx, endIdx );
+   retCode = TA_S_HT_TRENDMODE_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outInteger );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_IMI_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inOpen[],
+                                    const double  inClose[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_IMI( int           startIdx,
+                             int           endIdx,
+                             const double  inOpen[],
+                             const double  inClose[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 36, startIdx, endIdx );
+   retCode = TA_IMI_Kernel( startIdx, endIdx, inOpen, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_IMI_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inOpen[],
+                                      const float   inClose[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_IMI( int           startIdx,
+                               int           endIdx,
+                               const float   inOpen[],
+                               const float   inClose[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 36, startIdx, endIdx );
+   retCode = TA_S_IMI_Kernel( startIdx, endIdx, inOpen, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_JMA_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int           optInPhase,
+                                    int           optInVolPeriods,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outRealJMA[],
+                                    double        outRealUpperBand[],
+                                    double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_JMA( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int           optInPhase,
+                             int           optInVolPeriods,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outRealJMA[],
+                             double        outRealUpperBand[],
+                             double        outRealLowerBand[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 37, startIdx, endIdx );
+   retCode = TA_JMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInPhase, optInVolPeriods, outBegIdx, outNBElement, outRealJMA, outRealUpperBand, outRealLowerBand );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_JMA_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int           optInPhase,
+                                      int           optInVolPeriods,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outRealJMA[],
+                                      double        outRealUpperBand[],
+                                      double        outRealLowerBand[] );
+
+TA_LIB_API TA_RetCode TA_S_JMA( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int           optInPhase,
+                               int           optInVolPeriods,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outRealJMA[],
+                               double        outRealUpperBand[],
+                               double        outRealLowerBand[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 37, startIdx, endIdx );
+   retCode = TA_S_JMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInPhase, optInVolPeriods, outBegIdx, outNBElement, outRealJMA, outRealUpperBand, outRealLowerBand );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_KAMA_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_KAMA( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 38, startIdx, endIdx );
+   retCode = TA_KAMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_KAMA_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_KAMA( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 38, startIdx, endIdx );
+   retCode = TA_S_KAMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_LINEARREG_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const double  inReal[],
+                                          int           optInTimePeriod,
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG( int           startIdx,
+                                   int           endIdx,
+                                   const double  inReal[],
+                                   int           optInTimePeriod,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 39, startIdx, endIdx );
+   retCode = TA_LINEARREG_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_Kernel( int           startIdx,
+                                            int           endIdx,
+                                            const float   inReal[],
+                                            int           optInTimePeriod,
+                                            int          *outBegIdx,
+                                            int          *outNBElement,
+                                            double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG( int           startIdx,
+                                     int           endIdx,
+                                     const float   inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 39, startIdx, endIdx );
+   retCode = TA_S_LINEARREG_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_LINEARREG_ANGLE_Kernel( int           startIdx,
+                                                int           endIdx,
+                                                const double  inReal[],
+                                                int           optInTimePeriod,
+                                                int          *outBegIdx,
+                                                int          *outNBElement,
+                                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_ANGLE( int           startIdx,
+                                         int           endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 40, startIdx, endIdx );
+   retCode = TA_LINEARREG_ANGLE_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_ANGLE_Kernel( int           startIdx,
+                                                  int           endIdx,
+                                                  const float   inReal[],
+                                                  int           optInTimePeriod,
+                                                  int          *outBegIdx,
+                                                  int          *outNBElement,
+                                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_ANGLE( int           startIdx,
+                                           int           endIdx,
+                                           const float   inReal[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 40, startIdx, endIdx );
+   retCode = TA_S_LINEARREG_ANGLE_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_LINEARREG_INTERCEPT_Kernel( int           startIdx,
+                                                    int           endIdx,
+                                                    const double  inReal[],
+                                                    int           optInTimePeriod,
+                                                    int          *outBegIdx,
+                                                    int          *outNBElement,
+                                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_INTERCEPT( int           startIdx,
+                                             int           endIdx,
+                                             const double  inReal[],
+                                             int           optInTimePeriod,
+                                             int          *outBegIdx,
+                                             int          *outNBElement,
+                                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 41, startIdx, endIdx );
+   retCode = TA_LINEARREG_INTERCEPT_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_INTERCEPT_Kernel( int           startIdx,
+                                                      int           endIdx,
+                                                      const float   inReal[],
+                                                      int           optInTimePeriod,
+                                                      int          *outBegIdx,
+                                                      int          *outNBElement,
+                                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_INTERCEPT( int           startIdx,
+                                               int           endIdx,
+                                               const float   inReal[],
+                                               int           optInTimePeriod,
+                                               int          *outBegIdx,
+                                               int          *outNBElement,
+                                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 41, startIdx, endIdx );
+   retCode = TA_S_LINEARREG_INTERCEPT_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_LINEARREG_SLOPE_Kernel( int           startIdx,
+                                                int           endIdx,
+                                                const double  inReal[],
+                                                int           optInTimePeriod,
+                                                int          *outBegIdx,
+                                                int          *outNBElement,
+                                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LINEARREG_SLOPE( int           startIdx,
+                                         int           endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 42, startIdx, endIdx );
+   retCode = TA_LINEARREG_SLOPE_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_SLOPE_Kernel( int           startIdx,
+                                                  int           endIdx,
+                                                  const float   inReal[],
+                                                  int           optInTimePeriod,
+                                                  int          *outBegIdx,
+                                                  int          *outNBElement,
+                                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_SLOPE( int           startIdx,
+                                           int           endIdx,
+                                           const float   inReal[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 42, startIdx, endIdx );
+   retCode = TA_S_LINEARREG_SLOPE_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_LN_Kernel( int           startIdx,
+                                   int           endIdx,
+                                   const double  inReal[],
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LN( int           startIdx,
+                            int           endIdx,
+                            const double  inReal[],
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 43, startIdx, endIdx );
+   retCode = TA_LN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_LN_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const float   inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_LN( int           startIdx,
+                              int           endIdx,
+                              const float   inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 43, startIdx, endIdx );
+   retCode = TA_S_LN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_LOG10_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_LOG10( int           startIdx,
+                               int           endIdx,
+                               const double  inReal[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 44, startIdx, endIdx );
+   retCode = TA_LOG10_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_LOG10_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inReal[],
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_LOG10( int           startIdx,
+                                 int           endIdx,
+                                 const float   inReal[],
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 44, startIdx, endIdx );
+   retCode = TA_S_LOG10_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MA_Kernel( int           startIdx,
+                                   int           endIdx,
+                                   const double  inReal[],
+                                   int           optInTimePeriod,
+                                   TA_MAType     optInMAType,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MA( int           startIdx,
+                            int           endIdx,
+                            const double  inReal[],
+                            int           optInTimePeriod,
+                            TA_MAType     optInMAType,
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 45, startIdx, endIdx );
+   retCode = TA_MA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MA_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const float   inReal[],
+                                     int           optInTimePeriod,
+                                     TA_MAType     optInMAType,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MA( int           startIdx,
+                              int           endIdx,
+                              const float   inReal[],
+                              int           optInTimePeriod,
+                              TA_MAType     optInMAType,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 45, startIdx, endIdx );
+   retCode = TA_S_MA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MACD_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInFastPeriod,
+                                     int           optInSlowPeriod,
+                                     int           optInSignalPeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outMACD[],
+                                     double        outMACDSignal[],
+                                     double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_MACD( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInFastPeriod,
+                              int           optInSlowPeriod,
+                              int           optInSignalPeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outMACD[],
+                              double        outMACDSignal[],
+                              double        outMACDHist[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 46, startIdx, endIdx );
+   retCode = TA_MACD_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod, optInSignalPeriod, outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MACD_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInFastPeriod,
+                                       int           optInSlowPeriod,
+                                       int           optInSignalPeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outMACD[],
+                                       double        outMACDSignal[],
+                                       double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_S_MACD( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInFastPeriod,
+                                int           optInSlowPeriod,
+                                int           optInSignalPeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outMACD[],
+                                double        outMACDSignal[],
+                                double        outMACDHist[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 46, startIdx, endIdx );
+   retCode = TA_S_MACD_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod, optInSignalPeriod, outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MACDEXT_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const double  inReal[],
+                                        int           optInFastPeriod,
+                                        TA_MAType     optInFastMAType,
+                                        int           optInSlowPeriod,
+                                        TA_MAType     optInSlowMAType,
+                                        int           optInSignalPeriod,
+                                        TA_MAType     optInSignalMAType,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outMACD[],
+                                        double        outMACDSignal[],
+                                        double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_MACDEXT( int           startIdx,
+                                 int           endIdx,
+                                 const double  inReal[],
+                                 int           optInFastPeriod,
+                                 TA_MAType     optInFastMAType,
+                                 int           optInSlowPeriod,
+                                 TA_MAType     optInSlowMAType,
+                                 int           optInSignalPeriod,
+                                 TA_MAType     optInSignalMAType,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outMACD[],
+                                 double        outMACDSignal[],
+                                 double        outMACDHist[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 47, startIdx, endIdx );
+   retCode = TA_MACDEXT_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType, outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MACDEXT_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const float   inReal[],
+                                          int           optInFastPeriod,
+                                          TA_MAType     optInFastMAType,
+                                          int           optInSlowPeriod,
+                                          TA_MAType     optInSlowMAType,
+                                          int           optInSignalPeriod,
+                                          TA_MAType     optInSignalMAType,
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outMACD[],
+                                          double        outMACDSignal[],
+                                          double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_S_MACDEXT( int           startIdx,
+                                   int           endIdx,
+                                   const float   inReal[],
+                                   int           optInFastPeriod,
+                                   TA_MAType     optInFastMAType,
+                                   int           optInSlowPeriod,
+                                   TA_MAType     optInSlowMAType,
+                                   int           optInSignalPeriod,
+                                   TA_MAType     optInSignalMAType,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outMACD[],
+                                   double        outMACDSignal[],
+                                   double        outMACDHist[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 47, startIdx, endIdx );
+   retCode = TA_S_MACDEXT_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType, outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MACDFIX_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const double  inReal[],
+                                        int           optInSignalPeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outMACD[],
+                                        double        outMACDSignal[],
+                                        double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_MACDFIX( int           startIdx,
+                                 int           endIdx,
+                                 const double  inReal[],
+                                 int           optInSignalPeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outMACD[],
+                                 double        outMACDSignal[],
+                                 double        outMACDHist[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 48, startIdx, endIdx );
+   retCode = TA_MACDFIX_Kernel( startIdx, endIdx, inReal, optInSignalPeriod, outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MACDFIX_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const float   inReal[],
+                                          int           optInSignalPeriod,
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outMACD[],
+                                          double        outMACDSignal[],
+                                          double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_S_MACDFIX( int           startIdx,
+                                   int           endIdx,
+                                   const float   inReal[],
+                                   int           optInSignalPeriod,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outMACD[],
+                                   double        outMACDSignal[],
+                                   double        outMACDHist[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 48, startIdx, endIdx );
+   retCode = TA_S_MACDFIX_Kernel( startIdx, endIdx, inReal, optInSignalPeriod, outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MAMA_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     double        optInFastLimit,
+                                     double        optInSlowLimit,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outMAMA[],
+                                     double        outFAMA[] );
+
+TA_LIB_API TA_RetCode TA_MAMA( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              double        optInFastLimit,
+                              double        optInSlowLimit,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outMAMA[],
+                              double        outFAMA[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 49, startIdx, endIdx );
+   retCode = TA_MAMA_Kernel( startIdx, endIdx, inReal, optInFastLimit, optInSlowLimit, outBegIdx, outNBElement, outMAMA, outFAMA );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MAMA_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       double        optInFastLimit,
+                                       double        optInSlowLimit,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outMAMA[],
+                                       double        outFAMA[] );
+
+TA_LIB_API TA_RetCode TA_S_MAMA( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                double        optInFastLimit,
+                                double        optInSlowLimit,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outMAMA[],
+                                double        outFAMA[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 49, startIdx, endIdx );
+   retCode = TA_S_MAMA_Kernel( startIdx, endIdx, inReal, optInFastLimit, optInSlowLimit, outBegIdx, outNBElement, outMAMA, outFAMA );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MAVP_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     const double  inPeriods[],
+                                     int           optInMinPeriod,
+                                     int           optInMaxPeriod,
+                                     TA_MAType     optInMAType,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MAVP( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              const double  inPeriods[],
+                              int           optInMinPeriod,
+                              int           optInMaxPeriod,
+                              TA_MAType     optInMAType,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 50, startIdx, endIdx );
+   retCode = TA_MAVP_Kernel( startIdx, endIdx, inReal, inPeriods, optInMinPeriod, optInMaxPeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MAVP_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       const float   inPeriods[],
+                                       int           optInMinPeriod,
+                                       int           optInMaxPeriod,
+                                       TA_MAType     optInMAType,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MAVP( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                const float   inPeriods[],
+                                int           optInMinPeriod,
+                                int           optInMaxPeriod,
+                                TA_MAType     optInMAType,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 50, startIdx, endIdx );
+   retCode = TA_S_MAVP_Kernel( startIdx, endIdx, inReal, inPeriods, optInMinPeriod, optInMaxPeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MAX_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MAX( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 51, startIdx, endIdx );
+   retCode = TA_MAX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MAX_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MAX( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 51, startIdx, endIdx );
+   retCode = TA_S_MAX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MAXINDEX_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_MAXINDEX( int           startIdx,
+                                  int           endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  int           outInteger[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 52, startIdx, endIdx );
+   retCode = TA_MAXINDEX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outInteger );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MAXINDEX_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inReal[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_S_MAXINDEX( int           startIdx,
+                                    int           endIdx,
+                                    const float   inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    int           outInteger[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 52, startIdx, endIdx );
+   retCode = TA_S_MAXINDEX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outInteger );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MEDPRICE_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MEDPRICE( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 53, startIdx, endIdx );
+   retCode = TA_MEDPRICE_Kernel( startIdx, endIdx, inHigh, inLow, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MEDPRICE_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MEDPRICE( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 53, startIdx, endIdx );
+   retCode = TA_S_MEDPRICE_Kernel( startIdx, endIdx, inHigh, inLow, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MFI_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    const double  inClose[],
+                                    const double  inVolume[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MFI( int           startIdx,
+                             int           endIdx,
+                             const double  inHigh[],
+                             const double  inLow[],
+                             const double  inClose[],
+                             const double  inVolume[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 54, startIdx, endIdx );
+   retCode = TA_MFI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, inVolume, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MFI_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inHigh[],
+                                      const float   inLow[],
+                                      const float   inClose[],
+                                      const float   inVolume[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MFI( int           startIdx,
+                               int           endIdx,
+                               const float   inHigh[],
+                               const float   inLow[],
+                               const float   inClose[],
+                               const float   inVolume[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 54, startIdx, endIdx );
+   retCode = TA_S_MFI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, inVolume, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MIDPOINT_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MIDPOINT( int           startIdx,
+                                  int           endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 55, startIdx, endIdx );
+   retCode = TA_MIDPOINT_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MIDPOINT_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inReal[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MIDPOINT( int           startIdx,
+                                    int           endIdx,
+                                    const float   inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 55, startIdx, endIdx );
+   retCode = TA_S_MIDPOINT_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MIDPRICE_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MIDPRICE( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 56, startIdx, endIdx );
+   retCode = TA_MIDPRICE_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MIDPRICE_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MIDPRICE( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 56, startIdx, endIdx );
+   retCode = TA_S_MIDPRICE_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MIN_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MIN( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 57, startIdx, endIdx );
+   retCode = TA_MIN_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MIN_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MIN( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 57, startIdx, endIdx );
+   retCode = TA_S_MIN_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MININDEX_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_MININDEX( int           startIdx,
+                                  int           endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  int           outInteger[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 58, startIdx, endIdx );
+   retCode = TA_MININDEX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outInteger );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MININDEX_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inReal[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_S_MININDEX( int           startIdx,
+                                    int           endIdx,
+                                    const float   inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    int           outInteger[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 58, startIdx, endIdx );
+   retCode = TA_S_MININDEX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outInteger );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MINMAX_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outMin[],
+                                       double        outMax[] );
+
+TA_LIB_API TA_RetCode TA_MINMAX( int           startIdx,
+                                int           endIdx,
+                                const double  inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outMin[],
+                                double        outMax[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 59, startIdx, endIdx );
+   retCode = TA_MINMAX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outMin, outMax );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MINMAX_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inReal[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outMin[],
+                                         double        outMax[] );
+
+TA_LIB_API TA_RetCode TA_S_MINMAX( int           startIdx,
+                                  int           endIdx,
+                                  const float   inReal[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outMin[],
+                                  double        outMax[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 59, startIdx, endIdx );
+   retCode = TA_S_MINMAX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outMin, outMax );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MINMAXINDEX_Kernel( int           startIdx,
+                                            int           endIdx,
+                                            const double  inReal[],
+                                            int           optInTimePeriod,
+                                            int          *outBegIdx,
+                                            int          *outNBElement,
+                                            int           outMinIdx[],
+                                            int           outMaxIdx[] );
+
+TA_LIB_API TA_RetCode TA_MINMAXINDEX( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     int           outMinIdx[],
+                                     int           outMaxIdx[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 60, startIdx, endIdx );
+   retCode = TA_MINMAXINDEX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outMinIdx, outMaxIdx );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MINMAXINDEX_Kernel( int           startIdx,
+                                              int           endIdx,
+                                              const float   inReal[],
+                                              int           optInTimePeriod,
+                                              int          *outBegIdx,
+                                              int          *outNBElement,
+                                              int           outMinIdx[],
+                                              int           outMaxIdx[] );
+
+TA_LIB_API TA_RetCode TA_S_MINMAXINDEX( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       int           outMinIdx[],
+                                       int           outMaxIdx[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 60, startIdx, endIdx );
+   retCode = TA_S_MINMAXINDEX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outMinIdx, outMaxIdx );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MINUS_DI_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         const double  inClose[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MINUS_DI( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 61, startIdx, endIdx );
+   retCode = TA_MINUS_DI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MINUS_DI_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           const float   inClose[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MINUS_DI( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    const float   inClose[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 61, startIdx, endIdx );
+   retCode = TA_S_MINUS_DI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MINUS_DM_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         int           optInTimePeriod,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MINUS_DM( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  int           optInTimePeriod,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 62, startIdx, endIdx );
+   retCode = TA_MINUS_DM_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MINUS_DM_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           int           optInTimePeriod,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MINUS_DM( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 62, startIdx, endIdx );
+   retCode = TA_S_MINUS_DM_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MOM_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MOM( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 63, startIdx, endIdx );
+   retCode = TA_MOM_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MOM_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MOM( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 63, startIdx, endIdx );
+   retCode = TA_S_MOM_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_MULT_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal0[],
+                                     const double  inReal1[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_MULT( int           startIdx,
+                              int           endIdx,
+                              const double  inReal0[],
+                              const double  inReal1[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 64, startIdx, endIdx );
+   retCode = TA_MULT_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_MULT_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal0[],
+                                       const float   inReal1[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MULT( int           startIdx,
+                                int           endIdx,
+                                const float   inReal0[],
+                                const float   inReal1[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 64, startIdx, endIdx );
+   retCode = TA_S_MULT_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_NATR_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inHigh[],
+                                     const double  inLow[],
+                                     const double  inClose[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_NATR( int           startIdx,
+                              int           endIdx,
+                              const double  inHigh[],
+                              const double  inLow[],
+                              const double  inClose[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 65, startIdx, endIdx );
+   retCode = TA_NATR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_NATR_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inHigh[],
+                                       const float   inLow[],
+                                       const float   inClose[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_NATR( int           startIdx,
+                                int           endIdx,
+                                const float   inHigh[],
+                                const float   inLow[],
+                                const float   inClose[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 65, startIdx, endIdx );
+   retCode = TA_S_NATR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_OBV_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    const double  inVolume[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_OBV( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             const double  inVolume[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 66, startIdx, endIdx );
+   retCode = TA_OBV_Kernel( startIdx, endIdx, inReal, inVolume, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_OBV_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      const float   inVolume[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_OBV( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               const float   inVolume[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 66, startIdx, endIdx );
+   retCode = TA_S_OBV_Kernel( startIdx, endIdx, inReal, inVolume, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_PLUS_DI_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const double  inHigh[],
+                                        const double  inLow[],
+                                        const double  inClose[],
+                                        int           optInTimePeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_PLUS_DI( int           startIdx,
+                                 int           endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 const double  inClose[],
+                                 int           optInTimePeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 67, startIdx, endIdx );
+   retCode = TA_PLUS_DI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_PLUS_DI_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const float   inHigh[],
+                                          const float   inLow[],
+                                          const float   inClose[],
+                                          int           optInTimePeriod,
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_PLUS_DI( int           startIdx,
+                                   int           endIdx,
+                                   const float   inHigh[],
+                                   const float   inLow[],
+                                   const float   inClose[],
+                                   int           optInTimePeriod,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 67, startIdx, endIdx );
+   retCode = TA_S_PLUS_DI_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_PLUS_DM_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const double  inHigh[],
+                                        const double  inLow[],
+                                        int           optInTimePeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_PLUS_DM( int           startIdx,
+                                 int           endIdx,
+                                 const double  inHigh[],
+                                 const double  inLow[],
+                                 int           optInTimePeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 68, startIdx, endIdx );
+   retCode = TA_PLUS_DM_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_PLUS_DM_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const float   inHigh[],
+                                          const float   inLow[],
+                                          int           optInTimePeriod,
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_PLUS_DM( int           startIdx,
+                                   int           endIdx,
+                                   const float   inHigh[],
+                                   const float   inLow[],
+                                   int           optInTimePeriod,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 68, startIdx, endIdx );
+   retCode = TA_S_PLUS_DM_Kernel( startIdx, endIdx, inHigh, inLow, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_PPO_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInFastPeriod,
+                                    int           optInSlowPeriod,
+                                    TA_MAType     optInMAType,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_PPO( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInFastPeriod,
+                             int           optInSlowPeriod,
+                             TA_MAType     optInMAType,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 69, startIdx, endIdx );
+   retCode = TA_PPO_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_PPO_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInFastPeriod,
+                                      int           optInSlowPeriod,
+                                      TA_MAType     optInMAType,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_PPO( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInFastPeriod,
+                               int           optInSlowPeriod,
+                               TA_MAType     optInMAType,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 69, startIdx, endIdx );
+   retCode = TA_S_PPO_Kernel( startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod, optInMAType, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ROC_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROC( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 70, startIdx, endIdx );
+   retCode = TA_ROC_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ROC_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ROC( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 70, startIdx, endIdx );
+   retCode = TA_S_ROC_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ROCP_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROCP( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 71, startIdx, endIdx );
+   retCode = TA_ROCP_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ROCP_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ROCP( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 71, startIdx, endIdx );
+   retCode = TA_S_ROCP_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ROCR_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROCR( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 72, startIdx, endIdx );
+   retCode = TA_ROCR_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ROCR_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ROCR( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 72, startIdx, endIdx );
+   retCode = TA_S_ROCR_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ROCR100_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const double  inReal[],
+                                        int           optInTimePeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ROCR100( int           startIdx,
+                                 int           endIdx,
+                                 const double  inReal[],
+                                 int           optInTimePeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 73, startIdx, endIdx );
+   retCode = TA_ROCR100_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ROCR100_Kernel( int           startIdx,
+                                          int           endIdx,
+                                          const float   inReal[],
+                                          int           optInTimePeriod,
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ROCR100( int           startIdx,
+                                   int           endIdx,
+                                   const float   inReal[],
+                                   int           optInTimePeriod,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 73, startIdx, endIdx );
+   retCode = TA_S_ROCR100_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_RSI_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_RSI( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 74, startIdx, endIdx );
+   retCode = TA_RSI_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_RSI_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_RSI( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 74, startIdx, endIdx );
+   retCode = TA_S_RSI_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SAR_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inHigh[],
+                                    const double  inLow[],
+                                    double        optInAcceleration,
+                                    double        optInMaximum,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SAR( int           startIdx,
+                             int           endIdx,
+                             const double  inHigh[],
+                             const double  inLow[],
+                             double        optInAcceleration,
+                             double        optInMaximum,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 75, startIdx, endIdx );
+   retCode = TA_SAR_Kernel( startIdx, endIdx, inHigh, inLow, optInAcceleration, optInMaximum, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SAR_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inHigh[],
+                                      const float   inLow[],
+                                      double        optInAcceleration,
+                                      double        optInMaximum,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SAR( int           startIdx,
+                               int           endIdx,
+                               const float   inHigh[],
+                               const float   inLow[],
+                               double        optInAcceleration,
+                               double        optInMaximum,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 75, startIdx, endIdx );
+   retCode = TA_S_SAR_Kernel( startIdx, endIdx, inHigh, inLow, optInAcceleration, optInMaximum, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SAREXT_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inHigh[],
+                                       const double  inLow[],
+                                       double        optInStartValue,
+                                       double        optInOffsetOnReverse,
+                                       double        optInAccelerationInitLong,
+                                       double        optInAccelerationLong,
+                                       double        optInAccelerationMaxLong,
+                                       double        optInAccelerationInitShort,
+                                       double        optInAccelerationShort,
+                                       double        optInAccelerationMaxShort,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SAREXT( int           startIdx,
+                                int           endIdx,
+                                const double  inHigh[],
+                                const double  inLow[],
+                                double        optInStartValue,
+                                double        optInOffsetOnReverse,
+                                double        optInAccelerationInitLong,
+                                double        optInAccelerationLong,
+                                double        optInAccelerationMaxLong,
+                                double        optInAccelerationInitShort,
+                                double        optInAccelerationShort,
+                                double        optInAccelerationMaxShort,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 76, startIdx, endIdx );
+   retCode = TA_SAREXT_Kernel( startIdx, endIdx, inHigh, inLow, optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SAREXT_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inHigh[],
+                                         const float   inLow[],
+                                         double        optInStartValue,
+                                         double        optInOffsetOnReverse,
+                                         double        optInAccelerationInitLong,
+                                         double        optInAccelerationLong,
+                                         double        optInAccelerationMaxLong,
+                                         double        optInAccelerationInitShort,
+                                         double        optInAccelerationShort,
+                                         double        optInAccelerationMaxShort,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SAREXT( int           startIdx,
+                                  int           endIdx,
+                                  const float   inHigh[],
+                                  const float   inLow[],
+                                  double        optInStartValue,
+                                  double        optInOffsetOnReverse,
+                                  double        optInAccelerationInitLong,
+                                  double        optInAccelerationLong,
+                                  double        optInAccelerationMaxLong,
+                                  double        optInAccelerationInitShort,
+                                  double        optInAccelerationShort,
+                                  double        optInAccelerationMaxShort,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 76, startIdx, endIdx );
+   retCode = TA_S_SAREXT_Kernel( startIdx, endIdx, inHigh, inLow, optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SIN_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SIN( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 77, startIdx, endIdx );
+   retCode = TA_SIN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SIN_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SIN( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 77, startIdx, endIdx );
+   retCode = TA_S_SIN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SINH_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SINH( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 78, startIdx, endIdx );
+   retCode = TA_SINH_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SINH_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SINH( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 78, startIdx, endIdx );
+   retCode = TA_S_SINH_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SMA_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SMA( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 79, startIdx, endIdx );
+   retCode = TA_SMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SMA_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SMA( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 79, startIdx, endIdx );
+   retCode = TA_S_SMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SQRT_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SQRT( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 80, startIdx, endIdx );
+   retCode = TA_SQRT_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SQRT_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SQRT( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 80, startIdx, endIdx );
+   retCode = TA_S_SQRT_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_STDDEV_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inReal[],
+                                       int           optInTimePeriod,
+                                       double        optInNbDev,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_STDDEV( int           startIdx,
+                                int           endIdx,
+                                const double  inReal[],
+                                int           optInTimePeriod,
+                                double        optInNbDev,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 81, startIdx, endIdx );
+   retCode = TA_STDDEV_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInNbDev, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_STDDEV_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inReal[],
+                                         int           optInTimePeriod,
+                                         double        optInNbDev,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_STDDEV( int           startIdx,
+                                  int           endIdx,
+                                  const float   inReal[],
+                                  int           optInTimePeriod,
+                                  double        optInNbDev,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 81, startIdx, endIdx );
+   retCode = TA_S_STDDEV_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInNbDev, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_STOCH_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      int           optInFastK_Period,
+                                      int           optInSlowK_Period,
+                                      TA_MAType     optInSlowK_MAType,
+                                      int           optInSlowD_Period,
+                                      TA_MAType     optInSlowD_MAType,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outSlowK[],
+                                      double        outSlowD[] );
+
+TA_LIB_API TA_RetCode TA_STOCH( int           startIdx,
+                               int           endIdx,
+                               const double  inHigh[],
+                               const double  inLow[],
+                               const double  inClose[],
+                               int           optInFastK_Period,
+                               int           optInSlowK_Period,
+                               TA_MAType     optInSlowK_MAType,
+                               int           optInSlowD_Period,
+                               TA_MAType     optInSlowD_MAType,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outSlowK[],
+                               double        outSlowD[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 82, startIdx, endIdx );
+   retCode = TA_STOCH_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType, outBegIdx, outNBElement, outSlowK, outSlowD );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_STOCH_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inHigh[],
+                                        const float   inLow[],
+                                        const float   inClose[],
+                                        int           optInFastK_Period,
+                                        int           optInSlowK_Period,
+                                        TA_MAType     optInSlowK_MAType,
+                                        int           optInSlowD_Period,
+                                        TA_MAType     optInSlowD_MAType,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outSlowK[],
+                                        double        outSlowD[] );
+
+TA_LIB_API TA_RetCode TA_S_STOCH( int           startIdx,
+                                 int           endIdx,
+                                 const float   inHigh[],
+                                 const float   inLow[],
+                                 const float   inClose[],
+                                 int           optInFastK_Period,
+                                 int           optInSlowK_Period,
+                                 TA_MAType     optInSlowK_MAType,
+                                 int           optInSlowD_Period,
+                                 TA_MAType     optInSlowD_MAType,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outSlowK[],
+                                 double        outSlowD[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 82, startIdx, endIdx );
+   retCode = TA_S_STOCH_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType, outBegIdx, outNBElement, outSlowK, outSlowD );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_STOCHF_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inHigh[],
+                                       const double  inLow[],
+                                       const double  inClose[],
+                                       int           optInFastK_Period,
+                                       int           optInFastD_Period,
+                                       TA_MAType     optInFastD_MAType,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outFastK[],
+                                       double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_STOCHF( int           startIdx,
+                                int           endIdx,
+                                const double  inHigh[],
+                                const double  inLow[],
+                                const double  inClose[],
+                                int           optInFastK_Period,
+                                int           optInFastD_Period,
+                                TA_MAType     optInFastD_MAType,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outFastK[],
+                                double        outFastD[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 83, startIdx, endIdx );
+   retCode = TA_STOCHF_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInFastK_Period, optInFastD_Period, optInFastD_MAType, outBegIdx, outNBElement, outFastK, outFastD );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_STOCHF_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inHigh[],
+                                         const float   inLow[],
+                                         const float   inClose[],
+                                         int           optInFastK_Period,
+                                         int           optInFastD_Period,
+                                         TA_MAType     optInFastD_MAType,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outFastK[],
+                                         double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_S_STOCHF( int           startIdx,
+                                  int           endIdx,
+                                  const float   inHigh[],
+                                  const float   inLow[],
+                                  const float   inClose[],
+                                  int           optInFastK_Period,
+                                  int           optInFastD_Period,
+                                  TA_MAType     optInFastD_MAType,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outFastK[],
+                                  double        outFastD[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 83, startIdx, endIdx );
+   retCode = TA_S_STOCHF_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInFastK_Period, optInFastD_Period, optInFastD_MAType, outBegIdx, outNBElement, outFastK, outFastD );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_STOCHRSI_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inReal[],
+                                         int           optInTimePeriod,
+                                         int           optInFastK_Period,
+                                         int           optInFastD_Period,
+                                         TA_MAType     optInFastD_MAType,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outFastK[],
+                                         double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_STOCHRSI( int           startIdx,
+                                  int           endIdx,
+                                  const double  inReal[],
+                                  int           optInTimePeriod,
+                                  int           optInFastK_Period,
+                                  int           optInFastD_Period,
+                                  TA_MAType     optInFastD_MAType,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outFastK[],
+                                  double        outFastD[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 84, startIdx, endIdx );
+   retCode = TA_STOCHRSI_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType, outBegIdx, outNBElement, outFastK, outFastD );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_STOCHRSI_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inReal[],
+                                           int           optInTimePeriod,
+                                           int           optInFastK_Period,
+                                           int           optInFastD_Period,
+                                           TA_MAType     optInFastD_MAType,
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outFastK[],
+                                           double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_S_STOCHRSI( int           startIdx,
+                                    int           endIdx,
+                                    const float   inReal[],
+                                    int           optInTimePeriod,
+                                    int           optInFastK_Period,
+                                    int           optInFastD_Period,
+                                    TA_MAType     optInFastD_MAType,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outFastK[],
+                                    double        outFastD[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 84, startIdx, endIdx );
+   retCode = TA_S_STOCHRSI_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType, outBegIdx, outNBElement, outFastK, outFastD );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SUB_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal0[],
+                                    const double  inReal1[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SUB( int           startIdx,
+                             int           endIdx,
+                             const double  inReal0[],
+                             const double  inReal1[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 85, startIdx, endIdx );
+   retCode = TA_SUB_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SUB_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal0[],
+                                      const float   inReal1[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SUB( int           startIdx,
+                               int           endIdx,
+                               const float   inReal0[],
+                               const float   inReal1[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 85, startIdx, endIdx );
+   retCode = TA_S_SUB_Kernel( startIdx, endIdx, inReal0, inReal1, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_SUM_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_SUM( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 86, startIdx, endIdx );
+   retCode = TA_SUM_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_SUM_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_SUM( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 86, startIdx, endIdx );
+   retCode = TA_S_SUM_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_T3_Kernel( int           startIdx,
+                                   int           endIdx,
+                                   const double  inReal[],
+                                   int           optInTimePeriod,
+                                   double        optInVFactor,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_T3( int           startIdx,
+                            int           endIdx,
+                            const double  inReal[],
+                            int           optInTimePeriod,
+                            double        optInVFactor,
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 87, startIdx, endIdx );
+   retCode = TA_T3_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInVFactor, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_T3_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const float   inReal[],
+                                     int           optInTimePeriod,
+                                     double        optInVFactor,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_T3( int           startIdx,
+                              int           endIdx,
+                              const float   inReal[],
+                              int           optInTimePeriod,
+                              double        optInVFactor,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 87, startIdx, endIdx );
+   retCode = TA_S_T3_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInVFactor, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TAN_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TAN( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 88, startIdx, endIdx );
+   retCode = TA_TAN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TAN_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TAN( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 88, startIdx, endIdx );
+   retCode = TA_S_TAN_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TANH_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TANH( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 89, startIdx, endIdx );
+   retCode = TA_TANH_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TANH_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TANH( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 89, startIdx, endIdx );
+   retCode = TA_S_TANH_Kernel( startIdx, endIdx, inReal, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TEMA_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TEMA( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 90, startIdx, endIdx );
+   retCode = TA_TEMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TEMA_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TEMA( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 90, startIdx, endIdx );
+   retCode = TA_S_TEMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TRANGE_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inHigh[],
+                                       const double  inLow[],
+                                       const double  inClose[],
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TRANGE( int           startIdx,
+                                int           endIdx,
+                                const double  inHigh[],
+                                const double  inLow[],
+                                const double  inClose[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 91, startIdx, endIdx );
+   retCode = TA_TRANGE_Kernel( startIdx, endIdx, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TRANGE_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inHigh[],
+                                         const float   inLow[],
+                                         const float   inClose[],
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TRANGE( int           startIdx,
+                                  int           endIdx,
+                                  const float   inHigh[],
+                                  const float   inLow[],
+                                  const float   inClose[],
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 91, startIdx, endIdx );
+   retCode = TA_S_TRANGE_Kernel( startIdx, endIdx, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TRIMA_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TRIMA( int           startIdx,
+                               int           endIdx,
+                               const double  inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 92, startIdx, endIdx );
+   retCode = TA_TRIMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TRIMA_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inReal[],
+                                        int           optInTimePeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TRIMA( int           startIdx,
+                                 int           endIdx,
+                                 const float   inReal[],
+                                 int           optInTimePeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 92, startIdx, endIdx );
+   retCode = TA_S_TRIMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TRIX_Kernel( int           startIdx,
+                                     int           endIdx,
+                                     const double  inReal[],
+                                     int           optInTimePeriod,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TRIX( int           startIdx,
+                              int           endIdx,
+                              const double  inReal[],
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 93, startIdx, endIdx );
+   retCode = TA_TRIX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TRIX_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const float   inReal[],
+                                       int           optInTimePeriod,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TRIX( int           startIdx,
+                                int           endIdx,
+                                const float   inReal[],
+                                int           optInTimePeriod,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 93, startIdx, endIdx );
+   retCode = TA_S_TRIX_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TSF_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TSF( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 94, startIdx, endIdx );
+   retCode = TA_TSF_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TSF_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TSF( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 94, startIdx, endIdx );
+   retCode = TA_S_TSF_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_TYPPRICE_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         const double  inClose[],
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_TYPPRICE( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 95, startIdx, endIdx );
+   retCode = TA_TYPPRICE_Kernel( startIdx, endIdx, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_TYPPRICE_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           const float   inClose[],
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TYPPRICE( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    const float   inClose[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 95, startIdx, endIdx );
+   retCode = TA_S_TYPPRICE_Kernel( startIdx, endIdx, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_ULTOSC_Kernel( int           startIdx,
+                                       int           endIdx,
+                                       const double  inHigh[],
+                                       const double  inLow[],
+                                       const double  inClose[],
+                                       int           optInTimePeriod1,
+                                       int           optInTimePeriod2,
+                                       int           optInTimePeriod3,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ULTOSC( int           startIdx,
+                                int           endIdx,
+                                const double  inHigh[],
+                                const double  inLow[],
+                                const double  inClose[],
+                                int           optInTimePeriod1,
+                                int           optInTimePeriod2,
+                                int           optInTimePeriod3,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 96, startIdx, endIdx );
+   retCode = TA_ULTOSC_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod1, optInTimePeriod2, optInTimePeriod3, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_ULTOSC_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const float   inHigh[],
+                                         const float   inLow[],
+                                         const float   inClose[],
+                                         int           optInTimePeriod1,
+                                         int           optInTimePeriod2,
+                                         int           optInTimePeriod3,
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ULTOSC( int           startIdx,
+                                  int           endIdx,
+                                  const float   inHigh[],
+                                  const float   inLow[],
+                                  const float   inClose[],
+                                  int           optInTimePeriod1,
+                                  int           optInTimePeriod2,
+                                  int           optInTimePeriod3,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 96, startIdx, endIdx );
+   retCode = TA_S_ULTOSC_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod1, optInTimePeriod2, optInTimePeriod3, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_VAR_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    double        optInNbDev,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_VAR( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             double        optInNbDev,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 97, startIdx, endIdx );
+   retCode = TA_VAR_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInNbDev, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_VAR_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      double        optInNbDev,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_VAR( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               double        optInNbDev,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 97, startIdx, endIdx );
+   retCode = TA_S_VAR_Kernel( startIdx, endIdx, inReal, optInTimePeriod, optInNbDev, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_WCLPRICE_Kernel( int           startIdx,
+                                         int           endIdx,
+                                         const double  inHigh[],
+                                         const double  inLow[],
+                                         const double  inClose[],
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_WCLPRICE( int           startIdx,
+                                  int           endIdx,
+                                  const double  inHigh[],
+                                  const double  inLow[],
+                                  const double  inClose[],
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 98, startIdx, endIdx );
+   retCode = TA_WCLPRICE_Kernel( startIdx, endIdx, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_WCLPRICE_Kernel( int           startIdx,
+                                           int           endIdx,
+                                           const float   inHigh[],
+                                           const float   inLow[],
+                                           const float   inClose[],
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_WCLPRICE( int           startIdx,
+                                    int           endIdx,
+                                    const float   inHigh[],
+                                    const float   inLow[],
+                                    const float   inClose[],
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 98, startIdx, endIdx );
+   retCode = TA_S_WCLPRICE_Kernel( startIdx, endIdx, inHigh, inLow, inClose, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_WILLR_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const double  inHigh[],
+                                      const double  inLow[],
+                                      const double  inClose[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_WILLR( int           startIdx,
+                               int           endIdx,
+                               const double  inHigh[],
+                               const double  inLow[],
+                               const double  inClose[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 99, startIdx, endIdx );
+   retCode = TA_WILLR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_WILLR_Kernel( int           startIdx,
+                                        int           endIdx,
+                                        const float   inHigh[],
+                                        const float   inLow[],
+                                        const float   inClose[],
+                                        int           optInTimePeriod,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_WILLR( int           startIdx,
+                                 int           endIdx,
+                                 const float   inHigh[],
+                                 const float   inLow[],
+                                 const float   inClose[],
+                                 int           optInTimePeriod,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 99, startIdx, endIdx );
+   retCode = TA_S_WILLR_Kernel( startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_WMA_Kernel( int           startIdx,
+                                    int           endIdx,
+                                    const double  inReal[],
+                                    int           optInTimePeriod,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_WMA( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 100, startIdx, endIdx );
+   retCode = TA_WMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+TA_LIB_API TA_RetCode TA_S_WMA_Kernel( int           startIdx,
+                                      int           endIdx,
+                                      const float   inReal[],
+                                      int           optInTimePeriod,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_WMA( int           startIdx,
+                               int           endIdx,
+                               const float   inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outReal[] )
+{
+   TA_StatsCall call;
+   TA_RetCode retCode;
+
+   TA_StatsBegin( &call, 100, startIdx, endIdx );
+   retCode = TA_S_WMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod, outBegIdx, outNBElement, outReal );
+   retCode = TA_StatsEnd( &call, retCode, outNBElement );
+
+   return retCode;
+}
+
+#endif
+
+/***************/
+/* End of File */
+/***************/
@@ -37,12 +37,17 @@
  *
  * The goal of this file is to build the following global
  * constant:
+ *       TA_PerGroupFuncTable
  *       TA_PerGroupFuncDef
  *       TA_PerGroupSize
  *       TA_TotalNbFunction
+ *       TA_SortedFuncDef
  *
  * These constant allows mainly to speed optimize functionality related to
  * sequential access to TA_DefFunc by TA_GroupId (see ta_abstract.c)
+ *
+ * TA_SortedFuncDef is sorted by function name (case-insensitive) and
+ * is used by TA_GetFuncHandle for a binary search.
  */
 #include <stddef.h>
 #include "ta_def_ui.h"
@@ -85,6 +90,7 @@ extern const TA_FuncDef TA_DEF_HT_SINE;
 extern const TA_FuncDef TA_DEF_HT_TRENDLINE;
 extern const TA_FuncDef TA_DEF_HT_TRENDMODE;
 extern const TA_FuncDef TA_DEF_IMI;
+extern const TA_FuncDef TA_DEF_JMA;
 extern const TA_FuncDef TA_DEF_KAMA;
 extern const TA_FuncDef TA_DEF_LINEARREG;
 extern const TA_FuncDef TA_DEF_LINEARREG_ANGLE;
@@ -163,6 +169,19 @@ const TA_FuncDef *TA_PerGroupFunc_0[] = {
 &TA_DEF_SUM,
 NULL };
 #define SIZE_GROUP_0 ((sizeof(TA_PerGroupFunc_0)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_0[] = {
+"ADD",
+"DIV",
+"MAX",
+"MAXINDEX",
+"MIN",
+"MININDEX",
+"MINMAX",
+"MINMAXINDEX",
+"MULT",
+"SUB",
+"SUM",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_1[] = {
 &TA_DEF_ACOS,
@@ -182,6 +201,23 @@ const TA_FuncDef *TA_PerGroupFunc_1[] = {
 &TA_DEF_TANH,
 NULL };
 #define SIZE_GROUP_1 ((sizeof(TA_PerGroupFunc_1)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_1[] = {
+"ACOS",
+"ASIN",
+"ATAN",
+"CEIL",
+"COS",
+"COSH",
+"EXP",
+"FLOOR",
+"LN",
+"LOG10",
+"SIN",
+"SINH",
+"SQRT",
+"TAN",
+"TANH",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_2[] = {
 &TA_DEF_ACCBANDS,
@@ -189,6 +225,7 @@ const TA_FuncDef *TA_PerGroupFunc_2[] = {
 &TA_DEF_DEMA,
 &TA_DEF_EMA,
 &TA_DEF_HT_TRENDLINE,
+&TA_DEF_JMA,
 &TA_DEF_KAMA,
 &TA_DEF_MA,
 &TA_DEF_MAMA,
@@ -204,6 +241,27 @@ const TA_FuncDef *TA_PerGroupFunc_2[] = {
 &TA_DEF_WMA,
 NULL };
 #define SIZE_GROUP_2 ((sizeof(TA_PerGroupFunc_2)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_2[] = {
+"ACCBANDS",
+"BBANDS",
+"DEMA",
+"EMA",
+"HT_TRENDLINE",
+"JMA",
+"KAMA",
+"MA",
+"MAMA",
+"MAVP",
+"MIDPOINT",
+"MIDPRICE",
+"SAR",
+"SAREXT",
+"SMA",
+"T3",
+"TEMA",
+"TRIMA",
+"WMA",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_3[] = {
 &TA_DEF_ATR,
@@ -211,6 +269,11 @@ const TA_FuncDef *TA_PerGroupFunc_3[] = {
 &TA_DEF_TRANGE,
 NULL };
 #define SIZE_GROUP_3 ((sizeof(TA_PerGroupFunc_3)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_3[] = {
+"ATR",
+"NATR",
+"TRANGE",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_4[] = {
 &TA_DEF_ADX,
@@ -246,6 +309,39 @@ const TA_FuncDef *TA_PerGroupFunc_4[] = {
 &TA_DEF_WILLR,
 NULL };
 #define SIZE_GROUP_4 ((sizeof(TA_PerGroupFunc_4)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_4[] = {
+"ADX",
+"ADXR",
+"APO",
+"AROON",
+"AROONOSC",
+"BOP",
+"CCI",
+"CMO",
+"DX",
+"IMI",
+"MACD",
+"MACDEXT",
+"MACDFIX",
+"MFI",
+"MINUS_DI",
+"MINUS_DM",
+"MOM",
+"PLUS_DI",
+"PLUS_DM",
+"PPO",
+"ROC",
+"ROCP",
+"ROCR",
+"ROCR100",
+"RSI",
+"STOCH",
+"STOCHF",
+"STOCHRSI",
+"TRIX",
+"ULTOSC",
+"WILLR",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_5[] = {
 &TA_DEF_HT_DCPERIOD,
@@ -255,6 +351,13 @@ const TA_FuncDef *TA_PerGroupFunc_5[] = {
 &TA_DEF_HT_TRENDMODE,
 NULL };
 #define SIZE_GROUP_5 ((sizeof(TA_PerGroupFunc_5)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_5[] = {
+"HT_DCPERIOD",
+"HT_DCPHASE",
+"HT_PHASOR",
+"HT_SINE",
+"HT_TRENDMODE",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_6[] = {
 &TA_DEF_AD,
@@ -262,10 +365,17 @@ const TA_FuncDef *TA_PerGroupFunc_6[] = {
 &TA_DEF_OBV,
 NULL };
 #define SIZE_GROUP_6 ((sizeof(TA_PerGroupFunc_6)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_6[] = {
+"AD",
+"ADOSC",
+"OBV",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_7[] = {
 NULL };
 #define SIZE_GROUP_7 ((sizeof(TA_PerGroupFunc_7)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_7[] = {
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_8[] = {
 &TA_DEF_BETA,
@@ -279,6 +389,17 @@ const TA_FuncDef *TA_PerGroupFunc_8[] = {
 &TA_DEF_VAR,
 NULL };
 #define SIZE_GROUP_8 ((sizeof(TA_PerGroupFunc_8)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_8[] = {
+"BETA",
+"CORREL",
+"LINEARREG",
+"LINEARREG_ANGLE",
+"LINEARREG_INTERCEPT",
+"LINEARREG_SLOPE",
+"STDDEV",
+"TSF",
+"VAR",
+NULL };
 
 const TA_FuncDef *TA_PerGroupFunc_9[] = {
 &TA_DEF_AVGPRICE,
@@ -288,6 +409,26 @@ const TA_FuncDef *TA_PerGroupFunc_9[] = {
 &TA_DEF_WCLPRICE,
 NULL };
 #define SIZE_GROUP_9 ((sizeof(TA_PerGroupFunc_9)/sizeof(const TA_FuncDef *))-1)
+static const char *TA_PerGroupName_9[] = {
+"AVGPRICE",
+"AVGDEV",
+"MEDPRICE",
+"TYPPRICE",
+"WCLPRICE",
+NULL };
+/* Generated */ const TA_StringTable TA_PerGroupFuncTable[10] = {
+{ SIZE_GROUP_0, &TA_PerGroupName_0[0], NULL },
+{ SIZE_GROUP_1, &TA_PerGroupName_1[0], NULL },
+{ SIZE_GROUP_2, &TA_PerGroupName_2[0], NULL },
+{ SIZE_GROUP_3, &TA_PerGroupName_3[0], NULL },
+{ SIZE_GROUP_4, &TA_PerGroupName_4[0], NULL },
+{ SIZE_GROUP_5, &TA_PerGroupName_5[0], NULL },
+{ SIZE_GROUP_6, &TA_PerGroupName_6[0], NULL },
+{ SIZE_GROUP_7, &TA_PerGroupName_7[0], NULL },
+{ SIZE_GROUP_8, &TA_PerGroupName_8[0], NULL },
+{ SIZE_GROUP_9, &TA_PerGroupName_9[0], NULL }
+/* Generated */ };
+
 /* Generated */ const TA_FuncDef **TA_PerGroupFuncDef[10] = {
 &TA_PerGroupFunc_0[0],
 &TA_PerGroupFunc_1[0],
@@ -326,6 +467,111 @@ SIZE_GROUP_7+
 SIZE_GROUP_8+
 SIZE_GROUP_9;
 
+/* Generated */ const TA_FuncDef *TA_SortedFuncDef[101] = {
+&TA_DEF_ACCBANDS,
+&TA_DEF_ACOS,
+&TA_DEF_AD,
+&TA_DEF_ADD,
+&TA_DEF_ADOSC,
+&TA_DEF_ADX,
+&TA_DEF_ADXR,
+&TA_DEF_APO,
+&TA_DEF_AROON,
+&TA_DEF_AROONOSC,
+&TA_DEF_ASIN,
+&TA_DEF_ATAN,
+&TA_DEF_ATR,
+&TA_DEF_AVGDEV,
+&TA_DEF_AVGPRICE,
+&TA_DEF_BBANDS,
+&TA_DEF_BETA,
+&TA_DEF_BOP,
+&TA_DEF_CCI,
+&TA_DEF_CEIL,
+&TA_DEF_CMO,
+&TA_DEF_CORREL,
+&TA_DEF_COS,
+&TA_DEF_COSH,
+&TA_DEF_DEMA,
+&TA_DEF_DIV,
+&TA_DEF_DX,
+&TA_DEF_EMA,
+&TA_DEF_EXP,
+&TA_DEF_FLOOR,
+&TA_DEF_HT_DCPERIOD,
+&TA_DEF_HT_DCPHASE,
+&TA_DEF_HT_PHASOR,
+&TA_DEF_HT_SINE,
+&TA_DEF_HT_TRENDLINE,
+&TA_DEF_HT_TRENDMODE,
+&TA_DEF_IMI,
+&TA_DEF_JMA,
+&TA_DEF_KAMA,
+&TA_DEF_LINEARREG,
+&TA_DEF_LINEARREG_ANGLE,
+&TA_DEF_LINEARREG_INTERCEPT,
+&TA_DEF_LINEARREG_SLOPE,
+&TA_DEF_LN,
+&TA_DEF_LOG10,
+&TA_DEF_MA,
+&TA_DEF_MACD,
+&TA_DEF_MACDEXT,
+&TA_DEF_MACDFIX,
+&TA_DEF_MAMA,
+&TA_DEF_MAVP,
+&TA_DEF_MAX,
+&TA_DEF_MAXINDEX,
+&TA_DEF_MEDPRICE,
+&TA_DEF_MFI,
+&TA_DEF_MIDPOINT,
+&TA_DEF_MIDPRICE,
+&TA_DEF_MIN,
+&TA_DEF_MININDEX,
+&TA_DEF_MINMAX,
+&TA_DEF_MINMAXINDEX,
+&TA_DEF_MINUS_DI,
+&TA_DEF_MINUS_DM,
+&TA_DEF_MOM,
+&TA_DEF_MULT,
+&TA_DEF_NATR,
+&TA_DEF_OBV,
+&TA_DEF_PLUS_DI,
+&TA_DEF_PLUS_DM,
+&TA_DEF_PPO,
+&TA_DEF_ROC,
+&TA_DEF_ROCP,
+&TA_DEF_ROCR,
+&TA_DEF_ROCR100,
+&TA_DEF_RSI,
+&TA_DEF_SAR,
+&TA_DEF_SAREXT,
+&TA_DEF_SIN,
+&TA_DEF_SINH,
+&TA_DEF_SMA,
+&TA_DEF_SQRT,
+&TA_DEF_STDDEV,
+&TA_DEF_STOCH,
+&TA_DEF_STOCHF,
+&TA_DEF_STOCHRSI,
+&TA_DEF_SUB,
+&TA_DEF_SUM,
+&TA_DEF_T3,
+&TA_DEF_TAN,
+&TA_DEF_TANH,
+&TA_DEF_TEMA,
+&TA_DEF_TRANGE,
+&TA_DEF_TRIMA,
+&TA_DEF_TRIX,
+&TA_DEF_TSF,
+&TA_DEF_TYPPRICE,
+&TA_DEF_ULTOSC,
+&TA_DEF_VAR,
+&TA_DEF_WCLPRICE,
+&TA_DEF_WILLR,
+&TA_DEF_WMA
+/* Generated */ };
+
+
 /***************/
 /* End of File */
 /***************/
@@ -0,0 +1,285 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ */
+
+/* Description:
+ *   Accessors of the binary description of the TA functions
+ *   (see ta_meta.h). The blob itself is in ta_func_meta.c,
+ *   generated by gen_code.
+ *
+ *   Nothing here depends on TA_Initialize, the blob is only read.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "ta_meta.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* The layout is part of the format, verify it at compile time. */
+typedef char TA_MetaHeaderSizeCheck  [(sizeof(TA_MetaHeader)   == 64)? 1 : -1];
+typedef char TA_MetaFuncSizeCheck    [(sizeof(TA_MetaFunc)     == 64)? 1 : -1];
+typedef char TA_MetaInputSizeCheck   [(sizeof(TA_MetaInput)    == 16)? 1 : -1];
+typedef char TA_MetaOptInputSizeCheck[(sizeof(TA_MetaOptInput) == 80)? 1 : -1];
+typedef char TA_MetaOutputSizeCheck  [(sizeof(TA_MetaOutput)   == 16)? 1 : -1];
+typedef char TA_MetaListItemSizeCheck[(sizeof(TA_MetaListItem) == 16)? 1 : -1];
+
+#define META_PTR(header,offset) ((const char *)(header)+(offset))
+
+/**** Local functions declarations.    ****/
+static int isTableValid( const TA_MetaHeader *header,
+                         unsigned int offset,
+                         unsigned int nbRecord,
+                         size_t recordSize,
+                         unsigned int alignment );
+static int compareNameNoCase( const char *s1, const char *s2 );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_MetaCheck( const void           *blob,
+                         size_t                size,
+                         const TA_MetaHeader **header )
+{
+   const TA_MetaHeader *blobHeader;
+
+   if( !header )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *header = NULL;
+
+   if( !blob || ((uintptr_t)blob % 8) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   blobHeader = (const TA_MetaHeader *)blob;
+   if( (size < sizeof(TA_MetaHeader)) ||
+       (blobHeader->magic != TA_META_MAGIC) ||
+       (blobHeader->version != TA_META_VERSION) ||
+       (blobHeader->size < sizeof(TA_MetaHeader)) ||
+       (blobHeader->size > size) )
+   {
+      return TA_BAD_OBJECT;
+   }
+
+   if( !isTableValid( blobHeader, blobHeader->groupOffset,    blobHeader->nbGroup,    sizeof(unsigned int),    4 ) ||
+       !isTableValid( blobHeader, blobHeader->funcOffset,     blobHeader->nbFunc,     sizeof(TA_MetaFunc),     8 ) ||
+       !isTableValid( blobHeader, blobHeader->inputOffset,    blobHeader->nbInput,    sizeof(TA_MetaInput),    8 ) ||
+       !isTableValid( blobHeader, blobHeader->optInputOffset, blobHeader->nbOptInput, sizeof(TA_MetaOptInput), 8 ) ||
+       !isTableValid( blobHeader, blobHeader->outputOffset,   blobHeader->nbOutput,   sizeof(TA_MetaOutput),   8 ) ||
+       !isTableValid( blobHeader, blobHeader->listItemOffset, blobHeader->nbListItem, sizeof(TA_MetaListItem), 8 ) )
+   {
+      return TA_BAD_OBJECT;
+   }
+
+   /* The strings must be terminated within the blob. */
+   if( (blobHeader->stringOffset >= blobHeader->size) ||
+       (*META_PTR(blobHeader,blobHeader->size-1) != '\0') )
+   {
+      return TA_BAD_OBJECT;
+   }
+
+   *header = blobHeader;
+
+   return TA_SUCCESS;
+}
+
+const TA_MetaFunc *TA_MetaGetFunc( const TA_MetaHeader *header,
+                                   unsigned int funcIndex )
+{
+   if( !header || (funcIndex >= header->nbFunc) )
+      return NULL;
+
+   return (const TA_MetaFunc *)META_PTR(header,header->funcOffset) + funcIndex;
+}
+
+const TA_MetaFunc *TA_MetaFindFunc( const TA_MetaHeader *header,
+                                    const char *name )
+{
+   const TA_MetaFunc *func;
+   unsigned int low, high, mid;
+   int cmp;
+
+   if( !header || !name )
+      return NULL;
+
+   low  = 0;
+   high = header->nbFunc;
+   while( low < high )
+   {
+      mid  = low + (high-low)/2;
+      func = TA_MetaGetFunc( header, mid );
+      cmp  = compareNameNoCase( name, TA_MetaString( header, func->name ) );
+      if( cmp == 0 )
+         return func;
+      if( cmp < 0 )
+         high = mid;
+      else
+         low = mid+1;
+   }
+
+   return NULL;
+}
+
+const char *TA_MetaGetGroup( const TA_MetaHeader *header,
+                             unsigned int groupIndex )
+{
+   if( !header || (groupIndex >= header->nbGroup) )
+      return NULL;
+
+   return TA_MetaString( header, ((const unsigned int *)META_PTR(header,header->groupOffset))[groupIndex] );
+}
+
+const TA_MetaInput *TA_MetaGetInput( const TA_MetaHeader *header,
+                                     const TA_MetaFunc *func,
+                                     unsigned int paramIndex )
+{
+   if( !header || !func ||
+       (paramIndex >= func->nbInput) ||
+       (func->firstInput >= header->nbInput) ||
+       (paramIndex >= header->nbInput-func->firstInput) )
+      return NULL;
+
+   return (const TA_MetaInput *)META_PTR(header,header->inputOffset) + func->firstInput + paramIndex;
+}
+
+const TA_MetaOptInput *TA_MetaGetOptInput( const TA_MetaHeader *header,
+                                           const TA_MetaFunc *func,
+                                           unsigned int paramIndex )
+{
+   if( !header || !func ||
+       (paramIndex >= func->nbOptInput) ||
+       (func->firstOptInput >= header->nbOptInput) ||
+       (paramIndex >= header->nbOptInput-func->firstOptInput) )
+      return NULL;
+
+   return (const TA_MetaOptInput *)META_PTR(header,header->optInputOffset) + func->firstOptInput + paramIndex;
+}
+
+const TA_MetaOutput *TA_MetaGetOutput( const TA_MetaHeader *header,
+                                       const TA_MetaFunc *func,
+                                       unsigned int paramIndex )
+{
+   if( !header || !func ||
+       (paramIndex >= func->nbOutput) ||
+       (func->firstOutput >= header->nbOutput) ||
+       (paramIndex >= header->nbOutput-func->firstOutput) )
+      return NULL;
+
+   return (const TA_MetaOutput *)META_PTR(header,header->outputOffset) + func->firstOutput + paramIndex;
+}
+
+const TA_MetaListItem *TA_MetaGetListItem( const TA_MetaHeader *header,
+                                           const TA_MetaOptInput *optInput,
+                                           unsigned int itemIndex )
+{
+   if( !header || !optInput ||
+       (itemIndex >= optInput->nbListItem) ||
+       (optInput->firstListItem >= header->nbListItem) ||
+       (itemIndex >= header->nbListItem-optInput->firstListItem) )
+      return NULL;
+
+   return (const TA_MetaListItem *)META_PTR(header,header->listItemOffset) + optInput->firstListItem + itemIndex;
+}
+
+const char *TA_MetaString( const TA_MetaHeader *header,
+                           unsigned int offset )
+{
+   if( !header || (offset < header->stringOffset) || (offset >= header->size) )
+      return "";
+
+   return META_PTR(header,offset);
+}
+
+/**** Local functions definitions.     ****/
+static int isTableValid( const TA_MetaHeader *header,
+                         unsigned int offset,
+                         unsigned int nbRecord,
+                         size_t recordSize,
+                         unsigned int alignment )
+{
+   if( (offset % alignment) ||
+       (offset < sizeof(TA_MetaHeader)) ||
+       (offset > header->size) ||
+       (nbRecord > (header->size-offset)/recordSize) )
+      return 0;
+
+   return 1;
+}
+
+/* Same order as the sorted functions of TA_GetFuncHandle. */
+static int compareNameNoCase( const char *s1, const char *s2 )
+{
+   int c1, c2;
+
+   do
+   {
+      c1 = toupper( (unsigned char)*s1++ );
+      c2 = toupper( (unsigned char)*s2++ );
+   } while( c1 && (c1 == c2) );
+
+   return c1 - c2;
+}
+
+/***************/
+/* End of File */
+/***************/
@@ -0,0 +1,1081 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *  101926 AG   The working data of TA_PlanExecute is subject to the
+ *              strict allocation mode (TA_EntryMalloc).
+ */
+
+/* Description:
+ *   Evaluate many TA_ParamHolder calls at once while sharing the
+ *   moving averages and variances they have in common (see TA_PlanAlloc).
+ *
+ *   Each call (a "request") is decomposed in one or two "nodes". A node
+ *   is itself a call of a TA function, so it gives the exact same values
+ *   than the TA function would calculate internally:
+ *
+ *     MA(n>1,type)      -> SMA/EMA/WMA/DEMA/TEMA/TRIMA/KAMA/T3 node.
+ *     VAR(n,dev)        -> VAR(n,1) node.
+ *     STDDEV(n,dev)     -> VAR(n,1) node, then sqrt()*dev.
+ *     BBANDS(n,up,dn,t) -> MA(n,t) node, then the deviation is either
+ *                          re-calculated from the SMA (like BBANDS does)
+ *                          or taken from a VAR(n,1) node.
+ *     Others            -> a node for the call itself (identical calls
+ *                          are done only once).
+ *
+ *   The nodes are evaluated in their creation order. A request is
+ *   completed as soon as its last node is done, and the intermediate
+ *   buffers are then returned to a pool kept by the plan.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_abstract.h"
+#include "ta_frame_priv.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define TA_PLAN_NO_NODE (-1)
+
+typedef enum
+{
+   TA_PLAN_OP_CALL,   /* Call done as-is, nothing shared. */
+   TA_PLAN_OP_COPY,   /* Outputs of the node are the outputs of the call. */
+   TA_PLAN_OP_STDDEV, /* Square root of a VAR node. */
+   TA_PLAN_OP_BBANDS  /* MA node with the deviation from the SMA or a VAR node. */
+} TA_PlanOp;
+
+typedef struct
+{
+   TA_ParamHolder *params; /* Copy of the caller parameters. */
+   TA_Integer startIdx;
+   TA_Integer endIdx;
+} TA_PlanRequest;
+
+typedef struct
+{
+   TA_Real *buffer;
+   size_t   size;   /* Nb of TA_Real */
+   int      isUsed;
+} TA_PlanBuffer;
+
+struct TA_Plan
+{
+   unsigned int magicNumber;
+
+   TA_PlanRequest *request;
+   unsigned int nbRequest;
+   unsigned int maxRequest;
+
+   /* Intermediate buffers, recycled between nodes and executions. */
+   TA_PlanBuffer *buffer;
+   unsigned int nbBuffer;
+};
+
+typedef struct
+{
+   TA_ParamHolder *params;
+   TA_Integer startIdx;
+   TA_Integer endIdx;
+
+   /* Nb of requests using this node and not yet completed. */
+   unsigned int nbRef;
+
+   /* Pool buffer receiving the outputs, TA_PLAN_NO_NODE when the
+    * outputs are written directly in the outputs of the request.
+    */
+   int bufferIdx;
+   int directRequest;
+
+   TA_CallResult result;
+} TA_PlanNode;
+
+typedef struct
+{
+   TA_PlanOp op;
+   int node[2];
+   int lastNode;
+} TA_PlanStep;
+
+typedef struct
+{
+   const char *start;
+   const char *end;
+   int isOutput;
+} TA_PlanRegion;
+
+/**** Local functions declarations.    ****/
+static int isPlanShareable( const TA_Plan *plan );
+static unsigned int addRegions( const TA_PlanRequest *request, TA_PlanRegion *region );
+static TA_RetCode planRequest( const TA_PlanRequest *request,
+                               TA_PlanNode *node, int *nbNode,
+                               TA_PlanStep *step );
+static TA_RetCode newNodeParams( const char *name,
+                                 const TA_ParamHolderPriv *source,
+                                 TA_ParamHolder **params );
+static TA_RetCode newMAParams( const TA_ParamHolderPriv *source,
+                               TA_Integer period, TA_Integer maType,
+                               TA_ParamHolder **params );
+static TA_RetCode newVARParams( const TA_ParamHolderPriv *source,
+                                TA_Integer period,
+                                TA_ParamHolder **params );
+static int addNode( TA_PlanNode *node, int *nbNode,
+                    TA_ParamHolder *params,
+                    TA_Integer startIdx, TA_Integer endIdx );
+static int isSameCall( const TA_ParamHolderPriv *priv1,
+                       const TA_ParamHolderPriv *priv2 );
+static void executeNode( TA_Plan *plan, TA_PlanNode *node,
+                         const TA_PlanRequest *request );
+static void completeRequest( const TA_PlanRequest *request,
+                             const TA_PlanStep *step,
+                             const TA_PlanNode *node,
+                             TA_CallResult *result,
+                             unsigned int *nbComputed );
+static void completeBBands( const TA_PlanRequest *request,
+                            const TA_PlanStep *step,
+                            const TA_PlanNode *node,
+                            TA_CallResult *result,
+                            unsigned int *nbComputed );
+static int acquireBuffer( TA_Plan *plan, size_t size );
+static size_t outputSize( const TA_OutputParameterInfo *outputInfo );
+
+/**** Local variables definitions.     ****/
+
+/* Indexed by TA_MAType. NULL when the MA is used as-is. */
+static const char *maFuncName[] =
+{
+   "SMA", "EMA", "WMA", "DEMA", "TEMA", "TRIMA", "KAMA", NULL, "T3"
+};
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_PlanAlloc( TA_Plan **plan )
+{
+   TA_Plan *newPlan;
+
+   if( !plan )
+      return TA_BAD_PARAM;
+
+   *plan = NULL;
+
+   newPlan = (TA_Plan *)TA_Malloc( sizeof(TA_Plan) );
+   if( !newPlan )
+      return TA_ALLOC_ERR;
+
+   memset( newPlan, 0, sizeof(TA_Plan) );
+   newPlan->magicNumber = TA_PLAN_MAGIC_NB;
+
+   *plan = newPlan;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_PlanFree( TA_Plan *plan )
+{
+   unsigned int i;
+
+   if( !plan )
+      return TA_SUCCESS;
+
+   if( plan->magicNumber != TA_PLAN_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   for( i=0; i < plan->nbRequest; i++ )
+      TA_ParamHolderFree( plan->request[i].params );
+
+   for( i=0; i < plan->nbBuffer; i++ )
+      TA_Free( plan->buffer[i].buffer );
+
+   if( plan->request )
+      TA_Free( plan->request );
+   if( plan->buffer )
+      TA_Free( plan->buffer );
+
+   plan->magicNumber = 0;
+   TA_Free( plan );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_PlanAdd( TA_Plan              *plan,
+                       const TA_ParamHolder *params,
+                       TA_Integer            startIdx,
+                       TA_Integer            endIdx )
+{
+   TA_PlanRequest *newRequest;
+   TA_ParamHolder *clone;
+   TA_RetCode retCode;
+   unsigned int newMax;
+
+   if( !plan || !params )
+      return TA_BAD_PARAM;
+
+   if( plan->magicNumber != TA_PLAN_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   if( plan->nbRequest == plan->maxRequest )
+   {
+      newMax = plan->maxRequest? plan->maxRequest*2 : 16;
+      newRequest = (TA_PlanRequest *)TA_Realloc( plan->request, newMax*sizeof(TA_PlanRequest) );
+      if( !newRequest )
+         return TA_ALLOC_ERR;
+      plan->request    = newRequest;
+      plan->maxRequest = newMax;
+   }
+
+   retCode = TA_ParamHolderClone( params, NULL, 0, &clone );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   newRequest = &plan->request[plan->nbRequest++];
+   newRequest->params   = clone;
+   newRequest->startIdx = startIdx;
+   newRequest->endIdx   = endIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_PlanExecute( TA_Plan       *plan,
+                           TA_CallResult *results,
+                           TA_PlanStats  *stats )
+{
+   TA_PlanStep *step;
+   TA_PlanNode *node;
+   int *completeOrder, *completeFirst;
+   int nbNode, i, j, k;
+   unsigned int nbKernel, nbComputed;
+   int isShared;
+   const TA_PlanRequest *request;
+   TA_RetCode retCode;
+
+   if( !plan || !results )
+      return TA_BAD_PARAM;
+
+   if( plan->magicNumber != TA_PLAN_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   if( stats )
+      memset( stats, 0, sizeof(TA_PlanStats) );
+
+   if( plan->nbRequest == 0 )
+      return TA_SUCCESS;
+
+   /* One block for all the working data. A request
+    * has at most two nodes.
+    */
+   step = (TA_PlanStep *)TA_EntryMalloc( NULL,
+                                         plan->nbRequest*(sizeof(TA_PlanStep)+2*sizeof(TA_PlanNode)+3*sizeof(int)) + sizeof(int),
+                                         &retCode );
+   if( !step )
+      return retCode;
+   node          = (TA_PlanNode *)&step[plan->nbRequest];
+   completeOrder = (int *)&node[2*plan->nbRequest];
+   completeFirst = &completeOrder[plan->nbRequest];
+
+   /* Sharing is possible only when no output overwrites
+    * the data of another request.
+    */
+   isShared = isPlanShareable( plan );
+
+   nbNode     = 0;
+   nbKernel   = 0;
+   nbComputed = 0;
+   retCode    = TA_SUCCESS;
+   for( i=0; i < (int)plan->nbRequest; i++ )
+   {
+      request = &plan->request[i];
+      step[i].op       = TA_PLAN_OP_CALL;
+      step[i].node[0]  = TA_PLAN_NO_NODE;
+      step[i].node[1]  = TA_PLAN_NO_NODE;
+      step[i].lastNode = TA_PLAN_NO_NODE;
+
+      if( isShared && (retCode == TA_SUCCESS) )
+         retCode = planRequest( request, node, &nbNode, &step[i] );
+
+      if( strcmp( ((const TA_ParamHolderPriv *)request->params->hiddenData)->funcInfo->name, "BBANDS" ) == 0 )
+         nbKernel += 2;
+      else
+         nbKernel++;
+   }
+
+   if( retCode != TA_SUCCESS )
+   {
+      /* Could not plan, just do all the calls. */
+      for( i=0; i < nbNode; i++ )
+         TA_ParamHolderFree( node[i].params );
+      nbNode = 0;
+      for( i=0; i < (int)plan->nbRequest; i++ )
+      {
+         step[i].op       = TA_PLAN_OP_CALL;
+         step[i].node[0]  = TA_PLAN_NO_NODE;
+         step[i].node[1]  = TA_PLAN_NO_NODE;
+         step[i].lastNode = TA_PLAN_NO_NODE;
+      }
+   }
+
+   /* The calls not shared with anything are done right away. A node
+    * used by a single request writes directly in its outputs.
+    */
+   for( i=0; i < (int)plan->nbRequest; i++ )
+   {
+      request = &plan->request[i];
+      if( step[i].op == TA_PLAN_OP_CALL )
+      {
+         results[i].retCode = TA_CallFunc( request->params,
+                                           request->startIdx, request->endIdx,
+                                           &results[i].outBegIdx,
+                                           &results[i].outNbElement );
+         nbComputed += (strcmp( ((const TA_ParamHolderPriv *)request->params->hiddenData)->funcInfo->name, "BBANDS" ) == 0)? 2 : 1;
+      }
+      else if( ((step[i].op == TA_PLAN_OP_COPY) || (step[i].op == TA_PLAN_OP_STDDEV)) &&
+               (node[step[i].node[0]].nbRef == 1) )
+      {
+         node[step[i].node[0]].directRequest = i;
+      }
+   }
+
+   /* Order the requests by their last node. */
+   for( i=0; i <= nbNode; i++ )
+      completeFirst[i] = 0;
+   for( i=0; i < (int)plan->nbRequest; i++ )
+   {
+      if( step[i].lastNode != TA_PLAN_NO_NODE )
+         completeFirst[step[i].lastNode+1]++;
+   }
+   for( i=0; i < nbNode; i++ )
+      completeFirst[i+1] += completeFirst[i];
+   for( i=0; i < (int)plan->nbRequest; i++ )
+   {
+      if( step[i].lastNode != TA_PLAN_NO_NODE )
+         completeOrder[completeFirst[step[i].lastNode]++] = i;
+   }
+
+   /* Evaluate the nodes, and complete each request
+    * as soon as all its nodes are done.
+    */
+   k = 0;
+   for( i=0; i < nbNode; i++ )
+   {
+      executeNode( plan, &node[i],
+                   node[i].directRequest == TA_PLAN_NO_NODE? NULL : &plan->request[node[i].directRequest] );
+      nbComputed++;
+
+      for( ; (k < (int)plan->nbRequest) && (k < completeFirst[i]); k++ )
+      {
+         j = completeOrder[k];
+         completeRequest( &plan->request[j], &step[j], node, &results[j], &nbComputed );
+
+         if( (step[j].node[0] != TA_PLAN_NO_NODE) && (--node[step[j].node[0]].nbRef == 0) &&
+             (node[step[j].node[0]].bufferIdx != TA_PLAN_NO_NODE) )
+            plan->buffer[node[step[j].node[0]].bufferIdx].isUsed = 0;
+
+         if( (step[j].node[1] != TA_PLAN_NO_NODE) && (--node[step[j].node[1]].nbRef == 0) &&
+             (node[step[j].node[1]].bufferIdx != TA_PLAN_NO_NODE) )
+            plan->buffer[node[step[j].node[1]].bufferIdx].isUsed = 0;
+      }
+   }
+
+   for( i=0; i < nbNode; i++ )
+      TA_ParamHolderFree( node[i].params );
+
+   TA_Free( step );
+
+   if( stats )
+   {
+      stats->nbRequest  = plan->nbRequest;
+      stats->nbKernel   = nbKernel;
+      stats->nbComputed = nbComputed;
+      stats->nbBuffer   = plan->nbBuffer;
+   }
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static int isPlanShareable( const TA_Plan *plan )
+{
+   const TA_FuncInfo *funcInfo;
+   TA_PlanRegion *region;
+   unsigned int nbRegion, i, j;
+   int isShareable;
+   TA_RetCode retCode;
+
+   /* Up to 6 buffers per input (price components). */
+   nbRegion = 0;
+   for( i=0; i < plan->nbRequest; i++ )
+   {
+      funcInfo = ((const TA_ParamHolderPriv *)plan->request[i].params->hiddenData)->funcInfo;
+      nbRegion += funcInfo->nbInput*6 + funcInfo->nbOutput;
+   }
+
+   region = (TA_PlanRegion *)TA_EntryMalloc( NULL, nbRegion*sizeof(TA_PlanRegion), &retCode );
+   if( !region )
+      return 0;
+
+   nbRegion = 0;
+   for( i=0; i < plan->nbRequest; i++ )
+      nbRegion += addRegions( &plan->request[i], &region[nbRegion] );
+
+   isShareable = 1;
+   for( i=0; (i < nbRegion) && isShareable; i++ )
+   {
+      if( !region[i].isOutput )
+         continue;
+
+      for( j=0; j < nbRegion; j++ )
+      {
+         if( (j != i) &&
+             (region[i].start < region[j].end) &&
+             (region[j].start < region[i].end) )
+         {
+            isShareable = 0;
+            break;
+         }
+      }
+   }
+
+   TA_Free( region );
+
+   return isShareable;
+}
+
+static unsigned int addRegions( const TA_PlanRequest *request, TA_PlanRegion *region )
+{
+   const TA_ParamHolderPriv *priv;
+   const TA_ParamHolderInput *input;
+   const TA_Real *price[6];
+   const char *data;
+   unsigned int i, j, nbRegion;
+   size_t size, stride;
+
+   priv = (const TA_ParamHolderPriv *)request->params->hiddenData;
+   if( (priv->inBitmap != 0) || (priv->outBitmap != 0) ||
+       (request->startIdx < 0) || (request->endIdx < request->startIdx) )
+   {
+      /* The call will fail without touching any buffer. */
+      return 0;
+   }
+
+   nbRegion = 0;
+   for( i=0; i < priv->funcInfo->nbInput; i++ )
+   {
+      input = &priv->in[i];
+      if( input->inputInfo->type == TA_Input_Price )
+      {
+         price[0] = input->data.inPrice.open;
+         price[1] = input->data.inPrice.high;
+         price[2] = input->data.inPrice.low;
+         price[3] = input->data.inPrice.close;
+         price[4] = input->data.inPrice.volume;
+         price[5] = input->data.inPrice.openInterest;
+         size = sizeof(TA_Real);
+      }
+      else
+      {
+         price[0] = input->data.inReal;
+         for( j=1; j < 6; j++ )
+            price[j] = NULL;
+         size = (input->inputInfo->type == TA_Input_Integer)? sizeof(TA_Integer) : sizeof(TA_Real);
+      }
+
+      stride = input->stride? input->stride : size;
+      for( j=0; j < 6; j++ )
+      {
+         if( price[j] )
+         {
+            data = (const char *)price[j];
+            region[nbRegion].start    = data;
+            region[nbRegion].end      = data + (size_t)request->endIdx*stride + size;
+            region[nbRegion].isOutput = 0;
+            nbRegion++;
+         }
+      }
+   }
+
+   for( i=0; i < priv->funcInfo->nbOutput; i++ )
+   {
+      data = (const char *)priv->out[i].data.outReal;
+      region[nbRegion].start    = data;
+      region[nbRegion].end      = data + (size_t)(request->endIdx-request->startIdx+1)*outputSize(priv->out[i].outputInfo);
+      region[nbRegion].isOutput = 1;
+      nbRegion++;
+   }
+
+   return nbRegion;
+}
+
+static TA_RetCode planRequest( const TA_PlanRequest *request,
+                               TA_PlanNode *node, int *nbNode,
+                               TA_PlanStep *step )
+{
+   const TA_ParamHolderPriv *priv;
+   const char *name;
+   TA_ParamHolder *params;
+   TA_Integer lookback, period, maType;
+   TA_RetCode retCode;
+   int maNode;
+
+   priv = (const TA_ParamHolderPriv *)request->params->hiddenData;
+
+   /* Let TA_CallFunc report the errors. */
+   if( (priv->inBitmap != 0) || (priv->outBitmap != 0) ||
+       (request->startIdx < 0) || (request->endIdx < request->startIdx) )
+      return TA_SUCCESS;
+
+   retCode = TA_GetLookback( request->params, &lookback );
+   if( (retCode != TA_SUCCESS) || (lookback < 0) )
+      return TA_SUCCESS;
+
+   name = priv->funcInfo->name;
+   params = NULL;
+
+   if( strcmp( name, "MA" ) == 0 )
+   {
+      period = priv->optIn[0].data.optInInteger;
+      maType = priv->optIn[1].data.optInInteger;
+      if( period > 1 )
+         retCode = newMAParams( priv, period, maType, &params );
+      step->op = TA_PLAN_OP_COPY;
+   }
+   else if( strcmp( name, "VAR" ) == 0 )
+   {
+      retCode = newVARParams( priv, priv->optIn[0].data.optInInteger, &params );
+      step->op = TA_PLAN_OP_COPY;
+   }
+   else if( strcmp( name, "STDDEV" ) == 0 )
+   {
+      retCode = newVARParams( priv, priv->optIn[0].data.optInInteger, &params );
+      step->op = TA_PLAN_OP_STDDEV;
+   }
+   else if( strcmp( name, "BBANDS" ) == 0 )
+   {
+      period = priv->optIn[0].data.optInInteger;
+      maType = priv->optIn[3].data.optInInteger;
+
+      /* The deviation from the SMA is re-calculated directly
+       * from the input, which must be contiguous.
+       */
+      if( (maType == TA_MAType_SMA) && (priv->in[0].stride != 0) )
+         return TA_SUCCESS;
+
+      retCode = newMAParams( priv, period, maType, &params );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      maNode = addNode( node, nbNode, params, request->startIdx, request->endIdx );
+
+      step->op       = TA_PLAN_OP_BBANDS;
+      step->node[0]  = maNode;
+      step->lastNode = maNode;
+
+      /* Like BBANDS, the STDDEV starts where the MA starts. */
+      if( (maType != TA_MAType_SMA) && (node[maNode].startIdx <= request->endIdx) )
+      {
+         retCode = newVARParams( priv, period, &params );
+         if( retCode != TA_SUCCESS )
+            return retCode;
+
+         step->node[1] = addNode( node, nbNode, params, node[maNode].startIdx, request->endIdx );
+         if( step->node[1] > step->lastNode )
+            step->lastNode = step->node[1];
+      }
+      return TA_SUCCESS;
+   }
+   else
+   {
+      step->op = TA_PLAN_OP_COPY;
+   }
+
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( !params )
+   {
+      retCode = TA_ParamHolderClone( request->params, NULL, 0, &params );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   step->node[0]  = addNode( node, nbNode, params, request->startIdx, request->endIdx );
+   step->lastNode = step->node[0];
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode newNodeParams( const char *name,
+                                 const TA_ParamHolderPriv *source,
+                                 TA_ParamHolder **params )
+{
+   const TA_FuncHandle *handle;
+   TA_ParamHolderPriv *priv;
+   TA_RetCode retCode;
+
+   retCode = TA_GetFuncHandle( name, &handle );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   retCode = TA_ParamHolderAlloc( handle, params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Same single TA_Real input, including its stride. */
+   priv = (TA_ParamHolderPriv *)(*params)->hiddenData;
+   priv->in[0].data   = source->in[0].data;
+   priv->in[0].stride = source->in[0].stride;
+   priv->inBitmap     = 0;
+   priv->context      = source->context;
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode newMAParams( const TA_ParamHolderPriv *source,
+                               TA_Integer period, TA_Integer maType,
+                               TA_ParamHolder **params )
+{
+   const char *name;
+   TA_RetCode retCode;
+
+   /* Same dispatch as TA_MA for a period > 1. */
+   name = NULL;
+   if( (maType >= 0) && (maType < (TA_Integer)(sizeof(maFuncName)/sizeof(maFuncName[0]))) )
+      name = maFuncName[maType];
+
+   retCode = newNodeParams( name? name : "MA", source, params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   retCode = TA_SetOptInputParamInteger( *params, 0, period );
+   if( retCode == TA_SUCCESS )
+   {
+      if( !name )
+         retCode = TA_SetOptInputParamInteger( *params, 1, maType );
+      else if( maType == TA_MAType_T3 )
+         retCode = TA_SetOptInputParamReal( *params, 1, 0.7 );
+   }
+
+   if( retCode != TA_SUCCESS )
+   {
+      TA_ParamHolderFree( *params );
+      *params = NULL;
+   }
+
+   return retCode;
+}
+
+static TA_RetCode newVARParams( const TA_ParamHolderPriv *source,
+                                TA_Integer period,
+                                TA_ParamHolder **params )
+{
+   TA_RetCode retCode;
+
+   retCode = newNodeParams( "VAR", source, params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* The nbDev of VAR is not used by the calculation. */
+   retCode = TA_SetOptInputParamInteger( *params, 0, period );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_SetOptInputParamReal( *params, 1, 1.0 );
+
+   if( retCode != TA_SUCCESS )
+   {
+      TA_ParamHolderFree( *params );
+      *params = NULL;
+   }
+
+   return retCode;
+}
+
+static int addNode( TA_PlanNode *node, int *nbNode,
+                    TA_ParamHolder *params,
+                    TA_Integer startIdx, TA_Integer endIdx )
+{
+   const TA_ParamHolderPriv *priv;
+   TA_Integer lookback;
+   TA_PlanNode *newNode;
+   int i;
+
+   /* The functions start at their lookback anyway, this makes
+    * the calls starting anywhere before it identical.
+    */
+   if( (TA_GetLookback( params, &lookback ) == TA_SUCCESS) &&
+       (lookback > startIdx) && (lookback <= endIdx) )
+      startIdx = lookback;
+
+   priv = (const TA_ParamHolderPriv *)params->hiddenData;
+   for( i=0; i < *nbNode; i++ )
+   {
+      if( (node[i].startIdx == startIdx) && (node[i].endIdx == endIdx) &&
+          isSameCall( priv, (const TA_ParamHolderPriv *)node[i].params->hiddenData ) )
+      {
+         TA_ParamHolderFree( params );
+         node[i].nbRef++;
+         return i;
+      }
+   }
+
+   newNode = &node[(*nbNode)++];
+   newNode->params        = params;
+   newNode->startIdx      = startIdx;
+   newNode->endIdx        = endIdx;
+   newNode->nbRef         = 1;
+   newNode->bufferIdx     = TA_PLAN_NO_NODE;
+   newNode->directRequest = TA_PLAN_NO_NODE;
+   newNode->result.retCode      = TA_SUCCESS;
+   newNode->result.outBegIdx    = 0;
+   newNode->result.outNbElement = 0;
+
+   return *nbNode-1;
+}
+
+static int isSameCall( const TA_ParamHolderPriv *priv1,
+                       const TA_ParamHolderPriv *priv2 )
+{
+   unsigned int i;
+
+   if( (priv1->funcInfo != priv2->funcInfo) || (priv1->context != priv2->context) )
+      return 0;
+
+   /* The holders are zeroed on allocation, comparing the
+    * unions as a whole is fine.
+    */
+   for( i=0; i < priv1->funcInfo->nbInput; i++ )
+   {
+      if( (priv1->in[i].stride != priv2->in[i].stride) ||
+          (memcmp( &priv1->in[i].data, &priv2->in[i].data, sizeof(priv1->in[i].data) ) != 0) )
+         return 0;
+   }
+
+   for( i=0; i < priv1->funcInfo->nbOptInput; i++ )
+   {
+      if( memcmp( &priv1->optIn[i].data, &priv2->optIn[i].data, sizeof(priv1->optIn[i].data) ) != 0 )
+         return 0;
+   }
+
+   return 1;
+}
+
+static void executeNode( TA_Plan *plan, TA_PlanNode *node,
+                         const TA_PlanRequest *request )
+{
+   TA_ParamHolderPriv *priv;
+   const TA_ParamHolderPriv *requestPriv;
+   unsigned int i;
+   size_t nbElement;
+   TA_Real *buffer;
+
+   priv = (TA_ParamHolderPriv *)node->params->hiddenData;
+
+   if( request )
+   {
+      /* Only user of this node, same outputs. */
+      requestPriv = (const TA_ParamHolderPriv *)request->params->hiddenData;
+      for( i=0; i < priv->funcInfo->nbOutput; i++ )
+         priv->out[i].data = requestPriv->out[i].data;
+   }
+   else
+   {
+      /* A TA_Real is large enough for any output type. */
+      nbElement = (size_t)(node->endIdx-node->startIdx+1);
+      node->bufferIdx = acquireBuffer( plan, nbElement*priv->funcInfo->nbOutput );
+      if( node->bufferIdx == TA_PLAN_NO_NODE )
+      {
+         node->result.retCode = TA_ALLOC_ERR;
+         node->result.outNbElement = 0;
+         return;
+      }
+
+      buffer = plan->buffer[node->bufferIdx].buffer;
+      for( i=0; i < priv->funcInfo->nbOutput; i++ )
+         priv->out[i].data.outReal = &buffer[i*nbElement];
+   }
+   priv->outBitmap = 0;
+
+   node->result.retCode = TA_CallFunc( node->params, node->startIdx, node->endIdx,
+                                       &node->result.outBegIdx,
+                                       &node->result.outNbElement );
+}
+
+static void completeRequest( const TA_PlanRequest *request,
+                             const TA_PlanStep *step,
+                             const TA_PlanNode *node,
+                             TA_CallResult *result,
+                             unsigned int *nbComputed )
+{
+   const TA_ParamHolderPriv *priv, *nodePriv;
+   const TA_PlanNode *source;
+   const TA_Real *var;
+   TA_Real *out;
+   TA_Real tempReal, nbDev;
+   unsigned int i;
+   int j;
+
+   if( step->op == TA_PLAN_OP_BBANDS )
+   {
+      completeBBands( request, step, node, result, nbComputed );
+      return;
+   }
+
+   priv     = (const TA_ParamHolderPriv *)request->params->hiddenData;
+   source   = &node[step->node[0]];
+   nodePriv = (const TA_ParamHolderPriv *)source->params->hiddenData;
+
+   *result = source->result;
+   if( result->retCode != TA_SUCCESS )
+      return;
+
+   if( step->op == TA_PLAN_OP_STDDEV )
+   {
+      /* Same as TA_STDDEV. */
+      var   = nodePriv->out[0].data.outReal;
+      out   = priv->out[0].data.outReal;
+      nbDev = priv->optIn[1].data.optInReal;
+      for( j=0; j < result->outNbElement; j++ )
+      {
+         tempReal = var[j];
+         if( TA_IS_ZERO_OR_NEG(tempReal) )
+            out[j] = (double)0.0;
+         else if( nbDev != 1.0 )
+            out[j] = sqrt(tempReal) * nbDev;
+         else
+            out[j] = sqrt(tempReal);
+      }
+   }
+   else if( nodePriv->out[0].data.outReal != priv->out[0].data.outReal )
+   {
+      for( i=0; i < priv->funcInfo->nbOutput; i++ )
+      {
+         memcpy( priv->out[i].data.outReal, nodePriv->out[i].data.outReal,
+                 (size_t)result->outNbElement * outputSize(priv->out[i].outputInfo) );
+      }
+   }
+}
+
+static void completeBBands( const TA_PlanRequest *request,
+                            const TA_PlanStep *step,
+                            const TA_PlanNode *node,
+                            TA_CallResult *result,
+                            unsigned int *nbComputed )
+{
+   const TA_ParamHolderPriv *priv;
+   const TA_PlanNode *maNode, *varNode;
+   const TA_Real *ma, *var;
+   TA_Real *outRealUpperBand, *outRealMiddleBand, *outRealLowerBand;
+   TA_Real optInNbDevUp, optInNbDevDn, tempReal, tempReal2;
+   TA_Integer optInTimePeriod;
+   int i;
+
+   priv   = (const TA_ParamHolderPriv *)request->params->hiddenData;
+   maNode = &node[step->node[0]];
+   ma     = ((const TA_ParamHolderPriv *)maNode->params->hiddenData)->out[0].data.outReal;
+
+   optInTimePeriod   = priv->optIn[0].data.optInInteger;
+   optInNbDevUp      = priv->optIn[1].data.optInReal;
+   optInNbDevDn      = priv->optIn[2].data.optInReal;
+   outRealUpperBand  = priv->out[0].data.outReal;
+   outRealMiddleBand = priv->out[1].data.outReal;
+   outRealLowerBand  = priv->out[2].data.outReal;
+
+   *result = maNode->result;
+   if( (result->retCode != TA_SUCCESS) || (result->outNbElement == 0) )
+   {
+      result->outNbElement = 0;
+      return;
+   }
+
+   /* The deviation goes in the upper band, like in TA_BBANDS. */
+   if( step->node[1] == TA_PLAN_NO_NODE )
+   {
+      if( priv->optIn[3].data.optInInteger != TA_MAType_SMA )
+      {
+         /* Not expected, let the function do it. */
+         result->retCode = TA_CallFunc( request->params, request->startIdx, request->endIdx,
+                                        &result->outBegIdx, &result->outNbElement );
+         (*nbComputed)++;
+         return;
+      }
+
+      TA_INT_stddev_using_precalc_ma( priv->in[0].data.inReal, ma,
+                                      result->outBegIdx, result->outNbElement,
+                                      optInTimePeriod, outRealUpperBand );
+      (*nbComputed)++;
+   }
+   else
+   {
+      varNode = &node[step->node[1]];
+      if( varNode->startIdx != result->outBegIdx )
+      {
+         result->retCode = TA_CallFunc( request->params, request->startIdx, request->endIdx,
+                                        &result->outBegIdx, &result->outNbElement );
+         (*nbComputed)++;
+         return;
+      }
+
+      *result = varNode->result;
+      if( result->retCode != TA_SUCCESS )
+      {
+         result->outNbElement = 0;
+         return;
+      }
+
+      var = ((const TA_ParamHolderPriv *)varNode->params->hiddenData)->out[0].data.outReal;
+      for( i=0; i < result->outNbElement; i++ )
+      {
+         tempReal = var[i];
+         if( !TA_IS_ZERO_OR_NEG(tempReal) )
+            outRealUpperBand[i] = sqrt(tempReal);
+         else
+            outRealUpperBand[i] = (double)0.0;
+      }
+   }
+
+   memcpy( outRealMiddleBand, ma, (size_t)result->outNbElement * sizeof(TA_Real) );
+
+   /* Same loops as TA_BBANDS. */
+   if( optInNbDevUp == optInNbDevDn )
+   {
+      if( optInNbDevUp == 1.0 )
+      {
+         for( i=0; i < result->outNbElement; i++ )
+         {
+            tempReal  = outRealUpperBand[i];
+            tempReal2 = outRealMiddleBand[i];
+            outRealUpperBand[i] = tempReal2 + tempReal;
+            outRealLowerBand[i] = tempReal2 - tempReal;
+         }
+      }
+      else
+      {
+         for( i=0; i < result->outNbElement; i++ )
+         {
+            tempReal  = outRealUpperBand[i] * optInNbDevUp;
+            tempReal2 = outRealMiddleBand[i];
+            outRealUpperBand[i] = tempReal2 + tempReal;
+            outRealLowerBand[i] = tempReal2 - tempReal;
+         }
+      }
+   }
+   else if( optInNbDevUp == 1.0 )
+   {
+      for( i=0; i < result->outNbElement; i++ )
+      {
+         tempReal  = outRealUpperBand[i];
+         tempReal2 = outRealMiddleBand[i];
+         outRealUpperBand[i] = tempReal2 + tempReal;
+         outRealLowerBand[i] = tempReal2 - (tempReal * optInNbDevDn);
+      }
+   }
+   else if( optInNbDevDn == 1.0 )
+   {
+      for( i=0; i < result->outNbElement; i++ )
+      {
+         tempReal  = outRealUpperBand[i];
+         tempReal2 = outRealMiddleBand[i];
+         outRealLowerBand[i] = tempReal2 - tempReal;
+         outRealUpperBand[i] = tempReal2 + (tempReal * optInNbDevUp);
+      }
+   }
+   else
+   {
+      for( i=0; i < result->outNbElement; i++ )
+      {
+         tempReal  = outRealUpperBand[i];
+         tempReal2 = outRealMiddleBand[i];
+         outRealUpperBand[i] = tempReal2 + (tempReal * optInNbDevUp);
+         outRealLowerBand[i] = tempReal2 - (tempReal * optInNbDevDn);
+      }
+   }
+}
+
+static int acquireBuffer( TA_Plan *plan, size_t size )
+{
+   TA_PlanBuffer *newBuffer;
+   int i, best;
+
+   /* Smallest free buffer large enough. */
+   best = TA_PLAN_NO_NODE;
+   for( i=0; i < (int)plan->nbBuffer; i++ )
+   {
+      if( !plan->buffer[i].isUsed && (plan->buffer[i].size >= size) &&
+          ((best == TA_PLAN_NO_NODE) || (plan->buffer[i].size < plan->buffer[best].size)) )
+         best = i;
+   }
+
+   if( best == TA_PLAN_NO_NODE )
+   {
+      newBuffer = (TA_PlanBuffer *)TA_Realloc( plan->buffer, (plan->nbBuffer+1)*sizeof(TA_PlanBuffer) );
+      if( !newBuffer )
+         return TA_PLAN_NO_NODE;
+      plan->buffer = newBuffer;
+
+      newBuffer = &plan->buffer[plan->nbBuffer];
+      newBuffer->buffer = (TA_Real *)TA_Malloc( size*sizeof(TA_Real) );
+      if( !newBuffer->buffer )
+         return TA_PLAN_NO_NODE;
+      newBuffer->size = size;
+      best = (int)plan->nbBuffer++;
+   }
+
+   plan->buffer[best].isUsed = 1;
+
+   return best;
+}
+
+static size_t outputSize( const TA_OutputParameterInfo *outputInfo )
+{
+   return (outputInfo->type == TA_Output_Integer)? sizeof(TA_Integer) : sizeof(TA_Real);
+}
@@ -0,0 +1,562 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *  101926 AG   The wrappers also call the TA_TRACE hooks.
+ *  101926 AG   Count the allocations, add TA_SetStrictAlloc.
+ *  101926 AG   maxLiveByte is the peak of the bytes in use, not the
+ *              bytes requested.
+ *  101926 AG   Reuse the block of a thread which exited.
+ */
+
+/* Description:
+ *   Per-function call statistics (see ta_stats.h).
+ *
+ *   Each thread gets its own block of counters on its first measured
+ *   call. The blocks are chained in a list (lock-free insertion) and
+ *   are never freed, since a thread may still be using its block.
+ *   With POSIX threads, the block of a thread which exited is marked
+ *   free (a pthread key destructor) and is then taken over, with its
+ *   counts, by the next new thread. So the list does not grow with
+ *   short-lived threads.
+ *   TA_ResetStats only records the current totals, which are then
+ *   subtracted by TA_GetStats, so the counters are only written by
+ *   their own thread.
+ */
+
+/**** Headers ****/
+#if defined( TA_STATS ) && !defined( _WIN32 ) && !defined( _POSIX_C_SOURCE )
+   #define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( TA_STATS )
+   #if defined( _WIN32 )
+      #include <windows.h>
+   #else
+      #include <time.h>
+      #if !defined( TA_NO_THREADS )
+         #include <pthread.h>
+      #endif
+   #endif
+#endif
+
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_global.h"
+#include "ta_magic_nb.h"
+#include "ta_stats.h"
+#include "ta_stats_priv.h"
+#include "ta_def_ui.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+extern const TA_FuncDef *TA_SortedFuncDef[];
+extern const unsigned int TA_TotalNbFunction;
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   unsigned int magicNumber;
+} TA_StatsTablePriv;
+
+#if defined( TA_STATS )
+
+typedef struct
+{
+   TA_Integer64 nbCall;
+   TA_Integer64 nbElement;
+   TA_Integer64 nbNanoSec;
+   TA_Integer64 nbAllocByte;
+   TA_Integer64 nbAlloc;
+   TA_Integer64 nbHeapAlloc;
+   TA_Integer64 maxLiveByte; /* Since the reset statsResetId. */
+} TA_StatsCount;
+
+typedef struct TA_StatsBlock
+{
+   struct TA_StatsBlock *next;
+   volatile int isFree;    /* Its thread exited. */
+   unsigned int resetId;
+   TA_StatsCount count[1]; /* TA_TotalNbFunction elements. */
+} TA_StatsBlock;
+
+#if defined( TA_NO_THREADS )
+   #define STATS_CAS(ptr,oldValue,newValue) ((*(ptr) == (oldValue))? (*(ptr) = (newValue), 1) : 0)
+#elif defined( _MSC_VER )
+   #define STATS_CAS(ptr,oldValue,newValue) (InterlockedCompareExchangePointer((PVOID volatile *)(ptr),(newValue),(oldValue)) == (oldValue))
+#else
+   #define STATS_CAS(ptr,oldValue,newValue) __sync_bool_compare_and_swap((ptr),(oldValue),(newValue))
+#endif
+
+/* Blocks of the exited threads are reused (POSIX threads only). */
+#if !defined( TA_NO_THREADS ) && !defined( _WIN32 )
+   #define STATS_REUSE_BLOCK
+#endif
+
+#endif
+
+/**** Local functions declarations.    ****/
+#if defined( TA_STATS )
+static TA_Integer64 statsClock( void );
+static TA_StatsBlock *statsAllocBlock( void );
+static void statsSum( TA_StatsCount *total );
+#if defined( STATS_REUSE_BLOCK )
+static TA_StatsBlock *statsReuseBlock( void );
+static void statsKeyCreate( void );
+static void statsThreadExit( void *block );
+#endif
+#endif
+
+/**** Local variables definitions.     ****/
+#if defined( TA_STATS )
+static TA_StatsBlock *volatile statsBlockList = NULL;
+static TA_THREAD_LOCAL TA_StatsBlock *statsThreadBlock = NULL;
+
+/* Totals at the last TA_ResetStats (NULL before the first reset).
+ * A maximum cannot be subtracted, so a block restarts its maxLiveByte
+ * on its first call after a reset (see statsResetId).
+ */
+static TA_StatsCount *statsResetCount = NULL;
+static volatile unsigned int statsResetId = 0;
+
+#if defined( STATS_REUSE_BLOCK )
+/* Its destructor frees the block of an exiting thread. */
+static pthread_once_t statsKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t statsKey;
+static int statsKeyValid = 0;
+#endif
+#endif
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_GetStats( TA_StatsTable **table )
+{
+#if defined( TA_STATS )
+   TA_StatsTable *newTable;
+   TA_StatsTablePriv *tablePriv;
+   TA_FuncStats *stats;
+   TA_StatsCount *total;
+   unsigned int i, nbFunc, nbCalled;
+
+   if( !table )
+      return TA_BAD_PARAM;
+   *table = NULL;
+
+   nbFunc = TA_TotalNbFunction;
+   total = (TA_StatsCount *)TA_Malloc( sizeof(TA_StatsCount)*nbFunc );
+   if( !total )
+      return TA_ALLOC_ERR;
+
+   statsSum( total );
+
+   nbCalled = 0;
+   for( i=0; i < nbFunc; i++ )
+   {
+      if( total[i].nbCall != 0 )
+         nbCalled++;
+   }
+
+   /* The table, its private data and the stats in one block. */
+   newTable = (TA_StatsTable *)TA_Malloc( sizeof(TA_StatsTable) +
+                                          sizeof(TA_FuncStats)*(nbCalled? nbCalled : 1) +
+                                          sizeof(TA_StatsTablePriv) );
+   if( !newTable )
+   {
+      TA_Free( total );
+      return TA_ALLOC_ERR;
+   }
+
+   stats = (TA_FuncStats *)(newTable+1);
+   tablePriv = (TA_StatsTablePriv *)(stats+(nbCalled? nbCalled : 1));
+   tablePriv->magicNumber = TA_STATS_TABLE_MAGIC_NB;
+
+   newTable->size       = nbCalled;
+   newTable->stats      = stats;
+   newTable->hiddenData = tablePriv;
+
+   for( i=0; i < nbFunc; i++ )
+   {
+      if( total[i].nbCall == 0 )
+         continue;
+
+      stats->handle      = (const TA_FuncHandle *)TA_SortedFuncDef[i];
+      stats->nbCall      = total[i].nbCall;
+      stats->nbElement   = total[i].nbElement;
+      stats->nbNanoSec   = total[i].nbNanoSec;
+      stats->nbAllocByte = total[i].nbAllocByte;
+      stats->nbAlloc      = total[i].nbAlloc;
+      stats->nbHeapAlloc  = total[i].nbHeapAlloc;
+      stats->maxLiveByte  = total[i].maxLiveByte;
+      stats++;
+   }
+
+   TA_Free( total );
+   *table = newTable;
+
+   return TA_SUCCESS;
+#else
+   if( table )
+      *table = NULL;
+
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+TA_RetCode TA_StatsTableFree( TA_StatsTable *table )
+{
+   TA_StatsTablePriv *tablePriv;
+
+   if( table )
+   {
+      tablePriv = (TA_StatsTablePriv *)table->hiddenData;
+      if( !tablePriv )
+         return TA_INTERNAL_ERROR(185);
+
+      if( tablePriv->magicNumber != TA_STATS_TABLE_MAGIC_NB )
+         return TA_BAD_OBJECT;
+
+      tablePriv->magicNumber = 0;
+      TA_Free( table );
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResetStats( void )
+{
+#if defined( TA_STATS )
+   TA_StatsCount *total;
+
+   total = statsResetCount;
+   if( !total )
+   {
+      /* Kept until the end of the process, like the blocks. */
+      total = (TA_StatsCount *)malloc( sizeof(TA_StatsCount)*TA_TotalNbFunction );
+      if( !total )
+         return TA_ALLOC_ERR;
+      memset( total, 0, sizeof(TA_StatsCount)*TA_TotalNbFunction );
+   }
+
+   /* The new reference is the current totals (without
+    * subtracting the previous reference).
+    */
+   statsResetCount = NULL;
+   statsSum( total );
+   statsResetCount = total;
+   statsResetId++;
+
+   return TA_SUCCESS;
+#else
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+TA_RetCode TA_SetStrictAlloc( int enable,
+                              TA_StrictAllocFunc hook,
+                              void *userData )
+{
+#if defined( TA_STATS )
+   TA_StatsStrict.enabled  = 0;
+   TA_StatsStrict.hook     = hook;
+   TA_StatsStrict.userData = userData;
+   TA_StatsStrict.enabled  = enable? 1 : 0;
+
+   return TA_SUCCESS;
+#else
+   (void)enable;
+   (void)hook;
+   (void)userData;
+
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+#if defined( TA_STATS ) || defined( TA_TRACE )
+void TA_StatsBegin( TA_StatsCall *call,
+                    unsigned int funcIdx,
+                    int startIdx,
+                    int endIdx )
+{
+   call->funcIdx = funcIdx;
+
+#if defined( TA_TRACE )
+   call->trace.name     = TA_SortedFuncDef[funcIdx]->funcInfo->name;
+   call->trace.handle   = (const TA_FuncHandle *)TA_SortedFuncDef[funcIdx];
+   call->trace.startIdx = startIdx;
+   call->trace.endIdx   = endIdx;
+   TA_TraceEnter( &call->trace );
+#else
+   (void)startIdx;
+   (void)endIdx;
+#endif
+
+   /* Started after the hook, so its time is not counted. */
+#if defined( TA_STATS )
+   call->allocByte   = TA_StatsThreadData.allocByte;
+   call->nbAlloc     = TA_StatsThreadData.nbAlloc;
+   call->nbHeapAlloc = TA_StatsThreadData.nbHeapAlloc;
+   call->handle      = TA_StatsThreadData.handle;
+
+   /* The peak of the bytes in use restarts for this call. */
+   call->liveByte     = TA_StatsThreadData.liveByte;
+   call->peakLiveByte = TA_StatsThreadData.peakLiveByte;
+   TA_StatsThreadData.peakLiveByte = TA_StatsThreadData.liveByte;
+
+   TA_StatsThreadData.handle = TA_SortedFuncDef[funcIdx];
+   TA_StatsThreadData.depth++;
+   call->start = statsClock();
+#endif
+}
+
+TA_RetCode TA_StatsEnd( TA_StatsCall *call,
+                        TA_RetCode retCode,
+                        const int *outNBElement )
+{
+#if defined( TA_STATS )
+   TA_StatsThread *thread;
+   TA_StatsBlock *block;
+   TA_StatsCount *count;
+   TA_Integer64 end, liveByte;
+   unsigned int i;
+
+   end = statsClock();
+
+   thread = &TA_StatsThreadData;
+   thread->handle = call->handle;
+   thread->depth--;
+
+   /* Also a peak for the enclosing call. */
+   liveByte = thread->peakLiveByte - call->liveByte;
+   if( call->peakLiveByte > thread->peakLiveByte )
+      thread->peakLiveByte = call->peakLiveByte;
+
+   /* The functions fail with TA_ALLOC_ERR on a denied allocation. */
+   if( thread->denied )
+   {
+      if( retCode == TA_ALLOC_ERR )
+         retCode = TA_ALLOC_FORBIDDEN;
+      if( thread->depth == 0 )
+         thread->denied = 0;
+   }
+
+   block = statsThreadBlock;
+   if( !block )
+      block = statsAllocBlock();
+
+   if( block )
+   {
+      if( block->resetId != statsResetId )
+      {
+         block->resetId = statsResetId;
+         for( i=0; i < TA_TotalNbFunction; i++ )
+            block->count[i].maxLiveByte = 0;
+      }
+
+      count = &block->count[call->funcIdx];
+      count->nbCall++;
+      if( outNBElement )
+         count->nbElement += *outNBElement;
+      count->nbNanoSec   += end - call->start;
+      count->nbAllocByte += thread->allocByte - call->allocByte;
+      count->nbAlloc     += thread->nbAlloc - call->nbAlloc;
+      count->nbHeapAlloc += thread->nbHeapAlloc - call->nbHeapAlloc;
+      if( liveByte > count->maxLiveByte )
+         count->maxLiveByte = liveByte;
+   }
+#else
+   (void)outNBElement;
+#endif
+
+#if defined( TA_TRACE )
+   TA_TraceExit( &call->trace, retCode );
+#endif
+
+   return retCode;
+}
+#endif
+
+/**** Local functions definitions.     ****/
+#if defined( TA_STATS )
+static TA_Integer64 statsClock( void )
+{
+#if defined( _WIN32 )
+   static LARGE_INTEGER freq;
+   LARGE_INTEGER now;
+
+   if( freq.QuadPart == 0 )
+      QueryPerformanceFrequency( &freq );
+   QueryPerformanceCounter( &now );
+   return (TA_Integer64)((double)now.QuadPart * 1.0e9 / (double)freq.QuadPart);
+#else
+   struct timespec now;
+
+   clock_gettime( CLOCK_MONOTONIC, &now );
+   return (TA_Integer64)now.tv_sec*1000000000 + (TA_Integer64)now.tv_nsec;
+#endif
+}
+
+static TA_StatsBlock *statsAllocBlock( void )
+{
+   TA_StatsBlock *block, *head;
+   size_t size;
+
+#if defined( STATS_REUSE_BLOCK )
+   block = statsReuseBlock();
+   if( block )
+      return block;
+#endif
+
+   /* Not from TA_Malloc, this memory is not for a TA function. */
+   size = offsetof(TA_StatsBlock,count) + sizeof(TA_StatsCount)*TA_TotalNbFunction;
+   block = (TA_StatsBlock *)malloc( size );
+   if( !block )
+      return NULL;
+   memset( block, 0, size );
+   block->resetId = statsResetId;
+
+   do
+   {
+      head = statsBlockList;
+      block->next = head;
+   } while( !STATS_CAS( &statsBlockList, head, block ) );
+
+   statsThreadBlock = block;
+#if defined( STATS_REUSE_BLOCK )
+   if( statsKeyValid )
+      pthread_setspecific( statsKey, block );
+#endif
+
+   return block;
+}
+
+#if defined( STATS_REUSE_BLOCK )
+/* Take over the block of a thread which exited, with its counts
+ * (NULL when there is none).
+ */
+static TA_StatsBlock *statsReuseBlock( void )
+{
+   TA_StatsBlock *block;
+
+   pthread_once( &statsKeyOnce, statsKeyCreate );
+   if( !statsKeyValid )
+      return NULL;
+
+   for( block = statsBlockList; block; block = block->next )
+   {
+      if( block->isFree && STATS_CAS( &block->isFree, 1, 0 ) )
+      {
+         statsThreadBlock = block;
+         pthread_setspecific( statsKey, block );
+         return block;
+      }
+   }
+
+   return NULL;
+}
+
+static void statsKeyCreate( void )
+{
+   statsKeyValid = (pthread_key_create( &statsKey, statsThreadExit ) == 0);
+}
+
+static void statsThreadExit( void *block )
+{
+   /* After all the counts of the thread are written. */
+   __sync_synchronize();
+   ((TA_StatsBlock *)block)->isFree = 1;
+}
+#endif
+
+static void statsSum( TA_StatsCount *total )
+{
+   const TA_StatsBlock *block;
+   unsigned int i, nbFunc, resetId;
+
+   nbFunc  = TA_TotalNbFunction;
+   resetId = statsResetId;
+   memset( total, 0, sizeof(TA_StatsCount)*nbFunc );
+
+   for( block = statsBlockList; block; block = block->next )
+   {
+      for( i=0; i < nbFunc; i++ )
+      {
+         total[i].nbCall      += block->count[i].nbCall;
+         total[i].nbElement   += block->count[i].nbElement;
+         total[i].nbNanoSec   += block->count[i].nbNanoSec;
+         total[i].nbAllocByte += block->count[i].nbAllocByte;
+         total[i].nbAlloc     += block->count[i].nbAlloc;
+         total[i].nbHeapAlloc += block->count[i].nbHeapAlloc;
+         if( (block->resetId == resetId) &&
+             (block->count[i].maxLiveByte > total[i].maxLiveByte) )
+            total[i].maxLiveByte = block->count[i].maxLiveByte;
+      }
+   }
+
+   if( statsResetCount )
+   {
+      for( i=0; i < nbFunc; i++ )
+      {
+         total[i].nbCall      -= statsResetCount[i].nbCall;
+         total[i].nbElement   -= statsResetCount[i].nbElement;
+         total[i].nbNanoSec   -= statsResetCount[i].nbNanoSec;
+         total[i].nbAllocByte -= statsResetCount[i].nbAllocByte;
+         total[i].nbAlloc     -= statsResetCount[i].nbAlloc;
+         total[i].nbHeapAlloc -= statsResetCount[i].nbHeapAlloc;
+      }
+   }
+}
+#endif
+
+/***************/
+/* End of File */
+/***************/
@@ -0,0 +1,86 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_STATS_PRIV_H
+#define TA_STATS_PRIV_H
+
+/* Used by the wrappers of ta_func_stats.c (generated by gen_code)
+ * when TA_STATS or TA_TRACE is defined. See ta_stats.h and ta_trace.h
+ */
+
+#ifndef TA_COMMON_H
+   #include "ta_common.h"
+#endif
+
+#ifndef TA_TRACE_H
+   #include "ta_trace.h"
+#endif
+
+typedef struct
+{
+   unsigned int funcIdx;   /* Index of the function in TA_SortedFuncDef. */
+#if defined( TA_STATS )
+   TA_Integer64 start;     /* Nanoseconds. */
+
+   /* TA_StatsThreadData when the call started. */
+   TA_Integer64 allocByte;
+   TA_Integer64 nbAlloc;
+   TA_Integer64 nbHeapAlloc;
+   TA_Integer64 liveByte;
+   TA_Integer64 peakLiveByte;
+   const void  *handle;
+#endif
+#if defined( TA_TRACE )
+   TA_TraceCall trace;
+#endif
+} TA_StatsCall;
+
+void TA_StatsBegin( TA_StatsCall *call,
+                    unsigned int funcIdx,
+                    int startIdx,
+                    int endIdx );
+
+/* Return the retCode of the call, TA_ALLOC_FORBIDDEN when the
+ * failure is due to the strict allocation mode.
+ */
+TA_RetCode TA_StatsEnd( TA_StatsCall *call,
+                        TA_RetCode retCode,
+                        const int *outNBElement );
+
+/* Call the hooks of TA_SetTraceHooks (ta_trace.c). Also used
+ * directly by the wrappers of the internal functions.
+ */
+void TA_TraceEnter( TA_TraceCall *call );
+void TA_TraceExit ( const TA_TraceCall *call, TA_RetCode retCode );
+
+#endif
@@ -0,0 +1,452 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ */
+
+/* Description:
+ *   Function entry/exit tracing hooks (see ta_trace.h).
+ *
+ *   The TA_XXX wrappers of ta_func_stats.c call TA_TraceEnter and
+ *   TA_TraceExit through TA_StatsBegin/TA_StatsEnd. The internal
+ *   functions (TA_INT_EMA etc.) are renamed TA_INT_XXX_Kernel in the
+ *   file defining them, and the wrappers below are what the other
+ *   TA functions call.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include "ta_common.h"
+#include "ta_global.h"
+#include "ta_trace.h"
+#include "ta_stats_priv.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+#if defined( TA_TRACE )
+TA_RetCode TA_INT_SMA_Kernel( int startIdx, int endIdx, const double *inReal,
+                              int optInTimePeriod, int *outBegIdx,
+                              int *outNBElement, double *outReal );
+TA_RetCode TA_S_INT_SMA_Kernel( int startIdx, int endIdx, const float *inReal,
+                                int optInTimePeriod, int *outBegIdx,
+                                int *outNBElement, double *outReal );
+TA_RetCode TA_INT_EMA_Kernel( int startIdx, int endIdx, const double *inReal,
+                              int optInTimePeriod, double optInK_1,
+                              int *outBegIdx, int *outNBElement, double *outReal );
+TA_RetCode TA_S_INT_EMA_Kernel( int startIdx, int endIdx, const float *inReal,
+                                int optInTimePeriod, double optInK_1,
+                                int *outBegIdx, int *outNBElement, double *outReal );
+TA_RetCode TA_INT_MACD_Kernel( int startIdx, int endIdx, const double inReal[],
+                               int optInFastPeriod, int optInSlowPeriod,
+                               int optInSignalPeriod_2, int *outBegIdx,
+                               int *outNBElement, double outRealMACD_0[],
+                               double outRealMACDSignal_1[],
+                               double outRealMACDHist_2[] );
+TA_RetCode TA_S_INT_MACD_Kernel( int startIdx, int endIdx, const float inReal[],
+                                 int optInFastPeriod, int optInSlowPeriod,
+                                 int optInSignalPeriod_2, int *outBegIdx,
+                                 int *outNBElement, double outRealMACD_0[],
+                                 double outRealMACDSignal_1[],
+                                 double outRealMACDHist_2[] );
+TA_RetCode TA_INT_PO_Kernel( int startIdx, int endIdx, const double *inReal,
+                             int optInFastPeriod, int optInSlowPeriod,
+                             TA_MAType optInMethod_2, int *outBegIdx,
+                             int *outNBElement, double *outReal,
+                             double *tempBuffer, int doPercentageOutput );
+TA_RetCode TA_S_INT_PO_Kernel( int startIdx, int endIdx, const float *inReal,
+                               int optInFastPeriod, int optInSlowPeriod,
+                               TA_MAType optInMethod_2, int *outBegIdx,
+                               int *outNBElement, double *outReal,
+                               double *tempBuffer, int doPercentageOutput );
+TA_RetCode TA_INT_VAR_Kernel( int startIdx, int endIdx, const double *inReal,
+                              int optInTimePeriod, int *outBegIdx,
+                              int *outNBElement, double *outReal );
+TA_RetCode TA_S_INT_VAR_Kernel( int startIdx, int endIdx, const float *inReal,
+                                int optInTimePeriod, int *outBegIdx,
+                                int *outNBElement, double *outReal );
+void TA_INT_stddev_using_precalc_ma_Kernel( const double *inReal,
+                                            const double *inMovAvg,
+                                            int inMovAvgBegIdx,
+                                            int inMovAvgNbElement,
+                                            int timePeriod, double *output );
+void TA_S_INT_stddev_using_precalc_ma_Kernel( const float *inReal,
+                                              const double *inMovAvg,
+                                              int inMovAvgBegIdx,
+                                              int inMovAvgNbElement,
+                                              int timePeriod, double *output );
+#endif
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#if defined( TA_TRACE )
+typedef struct
+{
+   TA_TraceEnterFunc onEnter;
+   TA_TraceExitFunc  onExit;
+   void *userData;
+} TA_TraceHooks;
+#endif
+
+/**** Local functions declarations.    ****/
+#if defined( TA_TRACE )
+static void traceInit( TA_TraceCall *call, const char *name,
+                       int startIdx, int endIdx );
+#endif
+
+/**** Local variables definitions.     ****/
+#if defined( TA_TRACE )
+static TA_TraceHooks traceHooks = { NULL, NULL, NULL };
+static TA_THREAD_LOCAL unsigned int traceDepth = 0;
+#endif
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SetTraceHooks( TA_TraceEnterFunc onEnter,
+                             TA_TraceExitFunc  onExit,
+                             void *userData )
+{
+#if defined( TA_TRACE )
+   traceHooks.onEnter  = onEnter;
+   traceHooks.onExit   = onExit;
+   traceHooks.userData = userData;
+
+   return TA_SUCCESS;
+#else
+   (void)onEnter;
+   (void)onExit;
+   (void)userData;
+
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+#if defined( TA_TRACE )
+void TA_TraceEnter( TA_TraceCall *call )
+{
+   call->depth = traceDepth++;
+
+   if( traceHooks.onEnter )
+      traceHooks.onEnter( call, traceHooks.userData );
+}
+
+void TA_TraceExit( const TA_TraceCall *call, TA_RetCode retCode )
+{
+   traceDepth = call->depth;
+
+   if( traceHooks.onExit )
+      traceHooks.onExit( call, retCode, traceHooks.userData );
+}
+
+/* Wrappers of the internal functions (see ta_utility.h). */
+TA_RetCode TA_INT_SMA( int           startIdx,
+                       int           endIdx,
+                       const double *inReal,
+                       int           optInTimePeriod,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double       *outReal )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_SMA", startIdx, endIdx );
+   retCode = TA_INT_SMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod,
+                                outBegIdx, outNBElement, outReal );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_S_INT_SMA( int          startIdx,
+                         int          endIdx,
+                         const float *inReal,
+                         int          optInTimePeriod,
+                         int         *outBegIdx,
+                         int         *outNBElement,
+                         double      *outReal )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_SMA", startIdx, endIdx );
+   retCode = TA_S_INT_SMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod,
+                                  outBegIdx, outNBElement, outReal );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_INT_EMA( int           startIdx,
+                       int           endIdx,
+                       const double *inReal,
+                       int           optInTimePeriod,
+                       double        optInK_1,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double       *outReal )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_EMA", startIdx, endIdx );
+   retCode = TA_INT_EMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod,
+                                optInK_1, outBegIdx, outNBElement, outReal );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_S_INT_EMA( int          startIdx,
+                         int          endIdx,
+                         const float *inReal,
+                         int          optInTimePeriod,
+                         double       optInK_1,
+                         int         *outBegIdx,
+                         int         *outNBElement,
+                         double      *outReal )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_EMA", startIdx, endIdx );
+   retCode = TA_S_INT_EMA_Kernel( startIdx, endIdx, inReal, optInTimePeriod,
+                                  optInK_1, outBegIdx, outNBElement, outReal );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_INT_MACD( int           startIdx,
+                        int           endIdx,
+                        const double  inReal[],
+                        int           optInFastPeriod,
+                        int           optInSlowPeriod,
+                        int           optInSignalPeriod_2,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outRealMACD_0[],
+                        double        outRealMACDSignal_1[],
+                        double        outRealMACDHist_2[] )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_MACD", startIdx, endIdx );
+   retCode = TA_INT_MACD_Kernel( startIdx, endIdx, inReal, optInFastPeriod,
+                                 optInSlowPeriod, optInSignalPeriod_2,
+                                 outBegIdx, outNBElement, outRealMACD_0,
+                                 outRealMACDSignal_1, outRealMACDHist_2 );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_S_INT_MACD( int          startIdx,
+                          int          endIdx,
+                          const float  inReal[],
+                          int          optInFastPeriod,
+                          int          optInSlowPeriod,
+                          int          optInSignalPeriod_2,
+                          int         *outBegIdx,
+                          int         *outNBElement,
+                          double       outRealMACD_0[],
+                          double       outRealMACDSignal_1[],
+                          double       outRealMACDHist_2[] )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_MACD", startIdx, endIdx );
+   retCode = TA_S_INT_MACD_Kernel( startIdx, endIdx, inReal, optInFastPeriod,
+                                   optInSlowPeriod, optInSignalPeriod_2,
+                                   outBegIdx, outNBElement, outRealMACD_0,
+                                   outRealMACDSignal_1, outRealMACDHist_2 );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_INT_PO( int           startIdx,
+                      int           endIdx,
+                      const double *inReal,
+                      int           optInFastPeriod,
+                      int           optInSlowPeriod,
+                      TA_MAType     optInMethod_2,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double       *outReal,
+                      double       *tempBuffer,
+                      int  doPercentageOutput )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_PO", startIdx, endIdx );
+   retCode = TA_INT_PO_Kernel( startIdx, endIdx, inReal, optInFastPeriod,
+                               optInSlowPeriod, optInMethod_2, outBegIdx,
+                               outNBElement, outReal, tempBuffer,
+                               doPercentageOutput );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_S_INT_PO( int           startIdx,
+                        int           endIdx,
+                        const float  *inReal,
+                        int           optInFastPeriod,
+                        int           optInSlowPeriod,
+                        TA_MAType     optInMethod_2,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double       *outReal,
+                        double       *tempBuffer,
+                        int  doPercentageOutput )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_PO", startIdx, endIdx );
+   retCode = TA_S_INT_PO_Kernel( startIdx, endIdx, inReal, optInFastPeriod,
+                                 optInSlowPeriod, optInMethod_2, outBegIdx,
+                                 outNBElement, outReal, tempBuffer,
+                                 doPercentageOutput );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_INT_VAR( int           startIdx,
+                       int           endIdx,
+                       const double *inReal,
+                       int           optInTimePeriod,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double       *outReal )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_VAR", startIdx, endIdx );
+   retCode = TA_INT_VAR_Kernel( startIdx, endIdx, inReal, optInTimePeriod,
+                                outBegIdx, outNBElement, outReal );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+TA_RetCode TA_S_INT_VAR( int           startIdx,
+                         int           endIdx,
+                         const float  *inReal,
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double       *outReal )
+{
+   TA_TraceCall call;
+   TA_RetCode retCode;
+
+   traceInit( &call, "INT_VAR", startIdx, endIdx );
+   retCode = TA_S_INT_VAR_Kernel( startIdx, endIdx, inReal, optInTimePeriod,
+                                  outBegIdx, outNBElement, outReal );
+   TA_TraceExit( &call, retCode );
+
+   return retCode;
+}
+
+/* The range is the one of the moving average. */
+void TA_INT_stddev_using_precalc_ma( const double *inReal,
+                                     const double *inMovAvg,
+                                     int           inMovAvgBegIdx,
+                                     int           inMovAvgNbElement,
+                                     int           timePeriod,
+                                     double       *output )
+{
+   TA_TraceCall call;
+
+   traceInit( &call, "INT_stddev_using_precalc_ma", inMovAvgBegIdx,
+              inMovAvgBegIdx+inMovAvgNbElement-1 );
+   TA_INT_stddev_using_precalc_ma_Kernel( inReal, inMovAvg, inMovAvgBegIdx,
+                                          inMovAvgNbElement, timePeriod, output );
+   TA_TraceExit( &call, TA_SUCCESS );
+}
+
+void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
+                                       const double *inMovAvg,
+                                       int           inMovAvgBegIdx,
+                                       int           inMovAvgNbElement,
+                                       int           timePeriod,
+                                       double       *output )
+{
+   TA_TraceCall call;
+
+   traceInit( &call, "INT_stddev_using_precalc_ma", inMovAvgBegIdx,
+              inMovAvgBegIdx+inMovAvgNbElement-1 );
+   TA_S_INT_stddev_using_precalc_ma_Kernel( inReal, inMovAvg, inMovAvgBegIdx,
+                                            inMovAvgNbElement, timePeriod, output );
+   TA_TraceExit( &call, TA_SUCCESS );
+}
+#endif
+
+/**** Local functions definitions.     ****/
+#if defined( TA_TRACE )
+static void traceInit( TA_TraceCall *call, const char *name,
+                       int startIdx, int endIdx )
+{
+   call->name     = name;
+   call->handle   = NULL;
+   call->startIdx = startIdx;
+   call->endIdx   = endIdx;
+   TA_TraceEnter( call );
+}
+#endif
+
+/***************/
+/* End of File */
+/***************/
@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
+ *  AG       Agent
  *
  *
  * Change history:
@@ -46,6 +47,13 @@
  *  112400 MF   First version.
  *  041106 MF   Add prefix to theGlobals to avoid clash with other libs.
  *  040707 MF   Change global initialization to eliminate Mac OS X link error.
+ *  101926 AG   Add TA_SetExecutor.
+ *  101926 AG   Add TA_Context.
+ *  101926 AG   Add TA_SetAllocator and scratch buffer.
+ *  101926 AG   Count the allocated bytes for ta_stats.h
+ *  101926 AG   Add the strict allocation mode (TA_SetStrictAlloc).
+ *  101926 AG   Add TA_EntryMemAlloc (strict mode out of the TA functions).
+ *  101926 AG   Count the bytes in use for ta_stats.h
  */
 
 /* Description:
@@ -53,6 +61,7 @@
  */
 
 /**** Headers ****/
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -61,6 +70,7 @@
 #include "ta_magic_nb.h"
 #include "ta_global.h"
 #include "ta_func.h"
+#include "ta_memory.h"
 
 /**** External functions declarations. ****/
 /* None */
@@ -71,18 +81,48 @@
 /**** Global variables definitions.    ****/
 
 /* The entry point for all globals */
-TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0}};
+TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,{0,(TA_Compatibility)0,{0},{NULL,NULL,NULL,NULL},NULL,{NULL,0,0,0,0}},NULL,NULL};
 
 TA_LibcPriv *TA_Globals = &ta_theGlobals;
 
+TA_THREAD_LOCAL const TA_Context *TA_ThreadContext = NULL;
+
+#if defined( TA_STATS )
+TA_THREAD_LOCAL TA_StatsThread TA_StatsThreadData = {0,0,0,0,0,0,NULL,0};
+TA_StatsStrictAlloc TA_StatsStrict = {0,NULL,NULL};
+#endif
+
 /**** Local declarations.              ****/
-/* None */
+
+/* Tasks executed with the context of the submitting thread. */
+typedef struct
+{
+   const TA_Context *context;
+   TA_TaskFunc       taskFunc;
+   void             *taskData;
+} TA_ContextTask;
 
 /**** Local functions declarations.    ****/
-/* None */
+static void contextTask( void *taskData, int taskIdx );
+static TA_RetCode setAllocator( TA_Allocator  *allocator,
+                                TA_MallocFunc  mallocFunc,
+                                TA_ReallocFunc reallocFunc,
+                                TA_FreeFunc    freeFunc,
+                                void          *allocatorData );
+static int isInScratch( const TA_ScratchArena *arena, const void *ptr );
+static void *heapAlloc( const TA_Context *context, size_t size );
+#if defined( TA_STATS )
+static int statsHeapAlloc( size_t size );
+static void statsLiveByte( TA_Integer64 size );
+#endif
 
 /**** Local variables definitions.     ****/
-/* None */
+#if defined( TA_STATS )
+/* The heap blocks start with their size, so their bytes can be
+ * removed from TA_StatsThread.liveByte when freed.
+ */
+#define TA_STATS_HEADER TA_SCRATCH_ALIGN
+#endif
 
 /**** Global functions definitions.   ****/
 TA_RetCode TA_Initialize( void )
@@ -92,6 +132,7 @@ TA_RetCode TA_Initialize( void )
     */
    memset( TA_Globals, 0, sizeof( TA_LibcPriv ) );
    TA_Globals->magicNb = TA_LIBC_PRIV_MAGIC_NB;
+   TA_Globals->defaultContext.magicNb = TA_CONTEXT_MAGIC_NB;
 
    /*** At this point, TA_Shutdown can be called to clean-up. ***/
 
@@ -111,9 +152,511 @@ TA_RetCode TA_Shutdown( void )
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_SetExecutor( TA_Executor executor, void *executorData )
+{
+   TA_Globals->executor     = executor;
+   TA_Globals->executorData = executorData;
+
+   return TA_SUCCESS;
+}
+
+void TA_RunTasks( int nbTask, TA_TaskFunc taskFunc, void *taskData )
+{
+   TA_ExecuteTasks( TA_Globals->executor, TA_Globals->executorData,
+                    nbTask, taskFunc, taskData );
+}
+
+void TA_ExecuteTasks( TA_Executor executor, void *executorData,
+                      int nbTask, TA_TaskFunc taskFunc, void *taskData )
+{
+   TA_ContextTask task;
+   TA_Context workerContext;
+   int i;
+
+   if( !executor || (nbTask <= 1) )
+   {
+      for( i=0; i < nbTask; i++ )
+         taskFunc( taskData, i );
+   }
+   else if( !TA_ThreadContext )
+      executor( executorData, nbTask, taskFunc, taskData );
+   else
+   {
+      /* The worker threads must see the context of this thread,
+       * except for its scratch buffer which is not thread safe.
+       */
+      task.context = TA_ThreadContext;
+      if( task.context->scratch )
+      {
+         workerContext = *task.context;
+         workerContext.scratch = NULL;
+         task.context = &workerContext;
+      }
+      task.taskFunc = taskFunc;
+      task.taskData = taskData;
+      executor( executorData, nbTask, contextTask, &task );
+   }
+}
+
+TA_RetCode TA_ContextAlloc( TA_Context **context )
+{
+   TA_Context *newContext;
+
+   if( !context )
+      return TA_BAD_PARAM;
+
+   newContext = (TA_Context *)TA_Malloc( sizeof(TA_Context) );
+   if( !newContext )
+   {
+      *context = NULL;
+      return TA_ALLOC_ERR;
+   }
+
+   /* Start with the current default settings. */
+   *newContext = TA_Globals->defaultContext;
+   newContext->magicNb = TA_CONTEXT_MAGIC_NB;
+   newContext->scratch = NULL;
+   memset( &newContext->arena, 0, sizeof(TA_ScratchArena) );
+
+   *context = newContext;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ContextFree( TA_Context *context )
+{
+   if( !context )
+      return TA_SUCCESS;
+
+   if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   /* Invalidate the object before freeing it. */
+   context->magicNb = 0;
+   TA_Free( context );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ContextSetUnstablePeriod( TA_Context    *context,
+                                        TA_FuncUnstId  id,
+                                        unsigned int   unstablePeriod )
+{
+   int i;
+
+   if( !context || (id > TA_FUNC_UNST_ALL) )
+      return TA_BAD_PARAM;
+
+   if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   if( id == TA_FUNC_UNST_ALL )
+   {
+      for( i=0; i < (int)TA_FUNC_UNST_ALL; i++ )
+         context->unstablePeriod[i] = unstablePeriod;
+   }
+   else
+      context->unstablePeriod[id] = unstablePeriod;
+
+   return TA_SUCCESS;
+}
+
+unsigned int TA_ContextGetUnstablePeriod( const TA_Context *context,
+                                          TA_FuncUnstId     id )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) ||
+       (id >= TA_FUNC_UNST_ALL) )
+      return 0;
+
+   return context->unstablePeriod[id];
+}
+
+TA_RetCode TA_ContextSetCompatibility( TA_Context *context, TA_Compatibility value )
+{
+   if( !context )
+      return TA_BAD_PARAM;
+
+   if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   context->compatibility = value;
+
+   return TA_SUCCESS;
+}
+
+TA_Compatibility TA_ContextGetCompatibility( const TA_Context *context )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_COMPATIBILITY_DEFAULT;
+
+   return context->compatibility;
+}
+
+TA_RetCode TA_SetAllocator( TA_MallocFunc  mallocFunc,
+                            TA_ReallocFunc reallocFunc,
+                            TA_FreeFunc    freeFunc,
+                            void          *allocatorData )
+{
+   return setAllocator( &TA_Globals->defaultContext.allocator,
+                        mallocFunc, reallocFunc, freeFunc, allocatorData );
+}
+
+TA_RetCode TA_ContextSetAllocator( TA_Context    *context,
+                                   TA_MallocFunc  mallocFunc,
+                                   TA_ReallocFunc reallocFunc,
+                                   TA_FreeFunc    freeFunc,
+                                   void          *allocatorData )
+{
+   if( !context )
+      return TA_BAD_PARAM;
+
+   if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   return setAllocator( &context->allocator,
+                        mallocFunc, reallocFunc, freeFunc, allocatorData );
+}
+
+TA_RetCode TA_ContextSetScratch( TA_Context *context,
+                                 void       *buffer,
+                                 size_t      size )
+{
+   TA_ScratchArena *arena;
+   size_t padding;
+
+   if( !context )
+      return TA_BAD_PARAM;
+
+   if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   /* Changing the scratch buffer while temporary
+    * buffers are taken from it would be fatal.
+    */
+   if( context->scratch && (context->scratch->nbBlock != 0) )
+      return TA_BAD_OBJECT;
+
+   arena = &context->arena;
+   memset( arena, 0, sizeof(TA_ScratchArena) );
+
+   if( !buffer )
+   {
+      context->scratch = NULL;
+      return TA_SUCCESS;
+   }
+
+   /* Align the beginning of the buffer. */
+   padding = (TA_SCRATCH_ALIGN-((size_t)buffer%TA_SCRATCH_ALIGN))%TA_SCRATCH_ALIGN;
+   if( size > padding )
+   {
+      arena->buffer = (char *)buffer + padding;
+      arena->size   = size - padding;
+   }
+
+   context->scratch = arena;
+
+   return TA_SUCCESS;
+}
+
+size_t TA_ContextGetScratchPeak( const TA_Context *context )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) || !context->scratch )
+      return 0;
+
+   return context->scratch->peak;
+}
+
+void *TA_ContextMemAlloc( const TA_Context *context, size_t size )
+{
+   TA_ScratchArena *arena;
+   void *ptr;
+
+#if defined( TA_STATS )
+   TA_StatsThreadData.allocByte += (TA_Integer64)size;
+   TA_StatsThreadData.nbAlloc++;
+#endif
+
+   arena = context->scratch;
+   if( arena )
+   {
+      ptr = NULL;
+      if( arena->offset+size <= arena->size )
+         ptr = arena->buffer+arena->offset;
+
+      arena->offset += (size+TA_SCRATCH_ALIGN-1) & ~((size_t)TA_SCRATCH_ALIGN-1);
+      if( arena->offset > arena->peak )
+         arena->peak = arena->offset;
+
+      if( !ptr )
+      {
+         /* Too small, fallback on the allocator. */
+         ptr = heapAlloc( context, size );
+         if( !ptr )
+         {
+            if( arena->nbBlock == 0 )
+               arena->offset = 0;
+            return NULL;
+         }
+      }
+#if defined( TA_STATS )
+      else
+      {
+         arena->liveByte += size;
+         statsLiveByte( (TA_Integer64)size );
+      }
+#endif
+
+      arena->nbBlock++;
+      return ptr;
+   }
+
+   return heapAlloc( context, size );
+}
+
+void *TA_ContextMemRealloc( const TA_Context *context, void *ptr, size_t size )
+{
+   void *newPtr;
+#if defined( TA_STATS )
+   size_t oldSize;
+
+   TA_StatsThreadData.allocByte += (TA_Integer64)size;
+   TA_StatsThreadData.nbAlloc++;
+   if( !statsHeapAlloc( size ) )
+      return NULL;
+
+   oldSize = 0;
+   if( ptr )
+   {
+      ptr = (char *)ptr - TA_STATS_HEADER;
+      oldSize = *(size_t *)ptr;
+   }
+   size += TA_STATS_HEADER;
+#endif
+
+   if( context->allocator.reallocFunc )
+      newPtr = context->allocator.reallocFunc( context->allocator.allocatorData, ptr, size );
+   else
+      newPtr = realloc( ptr, size );
+
+#if defined( TA_STATS )
+   if( newPtr )
+   {
+      size -= TA_STATS_HEADER;
+      *(size_t *)newPtr = size;
+      statsLiveByte( (TA_Integer64)size - (TA_Integer64)oldSize );
+      newPtr = (char *)newPtr + TA_STATS_HEADER;
+   }
+#endif
+
+   return newPtr;
+}
+
+void TA_ContextMemFree( const TA_Context *context, void *ptr )
+{
+   TA_ScratchArena *arena;
+   int inScratch;
 
+   if( !ptr )
+      return;
+
+   arena = context->scratch;
+   inScratch = 0;
+   if( arena )
+   {
+      inScratch = isInScratch( arena, ptr );
+
+      /* Recycle the whole scratch buffer once all
+       * the temporary buffers are freed.
+       */
+      if( arena->nbBlock > 0 )
+         arena->nbBlock--;
+      if( arena->nbBlock == 0 )
+      {
+         arena->offset = 0;
+#if defined( TA_STATS )
+         statsLiveByte( -(TA_Integer64)arena->liveByte );
+         arena->liveByte = 0;
+#endif
+      }
+   }
+
+   if( inScratch )
+      return;
+
+#if defined( TA_STATS )
+   ptr = (char *)ptr - TA_STATS_HEADER;
+   statsLiveByte( -(TA_Integer64)*(size_t *)ptr );
+#endif
+
+   if( context->allocator.freeFunc )
+      context->allocator.freeFunc( context->allocator.allocatorData, ptr );
+   else
+      free( ptr );
+}
+
+void *TA_EntryMemAlloc( const TA_Context *context, const void *handle,
+                        size_t size, TA_RetCode *retCode )
+{
+   void *ptr;
+#if defined( TA_STATS )
+   TA_StatsThread *thread;
+   const void *savedHandle;
+   int isDenied;
+
+   /* Nested like a TA call (see TA_StatsBegin/TA_StatsEnd). */
+   thread = &TA_StatsThreadData;
+   savedHandle = thread->handle;
+   if( handle )
+      thread->handle = handle;
+   thread->depth++;
+
+   ptr = TA_ContextMemAlloc( context, size );
+
+   thread->depth--;
+   thread->handle = savedHandle;
+   isDenied = thread->denied;
+   if( thread->depth == 0 )
+      thread->denied = 0;
+
+   if( !ptr )
+      *retCode = isDenied? TA_ALLOC_FORBIDDEN : TA_ALLOC_ERR;
+#else
+   (void)handle;
+
+   ptr = TA_ContextMemAlloc( context, size );
+   if( !ptr )
+      *retCode = TA_ALLOC_ERR;
+#endif
+
+   return ptr;
+}
+
+TA_RetCode TA_SetThreadContext( const TA_Context *context )
+{
+   if( context && (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   TA_ThreadContext = context;
+
+   return TA_SUCCESS;
+}
+
+const TA_Context *TA_GetThreadContext( void )
+{
+   return TA_ThreadContext;
+}
 
 /**** Local functions definitions.     ****/
-/* None */
+static TA_RetCode setAllocator( TA_Allocator  *allocator,
+                                TA_MallocFunc  mallocFunc,
+                                TA_ReallocFunc reallocFunc,
+                                TA_FreeFunc    freeFunc,
+                                void          *allocatorData )
+{
+   /* All or none of the functions must be specified. */
+   if( !mallocFunc || !reallocFunc || !freeFunc )
+   {
+      if( mallocFunc || reallocFunc || freeFunc )
+         return TA_BAD_PARAM;
+   }
+
+   allocator->mallocFunc    = mallocFunc;
+   allocator->reallocFunc   = reallocFunc;
+   allocator->freeFunc      = freeFunc;
+   allocator->allocatorData = allocatorData;
+
+   return TA_SUCCESS;
+}
+
+static int isInScratch( const TA_ScratchArena *arena, const void *ptr )
+{
+   uintptr_t begin, address;
+
+   if( !arena->buffer )
+      return 0;
+
+   begin   = (uintptr_t)arena->buffer;
+   address = (uintptr_t)ptr;
+
+   return (address >= begin) && (address < begin+arena->size);
+}
+
+static void *heapAlloc( const TA_Context *context, size_t size )
+{
+   void *ptr;
+
+#if defined( TA_STATS )
+   if( !statsHeapAlloc( size ) )
+      return NULL;
+   size += TA_STATS_HEADER;
+#endif
+
+   if( context->allocator.mallocFunc )
+      ptr = context->allocator.mallocFunc( context->allocator.allocatorData, size );
+   else
+      ptr = malloc( size );
+
+#if defined( TA_STATS )
+   if( ptr )
+   {
+      size -= TA_STATS_HEADER;
+      *(size_t *)ptr = size;
+      statsLiveByte( (TA_Integer64)size );
+      ptr = (char *)ptr + TA_STATS_HEADER;
+   }
+#endif
+
+   return ptr;
+}
+
+#if defined( TA_STATS )
+/* Count an allocation reaching the allocator. Return 0 when the
+ * strict mode denies it, the TA call then fails with TA_ALLOC_ERR,
+ * turned into TA_ALLOC_FORBIDDEN by its wrapper (see ta_stats.c) or
+ * by TA_EntryMemAlloc.
+ */
+static int statsHeapAlloc( size_t size )
+{
+   TA_StatsThread *thread;
+
+   thread = &TA_StatsThreadData;
+   thread->nbHeapAlloc++;
+
+   if( !TA_StatsStrict.enabled || (thread->depth == 0) )
+      return 1;
+
+   if( TA_StatsStrict.hook &&
+       TA_StatsStrict.hook( (const TA_FuncHandle *)thread->handle, size,
+                            TA_StatsStrict.userData ) )
+      return 1;
+
+   thread->denied = 1;
+   return 0;
+}
+
+/* Add to the bytes in use by the calling thread. */
+static void statsLiveByte( TA_Integer64 size )
+{
+   TA_StatsThread *thread;
+
+   thread = &TA_StatsThreadData;
+   thread->liveByte += size;
+   if( thread->liveByte > thread->peakLiveByte )
+      thread->peakLiveByte = thread->liveByte;
+}
+#endif
+
+static void contextTask( void *taskData, int taskIdx )
+{
+   const TA_ContextTask *task;
+   const TA_Context *savedContext;
+
+   task = (const TA_ContextTask *)taskData;
+
+   savedContext = TA_ThreadContext;
+   TA_ThreadContext = task->context;
+   task->taskFunc( task->taskData, taskIdx );
+   TA_ThreadContext = savedContext;
+}
 
 
@@ -9,6 +9,10 @@
    #include "ta_func.h"
 #endif
 
+#ifndef TA_STATS_H
+   #include "ta_stats.h"
+#endif
+
 
 /* This interface is used exclusively INTERNALY to the TA-LIB.
  * There is nothing for the end-user here ;->
@@ -81,6 +85,62 @@ typedef struct
   void *global;
 } TA_ModuleControl;
 
+/* Memory allocation functions. NULL functions means the
+ * standard malloc/realloc/free.
+ */
+typedef struct
+{
+   TA_MallocFunc  mallocFunc;
+   TA_ReallocFunc reallocFunc;
+   TA_FreeFunc    freeFunc;
+   void          *allocatorData;
+} TA_Allocator;
+
+/* Scratch buffer of a TA_Context (see TA_ContextSetScratch).
+ *
+ * The temporary buffers of a function are taken one after the
+ * other from the scratch buffer. The whole buffer is recycled once
+ * all these temporary buffers are freed, which happens at the end
+ * of every TA function.
+ *
+ * When the buffer is too small, the allocator is used instead, but
+ * 'offset' is still incremented, so 'peak' always tells the size
+ * needed to avoid all heap allocations.
+ */
+typedef struct
+{
+   char        *buffer;
+   size_t       size;
+   size_t       offset;
+   size_t       peak;
+   unsigned int nbBlock; /* Temporary buffers not yet freed. */
+#if defined( TA_STATS )
+   size_t       liveByte; /* Bytes served since the buffer was recycled. */
+#endif
+} TA_ScratchArena;
+
+/* Alignment of the temporary buffers taken from a scratch buffer. */
+#define TA_SCRATCH_ALIGN 16
+
+/* This is the hidden implementation of a TA_Context. */
+struct TA_Context
+{
+   unsigned int magicNb; /* Unique identifier of this object. */
+
+   /* For handling the compatibility with other software */
+   TA_Compatibility compatibility;
+
+   /* For handling the unstable period of some TA function. */
+   unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
+
+   /* Used for all the memory allocated by the TA functions. */
+   TA_Allocator allocator;
+
+   /* Points on 'arena' when a scratch buffer is used, else NULL. */
+   TA_ScratchArena *scratch;
+   TA_ScratchArena  arena;
+};
+
 /* This is the hidden implementation of TA_Libc. */
 typedef struct
 {
@@ -93,12 +153,14 @@ typedef struct
 
    const char *localCachePath;
 
-   /* For handling the compatibility with other software */
-   TA_Compatibility compatibility;
-
-   /* For handling the unstable period of some TA function. */
-   unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
+   /* Settings used by the threads not bound to a TA_Context
+    * (see TA_SetUnstablePeriod and TA_SetCompatibility).
+    */
+   TA_Context defaultContext;
 
+   /* Executor used to spread independent tasks (see TA_SetExecutor). */
+   TA_Executor executor;
+   void       *executorData;
 
 } TA_LibcPriv;
 
@@ -107,4 +169,94 @@ typedef struct
  */
 extern TA_LibcPriv *TA_Globals;
 
+/* Thread local storage, used for the context bound to a thread. */
+#if defined( TA_NO_THREADS )
+   #define TA_THREAD_LOCAL
+#elif defined( _MSC_VER )
+   #define TA_THREAD_LOCAL __declspec(thread)
+#elif defined( __STDC_VERSION__ ) && (__STDC_VERSION__ >= 201112L)
+   #define TA_THREAD_LOCAL _Thread_local
+#else
+   #define TA_THREAD_LOCAL __thread
+#endif
+
+/* The context bound to the calling thread with TA_SetThreadContext,
+ * NULL when the thread uses the default context.
+ */
+extern TA_THREAD_LOCAL const TA_Context *TA_ThreadContext;
+
+#if defined( TA_STATS )
+/* Allocations of the calling thread, for the statistics and
+ * the strict allocation mode (see ta_stats.h).
+ */
+typedef struct
+{
+   TA_Integer64 allocByte;   /* Bytes requested. */
+   TA_Integer64 nbAlloc;     /* Number of requests. */
+   TA_Integer64 nbHeapAlloc; /* Requests not served by a scratch buffer. */
+
+   /* Bytes in use (allocated and not yet freed), and their most
+    * since the innermost call started.
+    */
+   TA_Integer64 liveByte;
+   TA_Integer64 peakLiveByte;
+
+   unsigned int depth;       /* Nesting of the TA calls in progress. */
+   const void  *handle;      /* TA_FuncHandle of the innermost call. */
+   int          denied;      /* An allocation was denied (strict mode). */
+} TA_StatsThread;
+
+extern TA_THREAD_LOCAL TA_StatsThread TA_StatsThreadData;
+
+/* Set with TA_SetStrictAlloc. */
+typedef struct
+{
+   int enabled;
+   TA_StrictAllocFunc hook;
+   void *userData;
+} TA_StatsStrictAlloc;
+
+extern TA_StatsStrictAlloc TA_StatsStrict;
+#endif
+
+/* The settings in effect for the calling thread. */
+#define TA_CURRENT_CONTEXT (TA_ThreadContext? TA_ThreadContext : &TA_Globals->defaultContext)
+
+/* Memory allocation with the allocator of a context.
+ *
+ * TA_ContextMemFree must be called with the same context used
+ * for the allocation.
+ *
+ * Only the temporary buffers of the TA functions are taken from the
+ * scratch buffer of the context. Realloc'ed memory never is.
+ */
+void *TA_ContextMemAlloc  ( const TA_Context *context, size_t size );
+void *TA_ContextMemRealloc( const TA_Context *context, void *ptr, size_t size );
+void  TA_ContextMemFree   ( const TA_Context *context, void *ptr );
+
+/* Same as TA_ContextMemAlloc, for the entry points which are not a
+ * TA function (bundles, panels, TA_CallFuncBatch, TA_Plan...). The
+ * allocation is done as within a call of the function 'handle' (may
+ * be NULL), so the strict allocation mode also applies to it.
+ *
+ * On failure, *retCode is TA_ALLOC_FORBIDDEN when the strict mode
+ * denied the allocation, else TA_ALLOC_ERR.
+ */
+void *TA_EntryMemAlloc( const TA_Context *context, const void *handle,
+                        size_t size, TA_RetCode *retCode );
+
+/* Execute the tasks with the executor specified by the user
+ * with TA_SetExecutor, or serially when there is none.
+ */
+void TA_RunTasks( int nbTask, TA_TaskFunc taskFunc, void *taskData );
+
+/* Same as TA_RunTasks, but with the specified executor (NULL
+ * to execute serially).
+ *
+ * In both cases, the tasks are executed with the context bound
+ * to the calling thread, whatever thread they end up running on.
+ */
+void TA_ExecuteTasks( TA_Executor executor, void *executorData,
+                      int nbTask, TA_TaskFunc taskFunc, void *taskData );
+
 #endif
@@ -6,12 +6,34 @@
       #include "ta_common.h"
    #endif
 
+   #ifndef TA_GLOBAL_H
+      #include "ta_global.h"
+   #endif
+
    #include <stdlib.h>
 
-   /* Interface macros */
-   #define TA_Malloc(a)       malloc(a)
-   #define TA_Realloc(a,b)    realloc((a),(b))
-   #define TA_Free(a)         free(a)
+   /* Interface macros
+    *
+    * TA_Malloc/TA_Realloc/TA_Free are for memory outliving a call
+    * (TA_ParamHolder etc.). They use the allocator specified with
+    * TA_SetAllocator.
+    *
+    * TA_TempMalloc/TA_TempFree are for the temporary buffers of the
+    * TA functions. They use the allocator and scratch buffer of the
+    * context of the calling thread.
+    */
+   #define TA_Malloc(a)       TA_ContextMemAlloc(&TA_Globals->defaultContext,(a))
+   #define TA_Realloc(a,b)    TA_ContextMemRealloc(&TA_Globals->defaultContext,(a),(b))
+   #define TA_Free(a)         TA_ContextMemFree(&TA_Globals->defaultContext,(a))
+
+   #define TA_TempMalloc(a)   TA_ContextMemAlloc(TA_CURRENT_CONTEXT,(a))
+   #define TA_TempFree(a)     TA_ContextMemFree(TA_CURRENT_CONTEXT,(a))
+
+   /* Same as TA_Malloc/TA_TempMalloc, for the temporary memory of
+    * the entry points which are not a TA function (see TA_EntryMemAlloc).
+    */
+   #define TA_EntryMalloc(h,a,r)     TA_EntryMemAlloc(&TA_Globals->defaultContext,(h),(a),(r))
+   #define TA_EntryTempMalloc(h,a,r) TA_EntryMemAlloc(TA_CURRENT_CONTEXT,(h),(a),(r))
 
    #define FREE_IF_NOT_NULL(x) { if((x)!=NULL) {TA_Free((void *)(x)); (x)=NULL;} }
 
@@ -56,11 +78,11 @@
 #else
    #define ARRAY_VTYPE_REF(type,name)             type *name
    #define ARRAY_VTYPE_LOCAL(type,name,size)      type name[size]
-   #define ARRAY_VTYPE_ALLOC(type,name,size)      name = (type *)TA_Malloc( sizeof(type)*(size))
+   #define ARRAY_VTYPE_ALLOC(type,name,size)      name = (type *)TA_TempMalloc( sizeof(type)*(size))
    #define ARRAY_VTYPE_COPY(type,dest,src,size)   memcpy(dest,src,sizeof(type)*(size))
    #define ARRAY_VTYPE_MEMMOVE(type,dest,destIdx,src,srcIdx,size) memmove( &dest[destIdx], &src[srcIdx], (size)*sizeof(type) )
-   #define ARRAY_VTYPE_FREE(type,name)            TA_Free(name)
-   #define ARRAY_VTYPE_FREE_COND(type,cond,name)  if( cond ){ TA_Free(name); }
+   #define ARRAY_VTYPE_FREE(type,name)            TA_TempFree(name)
+   #define ARRAY_VTYPE_FREE_COND(type,cond,name)  if( cond ){ TA_TempFree(name); }
 #endif
 
 /* ARRAY : Macros to manipulate arrays of double. */
@@ -101,6 +123,9 @@
  *
  * Depending of the language/platform, the globals might be in reality
  * a private member variable of an object...
+ *
+ * In C, these are the settings of the TA_Context bound to the calling
+ * thread (see TA_SetThreadContext), otherwise of the default context.
  */
 #if defined( _MANAGED )
    #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (Globals->unstablePeriod[(int)(FuncUnstId::y)])
@@ -109,8 +134,8 @@
    #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (this.unstablePeriod[FuncUnstId.y.ordinal()])
    #define TA_GLOBALS_COMPATIBILITY        (this.compatibility)
 #else
-   #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_Globals->unstablePeriod[x])
-   #define TA_GLOBALS_COMPATIBILITY        (TA_Globals->compatibility)
+   #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_CURRENT_CONTEXT->unstablePeriod[x])
+   #define TA_GLOBALS_COMPATIBILITY        (TA_CURRENT_CONTEXT->compatibility)
 #endif
 
 
@@ -320,7 +345,7 @@
          return TA_INTERNAL_ERROR(137); \
       if( (int)Size > (int)(sizeof(local_##Id)/sizeof(Type)) ) \
       { \
-         Id = TA_Malloc( sizeof(Type)*Size ); \
+         Id = TA_TempMalloc( sizeof(Type)*Size ); \
          if( !Id ) \
             return TA_ALLOC_ERR; \
       } \
@@ -342,7 +367,7 @@
 #define CIRCBUF_DESTROY(Id) \
    { \
       if( Id != &local_##Id[0] ) \
-         TA_Free( Id ); \
+         TA_TempFree( Id ); \
    }
 
 /* Use this macro to access the member when Type is a class or a struct. */
@@ -0,0 +1,435 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ */
+
+/* Description:
+ *   Thread pool usable as an executor (see TA_SetExecutor).
+ *
+ *   The tasks of a submission are handed out one at the time from a
+ *   shared counter protected by the pool mutex. The calling thread
+ *   participates in the processing, so a pool of 'n' threads has
+ *   'n-1' worker threads.
+ *
+ *   Define TA_NO_THREADS to build TA-Lib without any dependency on
+ *   a thread library. TA_ThreadPoolAlloc then returns TA_NOT_SUPPORTED.
+ */
+
+/**** Headers ****/
+#if !defined( TA_NO_THREADS ) && defined( __linux__ ) && !defined( _GNU_SOURCE )
+   /* Needed for pthread_setaffinity_np. */
+   #define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined( TA_NO_THREADS )
+   #if defined( _WIN32 )
+      #include <windows.h>
+      #include <process.h>
+   #else
+      #include <pthread.h>
+      #include <unistd.h>
+      #if defined( __linux__ )
+         #include <sched.h>
+      #endif
+   #endif
+#endif
+
+#include "ta_common.h"
+#include "ta_magic_nb.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#if !defined( TA_NO_THREADS )
+
+#if defined( _WIN32 )
+   typedef HANDLE             TA_ThreadHandle;
+   typedef CRITICAL_SECTION   TA_Mutex;
+   typedef CONDITION_VARIABLE TA_Cond;
+   #define TA_MUTEX_INIT(m)      InitializeCriticalSection(m)
+   #define TA_MUTEX_DESTROY(m)   DeleteCriticalSection(m)
+   #define TA_MUTEX_LOCK(m)      EnterCriticalSection(m)
+   #define TA_MUTEX_UNLOCK(m)    LeaveCriticalSection(m)
+   #define TA_COND_INIT(c)       InitializeConditionVariable(c)
+   #define TA_COND_DESTROY(c)
+   #define TA_COND_WAIT(c,m)     SleepConditionVariableCS(c,m,INFINITE)
+   #define TA_COND_BROADCAST(c)  WakeAllConditionVariable(c)
+#else
+   typedef pthread_t          TA_ThreadHandle;
+   typedef pthread_mutex_t    TA_Mutex;
+   typedef pthread_cond_t     TA_Cond;
+   #define TA_MUTEX_INIT(m)      pthread_mutex_init(m,NULL)
+   #define TA_MUTEX_DESTROY(m)   pthread_mutex_destroy(m)
+   #define TA_MUTEX_LOCK(m)      pthread_mutex_lock(m)
+   #define TA_MUTEX_UNLOCK(m)    pthread_mutex_unlock(m)
+   #define TA_COND_INIT(c)       pthread_cond_init(c,NULL)
+   #define TA_COND_DESTROY(c)    pthread_cond_destroy(c)
+   #define TA_COND_WAIT(c,m)     pthread_cond_wait(c,m)
+   #define TA_COND_BROADCAST(c)  pthread_cond_broadcast(c)
+#endif
+
+struct TA_ThreadPool
+{
+   unsigned int magicNb;
+
+   int nbWorker;
+   int flags;
+
+   TA_Mutex submitLock; /* Serialize the submissions. */
+   TA_Mutex lock;       /* Protect all the following. */
+   TA_Cond  workCond;   /* Signaled when tasks are available (or shutdown). */
+   TA_Cond  doneCond;   /* Signaled when all tasks are completed. */
+
+   /* Current submission. */
+   TA_TaskFunc taskFunc;
+   void       *taskData;
+   int         nbTask;
+   int         nextTask;
+   int         nbPending;
+
+   int shutdown;
+
+   TA_ThreadHandle *worker;
+};
+
+#if defined( _WIN32 )
+   #define TA_THREAD_FUNC(name) static unsigned __stdcall name( void *arg )
+   #define TA_THREAD_RETURN     return 0
+#else
+   #define TA_THREAD_FUNC(name) static void *name( void *arg )
+   #define TA_THREAD_RETURN     return NULL
+#endif
+
+#endif /* !defined( TA_NO_THREADS ) */
+
+/**** Local functions declarations.    ****/
+#if !defined( TA_NO_THREADS )
+static void runPendingTasks( TA_ThreadPool *pool );
+static int  nbOnlineProcessor( void );
+static void pinThread( TA_ThreadHandle thread, int processor );
+TA_THREAD_FUNC(workerMain);
+#endif
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_ThreadPoolAlloc( int nbThread, int flags, TA_ThreadPool **pool )
+{
+#if defined( TA_NO_THREADS )
+   (void)nbThread;
+   (void)flags;
+
+   if( pool )
+      *pool = NULL;
+
+   return TA_NOT_SUPPORTED;
+#else
+   TA_ThreadPool *newPool;
+   int i, nbProcessor;
+
+   if( !pool )
+      return TA_BAD_PARAM;
+
+   *pool = NULL;
+
+   if( nbThread < 0 )
+      return TA_BAD_PARAM;
+
+   nbProcessor = nbOnlineProcessor();
+   if( nbThread == 0 )
+      nbThread = nbProcessor;
+
+   newPool = (TA_ThreadPool *)TA_Malloc( sizeof( TA_ThreadPool ) );
+   if( !newPool )
+      return TA_ALLOC_ERR;
+
+   memset( newPool, 0, sizeof( TA_ThreadPool ) );
+   newPool->flags = flags;
+
+   if( nbThread > 1 )
+   {
+      newPool->worker = (TA_ThreadHandle *)TA_Malloc( sizeof(TA_ThreadHandle)*(nbThread-1) );
+      if( !newPool->worker )
+      {
+         TA_Free( newPool );
+         return TA_ALLOC_ERR;
+      }
+   }
+
+   TA_MUTEX_INIT( &newPool->submitLock );
+   TA_MUTEX_INIT( &newPool->lock );
+   TA_COND_INIT( &newPool->workCond );
+   TA_COND_INIT( &newPool->doneCond );
+   newPool->magicNb = TA_THREAD_POOL_MAGIC_NB;
+
+   for( i=0; i < nbThread-1; i++ )
+   {
+      #if defined( _WIN32 )
+         newPool->worker[i] = (HANDLE)_beginthreadex( NULL, 0, workerMain, newPool, 0, NULL );
+         if( newPool->worker[i] == 0 )
+            break;
+      #else
+         if( pthread_create( &newPool->worker[i], NULL, workerMain, newPool ) != 0 )
+            break;
+      #endif
+
+      newPool->nbWorker++;
+
+      /* The first processor is left for the calling thread. */
+      if( flags & TA_THREAD_POOL_PINNED )
+         pinThread( newPool->worker[i], (i+1)%nbProcessor );
+   }
+
+   if( newPool->nbWorker != nbThread-1 )
+   {
+      TA_ThreadPoolFree( newPool );
+      return TA_ALLOC_ERR;
+   }
+
+   *pool = newPool;
+
+   return TA_SUCCESS;
+#endif
+}
+
+TA_RetCode TA_ThreadPoolFree( TA_ThreadPool *pool )
+{
+#if defined( TA_NO_THREADS )
+   if( pool )
+      return TA_BAD_OBJECT;
+
+   return TA_SUCCESS;
+#else
+   int i;
+
+   if( !pool )
+      return TA_SUCCESS;
+
+   if( pool->magicNb != TA_THREAD_POOL_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   TA_MUTEX_LOCK( &pool->lock );
+   pool->shutdown = 1;
+   TA_COND_BROADCAST( &pool->workCond );
+   TA_MUTEX_UNLOCK( &pool->lock );
+
+   for( i=0; i < pool->nbWorker; i++ )
+   {
+      #if defined( _WIN32 )
+         WaitForSingleObject( pool->worker[i], INFINITE );
+         CloseHandle( pool->worker[i] );
+      #else
+         pthread_join( pool->worker[i], NULL );
+      #endif
+   }
+
+   /* Invalidate the object. */
+   pool->magicNb = 0;
+
+   TA_COND_DESTROY( &pool->doneCond );
+   TA_COND_DESTROY( &pool->workCond );
+   TA_MUTEX_DESTROY( &pool->lock );
+   TA_MUTEX_DESTROY( &pool->submitLock );
+
+   if( pool->worker )
+      TA_Free( pool->worker );
+   TA_Free( pool );
+
+   return TA_SUCCESS;
+#endif
+}
+
+void TA_ThreadPoolExecutor( void       *executorData,
+                            int         nbTask,
+                            TA_TaskFunc taskFunc,
+                            void       *taskData )
+{
+   int i;
+#if !defined( TA_NO_THREADS )
+   TA_ThreadPool *pool;
+
+   pool = (TA_ThreadPool *)executorData;
+
+   if( pool && (pool->magicNb == TA_THREAD_POOL_MAGIC_NB) &&
+       (pool->nbWorker > 0) && (nbTask > 1) )
+   {
+      TA_MUTEX_LOCK( &pool->submitLock );
+      TA_MUTEX_LOCK( &pool->lock );
+
+      pool->taskFunc  = taskFunc;
+      pool->taskData  = taskData;
+      pool->nbTask    = nbTask;
+      pool->nextTask  = 0;
+      pool->nbPending = nbTask;
+      TA_COND_BROADCAST( &pool->workCond );
+
+      /* The calling thread does its share of the work... */
+      runPendingTasks( pool );
+
+      /* ...and waits for the tasks still running in the workers. */
+      while( pool->nbPending > 0 )
+         TA_COND_WAIT( &pool->doneCond, &pool->lock );
+
+      pool->taskFunc = NULL;
+      pool->taskData = NULL;
+      pool->nbTask   = 0;
+      pool->nextTask = 0;
+
+      TA_MUTEX_UNLOCK( &pool->lock );
+      TA_MUTEX_UNLOCK( &pool->submitLock );
+      return;
+   }
+#else
+   (void)executorData;
+#endif
+
+   /* No thread to help, do the work serially. */
+   for( i=0; i < nbTask; i++ )
+      taskFunc( taskData, i );
+}
+
+/**** Local functions definitions.     ****/
+#if !defined( TA_NO_THREADS )
+
+/* Must be called with pool->lock held. Return with the lock held. */
+static void runPendingTasks( TA_ThreadPool *pool )
+{
+   TA_TaskFunc taskFunc;
+   void *taskData;
+   int taskIdx;
+
+   while( pool->nextTask < pool->nbTask )
+   {
+      taskFunc = pool->taskFunc;
+      taskData = pool->taskData;
+      taskIdx  = pool->nextTask++;
+      TA_MUTEX_UNLOCK( &pool->lock );
+
+      taskFunc( taskData, taskIdx );
+
+      TA_MUTEX_LOCK( &pool->lock );
+      pool->nbPending--;
+      if( pool->nbPending == 0 )
+         TA_COND_BROADCAST( &pool->doneCond );
+   }
+}
+
+TA_THREAD_FUNC(workerMain)
+{
+   TA_ThreadPool *pool;
+
+   pool = (TA_ThreadPool *)arg;
+
+   TA_MUTEX_LOCK( &pool->lock );
+   for( ;; )
+   {
+      while( !pool->shutdown && (pool->nextTask >= pool->nbTask) )
+         TA_COND_WAIT( &pool->workCond, &pool->lock );
+
+      if( pool->shutdown )
+         break;
+
+      runPendingTasks( pool );
+   }
+   TA_MUTEX_UNLOCK( &pool->lock );
+
+   TA_THREAD_RETURN;
+}
+
+static int nbOnlineProcessor( void )
+{
+   int nbProcessor;
+
+   #if defined( _WIN32 )
+      SYSTEM_INFO sysInfo;
+      GetSystemInfo( &sysInfo );
+      nbProcessor = (int)sysInfo.dwNumberOfProcessors;
+   #elif defined( _SC_NPROCESSORS_ONLN )
+      nbProcessor = (int)sysconf( _SC_NPROCESSORS_ONLN );
+   #else
+      nbProcessor = 1;
+   #endif
+
+   if( nbProcessor < 1 )
+      nbProcessor = 1;
+
+   return nbProcessor;
+}
+
+static void pinThread( TA_ThreadHandle thread, int processor )
+{
+   #if defined( _WIN32 )
+      if( processor < (int)(sizeof(DWORD_PTR)*8) )
+         SetThreadAffinityMask( thread, ((DWORD_PTR)1) << processor );
+   #elif defined( __linux__ )
+      cpu_set_t cpuSet;
+      CPU_ZERO( &cpuSet );
+      CPU_SET( processor, &cpuSet );
+      pthread_setaffinity_np( thread, sizeof(cpu_set_t), &cpuSet );
+   #else
+      /* Not supported on this platform. */
+      (void)thread;
+      (void)processor;
+   #endif
+}
+
+#endif /* !defined( TA_NO_THREADS ) */
+
+/***************/
+/* End of File */
+/***************/
@@ -76,6 +76,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_ACOS   TA_ACOS_Kernel
+/* Generated */    #define TA_S_ACOS TA_S_ACOS_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  AA       Andrew Atkinson
+ *  AG       Agent
  *
  * Change history:
  *
@@ -46,8 +47,17 @@
  *  052603 MF   Adapt code to compile with .NET Managed C++
  *  062804 MF   Resolve div by zero bug on limit case.
  *  020605 AA   Fix #1117666 Lookback & out-of-bound bug.
+ *  101926 AG   Trace the calls to TA_INT_PO (TA_TRACE).
  */
 
+/* The other TA functions call the TA_INT_PO traced wrapper (see
+ * ta_trace.c).
+ */
+#if defined( TA_TRACE ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   #define TA_INT_PO   TA_INT_PO_Kernel
+   #define TA_S_INT_PO TA_S_INT_PO_Kernel
+#endif
+
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
 /* All code within this section is automatically
  * generated by gen_code. Any modification will be lost
@@ -80,6 +90,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_APO   TA_APO_Kernel
+/* Generated */    #define TA_S_APO TA_S_APO_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
@@ -36,12 +36,14 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  AB       Anatoliy Belsky
+ *  AG       Agent
  *
  * Change history:
  *
  *  MMDDYY BY     Description
  *  -------------------------------------------------------------------
  *  181012 AB    Initial Version
+ *  101926 AG    Output zero instead of NaN when the period has no body.
  */
 
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
@@ -76,6 +78,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_IMI   TA_IMI_Kernel
+/* Generated */    #define TA_S_IMI TA_S_IMI_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
@@ -250,7 +258,12 @@ optInTimePeriod: i32) -> i32
 				downsum += (open - close);
 			}
 
-			outReal[outIdx] = 100.0*(upsum/(upsum + downsum));
+			/* No body over the whole period (a constant run). */
+			if (!TA_IS_ZERO(upsum + downsum)) {
+				outReal[outIdx] = 100.0*(upsum/(upsum + downsum));
+			} else {
+				outReal[outIdx] = 0.0;
+			}
 		}
 
 		startIdx++;
@@ -368,7 +381,11 @@ optInTimePeriod: i32) -> i32
 /* Generated */ 			} else {
 /* Generated */ 				downsum += (open - close);
 /* Generated */ 			}
-/* Generated */ 			outReal[outIdx] = 100.0*(upsum/(upsum + downsum));
+/* Generated */ 			if (!TA_IS_ZERO(upsum + downsum)) {
+/* Generated */ 				outReal[outIdx] = 100.0*(upsum/(upsum + downsum));
+/* Generated */ 			} else {
+/* Generated */ 				outReal[outIdx] = 0.0;
+/* Generated */ 			}
 /* Generated */ 		}
 /* Generated */ 		startIdx++;
 /* Generated */ 		outIdx++;
@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       Agent
  *  JPP      JP Pienaar (j.pienaar@mci.co.za)
  *
  * Change history:
@@ -45,9 +46,20 @@
  *  112400 MF   Template creation.
  *  052603 MF   Adapt code to compile with .NET Managed C++
  *  080403 JPP  Fix #767653 for logic when swapping periods.
+ *  101926 AG   Trace the calls to TA_INT_MACD (TA_TRACE).
+ *  101926 AG   A signal period of 1 has no lookback (the signal
+ *              is the MACD line itself).
  *
  */
 
+/* The other TA functions call the TA_INT_MACD traced wrapper (see
+ * ta_trace.c).
+ */
+#if defined( TA_TRACE ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   #define TA_INT_MACD   TA_INT_MACD_Kernel
+   #define TA_S_INT_MACD TA_S_INT_MACD_Kernel
+#endif
+
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
 /* All code within this section is automatically
  * generated by gen_code. Any modification will be lost
@@ -80,6 +92,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_MACD   TA_MACD_Kernel
+/* Generated */    #define TA_S_MACD TA_S_MACD_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
@@ -151,8 +169,9 @@ optInFastPeriod: i32,
        optInFastPeriod = tempInteger;
    }
 
+   /* A signal period of 1 is the MACD line itself. */
    return   LOOKBACK_CALL(EMA)( optInSlowPeriod   )
-          + LOOKBACK_CALL(EMA)( optInSignalPeriod );
+          + ((optInSignalPeriod > 1)? LOOKBACK_CALL(EMA)( optInSignalPeriod ) : 0);
 }
 
 
@@ -434,7 +453,13 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
       k2 = (double)0.15; /* Fix 12 */
    }
 
-   lookbackSignal = LOOKBACK_CALL(EMA)( optInSignalPeriod_2 );
+   /* A signal period of 1 has no lookback (TA_EMA_Lookback
+    * rejects it).
+    */
+   if( optInSignalPeriod_2 > 1 )
+      lookbackSignal = LOOKBACK_CALL(EMA)( optInSignalPeriod_2 );
+   else
+      lookbackSignal = 0;
 
    /* Move up the start index if there is not
     * enough initial data.
@@ -532,10 +557,18 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
    /* Copy the result into the output for the caller. */
    ARRAY_MEMMOVE( outMACD, 0, fastEMABuffer, lookbackSignal, (endIdx-startIdx)+1 );
 
-   /* Calculate the signal/trigger line. */
-   retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(outNbElement1)-1,
-                                            fastEMABuffer, optInSignalPeriod_2, PER_TO_K(optInSignalPeriod_2),
-                                            VALUE_HANDLE_OUT(outBegIdx2), VALUE_HANDLE_OUT(outNbElement2), outMACDSignal );
+   /* Calculate the signal/trigger line. With a period of 1
+    * the signal is the MACD line.
+    */
+   if( optInSignalPeriod_2 > 1 )
+      retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(outNbElement1)-1,
+                                               fastEMABuffer, optInSignalPeriod_2, PER_TO_K(optInSignalPeriod_2),
+                                               VALUE_HANDLE_OUT(outBegIdx2), VALUE_HANDLE_OUT(outNbElement2), outMACDSignal );
+   else
+   {
+      ARRAY_MEMMOVE( outMACDSignal, 0, fastEMABuffer, 0, VALUE_HANDLE_GET(outNbElement1) );
+      VALUE_HANDLE_SET( outNbElement2, VALUE_HANDLE_GET(outNbElement1) );
+   }
 
 
    ARRAY_FREE( fastEMABuffer );
@@ -769,7 +802,10 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
 /* Generated */       optInFastPeriod = 12;
 /* Generated */       k2 = (double)0.15; 
 /* Generated */    }
-/* Generated */    lookbackSignal = LOOKBACK_CALL(EMA)( optInSignalPeriod_2 );
+/* Generated */    if( optInSignalPeriod_2 > 1 )
+/* Generated */       lookbackSignal = LOOKBACK_CALL(EMA)( optInSignalPeriod_2 );
+/* Generated */    else
+/* Generated */       lookbackSignal = 0;
 /* Generated */    lookbackTotal =  lookbackSignal;
 /* Generated */    lookbackTotal += LOOKBACK_CALL(EMA)( optInSlowPeriod );
 /* Generated */    if( startIdx < lookbackTotal )
@@ -837,9 +873,15 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
 /* Generated */    for( i=0; i < VALUE_HANDLE_GET(outNbElement1); i++ )
 /* Generated */       fastEMABuffer[i] = fastEMABuffer[i] - slowEMABuffer[i];
 /* Generated */    ARRAY_MEMMOVE( outMACD, 0, fastEMABuffer, lookbackSignal, (endIdx-startIdx)+1 );
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(outNbElement1)-1,
-/* Generated */                                             fastEMABuffer, optInSignalPeriod_2, PER_TO_K(optInSignalPeriod_2),
-/* Generated */                                             VALUE_HANDLE_OUT(outBegIdx2), VALUE_HANDLE_OUT(outNbElement2), outMACDSignal );
+/* Generated */    if( optInSignalPeriod_2 > 1 )
+/* Generated */       retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(outNbElement1)-1,
+/* Generated */                                                fastEMABuffer, optInSignalPeriod_2, PER_TO_K(optInSignalPeriod_2),
+/* Generated */                                                VALUE_HANDLE_OUT(outBegIdx2), VALUE_HANDLE_OUT(outNbElement2), outMACDSignal );
+/* Generated */    else
+/* Generated */    {
+/* Generated */       ARRAY_MEMMOVE( outMACDSignal, 0, fastEMABuffer, 0, VALUE_HANDLE_GET(outNbElement1) );
+/* Generated */       VALUE_HANDLE_SET( outNbElement2, VALUE_HANDLE_GET(outNbElement1) );
+/* Generated */    }
 /* Generated */    ARRAY_FREE( fastEMABuffer );
 /* Generated */    ARRAY_FREE( slowEMABuffer );
 /* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       Agent
  *
  *
  * Change history:
@@ -44,6 +45,7 @@
  *  -------------------------------------------------------------------
  *  112400 MF   Template creation.
  *  052603 MF   Adapt code to compile with .NET Managed C++
+ *  101926 AG   A signal period of 1 has no lookback.
  *
  */
 
@@ -79,6 +81,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_MACDFIX   TA_MACDFIX_Kernel
+/* Generated */    #define TA_S_MACDFIX TA_S_MACDFIX_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
@@ -118,7 +126,7 @@ optInSignalPeriod: i32) -> i32
     *  by the fix 26 period EMA).
     */
    return   LOOKBACK_CALL(EMA)( 26 )
-          + LOOKBACK_CALL(EMA)( optInSignalPeriod );
+          + ((optInSignalPeriod > 1)? LOOKBACK_CALL(EMA)( optInSignalPeriod ) : 0);
 }
 
 /**** START GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
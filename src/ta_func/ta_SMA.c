@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       Agent
  *
  *
  * Change history:
@@ -44,9 +45,18 @@
  *  -------------------------------------------------------------------
  *  112400 MF   Template creation.
  *  052603 MF   Adapt code to compile with .NET Managed C++
+ *  101926 AG   Trace the calls to TA_INT_SMA (TA_TRACE).
  *
  */
 
+/* The other TA functions call the TA_INT_SMA traced wrapper (see
+ * ta_trace.c).
+ */
+#if defined( TA_TRACE ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   #define TA_INT_SMA   TA_INT_SMA_Kernel
+   #define TA_S_INT_SMA TA_S_INT_SMA_Kernel
+#endif
+
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
 /* All code within this section is automatically
  * generated by gen_code. Any modification will be lost
@@ -79,6 +89,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_SMA   TA_SMA_Kernel
+/* Generated */    #define TA_S_SMA TA_S_SMA_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  JV       Jesus Viver <324122@cienz.unizar.es>
+ *  AG       Agent
  *
  * Change history:
  *
@@ -46,8 +47,17 @@
  *  100502 JV   Speed optimization of the algorithm
  *  052603 MF   Adapt code to compile with .NET Managed C++
  *  090404 MF   Fix #978056. Trap sqrt with negative zero values.
+ *  101926 AG   Trace the calls to TA_INT_stddev_using_precalc_ma (TA_TRACE).
  */
 
+/* The other TA functions call the TA_INT_stddev_using_precalc_ma traced wrapper (see
+ * ta_trace.c).
+ */
+#if defined( TA_TRACE ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   #define TA_INT_stddev_using_precalc_ma   TA_INT_stddev_using_precalc_ma_Kernel
+   #define TA_S_INT_stddev_using_precalc_ma TA_S_INT_stddev_using_precalc_ma_Kernel
+#endif
+
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
 /* All code within this section is automatically
  * generated by gen_code. Any modification will be lost
@@ -80,6 +90,12 @@
 /* Generated */    #include "ta_memory.h"
 /* Generated */ #endif
 /* Generated */ 
+/* Generated */ #if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    /* The entry points are measuring wrappers (ta_func_stats.c). */
+/* Generated */    #define TA_STDDEV   TA_STDDEV_Kernel
+/* Generated */    #define TA_S_STDDEV TA_S_STDDEV_Kernel
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #define TA_PREFIX(x) TA_##x
 /* Generated */ #define INPUT_TYPE   double
 /* Generated */ 
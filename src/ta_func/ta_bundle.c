@@ -0,0 +1,802 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ * Change history:
+ *
+ *  MMDDYY BY     Description
+ *  -------------------------------------------------------------------
+ *  101926 AG     First version.
+ *  101926 AG     Add TA_BBANDS_Bundle and TA_MACD_Bundle.
+ *  101926 AG     Accept a signal period of 1 in TA_MACD_Bundle.
+ *  101926 AG     NATR uses the close of the bar of the ATR.
+ *  101926 AG     The temporary buffers are subject to the strict
+ *                allocation mode (TA_EntryTempMalloc).
+ */
+
+/* Description:
+ *    Implementation of the bundle functions (see ta_bundle.h).
+ *
+ *    TA_DMI_Bundle:
+ *       The directional movement functions all follow the same steps
+ *       from the bar where they start (startIdx minus their lookback):
+ *
+ *          - the +DM, -DM and TR are summed for 'period-1' bars, then
+ *            Wilder smoothed. This gives PLUS_DM/MINUS_DM, and the
+ *            ratio with the TR gives PLUS_DI/MINUS_DI and DX.
+ *          - ADX is the average of the first 'period' DX, then the
+ *            DX are Wilder smoothed.
+ *          - ADXR is the average of the ADX and the ADX 'period-1'
+ *            bars before (kept in a small circular buffer).
+ *          - ATR is the average of the first 'period' TR, then the
+ *            TR are Wilder smoothed. NATR is the ATR over the close.
+ *
+ *       The operations are done in the same order as the individual
+ *       functions, so the output is bit-for-bit identical. Only the
+ *       bar where the accumulators start may differ between functions,
+ *       so there is one pass per distinct starting bar (almost always
+ *       only one, since all the functions start at bar zero when
+ *       startIdx is within their lookback).
+ *
+ *    TA_BBANDS_Bundle:
+ *       Same steps as TA_BBANDS, except that the deviation is kept
+ *       and the derived outputs are done in the loop of the bands.
+ *
+ *    TA_MACD_Bundle:
+ *       Same steps as TA_INT_MACD, except that the fast and slow EMA
+ *       are copied out before their difference is taken.
+ */
+
+/**** Headers ****/
+#include <math.h>
+#include <string.h>
+
+#include "ta_bundle.h"
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_DMI_TRANGE,
+   TA_DMI_PLUS_DM,
+   TA_DMI_MINUS_DM,
+   TA_DMI_PLUS_DI,
+   TA_DMI_MINUS_DI,
+   TA_DMI_DX,
+   TA_DMI_ADX,
+   TA_DMI_ADXR,
+   TA_DMI_ATR,
+   TA_DMI_NATR,
+   TA_DMI_NB_OUTPUT
+} TA_DMIOutput;
+
+#define TRUE_RANGE(TH,TL,YC,OUT) {\
+   OUT = TH-TL; \
+   tempReal2 = std_fabs(TH-YC); \
+   if( tempReal2 > OUT ) \
+      OUT = tempReal2; \
+   tempReal2 = std_fabs(TL-YC); \
+   if( tempReal2 > OUT ) \
+      OUT = tempReal2; \
+}
+
+/**** Local functions declarations.    ****/
+static void dmiPass( int           firstIdx,
+                     int           begIdx,
+                     int           endIdx,
+                     const double  inHigh[],
+                     const double  inLow[],
+                     const double  inClose[],
+                     int           optInTimePeriod,
+                     const int     lookback[],
+                     double *const out[],
+                     double        adxHistory[] );
+
+static void bbandsDeviation( const double  inReal[],
+                             const double  inMovAvg[],
+                             int           inMovAvgBegIdx,
+                             int           inMovAvgNbElement,
+                             int           timePeriod,
+                             double        outStdDev[],
+                             double        outVariance[] );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_DMI_Bundle( int           startIdx,
+                          int           endIdx,
+                          const double  inHigh[],
+                          const double  inLow[],
+                          const double  inClose[],
+                          int           optInTimePeriod,
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          double        outTRange[],
+                          double        outPlusDM[],
+                          double        outMinusDM[],
+                          double        outPlusDI[],
+                          double        outMinusDI[],
+                          double        outDX[],
+                          double        outADX[],
+                          double        outADXR[],
+                          double        outATR[],
+                          double        outNATR[] )
+{
+   double *output[TA_DMI_NB_OUTPUT];
+   double *passOutput[TA_DMI_NB_OUTPUT];
+   int lookback[TA_DMI_NB_OUTPUT];
+   int firstIdx[TA_DMI_NB_OUTPUT];
+   double *adxHistory;
+   int i, begIdx, passIdx, isPassDone, nbOutput;
+   TA_RetCode retCode;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inHigh || !inLow || !inClose || !outBegIdx || !outNBElement )
+      return TA_BAD_PARAM;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( (optInTimePeriod < 2) || (optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   output[TA_DMI_TRANGE]   = outTRange;
+   output[TA_DMI_PLUS_DM]  = outPlusDM;
+   output[TA_DMI_MINUS_DM] = outMinusDM;
+   output[TA_DMI_PLUS_DI]  = outPlusDI;
+   output[TA_DMI_MINUS_DI] = outMinusDI;
+   output[TA_DMI_DX]       = outDX;
+   output[TA_DMI_ADX]      = outADX;
+   output[TA_DMI_ADXR]     = outADXR;
+   output[TA_DMI_ATR]      = outATR;
+   output[TA_DMI_NATR]     = outNATR;
+
+   lookback[TA_DMI_TRANGE]   = TA_TRANGE_Lookback();
+   lookback[TA_DMI_PLUS_DM]  = TA_PLUS_DM_Lookback( optInTimePeriod );
+   lookback[TA_DMI_MINUS_DM] = TA_MINUS_DM_Lookback( optInTimePeriod );
+   lookback[TA_DMI_PLUS_DI]  = TA_PLUS_DI_Lookback( optInTimePeriod );
+   lookback[TA_DMI_MINUS_DI] = TA_MINUS_DI_Lookback( optInTimePeriod );
+   lookback[TA_DMI_DX]       = TA_DX_Lookback( optInTimePeriod );
+   lookback[TA_DMI_ADX]      = TA_ADX_Lookback( optInTimePeriod );
+   lookback[TA_DMI_ADXR]     = TA_ADXR_Lookback( optInTimePeriod );
+   lookback[TA_DMI_ATR]      = TA_ATR_Lookback( optInTimePeriod );
+   lookback[TA_DMI_NATR]     = TA_NATR_Lookback( optInTimePeriod );
+
+   /* The outputs are aligned on the largest lookback requested. */
+   nbOutput = 0;
+   begIdx   = startIdx;
+   for( i=0; i < TA_DMI_NB_OUTPUT; i++ )
+   {
+      if( output[i] )
+      {
+         nbOutput++;
+         if( lookback[i] > begIdx )
+            begIdx = lookback[i];
+      }
+   }
+
+   if( nbOutput == 0 )
+      return TA_BAD_PARAM;
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+   if( begIdx > endIdx )
+      return TA_SUCCESS;
+
+   /* Bar where each function starts its accumulators. The
+    * true range has no state, it is done by the first pass.
+    */
+   for( i=0; i < TA_DMI_NB_OUTPUT; i++ )
+   {
+      if( startIdx > lookback[i] )
+         firstIdx[i] = startIdx - lookback[i];
+      else
+         firstIdx[i] = 0;
+   }
+   firstIdx[TA_DMI_TRANGE] = begIdx-1;
+   for( i=TA_DMI_TRANGE+1; i < TA_DMI_NB_OUTPUT; i++ )
+   {
+      if( output[i] && (firstIdx[i] < firstIdx[TA_DMI_TRANGE]) )
+         firstIdx[TA_DMI_TRANGE] = firstIdx[i];
+   }
+
+   adxHistory = NULL;
+   if( outADXR )
+   {
+      adxHistory = (double *)TA_EntryTempMalloc( NULL, sizeof(double)*(optInTimePeriod-1), &retCode );
+      if( !adxHistory )
+         return retCode;
+   }
+
+   /* One pass per distinct starting bar, in increasing order. */
+   do
+   {
+      passIdx = endIdx;
+      for( i=0; i < TA_DMI_NB_OUTPUT; i++ )
+      {
+         if( output[i] && (firstIdx[i] < passIdx) )
+            passIdx = firstIdx[i];
+      }
+
+      isPassDone = 1;
+      for( i=0; i < TA_DMI_NB_OUTPUT; i++ )
+      {
+         if( output[i] && (firstIdx[i] == passIdx) )
+         {
+            passOutput[i] = output[i];
+            output[i] = NULL;
+         }
+         else
+         {
+            passOutput[i] = NULL;
+            if( output[i] )
+               isPassDone = 0;
+         }
+      }
+
+      dmiPass( passIdx, begIdx, endIdx, inHigh, inLow, inClose,
+               optInTimePeriod, lookback, passOutput, adxHistory );
+   } while( !isPassDone );
+
+   if( adxHistory )
+      TA_TempFree( adxHistory );
+
+   *outBegIdx    = begIdx;
+   *outNBElement = endIdx-begIdx+1;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BBANDS_Bundle( int           startIdx,
+                             int           endIdx,
+                             const double  inReal[],
+                             int           optInTimePeriod,
+                             double        optInNbDevUp,
+                             double        optInNbDevDn,
+                             TA_MAType     optInMAType,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outRealUpperBand[],
+                             double        outRealMiddleBand[],
+                             double        outRealLowerBand[],
+                             double        outStdDev[],
+                             double        outVariance[],
+                             double        outPercentB[],
+                             double        outBandwidth[] )
+{
+   TA_RetCode retCode;
+   double *tempBuffer, *middle, *stdDev, *variance;
+   double tempReal, tempReal2, upper, lower;
+   int i, begIdx, nbElement, nbTempBuffer, bufferSize;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !outBegIdx || !outNBElement )
+      return TA_BAD_PARAM;
+
+   if( !outRealUpperBand && !outRealMiddleBand && !outRealLowerBand &&
+       !outStdDev && !outVariance && !outPercentB && !outBandwidth )
+      return TA_BAD_PARAM;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 5;
+   else if( (optInTimePeriod < 2) || (optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInNbDevUp == TA_REAL_DEFAULT )
+      optInNbDevUp = 2.0;
+   else if( (optInNbDevUp < -3.000000e+37) || (optInNbDevUp > 3.000000e+37) )
+      return TA_BAD_PARAM;
+
+   if( optInNbDevDn == TA_REAL_DEFAULT )
+      optInNbDevDn = 2.0;
+   else if( (optInNbDevDn < -3.000000e+37) || (optInNbDevDn > 3.000000e+37) )
+      return TA_BAD_PARAM;
+
+   if( (int)optInMAType == TA_INTEGER_DEFAULT )
+      optInMAType = TA_MAType_SMA;
+   else if( ((int)optInMAType < 0) || ((int)optInMAType > 8) )
+      return TA_BAD_PARAM;
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   /* The middle band and the deviation are needed for all
+    * the outputs. Use a temporary buffer when not requested.
+    */
+   bufferSize   = endIdx-startIdx+1;
+   nbTempBuffer = (outRealMiddleBand? 0 : 1) + (outStdDev? 0 : 1);
+   tempBuffer   = NULL;
+   if( nbTempBuffer )
+   {
+      tempBuffer = (double *)TA_EntryTempMalloc( NULL, sizeof(double)*bufferSize*nbTempBuffer, &retCode );
+      if( !tempBuffer )
+         return retCode;
+   }
+   middle = outRealMiddleBand? outRealMiddleBand : tempBuffer;
+   stdDev = outStdDev? outStdDev : &tempBuffer[outRealMiddleBand? 0 : bufferSize];
+
+   retCode = TA_MA( startIdx, endIdx, inReal, optInTimePeriod, optInMAType,
+                    &begIdx, &nbElement, middle );
+   if( (retCode != TA_SUCCESS) || (nbElement == 0) )
+   {
+      if( tempBuffer )
+         TA_TempFree( tempBuffer );
+      return retCode;
+   }
+
+   if( optInMAType == TA_MAType_SMA )
+   {
+      /* Re-use the SMA of the middle band, as TA_BBANDS does. */
+      bbandsDeviation( inReal, middle, begIdx, nbElement,
+                       optInTimePeriod, stdDev, outVariance );
+   }
+   else
+   {
+      variance = outVariance? outVariance : stdDev;
+      retCode = TA_INT_VAR( begIdx, endIdx, inReal, optInTimePeriod,
+                            &begIdx, &nbElement, variance );
+      if( retCode != TA_SUCCESS )
+      {
+         if( tempBuffer )
+            TA_TempFree( tempBuffer );
+         return retCode;
+      }
+
+      for( i=0; i < nbElement; i++ )
+      {
+         tempReal = variance[i];
+         if( !TA_IS_ZERO_OR_NEG(tempReal) )
+            stdDev[i] = std_sqrt(tempReal);
+         else
+            stdDev[i] = (double)0.0;
+      }
+   }
+
+   for( i=0; i < nbElement; i++ )
+   {
+      tempReal  = stdDev[i];
+      tempReal2 = middle[i];
+      upper = tempReal2 + (tempReal * optInNbDevUp);
+      lower = tempReal2 - (tempReal * optInNbDevDn);
+
+      if( outRealUpperBand )
+         outRealUpperBand[i] = upper;
+      if( outRealLowerBand )
+         outRealLowerBand[i] = lower;
+
+      tempReal = upper-lower;
+      if( outPercentB )
+      {
+         if( !TA_IS_ZERO(tempReal) )
+            outPercentB[i] = (inReal[begIdx+i]-lower)/tempReal;
+         else
+            outPercentB[i] = 0.0;
+      }
+      if( outBandwidth )
+      {
+         if( !TA_IS_ZERO(tempReal2) )
+            outBandwidth[i] = tempReal/tempReal2;
+         else
+            outBandwidth[i] = 0.0;
+      }
+   }
+
+   if( tempBuffer )
+      TA_TempFree( tempBuffer );
+
+   *outBegIdx    = begIdx;
+   *outNBElement = nbElement;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_MACD_Bundle( int           startIdx,
+                           int           endIdx,
+                           const double  inReal[],
+                           int           optInFastPeriod,
+                           int           optInSlowPeriod,
+                           int           optInSignalPeriod,
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           double        outMACD[],
+                           double        outMACDSignal[],
+                           double        outMACDHist[],
+                           double        outFastEMA[],
+                           double        outSlowEMA[] )
+{
+   TA_RetCode retCode;
+   double *tempBuffer, *fastEMA, *slowEMA, *signal;
+   double tempReal;
+   int i, tempInteger, lookbackSignal, lookbackTotal;
+   int nbEMA, nbElement, begIdx1, nbElement1, begIdx2, nbElement2;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !outBegIdx || !outNBElement )
+      return TA_BAD_PARAM;
+
+   if( !outMACD && !outMACDSignal && !outMACDHist && !outFastEMA && !outSlowEMA )
+      return TA_BAD_PARAM;
+
+   if( optInFastPeriod == TA_INTEGER_DEFAULT )
+      optInFastPeriod = 12;
+   else if( (optInFastPeriod < 2) || (optInFastPeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInSlowPeriod == TA_INTEGER_DEFAULT )
+      optInSlowPeriod = 26;
+   else if( (optInSlowPeriod < 2) || (optInSlowPeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInSignalPeriod == TA_INTEGER_DEFAULT )
+      optInSignalPeriod = 9;
+   else if( (optInSignalPeriod < 1) || (optInSignalPeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   /* Make sure slow is really slower than the fast period. */
+   if( optInSlowPeriod < optInFastPeriod )
+   {
+      tempInteger     = optInSlowPeriod;
+      optInSlowPeriod = optInFastPeriod;
+      optInFastPeriod = tempInteger;
+   }
+
+   /* An EMA of 1 period (k=1) is its input, without lookback. */
+   lookbackSignal = (optInSignalPeriod > 1)? TA_EMA_Lookback( optInSignalPeriod ) : 0;
+   lookbackTotal  = lookbackSignal + TA_EMA_Lookback( optInSlowPeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   /* The fast/slow EMA start 'lookbackSignal' bars before the
+    * output, so that the signal line starts at startIdx.
+    */
+   nbElement   = endIdx-startIdx+1;
+   nbEMA       = nbElement+lookbackSignal;
+   tempInteger = 2*nbEMA + (outMACDSignal? 0 : nbElement);
+   tempBuffer  = (double *)TA_EntryTempMalloc( NULL, sizeof(double)*tempInteger, &retCode );
+   if( !tempBuffer )
+      return retCode;
+
+   fastEMA = tempBuffer;
+   slowEMA = &tempBuffer[nbEMA];
+   signal  = outMACDSignal? outMACDSignal : &tempBuffer[2*nbEMA];
+
+   tempInteger = startIdx-lookbackSignal;
+   retCode = TA_INT_EMA( tempInteger, endIdx, inReal,
+                         optInSlowPeriod, PER_TO_K(optInSlowPeriod),
+                         &begIdx1, &nbElement1, slowEMA );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_TempFree( tempBuffer );
+      return retCode;
+   }
+
+   retCode = TA_INT_EMA( tempInteger, endIdx, inReal,
+                         optInFastPeriod, PER_TO_K(optInFastPeriod),
+                         &begIdx2, &nbElement2, fastEMA );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_TempFree( tempBuffer );
+      return retCode;
+   }
+
+   if( (begIdx1 != tempInteger) || (begIdx2 != tempInteger) ||
+       (nbElement1 != nbEMA) || (nbElement2 != nbEMA) )
+   {
+      TA_TempFree( tempBuffer );
+      return TA_INTERNAL_ERROR(182);
+   }
+
+   if( outFastEMA )
+      memcpy( outFastEMA, &fastEMA[lookbackSignal], sizeof(double)*nbElement );
+   if( outSlowEMA )
+      memcpy( outSlowEMA, &slowEMA[lookbackSignal], sizeof(double)*nbElement );
+
+   /* Calculate (fast EMA) - (slow EMA), then the signal line. */
+   for( i=0; i < nbEMA; i++ )
+      fastEMA[i] = fastEMA[i] - slowEMA[i];
+
+   if( optInSignalPeriod > 1 )
+   {
+      retCode = TA_INT_EMA( 0, nbEMA-1, fastEMA,
+                            optInSignalPeriod, PER_TO_K(optInSignalPeriod),
+                            &begIdx2, &nbElement2, signal );
+      if( retCode != TA_SUCCESS )
+      {
+         TA_TempFree( tempBuffer );
+         return retCode;
+      }
+   }
+   else
+   {
+      memcpy( signal, fastEMA, sizeof(double)*nbEMA );
+      nbElement2 = nbEMA;
+   }
+
+   for( i=0; i < nbElement2; i++ )
+   {
+      tempReal = fastEMA[lookbackSignal+i];
+      if( outMACD )
+         outMACD[i] = tempReal;
+      if( outMACDHist )
+         outMACDHist[i] = tempReal-signal[i];
+   }
+
+   TA_TempFree( tempBuffer );
+
+   *outBegIdx    = startIdx;
+   *outNBElement = nbElement2;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static void dmiPass( int           firstIdx,
+                     int           begIdx,
+                     int           endIdx,
+                     const double  inHigh[],
+                     const double  inLow[],
+                     const double  inClose[],
+                     int           optInTimePeriod,
+                     const int     lookback[],
+                     double *const out[],
+                     double        adxHistory[] )
+{
+   double prevHigh, prevLow, prevClose;
+   double prevPlusDM, prevMinusDM, prevTR;
+   double plusDI, minusDI, dx, dxValue, sumDX, prevADX;
+   double sumATR, prevATR;
+   double diffP, diffM, trueRange, tempReal, tempReal2;
+   int today, outIdx, i, isZeroTR, isDX;
+   const int adxLag = optInTimePeriod-1;
+
+   prevPlusDM  = 0.0;
+   prevMinusDM = 0.0;
+   prevTR      = 0.0;
+   plusDI      = 0.0;
+   minusDI     = 0.0;
+   dx          = 0.0;
+   dxValue     = 0.0;
+   sumDX       = 0.0;
+   prevADX     = 0.0;
+   sumATR      = 0.0;
+   prevATR     = 0.0;
+   isZeroTR    = 1;
+
+   prevHigh  = inHigh[firstIdx];
+   prevLow   = inLow[firstIdx];
+   prevClose = inClose[firstIdx];
+
+   /* 'i' is the number of bars since firstIdx. */
+   for( today=firstIdx+1, i=1; today <= endIdx; today++, i++ )
+   {
+      tempReal = inHigh[today];
+      diffP    = tempReal-prevHigh; /* Plus Delta */
+      prevHigh = tempReal;
+
+      tempReal = inLow[today];
+      diffM    = prevLow-tempReal;   /* Minus Delta */
+      prevLow  = tempReal;
+
+      TRUE_RANGE(prevHigh,prevLow,prevClose,trueRange);
+      prevClose = inClose[today];
+
+      /* +DM, -DM and TR: summed, then Wilder smoothed. */
+      if( i >= optInTimePeriod )
+      {
+         prevMinusDM -= prevMinusDM/optInTimePeriod;
+         prevPlusDM  -= prevPlusDM/optInTimePeriod;
+      }
+
+      if( (diffM > 0) && (diffP < diffM) )
+         prevMinusDM += diffM;
+      else if( (diffP > 0) && (diffP > diffM) )
+         prevPlusDM += diffP;
+
+      if( i < optInTimePeriod )
+         prevTR += trueRange;
+      else
+         prevTR = prevTR - (prevTR/optInTimePeriod) + trueRange;
+
+      /* DI, DX and ADX. */
+      if( i >= optInTimePeriod )
+      {
+         isDX = 0;
+         isZeroTR = TA_IS_ZERO(prevTR);
+         if( !isZeroTR )
+         {
+            minusDI  = 100.0*(prevMinusDM/prevTR);
+            plusDI   = 100.0*(prevPlusDM/prevTR);
+            tempReal = minusDI+plusDI;
+            if( !TA_IS_ZERO(tempReal) )
+            {
+               dxValue = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+               isDX = 1;
+            }
+         }
+
+         /* DX repeats its previous value when undefined. */
+         if( isDX )
+            dx = dxValue;
+         else if( i == lookback[TA_DMI_DX] )
+            dx = 0.0;
+
+         if( i < 2*optInTimePeriod )
+         {
+            if( isDX )
+               sumDX += dxValue;
+            if( i == 2*optInTimePeriod-1 )
+               prevADX = sumDX / optInTimePeriod;
+         }
+         else if( isDX )
+            prevADX = ((prevADX*(optInTimePeriod-1))+dxValue)/optInTimePeriod;
+      }
+
+      /* ATR: average, then Wilder smoothed. */
+      if( i <= optInTimePeriod )
+      {
+         sumATR += trueRange;
+         if( i == optInTimePeriod )
+            prevATR = sumATR / optInTimePeriod;
+      }
+      else
+      {
+         prevATR *= optInTimePeriod - 1;
+         prevATR += trueRange;
+         prevATR /= optInTimePeriod;
+      }
+
+      outIdx = today-begIdx;
+      if( out[TA_DMI_ADXR] && (i >= 2*optInTimePeriod-1) )
+      {
+         /* Value from 'period-1' bars ago, then keep the current one. */
+         tempReal = adxHistory[i%adxLag];
+         if( outIdx >= 0 )
+            out[TA_DMI_ADXR][outIdx] = (prevADX+tempReal)/2.0;
+         adxHistory[i%adxLag] = prevADX;
+      }
+
+      if( outIdx < 0 )
+         continue;
+
+      if( out[TA_DMI_TRANGE] )
+         out[TA_DMI_TRANGE][outIdx] = trueRange;
+      if( out[TA_DMI_PLUS_DM] )
+         out[TA_DMI_PLUS_DM][outIdx] = prevPlusDM;
+      if( out[TA_DMI_MINUS_DM] )
+         out[TA_DMI_MINUS_DM][outIdx] = prevMinusDM;
+      if( out[TA_DMI_PLUS_DI] )
+         out[TA_DMI_PLUS_DI][outIdx] = isZeroTR? 0.0 : plusDI;
+      if( out[TA_DMI_MINUS_DI] )
+         out[TA_DMI_MINUS_DI][outIdx] = isZeroTR? 0.0 : minusDI;
+      if( out[TA_DMI_DX] )
+         out[TA_DMI_DX][outIdx] = dx;
+      if( out[TA_DMI_ADX] )
+         out[TA_DMI_ADX][outIdx] = prevADX;
+      if( out[TA_DMI_ATR] )
+         out[TA_DMI_ATR][outIdx] = prevATR;
+      if( out[TA_DMI_NATR] )
+      {
+         tempReal = inClose[today];
+         if( !TA_IS_ZERO(tempReal) )
+            out[TA_DMI_NATR][outIdx] = (prevATR/tempReal)*100.0;
+         else
+            out[TA_DMI_NATR][outIdx] = 0.0;
+      }
+   }
+}
+
+/* Same as TA_INT_stddev_using_precalc_ma, with the variance
+ * also written out when requested.
+ */
+static void bbandsDeviation( const double  inReal[],
+                             const double  inMovAvg[],
+                             int           inMovAvgBegIdx,
+                             int           inMovAvgNbElement,
+                             int           timePeriod,
+                             double        outStdDev[],
+                             double        outVariance[] )
+{
+   double tempReal, periodTotal2, meanValue2;
+   int outIdx, startSum, endSum;
+
+   startSum = 1+inMovAvgBegIdx-timePeriod;
+   endSum   = inMovAvgBegIdx;
+
+   periodTotal2 = 0;
+
+   for( outIdx = startSum; outIdx < endSum; outIdx++)
+   {
+      tempReal = inReal[outIdx];
+      tempReal *= tempReal;
+      periodTotal2 += tempReal;
+   }
+
+   for( outIdx=0; outIdx < inMovAvgNbElement; outIdx++, startSum++, endSum++ )
+   {
+      tempReal = inReal[endSum];
+      tempReal *= tempReal;
+      periodTotal2 += tempReal;
+      meanValue2 = periodTotal2/timePeriod;
+
+      tempReal = inReal[startSum];
+      tempReal *= tempReal;
+      periodTotal2 -= tempReal;
+
+      tempReal = inMovAvg[outIdx];
+      tempReal *= tempReal;
+      meanValue2 -= tempReal;
+
+      if( outVariance )
+         outVariance[outIdx] = meanValue2;
+
+      if( !TA_IS_ZERO_OR_NEG(meanValue2) )
+         outStdDev[outIdx] = std_sqrt(meanValue2);
+      else
+         outStdDev[outIdx] = (double)0.0;
+   }
+}
+
+/***************/
+/* End of File */
+/***************/
@@ -0,0 +1,826 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ * Change history:
+ *
+ *  MMDDYY BY     Description
+ *  -------------------------------------------------------------------
+ *  101926 AG     First version.
+ *  101926 AG     Submit the blocks to the executor (TA_SetExecutor).
+ *  101926 AG     Add TA_SMA_Sweep.
+ *  101926 AG     Transpose the lanes in tiles of TA_PANEL_TILE bars.
+ *  101926 AG     The temporary memory is subject to the strict
+ *                allocation mode (TA_EntryMalloc).
+ */
+
+/* Description:
+ *    Implementation of the panel functions (see ta_panel.h).
+ *
+ *    The series are grouped in blocks of up to TA_PANEL_LANES.
+ *    Because all series of a panel share the same parameters and
+ *    start at index zero, every series of a block is at the same
+ *    phase of the algorithm for the same 'today'. The state of the
+ *    algorithm is therefore kept in small per-lane arrays.
+ *
+ *    While all the lanes produce output, the bars are transposed in
+ *    tiles of TA_PANEL_TILE x TA_PANEL_LANES (structure of arrays) on
+ *    the stack. The recurrence runs on the tile with a fixed number
+ *    of lanes (the missing lanes are zeroes), so the inner loop over
+ *    the lanes is vectorized, then the tile is copied to the outputs.
+ *    A tile is read from the inputs before being written, which keeps
+ *    an output being the same buffer as its input possible.
+ *
+ *    The arithmetic done for each lane is the same sequence of
+ *    operations as the single series function (the RSI gain/loss
+ *    update adds or subtracts a zero instead of branching, which does
+ *    not change the values), so the output is bit-for-bit identical.
+ *
+ *    Once the shortest series of a block is exhausted, the remaining
+ *    lanes are completed one at the time.
+ *
+ *    The blocks are independent of each other and are processed as
+ *    separate tasks when an executor is set (see TA_SetExecutor).
+ *
+ *    The sweep functions do the opposite: one series, many periods.
+ *    The input is split in blocks of TA_SWEEP_BLOCK values, and the
+ *    running sum of every period is advanced over a block before
+ *    moving to the next one, so the input is read once from memory.
+ *    Each period still does the same sequence of operations as the
+ *    single period function.
+ */
+
+/**** Headers ****/
+#include "ta_panel.h"
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+/* Nb of input values processed for all the periods of a sweep
+ * before moving to the next ones (16KB of doubles).
+ */
+#define TA_SWEEP_BLOCK 2048
+
+/* Nb of bars transposed at once for all the lanes of a block. */
+#define TA_PANEL_TILE 64
+
+typedef struct
+{
+   int           nbLane;
+   const double *in[TA_PANEL_LANES];
+   double       *out[TA_PANEL_LANES];
+   int           endIdx[TA_PANEL_LANES];
+   int           minEndIdx;
+   int          *outNBElement[TA_PANEL_LANES];
+} TA_PanelBlock;
+
+typedef void (*TA_PanelKernel)( TA_PanelBlock *block,
+                                int            optInTimePeriod,
+                                int            lookbackTotal );
+
+/* All the blocks of a panel, when processed through an executor. */
+typedef struct
+{
+   TA_PanelBlock  *block;
+   TA_PanelKernel  kernel;
+   int             optInTimePeriod;
+   int             lookbackTotal;
+} TA_PanelJob;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode panelRun( int                 nSeries,
+                            const int           inLength[],
+                            const double *const inReal[],
+                            int                 optInTimePeriod,
+                            int                 lookbackTotal,
+                            int                 outBegIdx[],
+                            int                 outNBElement[],
+                            double *const       outReal[],
+                            TA_PanelKernel      kernel );
+
+static void panelTask( void *taskData, int taskIdx );
+
+static void panelGather( const TA_PanelBlock *block, int idx, int nbBar,
+                         double tile[][TA_PANEL_LANES] );
+static void panelScatter( const TA_PanelBlock *block, int idx, int nbBar,
+                          const double tile[][TA_PANEL_LANES] );
+
+static void smaKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal );
+static void emaKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal );
+static void rsiKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal );
+static void rsiSerialKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SMA_Panel( int                 nSeries,
+                         const int           inLength[],
+                         const double *const inReal[],
+                         int                 optInTimePeriod,
+                         int                 outBegIdx[],
+                         int                 outNBElement[],
+                         double *const       outReal[] )
+{
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( (optInTimePeriod < 2) || (optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   return panelRun( nSeries, inLength, inReal, optInTimePeriod,
+                    TA_SMA_Lookback( optInTimePeriod ),
+                    outBegIdx, outNBElement, outReal, smaKernel );
+}
+
+TA_RetCode TA_EMA_Panel( int                 nSeries,
+                         const int           inLength[],
+                         const double *const inReal[],
+                         int                 optInTimePeriod,
+                         int                 outBegIdx[],
+                         int                 outNBElement[],
+                         double *const       outReal[] )
+{
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( (optInTimePeriod < 2) || (optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   return panelRun( nSeries, inLength, inReal, optInTimePeriod,
+                    TA_EMA_Lookback( optInTimePeriod ),
+                    outBegIdx, outNBElement, outReal, emaKernel );
+}
+
+TA_RetCode TA_RSI_Panel( int                 nSeries,
+                         const int           inLength[],
+                         const double *const inReal[],
+                         int                 optInTimePeriod,
+                         int                 outBegIdx[],
+                         int                 outNBElement[],
+                         double *const       outReal[] )
+{
+   TA_PanelKernel kernel;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( (optInTimePeriod < 2) || (optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   /* The Metastock variant without unstable period produces an
+    * additional first value using a different seed. This is
+    * rarely used, so just do these series one at the time.
+    */
+   if( (TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi) == 0) &&
+       (TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_METASTOCK) )
+      kernel = rsiSerialKernel;
+   else
+      kernel = rsiKernel;
+
+   return panelRun( nSeries, inLength, inReal, optInTimePeriod,
+                    TA_RSI_Lookback( optInTimePeriod ),
+                    outBegIdx, outNBElement, outReal, kernel );
+}
+
+TA_RetCode TA_SMA_Sweep( int                 startIdx,
+                         int                 endIdx,
+                         const double        inReal[],
+                         int                 nPeriod,
+                         const int           optInTimePeriod[],
+                         int                 outBegIdx[],
+                         int                 outNBElement[],
+                         double *const       outReal[] )
+{
+   double *periodTotal;
+   int *trailingIdx;
+   double tempReal, total;
+   double *out;
+   int k, i, period, firstIdx, blockIdx, blockEndIdx, trailing;
+   TA_RetCode retCode;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( nPeriod < 0 )
+      return TA_BAD_PARAM;
+
+   if( nPeriod == 0 )
+      return TA_SUCCESS;
+
+   if( !inReal || !optInTimePeriod || !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   /* Validate everything before writing any output. */
+   for( k=0; k < nPeriod; k++ )
+   {
+      if( (optInTimePeriod[k] < 2) || (optInTimePeriod[k] > 100000) || !outReal[k] )
+         return TA_BAD_PARAM;
+   }
+
+   periodTotal = (double *)TA_EntryTempMalloc( NULL, nPeriod*(sizeof(double)+sizeof(int)), &retCode );
+   if( !periodTotal )
+      return retCode;
+   trailingIdx = (int *)&periodTotal[nPeriod];
+
+   /* outBegIdx is where the outputs start, trailingIdx is where the
+    * sum starts (the first value to be removed from it).
+    */
+   firstIdx = endIdx+1;
+   for( k=0; k < nPeriod; k++ )
+   {
+      period = optInTimePeriod[k];
+      outBegIdx[k]    = (startIdx < period-1)? period-1 : startIdx;
+      outNBElement[k] = 0;
+      periodTotal[k]  = 0;
+      trailingIdx[k]  = outBegIdx[k]-(period-1);
+      if( (outBegIdx[k] <= endIdx) && (trailingIdx[k] < firstIdx) )
+         firstIdx = trailingIdx[k];
+   }
+
+   for( blockIdx=firstIdx; blockIdx <= endIdx; blockIdx += TA_SWEEP_BLOCK )
+   {
+      blockEndIdx = blockIdx+TA_SWEEP_BLOCK-1;
+      if( blockEndIdx > endIdx )
+         blockEndIdx = endIdx;
+
+      for( k=0; k < nPeriod; k++ )
+      {
+         /* Skip the periods without output or not yet started. */
+         if( (outBegIdx[k] > endIdx) || (trailingIdx[k] > blockEndIdx) )
+            continue;
+
+         period   = optInTimePeriod[k];
+         total    = periodTotal[k];
+         trailing = trailingIdx[k];
+         out      = outReal[k];
+
+         i = trailing+period-1;
+         if( outNBElement[k] == 0 )
+         {
+            /* Add-up the initial period, except for the last value. */
+            i = (trailing > blockIdx)? trailing : blockIdx;
+            while( (i < outBegIdx[k]) && (i <= blockEndIdx) )
+               total += inReal[i++];
+         }
+
+         while( i <= blockEndIdx )
+         {
+            total += inReal[i++];
+            tempReal = total;
+            total -= inReal[trailing++];
+            out[i-1-outBegIdx[k]] = tempReal / period;
+         }
+
+         periodTotal[k]  = total;
+         trailingIdx[k]  = trailing;
+         outNBElement[k] = (i > outBegIdx[k])? i-outBegIdx[k] : 0;
+      }
+   }
+
+   for( k=0; k < nPeriod; k++ )
+   {
+      if( outNBElement[k] == 0 )
+         outBegIdx[k] = 0;
+   }
+
+   TA_TempFree( periodTotal );
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode panelRun( int                 nSeries,
+                            const int           inLength[],
+                            const double *const inReal[],
+                            int                 optInTimePeriod,
+                            int                 lookbackTotal,
+                            int                 outBegIdx[],
+                            int                 outNBElement[],
+                            double *const       outReal[],
+                            TA_PanelKernel      kernel )
+{
+   TA_PanelBlock localBlock;
+   TA_PanelBlock *block;
+   TA_PanelJob job;
+   int i, nbActive, nbBlock;
+   TA_RetCode retCode;
+
+   if( nSeries < 0 )
+      return TA_BAD_PARAM;
+
+   if( nSeries == 0 )
+      return TA_SUCCESS;
+
+   if( !inLength || !inReal || !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   /* Validate everything before writing any output. */
+   nbActive = 0;
+   for( i=0; i < nSeries; i++ )
+   {
+      if( inLength[i] < 0 )
+         return TA_BAD_PARAM;
+      if( (inLength[i] > 0) && (!inReal[i] || !outReal[i]) )
+         return TA_BAD_PARAM;
+      if( inLength[i] > lookbackTotal )
+         nbActive++;
+   }
+
+   /* When an executor is specified, all the blocks are prepared
+    * first and then processed as independent tasks. Otherwise (or
+    * if the memory is not available, or denied by the strict
+    * allocation mode) each block is processed as soon as it is
+    * filled.
+    */
+   nbBlock = (nbActive+TA_PANEL_LANES-1)/TA_PANEL_LANES;
+   job.block = NULL;
+   if( TA_Globals->executor && (nbBlock > 1) )
+      job.block = (TA_PanelBlock *)TA_EntryMalloc( NULL, sizeof(TA_PanelBlock)*nbBlock, &retCode );
+
+   block = job.block? job.block : &localBlock;
+   block->nbLane = 0;
+   for( i=0; i < nSeries; i++ )
+   {
+      outBegIdx[i]    = 0;
+      outNBElement[i] = 0;
+
+      /* Make sure there is something to evaluate. */
+      if( inLength[i] <= lookbackTotal )
+         continue;
+
+      outBegIdx[i] = lookbackTotal;
+
+      if( block->nbLane == TA_PANEL_LANES )
+      {
+         if( job.block )
+            block++;
+         else
+            kernel( block, optInTimePeriod, lookbackTotal );
+         block->nbLane = 0;
+      }
+
+      if( (block->nbLane == 0) || (inLength[i]-1 < block->minEndIdx) )
+         block->minEndIdx = inLength[i]-1;
+      block->in[block->nbLane]           = inReal[i];
+      block->out[block->nbLane]          = outReal[i];
+      block->endIdx[block->nbLane]       = inLength[i]-1;
+      block->outNBElement[block->nbLane] = &outNBElement[i];
+      block->nbLane++;
+   }
+
+   if( job.block )
+   {
+      job.kernel          = kernel;
+      job.optInTimePeriod = optInTimePeriod;
+      job.lookbackTotal   = lookbackTotal;
+      TA_RunTasks( nbBlock, panelTask, &job );
+      TA_Free( job.block );
+   }
+   else if( block->nbLane > 0 )
+      kernel( block, optInTimePeriod, lookbackTotal );
+
+   return TA_SUCCESS;
+}
+
+static void panelTask( void *taskData, int taskIdx )
+{
+   TA_PanelJob *job;
+
+   job = (TA_PanelJob *)taskData;
+   job->kernel( &job->block[taskIdx], job->optInTimePeriod, job->lookbackTotal );
+}
+
+/* Transpose the bars [idx..idx+nbBar-1] of all the lanes in a tile,
+ * the missing lanes are zeroes.
+ */
+static void panelGather( const TA_PanelBlock *block, int idx, int nbBar,
+                         double tile[][TA_PANEL_LANES] )
+{
+   const double *in;
+   int lane, t;
+
+   for( lane=0; lane < block->nbLane; lane++ )
+   {
+      in = &block->in[lane][idx];
+      for( t=0; t < nbBar; t++ )
+         tile[t][lane] = in[t];
+   }
+
+   for( ; lane < TA_PANEL_LANES; lane++ )
+   {
+      for( t=0; t < nbBar; t++ )
+         tile[t][lane] = 0.0;
+   }
+}
+
+static void panelScatter( const TA_PanelBlock *block, int idx, int nbBar,
+                          const double tile[][TA_PANEL_LANES] )
+{
+   double *out;
+   int lane, t;
+
+   for( lane=0; lane < block->nbLane; lane++ )
+   {
+      out = &block->out[lane][idx];
+      for( t=0; t < nbBar; t++ )
+         out[t] = tile[t][lane];
+   }
+}
+
+static void smaKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal )
+{
+   double tileIn[TA_PANEL_TILE][TA_PANEL_LANES];
+   double tileTrailing[TA_PANEL_TILE][TA_PANEL_LANES];
+   double tileOut[TA_PANEL_TILE][TA_PANEL_LANES];
+   double periodTotal[TA_PANEL_LANES];
+   double tempReal;
+   const double *in;
+   double *out;
+   int lane, nbLane, i, t, nbBar, trailingIdx, outIdx;
+   int today, laneTrailingIdx, laneOutIdx;
+   double laneTotal;
+
+   nbLane = block->nbLane;
+
+   /* Add-up the initial period, except for the last value. */
+   for( lane=0; lane < TA_PANEL_LANES; lane++ )
+      periodTotal[lane] = 0.0;
+   for( lane=0; lane < nbLane; lane++ )
+   {
+      in = block->in[lane];
+      for( i=0; i < lookbackTotal; i++ )
+         periodTotal[lane] += in[i];
+   }
+
+   /* Proceed with all the lanes together up to the end of
+    * the shortest series, one tile at the time.
+    */
+   today = lookbackTotal;
+   trailingIdx = 0;
+   outIdx = 0;
+   while( today <= block->minEndIdx )
+   {
+      nbBar = block->minEndIdx-today+1;
+      if( nbBar > TA_PANEL_TILE )
+         nbBar = TA_PANEL_TILE;
+
+      panelGather( block, today, nbBar, tileIn );
+      panelGather( block, trailingIdx, nbBar, tileTrailing );
+      for( t=0; t < nbBar; t++ )
+      {
+         for( lane=0; lane < TA_PANEL_LANES; lane++ )
+         {
+            periodTotal[lane] += tileIn[t][lane];
+            tileOut[t][lane] = periodTotal[lane] / optInTimePeriod;
+            periodTotal[lane] -= tileTrailing[t][lane];
+         }
+      }
+      panelScatter( block, outIdx, nbBar, tileOut );
+
+      today       += nbBar;
+      trailingIdx += nbBar;
+      outIdx      += nbBar;
+   }
+
+   /* Complete the longer series. */
+   for( lane=0; lane < nbLane; lane++ )
+   {
+      in  = block->in[lane];
+      out = block->out[lane];
+      laneTotal       = periodTotal[lane];
+      laneTrailingIdx = trailingIdx;
+      laneOutIdx      = outIdx;
+      for( i=today; i <= block->endIdx[lane]; i++ )
+      {
+         laneTotal += in[i];
+         tempReal = laneTotal;
+         laneTotal -= in[laneTrailingIdx++];
+         out[laneOutIdx++] = tempReal / optInTimePeriod;
+      }
+      *block->outNBElement[lane] = laneOutIdx;
+   }
+}
+
+static void emaKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal )
+{
+   double tileIn[TA_PANEL_TILE][TA_PANEL_LANES];
+   double tileOut[TA_PANEL_TILE][TA_PANEL_LANES];
+   double prevMA[TA_PANEL_LANES];
+   double optInK_1, tempReal, laneMA;
+   const double *in;
+   double *out;
+   int lane, nbLane, i, t, nbBar, today, outIdx, laneOutIdx;
+
+   nbLane   = block->nbLane;
+   optInK_1 = PER_TO_K( optInTimePeriod );
+
+   /* Seed each lane exactly like TA_INT_EMA. */
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+   {
+      for( lane=0; lane < nbLane; lane++ )
+      {
+         in = block->in[lane];
+         tempReal = 0.0;
+         for( i=0; i < optInTimePeriod; i++ )
+            tempReal += in[i];
+         prevMA[lane] = tempReal / optInTimePeriod;
+      }
+      today = optInTimePeriod;
+   }
+   else
+   {
+      for( lane=0; lane < nbLane; lane++ )
+         prevMA[lane] = block->in[lane][0];
+      today = 1;
+   }
+
+   /* Skip the unstable period. Do the processing
+    * but do not write it in the output.
+    */
+   while( today <= lookbackTotal )
+   {
+      for( lane=0; lane < nbLane; lane++ )
+         prevMA[lane] = ((block->in[lane][today]-prevMA[lane])*optInK_1) + prevMA[lane];
+      today++;
+   }
+
+   for( lane=0; lane < nbLane; lane++ )
+      block->out[lane][0] = prevMA[lane];
+   for( lane=nbLane; lane < TA_PANEL_LANES; lane++ )
+      prevMA[lane] = 0.0;
+   outIdx = 1;
+
+   while( today <= block->minEndIdx )
+   {
+      nbBar = block->minEndIdx-today+1;
+      if( nbBar > TA_PANEL_TILE )
+         nbBar = TA_PANEL_TILE;
+
+      panelGather( block, today, nbBar, tileIn );
+      for( t=0; t < nbBar; t++ )
+      {
+         for( lane=0; lane < TA_PANEL_LANES; lane++ )
+         {
+            prevMA[lane] = ((tileIn[t][lane]-prevMA[lane])*optInK_1) + prevMA[lane];
+            tileOut[t][lane] = prevMA[lane];
+         }
+      }
+      panelScatter( block, outIdx, nbBar, tileOut );
+
+      today  += nbBar;
+      outIdx += nbBar;
+   }
+
+   /* Complete the longer series. */
+   for( lane=0; lane < nbLane; lane++ )
+   {
+      in  = block->in[lane];
+      out = block->out[lane];
+      laneMA     = prevMA[lane];
+      laneOutIdx = outIdx;
+      for( i=today; i <= block->endIdx[lane]; i++ )
+      {
+         laneMA = ((in[i]-laneMA)*optInK_1) + laneMA;
+         out[laneOutIdx++] = laneMA;
+      }
+      *block->outNBElement[lane] = laneOutIdx;
+   }
+}
+
+static void rsiKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal )
+{
+   double tileIn[TA_PANEL_TILE][TA_PANEL_LANES];
+   double tileGain[TA_PANEL_TILE][TA_PANEL_LANES];
+   double tileLoss[TA_PANEL_TILE][TA_PANEL_LANES];
+   double tileOut[TA_PANEL_TILE][TA_PANEL_LANES];
+   double prevGain[TA_PANEL_LANES];
+   double prevLoss[TA_PANEL_LANES];
+   double prevValue[TA_PANEL_LANES];
+   double tempValue1, tempValue2;
+   double laneGain, laneLoss, laneValue;
+   const double *in, *tile;
+   double *out, *gain, *loss;
+   int lane, nbLane, i, t, nbBar, today, outIdx, laneOutIdx;
+
+   nbLane = block->nbLane;
+
+   /* Accumulate Wilder's "Average Gain" and "Average Loss"
+    * among the initial period. Same algorithm as TA_RSI.
+    */
+   for( lane=0; lane < TA_PANEL_LANES; lane++ )
+   {
+      prevValue[lane] = (lane < nbLane)? block->in[lane][0] : 0.0;
+      prevGain[lane]  = 0.0;
+      prevLoss[lane]  = 0.0;
+   }
+
+   today = 1;
+   for( i=optInTimePeriod; i > 0; i-- )
+   {
+      for( lane=0; lane < nbLane; lane++ )
+      {
+         tempValue1 = block->in[lane][today];
+         tempValue2 = tempValue1 - prevValue[lane];
+         prevValue[lane] = tempValue1;
+         if( tempValue2 < 0 )
+            prevLoss[lane] -= tempValue2;
+         else
+            prevGain[lane] += tempValue2;
+      }
+      today++;
+   }
+
+   for( lane=0; lane < nbLane; lane++ )
+   {
+      prevLoss[lane] /= optInTimePeriod;
+      prevGain[lane] /= optInTimePeriod;
+   }
+
+   outIdx = 0;
+   if( today > lookbackTotal )
+   {
+      for( lane=0; lane < nbLane; lane++ )
+      {
+         tempValue1 = prevGain[lane]+prevLoss[lane];
+         if( !TA_IS_ZERO(tempValue1) )
+            block->out[lane][0] = 100.0*(prevGain[lane]/tempValue1);
+         else
+            block->out[lane][0] = 0.0;
+      }
+      outIdx = 1;
+   }
+
+   /* Skip the unstable period (if any). Do the processing
+    * but do not write it in the output.
+    */
+   while( today < lookbackTotal )
+   {
+      for( lane=0; lane < nbLane; lane++ )
+      {
+         tempValue1 = block->in[lane][today];
+         tempValue2 = tempValue1 - prevValue[lane];
+         prevValue[lane] = tempValue1;
+
+         prevLoss[lane] *= (optInTimePeriod-1);
+         prevGain[lane] *= (optInTimePeriod-1);
+         if( tempValue2 < 0 )
+            prevLoss[lane] -= tempValue2;
+         else
+            prevGain[lane] += tempValue2;
+
+         prevLoss[lane] /= optInTimePeriod;
+         prevGain[lane] /= optInTimePeriod;
+      }
+      today++;
+   }
+
+   /* Write the output until the shortest series is exhausted.
+    *
+    * Each tile is done in three passes, so none of them branches:
+    * the changes of the tile (as flat arrays), the recurrence, then
+    * the RSI values. The gain and the loss are always updated, with
+    * zero for the one not concerned (a zero gain or loss is +0.0,
+    * so the sums are the same as when branching).
+    */
+   tile = &tileIn[0][0];
+   gain = &tileGain[0][0];
+   loss = &tileLoss[0][0];
+   out  = &tileOut[0][0];
+   while( today <= block->minEndIdx )
+   {
+      nbBar = block->minEndIdx-today+1;
+      if( nbBar > TA_PANEL_TILE )
+         nbBar = TA_PANEL_TILE;
+
+      panelGather( block, today, nbBar, tileIn );
+      for( i=0; i < nbBar*TA_PANEL_LANES; i++ )
+      {
+         tempValue2 = tile[i] - ((i < TA_PANEL_LANES)? prevValue[i] : tile[i-TA_PANEL_LANES]);
+         gain[i] = (tempValue2 < 0)? 0.0 : tempValue2;
+         loss[i] = (tempValue2 < 0)? tempValue2 : 0.0;
+      }
+      for( lane=0; lane < TA_PANEL_LANES; lane++ )
+         prevValue[lane] = tileIn[nbBar-1][lane];
+
+      for( t=0; t < nbBar; t++ )
+      {
+         for( lane=0; lane < TA_PANEL_LANES; lane++ )
+         {
+            prevLoss[lane] *= (optInTimePeriod-1);
+            prevGain[lane] *= (optInTimePeriod-1);
+            prevLoss[lane] -= tileLoss[t][lane];
+            prevGain[lane] += tileGain[t][lane];
+
+            prevLoss[lane] /= optInTimePeriod;
+            prevGain[lane] /= optInTimePeriod;
+
+            tileLoss[t][lane] = prevLoss[lane];
+            tileGain[t][lane] = prevGain[lane];
+         }
+      }
+
+      for( i=0; i < nbBar*TA_PANEL_LANES; i++ )
+      {
+         tempValue1 = gain[i]+loss[i];
+         tempValue2 = 100.0*(gain[i]/tempValue1);
+         out[i] = TA_IS_ZERO(tempValue1)? 0.0 : tempValue2;
+      }
+      panelScatter( block, outIdx, nbBar, tileOut );
+
+      today  += nbBar;
+      outIdx += nbBar;
+   }
+
+   /* Complete the longer series. */
+   for( lane=0; lane < nbLane; lane++ )
+   {
+      in  = block->in[lane];
+      out = block->out[lane];
+      laneGain   = prevGain[lane];
+      laneLoss   = prevLoss[lane];
+      laneValue  = prevValue[lane];
+      laneOutIdx = outIdx;
+      for( i=today; i <= block->endIdx[lane]; i++ )
+      {
+         tempValue1 = in[i];
+         tempValue2 = tempValue1 - laneValue;
+         laneValue  = tempValue1;
+
+         laneLoss *= (optInTimePeriod-1);
+         laneGain *= (optInTimePeriod-1);
+         if( tempValue2 < 0 )
+            laneLoss -= tempValue2;
+         else
+            laneGain += tempValue2;
+
+         laneLoss /= optInTimePeriod;
+         laneGain /= optInTimePeriod;
+
+         tempValue1 = laneGain+laneLoss;
+         if( !TA_IS_ZERO(tempValue1) )
+            out[laneOutIdx++] = 100.0*(laneGain/tempValue1);
+         else
+            out[laneOutIdx++] = 0.0;
+      }
+      *block->outNBElement[lane] = laneOutIdx;
+   }
+}
+
+static void rsiSerialKernel( TA_PanelBlock *block, int optInTimePeriod, int lookbackTotal )
+{
+   int lane, outBegIdx;
+
+   (void)lookbackTotal;
+
+   for( lane=0; lane < block->nbLane; lane++ )
+   {
+      TA_RSI( 0, block->endIdx[lane], block->in[lane], optInTimePeriod,
+              &outBegIdx, block->outNBElement[lane], block->out[lane] );
+   }
+}
+
+/***************/
+/* End of File */
+/***************/
@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  RM       Robert Meier (talib@meierlim.com http://www.meierlim.com)
+ *  AG       Agent
  *
  * Change history:
  *
@@ -44,6 +45,7 @@
  *  -------------------------------------------------------------------
  *  052603 MF     Adapt code to compile with .NET Managed C++
  *  123004 RM,MF  Adapt code to work with Visual Studio 2005
+ *  101926 AG     Settings are now kept in the default TA_Context.
  *
  */
 
@@ -78,7 +80,7 @@ TA_RetCode TA_SetUnstablePeriod( TA_FuncUnstId id,
          #if defined( _MANAGED )
             Globals->unstablePeriod[(int)i] = unstablePeriod;
          #else
-            TA_Globals->unstablePeriod[i] = unstablePeriod;
+            TA_Globals->defaultContext.unstablePeriod[i] = unstablePeriod;
          #endif
 	  }
    }
@@ -87,7 +89,7 @@ TA_RetCode TA_SetUnstablePeriod( TA_FuncUnstId id,
          #if defined( _MANAGED )
             Globals->unstablePeriod[(int)id] = unstablePeriod;
          #else
-            TA_Globals->unstablePeriod[id] = unstablePeriod;
+            TA_Globals->defaultContext.unstablePeriod[id] = unstablePeriod;
          #endif
    }
 
@@ -106,7 +108,7 @@ unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id )
    #if defined( _MANAGED )
       return Globals->unstablePeriod[(int)id];
    #else
-      return TA_Globals->unstablePeriod[id];
+      return TA_Globals->defaultContext.unstablePeriod[id];
    #endif
 }
 
@@ -116,7 +118,11 @@ unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id )
 TA_RetCode TA_SetCompatibility( TA_Compatibility value )
 #endif
 {
-   TA_GLOBALS_COMPATIBILITY = value;
+   #if defined( _MANAGED )
+      TA_GLOBALS_COMPATIBILITY = value;
+   #else
+      TA_Globals->defaultContext.compatibility = value;
+   #endif
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
@@ -126,7 +132,11 @@ TA_RetCode TA_SetCompatibility( TA_Compatibility value )
 TA_Compatibility TA_GetCompatibility( void )
 #endif
 {
-   return TA_GLOBALS_COMPATIBILITY;
+   #if defined( _MANAGED )
+      return TA_GLOBALS_COMPATIBILITY;
+   #else
+      return TA_Globals->defaultContext.compatibility;
+   #endif
 }
 
 #if defined( _MANAGED )
@@ -42,6 +42,7 @@
  *  CM       Craig Miller  (c-miller@users.sourceforge.net)
  *  RG       Richard Gomes
  *  AB       Anatol Belski (ab@php.net)
+ *  AG       Agent
  *
  * Change history:
  *
@@ -71,6 +72,12 @@
  *  082712 AB    Implemented java code generation on linux.
  *  110724 MF    Removed all TA-Lib Pro specific code.
  *  110824 MF    Removed VS2005 and VS2008 project file generation.
+ *  101926 AG    Generate TA_SortedFuncDef and TA_PerGroupFuncTable.
+ *  101926 AG    Generate the 64 bits index functions ta_func64.h/.c
+ *  101926 AG    Generate the binary description ta_func_meta.bin/.c
+ *  101926 AG    Generate the TA_STATS wrappers ta_func_stats.c
+ *  101926 AG    The wrappers are also used for TA_TRACE.
+ *  101926 AG    The wrappers return the retCode of TA_StatsEnd.
  */
 
 /* Description:
@@ -111,6 +118,7 @@
 #include "ta_common.h"
 #include "ta_abstract.h"
 #include "ta_memory.h"
+#include "ta_meta.h"
 
 #if defined(__WIN32__) || defined(WIN32)
    #define PATH_SEPARATOR "\\"
@@ -255,6 +263,8 @@ typedef struct
 FileHandle *gOutFunc_H = NULL;        /* For "ta_func.h"  */
 FileHandle *gOutFrame_H = NULL;       /* For "ta_frame.h" */
 FileHandle *gOutFrame_C = NULL;       /* For "ta_frame.c" */
+FileHandle *gOutFunc64_H = NULL;      /* For "ta_func64.h" */
+FileHandle *gOutFunc64_C = NULL;      /* For "ta_func64.c" */
 FileHandle *gOutGroupIdx_C = NULL;    /* For "ta_group_idx.c" */
 FileHandle *gOutFunc_C = NULL;        /* For "ta_x.c" where 'x' is TA function name. */
 FileHandle *gOutRetCode_C = NULL;     /* For "ta_retcode.c" */
@@ -327,6 +337,7 @@ static void printFunc(FILE *out,
 );
 
 static void printCallFrame  ( FILE *out, const TA_FuncInfo *funcInfo );
+static void printFunc64     ( FILE *out, const TA_FuncInfo *funcInfo, unsigned int prototype );
 static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature );
 
 static void printExternReferenceForEachFunction( const TA_FuncInfo *info,
@@ -335,6 +346,14 @@ static void printExternReferenceForEachFunction( const TA_FuncInfo *info,
 static void printFunctionAddress( const TA_FuncInfo *info,
                                   void *opaqueData );
 
+static void printFunctionName( const TA_FuncInfo *info,
+                               void *opaqueData );
+
+static void collectFuncName( const TA_FuncInfo *info,
+                             void *opaqueData );
+
+static int compareFuncNameNoCase( const void *a, const void *b );
+
 static void printPerGroupList( const char *groupName,
                                unsigned int index,
                                unsigned int isFirst,
@@ -356,12 +375,47 @@ static void printGroupSizeAddition(  const char *groupName,
                                      unsigned int isFirst,
                                      unsigned int isLast
                                   );
+static void printGroupFuncTable(  const char *groupName,
+                                  unsigned int index,
+                                  unsigned int isFirst,
+                                  unsigned int isLast
+                               );
 
 static int addUnstablePeriodEnum( FILE *out );
 
 static int createTemplate( FileHandle *in, FileHandle *out );
 
 static int generateFuncAPI_C( void );
+/* A lookback expression (see metaSetLookback):
+ * constant + sum(scale[i]*optIn[i]) + unstable*(unstable period)
+ */
+#define META_MAX_OPTINPUT 16
+typedef struct
+{
+   int isValid;
+   int constant;
+   int scale[META_MAX_OPTINPUT];
+   int unstable;
+} MetaExpr;
+
+static int generateFuncMeta( void );
+static int generateFuncStats( void );
+static void printFuncStats( FILE *out, const TA_FuncInfo *funcInfo,
+                            unsigned int funcIdx, unsigned int singlePrecision );
+static unsigned int metaAddString( const char *str );
+static unsigned int metaNbListItem( const TA_OptInputParameterInfo *optInputInfo );
+static void metaSetOptInput( TA_MetaOptInput *metaOptInput,
+                             const TA_OptInputParameterInfo *optInputInfo,
+                             TA_MetaListItem *metaListItem,
+                             unsigned int *nbListItem );
+static void metaSetLookback( TA_MetaFunc *metaFunc,
+                             const TA_FuncHandle *handle,
+                             const TA_FuncInfo *funcInfo );
+static void metaParseExpr  ( MetaExpr *expr );
+static void metaParseTerm  ( MetaExpr *expr );
+static void metaParseFactor( MetaExpr *expr );
+static void metaSkipSpace( void );
+static int writeBinaryFile( const char *fileName, const void *data, size_t size );
 
 #ifdef _MSC_VER
 #endif
@@ -416,6 +470,22 @@ const char *doubleToStr( double value );
 
 const char *gCurrentGroupName;
 
+/* Used to build the sorted (case-insensitive) function table. */
+#define MAX_NB_FUNC_NAME 1024
+const char *gFuncName[MAX_NB_FUNC_NAME];
+unsigned int gNbFuncName;
+
+/* The binary description of the functions (see ta_meta.h). */
+static union
+{
+   unsigned char byte[512*1024];
+   double        align;
+} gMeta;
+static unsigned int gMetaSize;
+static const char *gMetaExprPtr;
+static const char *gMetaOptInName[META_MAX_OPTINPUT];
+static unsigned int gMetaNbOptIn;
+
 static int genCode(int argc, char* argv[]);
 
 extern const TA_OptInputParameterInfo TA_DEF_UI_MA_Method;
@@ -496,6 +566,9 @@ int main(int argc, char* argv[])
          // printf( "     - ta-lib/java/src/com/tictactec/ta/lib/CoreAnnotated.java\n" );
          printf( "     - ta-lib/ta_func_api.xml\n" );
          printf( "     - ta-lib/src/ta_abstract/ta_func_api.c\n" );
+         printf( "     - ta-lib/ta_func_meta.bin\n" );
+         printf( "     - ta-lib/src/ta_abstract/ta_func_meta.c\n" );
+         printf( "     - ta-lib/src/ta_abstract/ta_func_stats.c\n" );
          printf( "     ... and more ...");
          printf( "\n" );
          printf( "  The functions signature, params and validation code\n" );
@@ -775,6 +848,7 @@ static int genCode(int argc, char* argv[])
 {
    TA_RetCode retCode;
    unsigned int nbGroup;
+   unsigned int i;
    FileHandle *tempFile;
 
    FileHandle *tempFileOut;
@@ -855,6 +929,27 @@ static int genCode(int argc, char* argv[])
          return -1;
       }
 
+      /* Create the "ta_func64.h" and "ta_func64.c" */
+      gOutFunc64_H = fileOpen( ta_fs_path(3, "..", "include", "ta_func64.h"),
+                               ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_func64.h.template"),
+                               FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+      if( gOutFunc64_H == NULL )
+      {
+         printf( "\nCannot access [%s]\n", gToOpen );
+         return -1;
+      }
+
+      gOutFunc64_C = fileOpen( ta_fs_path(4, "..", "src", "ta_abstract", "ta_func64.c"),
+                               ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_func64.c.template"),
+                               FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+      if( gOutFunc64_C == NULL )
+      {
+         printf( "\nCannot access [%s]\n", gToOpen );
+         return -1;
+      }
+
       /* Create the "Makefile.am" */
       gOutMakefile_AM = fileOpen( ta_fs_path(4, "..", "src", "ta_func", "Makefile.am"),
                                  ta_fs_path(5, "..", "src", "ta_abstract", "templates", "Makefile.am.template"),
@@ -897,6 +992,8 @@ static int genCode(int argc, char* argv[])
    fileClose( gOutFunc_H );
    fileClose( gOutFrame_H );
    fileClose( gOutFrame_C );
+   fileClose( gOutFunc64_H );
+   fileClose( gOutFunc64_C );
    fileClose( gOutFunc_XML );
    fileClose( gOutMakefile_AM );
 
@@ -929,6 +1026,10 @@ static int genCode(int argc, char* argv[])
 
       nbGroup = forEachGroup( printPerGroupList, NULL );
 
+      print( gOutGroupIdx_C->file, "const TA_StringTable TA_PerGroupFuncTable[%d] = {\n", nbGroup );
+      forEachGroup( printGroupFuncTable, NULL );
+      print( gOutGroupIdx_C->file, "};\n\n" );
+
       print( gOutGroupIdx_C->file, "const TA_FuncDef **TA_PerGroupFuncDef[%d] = {\n", nbGroup );
       forEachGroup( printGroupListAddress, NULL );
       print( gOutGroupIdx_C->file, "};\n\n" );
@@ -940,6 +1041,24 @@ static int genCode(int argc, char* argv[])
       print( gOutGroupIdx_C->file, "const unsigned int TA_TotalNbFunction =\n" );
       forEachGroup( printGroupSizeAddition, NULL );
 
+      /* All functions sorted by name (case-insensitive). Allows
+       * TA_GetFuncHandle to do a binary search.
+       */
+      gNbFuncName = 0;
+      retCode = TA_ForEachFunc( collectFuncName, NULL );
+      if( (retCode != TA_SUCCESS) || (gNbFuncName >= MAX_NB_FUNC_NAME) )
+      {
+         fileClose( gOutGroupIdx_C );
+         return -1;
+      }
+      qsort( (void *)gFuncName, gNbFuncName, sizeof(const char *), compareFuncNameNoCase );
+
+      fprintf( gOutGroupIdx_C->file, "\n\n" );
+      print( gOutGroupIdx_C->file, "const TA_FuncDef *TA_SortedFuncDef[%d] = {\n", gNbFuncName );
+      for( i=0; i < gNbFuncName; i++ )
+         fprintf( gOutGroupIdx_C->file, "&TA_DEF_%s%s\n", gFuncName[i], i == gNbFuncName-1? "" : "," );
+      print( gOutGroupIdx_C->file, "};\n" );
+
       fileClose( gOutGroupIdx_C );
       genPrefix = 0;
 
@@ -951,6 +1070,18 @@ static int genCode(int argc, char* argv[])
       {
          return -1; /*  Failed. */
       }
+
+      /* Binary description, uses the sorted gFuncName. */
+      if( generateFuncMeta() != 1 )
+      {
+         return -1; /*  Failed. */
+      }
+
+      /* Wrappers for TA_STATS/TA_TRACE, uses the sorted gFuncName. */
+      if( generateFuncStats() != 1 )
+      {
+         return -1; /*  Failed. */
+      }
    #endif
 
    // Removed: Java post-processing - not needed for C-only compilation
@@ -1435,6 +1566,11 @@ static void doForEachFunctionPhase2( const TA_FuncInfo *funcInfo,
       fprintf( gOutFrame_H->file, ";\n\n" );
       printCallFrame( gOutFrame_C->file, funcInfo );
 
+      /* Same function with 64 bits indexes (ta_func64.h and ta_func64.c) */
+      genPrefix = 0;
+      printFunc64( gOutFunc64_H->file, funcInfo, 1 );
+      printFunc64( gOutFunc64_C->file, funcInfo, 0 );
+
       /* Add this function to the Makefile.am */
       if( firstTime )
          fprintf( gOutMakefile_AM->file, "\tta_%s.c", funcInfo->name );
@@ -2404,6 +2540,149 @@ static void printCallFrame( FILE *out, const TA_FuncInfo *funcInfo )
 }
 
 
+/* Print the TA_XXX_64 prototype, or its definition calling
+ * TA_CallFunc64 (see ta_func64.c.template).
+ */
+static void printFunc64( FILE *out, const TA_FuncInfo *funcInfo, unsigned int prototype )
+{
+   #define NB_PRICE_FIELD 6
+   static const char *priceName[NB_PRICE_FIELD] =
+      { "inOpen", "inHigh", "inLow", "inClose", "inVolume", "inOpenInterest" };
+   static const char *priceField[NB_PRICE_FIELD] =
+      { "open", "high", "low", "close", "volume", "openInterest" };
+   static const int priceFlag[NB_PRICE_FIELD] =
+      { TA_IN_PRICE_OPEN, TA_IN_PRICE_HIGH, TA_IN_PRICE_LOW,
+        TA_IN_PRICE_CLOSE, TA_IN_PRICE_VOLUME, TA_IN_PRICE_OPENINTEREST };
+   const TA_InputParameterInfo *inputParamInfo;
+   const TA_OptInputParameterInfo *optInputParamInfo;
+   const TA_OutputParameterInfo *outputParamInfo;
+   unsigned int i, j;
+   int indent;
+
+   if( !out ) return;
+
+   if( prototype )
+      fprintf( out, "\nTA_LIB_API TA_RetCode TA_%s_64( ", funcInfo->name );
+   else
+   {
+      fprintf( out, "\nextern const TA_FuncDef TA_DEF_%s;\n\n", funcInfo->name );
+      fprintf( out, "TA_RetCode TA_%s_64( ", funcInfo->name );
+   }
+   indent = (int)strlen(funcInfo->name) + (prototype? 30 : 19);
+
+   fprintf( out, "TA_Integer64  startIdx,\n" );
+   printIndent( out, indent );
+   fprintf( out, "TA_Integer64  endIdx,\n" );
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputParamInfo );
+      if( inputParamInfo->type == TA_Input_Price )
+      {
+         for( j=0; j < NB_PRICE_FIELD; j++ )
+         {
+            if( inputParamInfo->flags & priceFlag[j] )
+            {
+               printIndent( out, indent );
+               fprintf( out, "const double  %s[],\n", priceName[j] );
+            }
+         }
+      }
+      else
+      {
+         printIndent( out, indent );
+         fprintf( out, "const %-7s %s[],\n",
+                  inputParamInfo->type == TA_Input_Integer? "int" : "double",
+                  inputParamInfo->paramName );
+      }
+   }
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputParamInfo );
+      printIndent( out, indent );
+      if( (optInputParamInfo->type == TA_OptInput_RealRange) ||
+          (optInputParamInfo->type == TA_OptInput_RealList) )
+         fprintf( out, "double        %s,\n", optInputParamInfo->paramName );
+      else if( optInputParamInfo->dataSet == TA_DEF_UI_MA_Method.dataSet )
+         fprintf( out, "TA_MAType     %s,\n", optInputParamInfo->paramName );
+      else
+         fprintf( out, "int           %s,\n", optInputParamInfo->paramName );
+   }
+
+   printIndent( out, indent );
+   fprintf( out, "TA_Integer64 *outBegIdx,\n" );
+   printIndent( out, indent );
+   fprintf( out, "TA_Integer64 *outNBElement" );
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputParamInfo );
+      fprintf( out, ",\n" );
+      printIndent( out, indent );
+      fprintf( out, "%-13s %s[]",
+               outputParamInfo->type == TA_Output_Integer? "int" : "double",
+               outputParamInfo->paramName );
+   }
+
+   if( prototype )
+   {
+      fprintf( out, " );\n" );
+      return;
+   }
+
+   fprintf( out, " )\n{\n" );
+   fprintf( out, "   TA_ParamHolderInput    in[%d];\n", funcInfo->nbInput );
+   if( funcInfo->nbOptInput )
+      fprintf( out, "   TA_ParamHolderOptInput optIn[%d];\n", funcInfo->nbOptInput );
+   fprintf( out, "   TA_ParamHolderOutput   out[%d];\n\n", funcInfo->nbOutput );
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputParamInfo );
+      switch( inputParamInfo->type )
+      {
+      case TA_Input_Price:
+         for( j=0; j < NB_PRICE_FIELD; j++ )
+         {
+            fprintf( out, "   in[%d].data.inPrice.%s = %s;\n", i, priceField[j],
+                     (inputParamInfo->flags & priceFlag[j])? priceName[j] : "NULL" );
+         }
+         break;
+      case TA_Input_Integer:
+         fprintf( out, "   in[%d].data.inInteger = %s;\n", i, inputParamInfo->paramName );
+         break;
+      default:
+         fprintf( out, "   in[%d].data.inReal = %s;\n", i, inputParamInfo->paramName );
+         break;
+      }
+   }
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputParamInfo );
+      if( (optInputParamInfo->type == TA_OptInput_RealRange) ||
+          (optInputParamInfo->type == TA_OptInput_RealList) )
+         fprintf( out, "   optIn[%d].data.optInReal = %s;\n", i, optInputParamInfo->paramName );
+      else
+         fprintf( out, "   optIn[%d].data.optInInteger = (TA_Integer)%s;\n", i, optInputParamInfo->paramName );
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputParamInfo );
+      fprintf( out, "   out[%d].data.%s = %s;\n", i,
+               outputParamInfo->type == TA_Output_Integer? "outInteger" : "outReal",
+               outputParamInfo->paramName );
+   }
+
+   fprintf( out, "\n   return callFunc64( &TA_DEF_%s, in, %s, out,\n", funcInfo->name,
+            funcInfo->nbOptInput? "optIn" : "NULL" );
+   fprintf( out, "                      startIdx, endIdx, outBegIdx, outNBElement );\n" );
+   fprintf( out, "}\n" );
+   #undef NB_PRICE_FIELD
+}
+
 static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature )
 {
    if (!out) return;
@@ -2452,6 +2731,11 @@ static void printPerGroupList( const char *groupName,
       fprintf( gOutGroupIdx_C->file,
          "#define SIZE_GROUP_%d ((sizeof(TA_PerGroupFunc_%d)/sizeof(const TA_FuncDef *))-1)\n",
          index, index );
+
+      fprintf( gOutGroupIdx_C->file,
+            "static const char *TA_PerGroupName_%d[] = {\n", index );
+      TA_ForEachFunc( printFunctionName, NULL );
+      fprintf( gOutGroupIdx_C->file, "NULL };\n" );
    #endif
 }
 
@@ -2466,6 +2750,58 @@ static void printFunctionAddress( const TA_FuncInfo *info,
    #endif
 }
 
+static void printFunctionName( const TA_FuncInfo *info,
+                               void *opaqueData )
+{
+   (void)opaqueData; /* Get ride of compiler warning. */
+
+   #if defined(ENABLE_C)
+      if( strcmp( info->group, gCurrentGroupName ) == 0 )
+         fprintf( gOutGroupIdx_C->file, "\"%s\",\n", info->name );
+   #endif
+}
+
+static void collectFuncName( const TA_FuncInfo *info,
+                             void *opaqueData )
+{
+   (void)opaqueData; /* Get ride of compiler warning. */
+
+   if( gNbFuncName < MAX_NB_FUNC_NAME )
+      gFuncName[gNbFuncName] = info->name;
+   gNbFuncName++;
+}
+
+/* Must match the comparison done by TA_GetFuncHandle. */
+static int compareFuncNameNoCase( const void *a, const void *b )
+{
+   const char *s1 = *(const char * const *)a;
+   const char *s2 = *(const char * const *)b;
+   int c1, c2;
+
+   do
+   {
+      c1 = toupper( (unsigned char)*s1++ );
+      c2 = toupper( (unsigned char)*s2++ );
+   } while( c1 && (c1 == c2) );
+
+   return c1 - c2;
+}
+
+static void printGroupFuncTable( const char *groupName,
+                                 unsigned int index,
+                                 unsigned int isFirst,
+                                 unsigned int isLast
+                                )
+{
+   (void)isFirst;   /* Get ride of compiler warning. */
+   (void)groupName; /* Get ride of compiler warning. */
+
+   #if defined(ENABLE_C)
+      fprintf( gOutGroupIdx_C->file, "{ SIZE_GROUP_%d, &TA_PerGroupName_%d[0], NULL }%s\n",
+               index, index, isLast? "" : "," );
+   #endif
+}
+
 static void printGroupListAddress( const char *groupName,
                                    unsigned int index,
                                    unsigned int isFirst,
@@ -2801,6 +3137,12 @@ static void writeFuncFile( const TA_FuncInfo *funcInfo )
    print( out, "   #include \"ta_memory.h\"\n" );
    print( out, "#endif\n" );
    print( out, "\n" );
+   print( out, "#if ( defined( TA_STATS ) || defined( TA_TRACE ) ) && !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )\n" );
+   print( out, "   /* The entry points are measuring wrappers (ta_func_stats.c). */\n" );
+   print( out, "   #define TA_%s   TA_%s_Kernel\n", funcInfo->name, funcInfo->name );
+   print( out, "   #define TA_S_%s TA_S_%s_Kernel\n", funcInfo->name, funcInfo->name );
+   print( out, "#endif\n" );
+   print( out, "\n" );
    print( out, "#define TA_PREFIX(x) TA_##x\n" );
    print( out, "#define INPUT_TYPE   double\n" );
    print( out, "\n" );
@@ -3836,6 +4178,818 @@ static int generateFuncAPI_C()
    return 1;
 }
 
+/* Build the binary description of the functions (see ta_meta.h) in
+ * gMeta, then write it to ta_func_meta.c and ta_func_meta.bin.
+ */
+static int generateFuncMeta( void )
+{
+   #if defined(ENABLE_C)
+      TA_MetaHeader *header;
+      TA_MetaFunc *metaFunc;
+      TA_MetaInput *metaInput;
+      TA_MetaOptInput *metaOptInput;
+      TA_MetaOutput *metaOutput;
+      TA_MetaListItem *metaListItem;
+      unsigned int *metaGroup;
+      TA_StringTable *groupTable;
+      const TA_FuncHandle *handle;
+      const TA_FuncInfo *funcInfo;
+      const TA_InputParameterInfo *inputInfo;
+      const TA_OptInputParameterInfo *optInputInfo;
+      const TA_OutputParameterInfo *outputInfo;
+      unsigned int i, j, nbInput, nbOptInput, nbOutput, nbListItem;
+      FileHandle *outFile;
+
+      #define META_ALIGN(x) (((x)+7) & ~7u)
+
+      if( TA_GroupTableAlloc( &groupTable ) != TA_SUCCESS )
+         return -1;
+
+      /* First pass, only for the size of the tables. */
+      nbInput = nbOptInput = nbOutput = nbListItem = 0;
+      for( i=0; i < gNbFuncName; i++ )
+      {
+         if( (TA_GetFuncHandle( gFuncName[i], &handle ) != TA_SUCCESS) ||
+             (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) )
+         {
+            TA_GroupTableFree( groupTable );
+            return -1;
+         }
+
+         nbInput    += funcInfo->nbInput;
+         nbOptInput += funcInfo->nbOptInput;
+         nbOutput   += funcInfo->nbOutput;
+         for( j=0; j < funcInfo->nbOptInput; j++ )
+         {
+            TA_GetOptInputParameterInfo( handle, j, &optInputInfo );
+            nbListItem += metaNbListItem( optInputInfo );
+         }
+      }
+
+      memset( &gMeta, 0, sizeof(gMeta) );
+      header = (TA_MetaHeader *)gMeta.byte;
+      header->magic      = TA_META_MAGIC;
+      header->version    = TA_META_VERSION;
+      header->nbGroup    = groupTable->size;
+      header->nbFunc     = gNbFuncName;
+      header->nbInput    = nbInput;
+      header->nbOptInput = nbOptInput;
+      header->nbOutput   = nbOutput;
+      header->nbListItem = nbListItem;
+
+      header->groupOffset    = sizeof(TA_MetaHeader);
+      header->funcOffset     = META_ALIGN(header->groupOffset+header->nbGroup*sizeof(unsigned int));
+      header->inputOffset    = header->funcOffset+header->nbFunc*sizeof(TA_MetaFunc);
+      header->optInputOffset = header->inputOffset+nbInput*sizeof(TA_MetaInput);
+      header->outputOffset   = header->optInputOffset+nbOptInput*sizeof(TA_MetaOptInput);
+      header->listItemOffset = header->outputOffset+nbOutput*sizeof(TA_MetaOutput);
+      header->stringOffset   = header->listItemOffset+nbListItem*sizeof(TA_MetaListItem);
+      gMetaSize = header->stringOffset;
+
+      /* Second pass to fill the tables. */
+      metaGroup = (unsigned int *)&gMeta.byte[header->groupOffset];
+      for( i=0; i < groupTable->size; i++ )
+         metaGroup[i] = metaAddString( groupTable->string[i] );
+
+      metaFunc     = (TA_MetaFunc *)&gMeta.byte[header->funcOffset];
+      metaInput    = (TA_MetaInput *)&gMeta.byte[header->inputOffset];
+      metaOptInput = (TA_MetaOptInput *)&gMeta.byte[header->optInputOffset];
+      metaOutput   = (TA_MetaOutput *)&gMeta.byte[header->outputOffset];
+      metaListItem = (TA_MetaListItem *)&gMeta.byte[header->listItemOffset];
+      nbInput = nbOptInput = nbOutput = nbListItem = 0;
+
+      for( i=0; i < gNbFuncName; i++, metaFunc++ )
+      {
+         TA_GetFuncHandle( gFuncName[i], &handle );
+         TA_GetFuncInfo( handle, &funcInfo );
+
+         metaFunc->name          = metaAddString( funcInfo->name );
+         metaFunc->camelCaseName = metaAddString( funcInfo->camelCaseName );
+         metaFunc->hint          = metaAddString( funcInfo->hint );
+         metaFunc->flags         = (unsigned int)funcInfo->flags;
+         for( j=0; j < groupTable->size; j++ )
+         {
+            if( strcmp( funcInfo->group, groupTable->string[j] ) == 0 )
+               metaFunc->group = j;
+         }
+
+         metaFunc->nbInput       = funcInfo->nbInput;
+         metaFunc->nbOptInput    = funcInfo->nbOptInput;
+         metaFunc->nbOutput      = funcInfo->nbOutput;
+         metaFunc->firstInput    = nbInput;
+         metaFunc->firstOptInput = nbOptInput;
+         metaFunc->firstOutput   = nbOutput;
+
+         for( j=0; j < funcInfo->nbInput; j++, nbInput++ )
+         {
+            TA_GetInputParameterInfo( handle, j, &inputInfo );
+            metaInput[nbInput].name  = metaAddString( inputInfo->paramName );
+            metaInput[nbInput].type  = (unsigned int)inputInfo->type;
+            metaInput[nbInput].flags = (unsigned int)inputInfo->flags;
+         }
+
+         for( j=0; j < funcInfo->nbOptInput; j++, nbOptInput++ )
+         {
+            TA_GetOptInputParameterInfo( handle, j, &optInputInfo );
+            metaSetOptInput( &metaOptInput[nbOptInput], optInputInfo,
+                             metaListItem, &nbListItem );
+         }
+
+         for( j=0; j < funcInfo->nbOutput; j++, nbOutput++ )
+         {
+            TA_GetOutputParameterInfo( handle, j, &outputInfo );
+            metaOutput[nbOutput].name  = metaAddString( outputInfo->paramName );
+            metaOutput[nbOutput].type  = (unsigned int)outputInfo->type;
+            metaOutput[nbOutput].flags = (unsigned int)outputInfo->flags;
+         }
+
+         metaSetLookback( metaFunc, handle, funcInfo );
+      }
+
+      TA_GroupTableFree( groupTable );
+
+      /* Keep the size a multiple of 8, the padding also
+       * terminates the last string.
+       */
+      gMetaSize = META_ALIGN(gMetaSize+1);
+      if( gMetaSize > sizeof(gMeta.byte) )
+      {
+         printf( "\nMetadata exceed %lu bytes\n", (unsigned long)sizeof(gMeta.byte) );
+         return -1;
+      }
+      header->size = gMetaSize;
+
+      /* The blob embedded in the library. */
+      outFile = fileOpen( ta_fs_path(4, "..", "src", "ta_abstract", "ta_func_meta.c"),
+                          ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_func_meta.c.template"),
+                          FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+      if( outFile == NULL )
+      {
+         printf( "\nCannot write to [%s]\n", gToOpen );
+         return -1;
+      }
+
+      fprintf( outFile->file, "static const union\n{\n" );
+      fprintf( outFile->file, "   unsigned char byte[%u];\n", gMetaSize );
+      fprintf( outFile->file, "   double        align;\n" );
+      fprintf( outFile->file, "} TA_FuncMetaArray =\n{\n{\n" );
+      for( i=0; i < gMetaSize; i++ )
+      {
+         fprintf( outFile->file, "%s0x%02X", i == 0? "" : ",", gMeta.byte[i] );
+         if( ((i+1) % 20) == 0 )
+            fprintf( outFile->file, "\n" );
+      }
+      fprintf( outFile->file, "\n}\n};\n" );
+      fileClose( outFile );
+
+      /* Same blob, for the wrappers mapping it in memory. */
+      if( writeBinaryFile( ta_fs_path(2, "..", "ta_func_meta.bin"), gMeta.byte, gMetaSize ) != 1 )
+      {
+         printf( "\nCannot write ta_func_meta.bin\n" );
+         return -1;
+      }
+
+      #undef META_ALIGN
+   #endif
+
+   return 1;
+}
+
+/* Write ta_func_stats.c: when TA_STATS or TA_TRACE is defined, the
+ * TA_XXX and TA_S_XXX functions are wrappers measuring and tracing the
+ * calls of the renamed kernels (see writeFuncFile). The index of a function is its
+ * position in TA_SortedFuncDef.
+ */
+static int generateFuncStats( void )
+{
+   #if defined(ENABLE_C)
+      const TA_FuncHandle *handle;
+      const TA_FuncInfo *funcInfo;
+      FileHandle *outFile;
+      unsigned int i;
+
+      outFile = fileOpen( ta_fs_path(4, "..", "src", "ta_abstract", "ta_func_stats.c"),
+                          ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_func_stats.c.template"),
+                          FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+      if( outFile == NULL )
+      {
+         printf( "\nCannot write to [%s]\n", gToOpen );
+         return -1;
+      }
+
+      for( i=0; i < gNbFuncName; i++ )
+      {
+         if( (TA_GetFuncHandle( gFuncName[i], &handle ) != TA_SUCCESS) ||
+             (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) )
+         {
+            fileClose( outFile );
+            return -1;
+         }
+
+         printFuncStats( outFile->file, funcInfo, i, 0 );
+         printFuncStats( outFile->file, funcInfo, i, 1 );
+      }
+
+      fileClose( outFile );
+   #endif
+
+   return 1;
+}
+
+/* Print the renamed kernel prototype and the wrapper of TA_XXX
+ * (or TA_S_XXX when singlePrecision).
+ */
+static void printFuncStats( FILE *out, const TA_FuncInfo *funcInfo,
+                            unsigned int funcIdx, unsigned int singlePrecision )
+{
+   #define NB_PRICE_FIELD 6
+   static const char *priceName[NB_PRICE_FIELD] =
+      { "inOpen", "inHigh", "inLow", "inClose", "inVolume", "inOpenInterest" };
+   static const int priceFlag[NB_PRICE_FIELD] =
+      { TA_IN_PRICE_OPEN, TA_IN_PRICE_HIGH, TA_IN_PRICE_LOW,
+        TA_IN_PRICE_CLOSE, TA_IN_PRICE_VOLUME, TA_IN_PRICE_OPENINTEREST };
+   const TA_InputParameterInfo *inputParamInfo;
+   const TA_OptInputParameterInfo *optInputParamInfo;
+   const TA_OutputParameterInfo *outputParamInfo;
+   const char *prefix, *inputType;
+   unsigned int i, j, pass;
+   int indent;
+
+   if( !out ) return;
+
+   prefix = singlePrecision? "TA_S_" : "TA_";
+   inputType = singlePrecision? "const float  " : "const double ";
+
+   /* First pass for the kernel prototype, second for the wrapper. */
+   for( pass=0; pass < 2; pass++ )
+   {
+      if( pass == 0 )
+      {
+         fprintf( out, "\nTA_LIB_API TA_RetCode %s%s_Kernel( ", prefix, funcInfo->name );
+         indent = (int)(strlen(prefix) + strlen(funcInfo->name)) + 30;
+      }
+      else
+      {
+         fprintf( out, "\nTA_LIB_API TA_RetCode %s%s( ", prefix, funcInfo->name );
+         indent = (int)(strlen(prefix) + strlen(funcInfo->name)) + 23;
+      }
+
+      fprintf( out, "int           startIdx,\n" );
+      printIndent( out, indent );
+      fprintf( out, "int           endIdx,\n" );
+
+      for( i=0; i < funcInfo->nbInput; i++ )
+      {
+         TA_GetInputParameterInfo( funcInfo->handle, i, &inputParamInfo );
+         if( inputParamInfo->type == TA_Input_Price )
+         {
+            for( j=0; j < NB_PRICE_FIELD; j++ )
+            {
+               if( inputParamInfo->flags & priceFlag[j] )
+               {
+                  printIndent( out, indent );
+                  fprintf( out, "%s %s[],\n", inputType, priceName[j] );
+               }
+            }
+         }
+         else
+         {
+            printIndent( out, indent );
+            fprintf( out, "%s %s[],\n",
+                     inputParamInfo->type == TA_Input_Integer? "const int    " : inputType,
+                     inputParamInfo->paramName );
+         }
+      }
+
+      for( i=0; i < funcInfo->nbOptInput; i++ )
+      {
+         TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputParamInfo );
+         printIndent( out, indent );
+         if( (optInputParamInfo->type == TA_OptInput_RealRange) ||
+             (optInputParamInfo->type == TA_OptInput_RealList) )
+            fprintf( out, "double        %s,\n", optInputParamInfo->paramName );
+         else if( optInputParamInfo->dataSet == TA_DEF_UI_MA_Method.dataSet )
+            fprintf( out, "TA_MAType     %s,\n", optInputParamInfo->paramName );
+         else
+            fprintf( out, "int           %s,\n", optInputParamInfo->paramName );
+      }
+
+      printIndent( out, indent );
+      fprintf( out, "int          *outBegIdx,\n" );
+      printIndent( out, indent );
+      fprintf( out, "int          *outNBElement" );
+
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, i, &outputParamInfo );
+         fprintf( out, ",\n" );
+         printIndent( out, indent );
+         fprintf( out, "%-13s %s[]",
+                  outputParamInfo->type == TA_Output_Integer? "int" : "double",
+                  outputParamInfo->paramName );
+      }
+
+      fprintf( out, pass == 0? " );\n" : " )\n" );
+   }
+
+   fprintf( out, "{\n" );
+   fprintf( out, "   TA_StatsCall call;\n" );
+   fprintf( out, "   TA_RetCode retCode;\n\n" );
+   fprintf( out, "   TA_StatsBegin( &call, %u, startIdx, endIdx );\n", funcIdx );
+   fprintf( out, "   retCode = %s%s_Kernel( startIdx, endIdx", prefix, funcInfo->name );
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputParamInfo );
+      if( inputParamInfo->type == TA_Input_Price )
+      {
+         for( j=0; j < NB_PRICE_FIELD; j++ )
+         {
+            if( inputParamInfo->flags & priceFlag[j] )
+               fprintf( out, ", %s", priceName[j] );
+         }
+      }
+      else
+         fprintf( out, ", %s", inputParamInfo->paramName );
+   }
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputParamInfo );
+      fprintf( out, ", %s", optInputParamInfo->paramName );
+   }
+
+   fprintf( out, ", outBegIdx, outNBElement" );
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputParamInfo );
+      fprintf( out, ", %s", outputParamInfo->paramName );
+   }
+
+   fprintf( out, " );\n" );
+   fprintf( out, "   retCode = TA_StatsEnd( &call, retCode, outNBElement );\n\n" );
+   fprintf( out, "   return retCode;\n" );
+   fprintf( out, "}\n" );
+   #undef NB_PRICE_FIELD
+}
+
+/* Offset of the string in gMeta, added when not already there. */
+static unsigned int metaAddString( const char *str )
+{
+   const TA_MetaHeader *header;
+   unsigned int offset, length;
+
+   header = (const TA_MetaHeader *)gMeta.byte;
+   if( !str )
+      str = "";
+
+   offset = header->stringOffset;
+   while( offset < gMetaSize )
+   {
+      if( strcmp( (const char *)&gMeta.byte[offset], str ) == 0 )
+         return offset;
+      offset += (unsigned int)strlen( (const char *)&gMeta.byte[offset] )+1;
+   }
+
+   length = (unsigned int)strlen( str )+1;
+   if( gMetaSize+length >= sizeof(gMeta.byte) )
+   {
+      /* Detected by generateFuncMeta. */
+      gMetaSize = sizeof(gMeta.byte);
+      return header->stringOffset;
+   }
+
+   offset = gMetaSize;
+   memcpy( &gMeta.byte[offset], str, length );
+   gMetaSize += length;
+
+   return offset;
+}
+
+static unsigned int metaNbListItem( const TA_OptInputParameterInfo *optInputInfo )
+{
+   switch( optInputInfo->type )
+   {
+   case TA_OptInput_IntegerList:
+      return ((const TA_IntegerList *)optInputInfo->dataSet)->nbElement;
+   case TA_OptInput_RealList:
+      return ((const TA_RealList *)optInputInfo->dataSet)->nbElement;
+   default:
+      return 0;
+   }
+}
+
+static void metaSetOptInput( TA_MetaOptInput *metaOptInput,
+                             const TA_OptInputParameterInfo *optInputInfo,
+                             TA_MetaListItem *metaListItem,
+                             unsigned int *nbListItem )
+{
+   const TA_IntegerRange *integerRange;
+   const TA_RealRange *realRange;
+   const TA_IntegerList *integerList;
+   const TA_RealList *realList;
+   TA_MetaListItem *item;
+   unsigned int i;
+
+   metaOptInput->name          = metaAddString( optInputInfo->paramName );
+   metaOptInput->displayName   = metaAddString( optInputInfo->displayName );
+   metaOptInput->hint          = metaAddString( optInputInfo->hint );
+   metaOptInput->type          = (unsigned int)optInputInfo->type;
+   metaOptInput->flags         = (unsigned int)optInputInfo->flags;
+   metaOptInput->defaultValue  = optInputInfo->defaultValue;
+   metaOptInput->nbListItem    = metaNbListItem( optInputInfo );
+   metaOptInput->firstListItem = *nbListItem;
+
+   switch( optInputInfo->type )
+   {
+   case TA_OptInput_RealRange:
+      realRange = (const TA_RealRange *)optInputInfo->dataSet;
+      metaOptInput->min                = realRange->min;
+      metaOptInput->max                = realRange->max;
+      metaOptInput->precision          = realRange->precision;
+      metaOptInput->suggestedStart     = realRange->suggested_start;
+      metaOptInput->suggestedEnd       = realRange->suggested_end;
+      metaOptInput->suggestedIncrement = realRange->suggested_increment;
+      break;
+   case TA_OptInput_IntegerRange:
+      integerRange = (const TA_IntegerRange *)optInputInfo->dataSet;
+      metaOptInput->min                = integerRange->min;
+      metaOptInput->max                = integerRange->max;
+      metaOptInput->suggestedStart     = integerRange->suggested_start;
+      metaOptInput->suggestedEnd       = integerRange->suggested_end;
+      metaOptInput->suggestedIncrement = integerRange->suggested_increment;
+      break;
+   case TA_OptInput_IntegerList:
+      integerList = (const TA_IntegerList *)optInputInfo->dataSet;
+      for( i=0; i < integerList->nbElement; i++ )
+      {
+         item = &metaListItem[(*nbListItem)++];
+         item->value  = integerList->data[i].value;
+         item->string = metaAddString( integerList->data[i].string );
+         if( (i == 0) || (item->value < metaOptInput->min) )
+            metaOptInput->min = item->value;
+         if( (i == 0) || (item->value > metaOptInput->max) )
+            metaOptInput->max = item->value;
+      }
+      break;
+   case TA_OptInput_RealList:
+      realList = (const TA_RealList *)optInputInfo->dataSet;
+      for( i=0; i < realList->nbElement; i++ )
+      {
+         item = &metaListItem[(*nbListItem)++];
+         item->value  = realList->data[i].value;
+         item->string = metaAddString( realList->data[i].string );
+         if( (i == 0) || (item->value < metaOptInput->min) )
+            metaOptInput->min = item->value;
+         if( (i == 0) || (item->value > metaOptInput->max) )
+            metaOptInput->max = item->value;
+      }
+      break;
+   }
+}
+
+/* Find how the lookback can be calculated from the source of the
+ * TA_XXX_Lookback function. Only a lookback code made of a single
+ * "return <expression>;" is considered, the expression being a
+ * linear combination of integer constants, at most one optional
+ * input and TA_GLOBALS_UNSTABLE_PERIOD. Anything else is
+ * TA_META_LOOKBACK_OTHER.
+ *
+ * ta_regtest verifies the result with TA_GetLookback.
+ */
+static void metaSetLookback( TA_MetaFunc *metaFunc,
+                             const TA_FuncHandle *handle,
+                             const TA_FuncInfo *funcInfo )
+{
+   const TA_OptInputParameterInfo *optInputInfo;
+   static char code[BUFFER_SIZE];
+   char fileName[BUFFER_SIZE];
+   char *ptr, *end;
+   FILE *in;
+   int inLookback, inComment;
+   unsigned int i, length, nbScale;
+   MetaExpr expr;
+
+   metaFunc->lookbackId     = TA_META_LOOKBACK_OTHER;
+   metaFunc->lookbackOptIn  = 0;
+   metaFunc->lookbackScale  = 0;
+   metaFunc->lookbackOffset = 0;
+
+   if( funcInfo->nbOptInput > META_MAX_OPTINPUT )
+      return;
+
+   sprintf( fileName, ".." PATH_SEPARATOR "src" PATH_SEPARATOR "ta_func" PATH_SEPARATOR "ta_%s.c", funcInfo->name );
+   in = fopen( fileName, "r" );
+   if( !in )
+      return;
+
+   /* Keep the code following the "insert lookback code here"
+    * marker up to the end of the function, without the comments.
+    */
+   length = 0;
+   inLookback = 0;
+   inComment = 0;
+   while( fgets( gTempBuf, BUFFER_SIZE, in ) )
+   {
+      if( !inLookback )
+      {
+         inLookback = strstr( gTempBuf, "insert lookback code here" ) != NULL;
+         continue;
+      }
+
+      if( gTempBuf[0] == '}' )
+         break;
+
+      for( ptr=gTempBuf; *ptr && (length < sizeof(code)-2); ptr++ )
+      {
+         if( inComment )
+         {
+            if( (ptr[0] == '*') && (ptr[1] == '/') )
+            {
+               inComment = 0;
+               ptr++;
+            }
+         }
+         else if( (ptr[0] == '/') && (ptr[1] == '*') )
+         {
+            inComment = 1;
+            ptr++;
+         }
+         else
+            code[length++] = isspace((unsigned char)*ptr)? ' ' : *ptr;
+      }
+   }
+   code[length] = '\0';
+   fclose( in );
+
+   /* UNUSED_VARIABLE(x); has no effect on the lookback. */
+   while( (ptr = strstr( code, "UNUSED_VARIABLE" )) != NULL )
+   {
+      end = strchr( ptr, ';' );
+      if( !end )
+         return;
+      memmove( ptr, end+1, strlen(end+1)+1 );
+   }
+
+   ptr = trimWhitespace( code );
+   length = (unsigned int)strlen( ptr );
+   if( (strncmp( ptr, "return", 6 ) != 0) ||
+       isalnum((unsigned char)ptr[6]) || (ptr[6] == '_') ||
+       (length == 0) || (strchr( ptr, ';' ) != &ptr[length-1]) )
+      return;
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( handle, i, &optInputInfo );
+      gMetaOptInName[i] = optInputInfo->paramName;
+   }
+   gMetaNbOptIn = funcInfo->nbOptInput;
+
+   gMetaExprPtr = &ptr[6];
+   metaParseExpr( &expr );
+   metaSkipSpace();
+   if( !expr.isValid || (*gMetaExprPtr != ';') )
+      return;
+
+   /* The unstable period must be the one of the function. */
+   if( expr.unstable != ((funcInfo->flags&TA_FUNC_FLG_UNST_PER)? 1 : 0) )
+      return;
+
+   nbScale = 0;
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      if( expr.scale[i] != 0 )
+      {
+         TA_GetOptInputParameterInfo( handle, i, &optInputInfo );
+         if( optInputInfo->type != TA_OptInput_IntegerRange )
+            return;
+         metaFunc->lookbackOptIn = i;
+         metaFunc->lookbackScale = expr.scale[i];
+         nbScale++;
+      }
+   }
+
+   if( nbScale > 1 )
+   {
+      metaFunc->lookbackOptIn = 0;
+      metaFunc->lookbackScale = 0;
+      return;
+   }
+
+   metaFunc->lookbackId     = nbScale? TA_META_LOOKBACK_LINEAR : TA_META_LOOKBACK_CONST;
+   metaFunc->lookbackOffset = expr.constant;
+}
+
+static void metaSkipSpace( void )
+{
+   while( isspace((unsigned char)*gMetaExprPtr) )
+      gMetaExprPtr++;
+}
+
+/* expression := term { ('+'|'-') term } */
+static void metaParseExpr( MetaExpr *expr )
+{
+   MetaExpr term;
+   unsigned int i;
+   int sign;
+
+   metaParseTerm( expr );
+   while( expr->isValid )
+   {
+      metaSkipSpace();
+      if( (*gMetaExprPtr != '+') && (*gMetaExprPtr != '-') )
+         break;
+
+      sign = *gMetaExprPtr++ == '+'? 1 : -1;
+      metaParseTerm( &term );
+      expr->isValid   = term.isValid;
+      expr->constant += sign*term.constant;
+      expr->unstable += sign*term.unstable;
+      for( i=0; i < META_MAX_OPTINPUT; i++ )
+         expr->scale[i] += sign*term.scale[i];
+   }
+}
+
+/* term := factor { '*' factor }, one of the factors being a constant. */
+static void metaParseTerm( MetaExpr *expr )
+{
+   MetaExpr factor, *constant, *other;
+   unsigned int i, isConstant;
+
+   metaParseFactor( expr );
+   while( expr->isValid )
+   {
+      metaSkipSpace();
+      if( *gMetaExprPtr != '*' )
+         break;
+
+      gMetaExprPtr++;
+      metaParseFactor( &factor );
+      if( !factor.isValid )
+      {
+         expr->isValid = 0;
+         break;
+      }
+
+      isConstant = (factor.unstable == 0);
+      for( i=0; i < META_MAX_OPTINPUT; i++ )
+         isConstant = isConstant && (factor.scale[i] == 0);
+
+      constant = isConstant? &factor : expr;
+      other    = isConstant? expr : &factor;
+
+      isConstant = (constant->unstable == 0);
+      for( i=0; i < META_MAX_OPTINPUT; i++ )
+         isConstant = isConstant && (constant->scale[i] == 0);
+      if( !isConstant )
+      {
+         expr->isValid = 0;
+         break;
+      }
+
+      other->constant *= constant->constant;
+      other->unstable *= constant->constant;
+      for( i=0; i < META_MAX_OPTINPUT; i++ )
+         other->scale[i] *= constant->constant;
+      if( other != expr )
+         *expr = *other;
+   }
+}
+
+/* factor := number | optional input | TA_GLOBALS_UNSTABLE_PERIOD(...)
+ *           | '(' expression ')' | '(int)' factor | '-' factor
+ */
+static void metaParseFactor( MetaExpr *expr )
+{
+   const char *start;
+   unsigned int i, length, depth;
+
+   memset( expr, 0, sizeof(MetaExpr) );
+   metaSkipSpace();
+
+   if( *gMetaExprPtr == '-' )
+   {
+      gMetaExprPtr++;
+      metaParseFactor( expr );
+      expr->constant = -expr->constant;
+      expr->unstable = -expr->unstable;
+      for( i=0; i < META_MAX_OPTINPUT; i++ )
+         expr->scale[i] = -expr->scale[i];
+      return;
+   }
+
+   if( *gMetaExprPtr == '(' )
+   {
+      gMetaExprPtr++;
+      metaSkipSpace();
+      if( strncmp( gMetaExprPtr, "int", 3 ) == 0 )
+      {
+         start = gMetaExprPtr;
+         gMetaExprPtr += 3;
+         metaSkipSpace();
+         if( *gMetaExprPtr == ')' )
+         {
+            gMetaExprPtr++;
+            metaParseFactor( expr );
+            return;
+         }
+         gMetaExprPtr = start;
+      }
+
+      metaParseExpr( expr );
+      metaSkipSpace();
+      if( *gMetaExprPtr != ')' )
+         expr->isValid = 0;
+      else
+         gMetaExprPtr++;
+      return;
+   }
+
+   if( isdigit((unsigned char)*gMetaExprPtr) )
+   {
+      expr->constant = (int)strtol( gMetaExprPtr, (char **)&gMetaExprPtr, 10 );
+      expr->isValid  = !isalnum((unsigned char)*gMetaExprPtr) && (*gMetaExprPtr != '.');
+      return;
+   }
+
+   start = gMetaExprPtr;
+   while( isalnum((unsigned char)*gMetaExprPtr) || (*gMetaExprPtr == '_') )
+      gMetaExprPtr++;
+   length = (unsigned int)(gMetaExprPtr-start);
+   if( length == 0 )
+      return;
+
+   for( i=0; i < gMetaNbOptIn; i++ )
+   {
+      if( (strlen( gMetaOptInName[i] ) == length) &&
+          (strncmp( gMetaOptInName[i], start, length ) == 0) )
+      {
+         expr->scale[i] = 1;
+         expr->isValid  = 1;
+         return;
+      }
+   }
+
+   if( (length == strlen("TA_GLOBALS_UNSTABLE_PERIOD")) &&
+       (strncmp( start, "TA_GLOBALS_UNSTABLE_PERIOD", length ) == 0) )
+   {
+      metaSkipSpace();
+      if( *gMetaExprPtr != '(' )
+         return;
+
+      depth = 0;
+      do
+      {
+         if( *gMetaExprPtr == '(' )
+            depth++;
+         else if( *gMetaExprPtr == ')' )
+            depth--;
+         gMetaExprPtr++;
+      } while( depth && *gMetaExprPtr );
+
+      expr->unstable = 1;
+      expr->isValid  = (depth == 0);
+   }
+}
+
+/* Write a binary file, only when its content changes. */
+static int writeBinaryFile( const char *fileName, const void *data, size_t size )
+{
+   FILE *file;
+   char *current;
+   size_t currentSize;
+   int same;
+
+   init_gToOpen( fileName, NULL );
+
+   same = 0;
+   file = fopen( gToOpen, "rb" );
+   if( file )
+   {
+      current = (char *)malloc( size+1 );
+      if( current )
+      {
+         currentSize = fread( current, 1, size+1, file );
+         same = (currentSize == size) && (memcmp( current, data, size ) == 0);
+         free( current );
+      }
+      fclose( file );
+   }
+
+   if( same )
+      return 1;
+
+   file = fopen( gToOpen, "wb" );
+   if( !file )
+      return 0;
+
+   same = fwrite( data, 1, size, file ) == size;
+   fclose( file );
+
+   return same? 1 : 0;
+}
+
 static void convertFileToCArray( FILE *in, FILE *out )
 {
     int c;
@@ -0,0 +1,1856 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *  101926 AG   Add comparison with a baseline (-baseline).
+ *  101926 AG   Add the period sweep (-period) and the descending series.
+ *  101926 AG   Series from ta_datagen, add the gbm, jump_diffusion and
+ *              regime_switching series and the mapped files (-m).
+ *  101926 AG   Add the hardware counters (-hw).
+ *  101926 AG   Add the tail latency of the small range calls (-latency).
+ */
+
+/* Description:
+ *    Benchmark of all the TA functions.
+ *
+ *    Each function is called through the abstract interface, with its
+ *    default optional inputs, on synthetic series of many sizes and
+ *    shapes (trending, mean-reverting, random walk and constant by
+ *    default). The series come from ta_datagen, the same with -m except
+ *    that they are generated once in a file mapped in memory, which
+ *    saves the generation of the largest sizes from one run to the other.
+ *
+ *    Every measurement is preceded by a warmup call, and is repeated
+ *    many times. The median is reported as nanoseconds per bar, along
+ *    with the bytes per bar read from the inputs and written to the
+ *    outputs. The results are written as CSV and/or JSON, so they can
+ *    be compared from one version to the other.
+ *
+ *    With -baseline, the results are compared with a JSON file from
+ *    a previous run. The ratio of the medians (current/baseline) is
+ *    estimated with a bootstrap confidence interval over the
+ *    repetitions of both runs, so noisy functions need more evidence
+ *    before being reported. A function regressed when the whole
+ *    interval is above 1+threshold. The regressions are listed from
+ *    the worst to the least, and the exit code is then 2.
+ *
+ *    With -period, the cost is measured as a function of the period
+ *    instead: every integer "...Period" optional input is swept from 2
+ *    to 10000 (within its range), the others keeping their defaults.
+ *    The exponent of the per-bar cost is fitted (log-log least squares)
+ *    and the functions with a cost growing with the period are flagged.
+ *    By default, the sweep uses a random walk and a descending series
+ *    (the worst case of the MAX/MIN like functions).
+ *
+ *    With -hw, the Linux perf_event counters (cycles, instructions,
+ *    L1 data and last level cache misses, branch misses) are read around
+ *    the repetitions of each measurement. The IPC and the counts per bar
+ *    are added to the results, which tells apart the functions limited by
+ *    the memory bandwidth from those limited by a dependency chain. A
+ *    counter that cannot be opened (other platform, perf_event_paranoid,
+ *    virtual machine) is left empty, the measurement goes on without it.
+ *
+ *    With -latency, every function is called many times on the last
+ *    1 to 5 bars of a single size (default 10000 bars), as done on live
+ *    data. Each call is timed alone (minus the cost of reading the
+ *    clock), and the p50, p99 and p99.9 latencies are reported for two
+ *    paths: "direct" calls the generated frame of the function, which
+ *    only unpacks the parameters for the TA_XXX function of ta_func.h,
+ *    and "abstract" calls TA_CallFunc. The fixed costs (validation,
+ *    lookback, unstable periods, temporary buffers) are then visible,
+ *    and the difference between the two paths is the cost of the
+ *    abstract interface.
+ *
+ *    ta_bench is not part of ta_regtest: measurements are meaningful
+ *    only with a release build on an otherwise idle machine.
+ */
+
+/**** Headers ****/
+#if !defined(WIN32) && !defined(_POSIX_C_SOURCE)
+   #define _POSIX_C_SOURCE 199309L
+#endif
+
+/* For syscall() (perf_event_open has no wrapper). */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+   #define _DEFAULT_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef WIN32
+   #include <windows.h>
+#else
+   #include <time.h>
+#endif
+
+#ifdef __linux__
+   #include <unistd.h>
+   #include <sys/ioctl.h>
+   #include <sys/syscall.h>
+   #include <linux/perf_event.h>
+#endif
+
+#include "ta_libc.h"
+#include "ta_def_ui.h"
+#include "ta_datagen.h"
+
+/**** Local declarations.              ****/
+#define BENCH_MAX_SIZE      32
+#define BENCH_DEFAULT_REPS  7
+#define BENCH_MAX_REPS      101
+
+/* Each sample lasts at least that long (the function is called
+ * many times in a loop when it is faster than that).
+ */
+#define BENCH_MIN_SAMPLE_NS 1000000.0
+
+/* Comparison with a baseline. */
+#define BENCH_DEFAULT_THRESHOLD 0.10
+#define BENCH_NB_BOOTSTRAP      2000
+#define BENCH_CONFIDENCE        0.95
+#define BENCH_MAX_NAME          32
+
+/* Period sweep (-period). A function is super-constant in period
+ * when the fitted exponent and the cost ratio between the largest
+ * and smallest period both exceed these limits.
+ */
+#define BENCH_PERIOD_BARS       100000
+#define BENCH_MAX_PERIOD_POINT  16
+#define BENCH_FLAG_EXPONENT     0.1
+#define BENCH_FLAG_RATIO        1.5
+
+/* Tail latency (-latency). The calls are on the last
+ * 1 to BENCH_LATENCY_WINDOW bars.
+ */
+#define BENCH_LATENCY_BARS      10000
+#define BENCH_LATENCY_CALLS     20000
+#define BENCH_LATENCY_WARMUP    1000
+#define BENCH_LATENCY_WINDOW    5
+
+typedef enum
+{
+   SERIES_TRENDING,
+   SERIES_MEAN_REVERTING,
+   SERIES_RANDOM_WALK,
+   SERIES_CONSTANT,
+   SERIES_DESCENDING,
+   SERIES_GBM,
+   SERIES_JUMP_DIFFUSION,
+   SERIES_REGIME_SWITCHING,
+   SERIES_NB
+} SeriesKind; /* Same order as TA_DataGenModel. */
+
+#define SERIES_MASK(kind) (1u << (kind))
+
+/* Hardware counters (-hw). */
+typedef enum
+{
+   COUNTER_CYCLES,
+   COUNTER_INSTRUCTIONS,
+   COUNTER_L1D_MISSES,
+   COUNTER_LLC_MISSES,
+   COUNTER_BRANCH_MISSES,
+   COUNTER_NB
+} CounterKind;
+
+typedef struct
+{
+   TA_Real *open;
+   TA_Real *high;
+   TA_Real *low;
+   TA_Real *close;
+   TA_Real *volume;
+   TA_Integer nbBar;
+} Series;
+
+typedef struct
+{
+   double nsPerBar;     /* Median. */
+   double nsPerBarMin;
+   double nsPerBarMax;
+   double bytesPerBar;
+   unsigned int nbLoop; /* Calls per sample. */
+   TA_Integer lookback;
+   unsigned int nbSample;
+   double sample[BENCH_MAX_REPS];
+   double counter[COUNTER_NB]; /* Per bar, negative when not counted. */
+} Measure;
+
+typedef struct
+{
+   char funcName[BENCH_MAX_NAME];
+   char seriesName[BENCH_MAX_NAME];
+   TA_Integer nbBar;
+   Measure measure;
+} Result;
+
+typedef struct
+{
+   const Result *current;
+   const Result *baseline;
+   double ratio;  /* Of the medians, current/baseline. */
+   double low;    /* Confidence interval of the ratio. */
+   double high;
+} Comparison;
+
+typedef struct
+{
+   /* Options. */
+   TA_Integer size[BENCH_MAX_SIZE];
+   unsigned int nbSize;
+   unsigned int nbRep;
+   const char *funcName;
+   double threshold;
+   unsigned int seriesMask;
+   int periodSweep;
+   const char *dataDir;
+   int hwCounters;
+   int latency;
+   double clockOverhead; /* Nanoseconds, subtracted from each call (-latency). */
+   double *latencySample;
+
+   /* Hardware counters, -1 when not opened. */
+   int counterFd[COUNTER_NB];
+
+   /* Current series. */
+   const Series *series;
+   SeriesKind kind;
+
+   /* Results. */
+   FILE *csvFile;
+   FILE *jsonFile;
+   Result *result;
+   unsigned int nbResult;
+   unsigned int maxResult;
+   int failed;
+
+   /* Baseline (-baseline). */
+   Result *baseline;
+   unsigned int nbBaseline;
+
+   /* Functions flagged by the period sweep (-period). */
+   FILE *reportFile;
+   unsigned int nbSwept;
+   unsigned int nbFlagged;
+} Bench;
+
+typedef enum
+{
+   LATENCY_DIRECT,
+   LATENCY_ABSTRACT,
+   LATENCY_NB
+} LatencyPath;
+
+typedef struct
+{
+   double p50;  /* Nanoseconds per call. */
+   double p99;
+   double p999;
+   double max;
+} Latency;
+
+typedef struct
+{
+   unsigned int nbPoint;
+   TA_Integer period[BENCH_MAX_PERIOD_POINT];
+   Measure measure[BENCH_MAX_PERIOD_POINT];
+   double exponent;
+   double ratio;
+   int superConstant;
+} Sweep;
+
+/**** Local functions declarations.    ****/
+static void printUsage( void );
+static int parseSizeList( Bench *bench, const char *str );
+static int parseSeriesList( Bench *bench, const char *str );
+static int allocSeries( Series *series, TA_Integer nbBar );
+static void freeSeries( Series *series );
+static void generateSeries( Series *series, SeriesKind kind, TA_Integer nbBar );
+static int mapSeries( const char *dataDir, SeriesKind kind, TA_Integer nbBar,
+                      Series *series, TA_DataGenSeries *mapped );
+static double randomUniform( void );
+static double clockNs( void );
+static void benchFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static TA_RetCode measureFunc( const Bench *bench,
+                               const TA_FuncInfo *funcInfo,
+                               int optInIndex,
+                               TA_Integer optInValue,
+                               Measure *measure );
+static TA_RetCode setupParams( const Series *series,
+                               const TA_FuncInfo *funcInfo,
+                               TA_ParamHolder *params,
+                               double *bytesPerBar );
+static double timeCalls( const TA_ParamHolder *params,
+                         TA_Integer nbBar,
+                         unsigned int nbLoop,
+                         TA_RetCode *retCode );
+static int compareDouble( const void *a, const void *b );
+static void writeResult( Bench *bench,
+                         const TA_FuncInfo *funcInfo,
+                         const Measure *measure );
+static int loadBaseline( Bench *bench, const char *fileName );
+static const char *findKey( const char *object, const char *end, const char *key );
+static int readString( const char *value, char *str, size_t size );
+static const Result *findBaseline( const Bench *bench, const Result *current );
+static void bootstrapRatio( const Measure *current,
+                            const Measure *baseline,
+                            Comparison *comparison );
+static double resampleMedian( const Measure *measure, double *buffer );
+static double median( double *value, unsigned int nbValue );
+static int compareRegression( const void *a, const void *b );
+static int compareBaseline( const Bench *bench );
+static void sweepFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static void fitSweep( Sweep *sweep );
+static void writeSweep( Bench *bench,
+                        const TA_FuncInfo *funcInfo,
+                        const TA_OptInputParameterInfo *optInfo,
+                        const Sweep *sweep );
+static void latencyFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static TA_RetCode latencyCalls( const TA_ParamHolder *params,
+                                const TA_FuncInfo *funcInfo,
+                                TA_Integer nbBar,
+                                LatencyPath path,
+                                unsigned int nbCall,
+                                double *sample );
+static double measureClockOverhead( double *sample );
+static double percentile( const double *sorted, unsigned int nbValue, double p );
+static void writeLatency( Bench *bench,
+                          const TA_FuncInfo *funcInfo,
+                          TA_Integer lookback,
+                          const Latency *latency );
+static int openCounters( Bench *bench );
+static void closeCounters( Bench *bench );
+static void startCounters( const Bench *bench );
+static void stopCounters( const Bench *bench, double nbBar, Measure *measure );
+static void writeCounters( FILE *file, const Measure *measure, int isJson );
+
+/**** Local variables definitions.     ****/
+static const char *seriesName[SERIES_NB] =
+{
+   "trending",
+   "mean_reverting",
+   "random_walk",
+   "constant",
+   "descending",
+   "gbm",
+   "jump_diffusion",
+   "regime_switching"
+};
+
+static const char *counterName[COUNTER_NB] =
+{
+   "cycles",
+   "instructions",
+   "l1d_misses",
+   "llc_misses",
+   "branch_misses"
+};
+
+static const char *latencyPathName[LATENCY_NB] =
+{
+   "direct",
+   "abstract"
+};
+
+static const TA_Integer periodList[] =
+{
+   2, 3, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000
+};
+
+static unsigned long long randomState;
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   Bench bench;
+   Series series, mappedSeries;
+   TA_DataGenSeries mapped;
+   const TA_FuncHandle *handle;
+   TA_Integer maxSize;
+   const char *csvName, *jsonName, *baselineName;
+   FILE *file;
+   unsigned int i, nbSize;
+   int j, kind, sizeGiven, seriesGiven;
+   TA_RetCode retCode;
+
+   memset( &bench, 0, sizeof(bench) );
+   sizeGiven = 0;
+   seriesGiven = 0;
+   bench.nbRep = BENCH_DEFAULT_REPS;
+   csvName = NULL;
+   jsonName = NULL;
+   baselineName = NULL;
+   bench.threshold = BENCH_DEFAULT_THRESHOLD;
+   parseSizeList( &bench, "1000,100000,10000000" );
+
+   for( j=1; j < argc; j++ )
+   {
+      if( (strcmp( argv[j], "-s" ) == 0) && (j+1 < argc) )
+      {
+         if( !parseSizeList( &bench, argv[++j] ) )
+         {
+            printUsage();
+            return 1;
+         }
+         sizeGiven = 1;
+      }
+      else if( (strcmp( argv[j], "-k" ) == 0) && (j+1 < argc) )
+      {
+         if( !parseSeriesList( &bench, argv[++j] ) )
+         {
+            printUsage();
+            return 1;
+         }
+         seriesGiven = 1;
+      }
+      else if( strcmp( argv[j], "-period" ) == 0 )
+         bench.periodSweep = 1;
+      else if( (strcmp( argv[j], "-m" ) == 0) && (j+1 < argc) )
+         bench.dataDir = argv[++j];
+      else if( strcmp( argv[j], "-hw" ) == 0 )
+         bench.hwCounters = 1;
+      else if( strcmp( argv[j], "-latency" ) == 0 )
+         bench.latency = 1;
+      else if( (strcmp( argv[j], "-r" ) == 0) && (j+1 < argc) )
+      {
+         bench.nbRep = (unsigned int)atoi( argv[++j] );
+         if( (bench.nbRep < 1) || (bench.nbRep > BENCH_MAX_REPS) )
+         {
+            printUsage();
+            return 1;
+         }
+      }
+      else if( (strcmp( argv[j], "-f" ) == 0) && (j+1 < argc) )
+         bench.funcName = argv[++j];
+      else if( (strcmp( argv[j], "-csv" ) == 0) && (j+1 < argc) )
+         csvName = argv[++j];
+      else if( (strcmp( argv[j], "-json" ) == 0) && (j+1 < argc) )
+         jsonName = argv[++j];
+      else if( (strcmp( argv[j], "-baseline" ) == 0) && (j+1 < argc) )
+         baselineName = argv[++j];
+      else if( (strcmp( argv[j], "-t" ) == 0) && (j+1 < argc) )
+      {
+         bench.threshold = atof( argv[++j] );
+         if( bench.threshold < 0.0 )
+         {
+            printUsage();
+            return 1;
+         }
+      }
+      else
+      {
+         printUsage();
+         return 1;
+      }
+   }
+
+   if( (bench.periodSweep || bench.latency) && baselineName )
+   {
+      printUsage();
+      return 1;
+   }
+
+   if( bench.periodSweep && bench.latency )
+   {
+      printUsage();
+      return 1;
+   }
+
+   /* The period sweep and the latency are done for a single size. */
+   nbSize = bench.nbSize;
+   if( bench.periodSweep || bench.latency )
+   {
+      if( !sizeGiven )
+         bench.size[0] = bench.periodSweep? BENCH_PERIOD_BARS : BENCH_LATENCY_BARS;
+      nbSize = 1;
+   }
+
+   if( bench.latency && (bench.size[0] < BENCH_LATENCY_WINDOW) )
+   {
+      printUsage();
+      return 1;
+   }
+
+   if( !seriesGiven )
+   {
+      if( bench.latency )
+         bench.seriesMask = SERIES_MASK(SERIES_RANDOM_WALK);
+      else if( bench.periodSweep )
+         bench.seriesMask = SERIES_MASK(SERIES_RANDOM_WALK)|SERIES_MASK(SERIES_DESCENDING);
+      else
+         bench.seriesMask = SERIES_MASK(SERIES_TRENDING)|SERIES_MASK(SERIES_MEAN_REVERTING)|
+                            SERIES_MASK(SERIES_RANDOM_WALK)|SERIES_MASK(SERIES_CONSTANT);
+   }
+
+   if( bench.funcName && (TA_GetFuncHandle( bench.funcName, &handle ) != TA_SUCCESS) )
+   {
+      fprintf( stderr, "Unknown function [%s]\n", bench.funcName );
+      return 1;
+   }
+
+   /* A missing baseline is created with the results of this run. */
+   if( baselineName )
+   {
+      file = fopen( baselineName, "r" );
+      if( file )
+      {
+         fclose( file );
+         if( !loadBaseline( &bench, baselineName ) )
+            return 1;
+      }
+      else if( !jsonName )
+      {
+         fprintf( stderr, "No baseline [%s], it will be created.\n", baselineName );
+         jsonName = baselineName;
+         baselineName = NULL;
+      }
+      else
+      {
+         fprintf( stderr, "No baseline [%s], copy [%s] there to create it.\n", baselineName, jsonName );
+         baselineName = NULL;
+      }
+   }
+
+   /* CSV on the standard output when no file is specified. */
+   if( csvName )
+   {
+      bench.csvFile = fopen( csvName, "w" );
+      if( !bench.csvFile )
+      {
+         fprintf( stderr, "Cannot create [%s]\n", csvName );
+         return 1;
+      }
+   }
+   else if( !jsonName && !baselineName )
+      bench.csvFile = stdout;
+
+   if( jsonName )
+   {
+      bench.jsonFile = fopen( jsonName, "w" );
+      if( !bench.jsonFile )
+      {
+         fprintf( stderr, "Cannot create [%s]\n", jsonName );
+         return 1;
+      }
+   }
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+   {
+      fprintf( stderr, "TA_Initialize failed [%d]\n", retCode );
+      return 1;
+   }
+
+   for( i=0; i < COUNTER_NB; i++ )
+      bench.counterFd[i] = -1;
+   if( bench.hwCounters && !openCounters( &bench ) )
+      fprintf( stderr, "Hardware counters not available, their columns are left empty.\n" );
+
+   maxSize = 0;
+   for( i=0; i < nbSize; i++ )
+   {
+      if( bench.size[i] > maxSize )
+         maxSize = bench.size[i];
+   }
+
+   if( !bench.dataDir && !allocSeries( &series, maxSize ) )
+   {
+      fprintf( stderr, "Cannot allocate %d bars\n", maxSize );
+      return 1;
+   }
+
+   if( bench.latency )
+   {
+      bench.latencySample = (double *)malloc( sizeof(double)*BENCH_LATENCY_CALLS );
+      if( !bench.latencySample )
+      {
+         fprintf( stderr, "Out of memory\n" );
+         return 1;
+      }
+      bench.clockOverhead = measureClockOverhead( bench.latencySample );
+      fprintf( stderr, "Clock overhead: %.1f ns per call\n", bench.clockOverhead );
+   }
+
+   if( bench.csvFile && bench.latency )
+      fprintf( bench.csvFile, "function,group,series,bars,lookback,path,calls,p50_ns,p99_ns,p999_ns,max_ns\n" );
+   else if( bench.csvFile && bench.periodSweep )
+      fprintf( bench.csvFile, "function,group,series,bars,opt_input,period,lookback,reps,loops,ns_per_bar,ns_per_bar_min,ns_per_bar_max,exponent,super_constant\n" );
+   else if( bench.csvFile )
+   {
+      fprintf( bench.csvFile, "function,group,series,bars,lookback,reps,loops,ns_per_bar,ns_per_bar_min,ns_per_bar_max,bytes_per_bar" );
+      if( bench.hwCounters )
+      {
+         fprintf( bench.csvFile, ",ipc" );
+         for( i=0; i < COUNTER_NB; i++ )
+            fprintf( bench.csvFile, ",%s_per_bar", counterName[i] );
+      }
+      fprintf( bench.csvFile, "\n" );
+   }
+
+   bench.reportFile = (bench.csvFile == stdout)? stderr : stdout;
+
+   if( bench.jsonFile )
+   {
+      fprintf( bench.jsonFile, "{\n" );
+      fprintf( bench.jsonFile, "  \"version\": \"%s\",\n", TA_GetVersionString() );
+      fprintf( bench.jsonFile, "  \"reps\": %u,\n", bench.nbRep );
+      fprintf( bench.jsonFile, "  \"results\": [" );
+   }
+
+   for( i=0; i < nbSize; i++ )
+   {
+      for( kind=0; kind < SERIES_NB; kind++ )
+      {
+         if( !(bench.seriesMask & SERIES_MASK(kind)) )
+            continue;
+
+         fprintf( stderr, "%10d bars, %-16s: %s", bench.size[i], seriesName[kind],
+                  bench.periodSweep? "\n" : "" );
+         fflush( stderr );
+         if( bench.dataDir )
+         {
+            if( !mapSeries( bench.dataDir, (SeriesKind)kind, bench.size[i], &mappedSeries, &mapped ) )
+            {
+               fprintf( stderr, "Cannot map the series in [%s]\n", bench.dataDir );
+               return 1;
+            }
+            bench.series = &mappedSeries;
+         }
+         else
+         {
+            generateSeries( &series, (SeriesKind)kind, bench.size[i] );
+            bench.series = &series;
+         }
+         bench.kind = (SeriesKind)kind;
+         TA_ForEachFunc( bench.periodSweep? sweepFunc : (bench.latency? latencyFunc : benchFunc), &bench );
+         if( bench.dataDir )
+            TA_DataGenUnmapFile( &mapped );
+         if( !bench.periodSweep )
+            fprintf( stderr, "done\n" );
+      }
+   }
+
+   if( bench.jsonFile )
+   {
+      fprintf( bench.jsonFile, "\n  ]\n}\n" );
+      fclose( bench.jsonFile );
+   }
+
+   if( bench.csvFile && (bench.csvFile != stdout) )
+      fclose( bench.csvFile );
+
+   if( !bench.dataDir )
+      freeSeries( &series );
+   closeCounters( &bench );
+   free( bench.latencySample );
+   TA_Shutdown();
+
+   if( bench.failed )
+      return 1;
+
+   if( bench.baseline && !compareBaseline( &bench ) )
+      return 2;
+
+   if( bench.periodSweep )
+   {
+      fprintf( bench.reportFile, "\n%u sweeps, %u with a cost growing with the period.\n",
+               bench.nbSwept, bench.nbFlagged );
+   }
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static void printUsage( void )
+{
+   printf( "Usage: ta_bench [-s sizes] [-r reps] [-f function] [-csv file] [-json file]\n" );
+   printf( "                [-baseline file] [-t threshold] [-k series] [-period] [-m dir]\n" );
+   printf( "                [-hw] [-latency]\n" );
+   printf( "\n" );
+   printf( "   Benchmark all the TA functions with their default optional\n" );
+   printf( "   inputs, on trending, mean-reverting, random walk and constant\n" );
+   printf( "   series.\n" );
+   printf( "\n" );
+   printf( "   -s     Comma separated number of bars (default 1000,100000,10000000).\n" );
+   printf( "   -r     Repetitions of each measurement, the median is reported (default %d).\n", BENCH_DEFAULT_REPS );
+   printf( "   -f     Benchmark only this function (like SMA).\n" );
+   printf( "   -csv   Write the results in this CSV file.\n" );
+   printf( "   -json  Write the results in this JSON file.\n" );
+   printf( "   -baseline  Compare with the JSON file of a previous run (created\n" );
+   printf( "              when it does not exist).\n" );
+   printf( "   -t     Slowdown tolerated before a regression is reported (default %g).\n", BENCH_DEFAULT_THRESHOLD );
+   printf( "   -k     Comma separated series among trending, mean_reverting,\n" );
+   printf( "          random_walk, constant, descending, gbm, jump_diffusion\n" );
+   printf( "          and regime_switching.\n" );
+   printf( "   -period  Sweep the period optional inputs from 2 to 10000 on a single\n" );
+   printf( "            size (default %d bars) and flag the functions with a cost\n", BENCH_PERIOD_BARS );
+   printf( "            growing with the period.\n" );
+   printf( "   -m     Map the series from files in this directory, generated\n" );
+   printf( "          the first time.\n" );
+   printf( "   -hw    Add the IPC and the hardware counters per bar (cycles,\n" );
+   printf( "          instructions, L1D/LLC misses, branch misses), Linux only.\n" );
+   printf( "   -latency  Report the p50/p99/p99.9 latency of the calls on the last\n" );
+   printf( "             1 to %d bars, direct and with TA_CallFunc, on a single\n", BENCH_LATENCY_WINDOW );
+   printf( "             size (default %d bars).\n", BENCH_LATENCY_BARS );
+   printf( "\n" );
+   printf( "   The CSV goes to the standard output when no file is specified.\n" );
+   printf( "   The exit code is 2 when a regression is detected.\n" );
+}
+
+static int parseSizeList( Bench *bench, const char *str )
+{
+   char *end;
+   long size;
+
+   bench->nbSize = 0;
+   while( *str )
+   {
+      size = strtol( str, &end, 10 );
+      if( (end == str) || (size < 1) || (size > 100000000) || (bench->nbSize >= BENCH_MAX_SIZE) )
+         return 0;
+
+      bench->size[bench->nbSize++] = (TA_Integer)size;
+      str = end;
+      if( *str == ',' )
+         str++;
+      else if( *str != '\0' )
+         return 0;
+   }
+
+   return bench->nbSize != 0;
+}
+
+static int parseSeriesList( Bench *bench, const char *str )
+{
+   size_t len;
+   int kind;
+
+   bench->seriesMask = 0;
+   while( *str )
+   {
+      len = strcspn( str, "," );
+      for( kind=0; kind < SERIES_NB; kind++ )
+      {
+         if( (strlen( seriesName[kind] ) == len) && (strncmp( seriesName[kind], str, len ) == 0) )
+            break;
+      }
+      if( kind == SERIES_NB )
+         return 0;
+
+      bench->seriesMask |= SERIES_MASK(kind);
+      str += len;
+      if( *str == ',' )
+         str++;
+   }
+
+   return bench->seriesMask != 0;
+}
+
+static int allocSeries( Series *series, TA_Integer nbBar )
+{
+   size_t size = sizeof(TA_Real)*(size_t)nbBar;
+
+   series->open   = (TA_Real *)malloc( size );
+   series->high   = (TA_Real *)malloc( size );
+   series->low    = (TA_Real *)malloc( size );
+   series->close  = (TA_Real *)malloc( size );
+   series->volume = (TA_Real *)malloc( size );
+   series->nbBar  = 0;
+
+   if( !series->open || !series->high || !series->low || !series->close || !series->volume )
+   {
+      freeSeries( series );
+      return 0;
+   }
+
+   return 1;
+}
+
+static void freeSeries( Series *series )
+{
+   free( series->open );
+   free( series->high );
+   free( series->low );
+   free( series->close );
+   free( series->volume );
+   memset( series, 0, sizeof(Series) );
+}
+
+static void generateSeries( Series *series, SeriesKind kind, TA_Integer nbBar )
+{
+   TA_DataGenParam param;
+
+   /* Same series from one run to the other. */
+   TA_DataGenDefault( &param, (TA_DataGenModel)kind );
+   TA_DataGenerate( &param, nbBar, series->open, series->high,
+                    series->low, series->close, series->volume );
+   series->nbBar = nbBar;
+}
+
+static int mapSeries( const char *dataDir, SeriesKind kind, TA_Integer nbBar,
+                      Series *series, TA_DataGenSeries *mapped )
+{
+   TA_DataGenParam param;
+   char fileName[1024];
+
+   TA_DataGenDefault( &param, (TA_DataGenModel)kind );
+   sprintf( fileName, "%.900s/ta_bench_%s_%d.dat", dataDir, seriesName[kind], nbBar );
+   if( !TA_DataGenMapFile( fileName, &param, nbBar, mapped ) )
+      return 0;
+
+   series->open   = mapped->open;
+   series->high   = mapped->high;
+   series->low    = mapped->low;
+   series->close  = mapped->close;
+   series->volume = mapped->volume;
+   series->nbBar  = nbBar;
+   return 1;
+}
+
+static double randomUniform( void )
+{
+   /* xorshift64*, in ]0,1[ */
+   randomState ^= randomState >> 12;
+   randomState ^= randomState << 25;
+   randomState ^= randomState >> 27;
+   return ((double)((randomState * 0x2545F4914F6CDD1DULL) >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static double clockNs( void )
+{
+   /* Monotonic high-resolution clock. */
+#ifdef WIN32
+   static LARGE_INTEGER freq;
+   LARGE_INTEGER now;
+
+   if( freq.QuadPart == 0 )
+      QueryPerformanceFrequency( &freq );
+   QueryPerformanceCounter( &now );
+   return (double)now.QuadPart * 1.0e9 / (double)freq.QuadPart;
+#else
+   struct timespec now;
+
+   clock_gettime( CLOCK_MONOTONIC, &now );
+   return (double)now.tv_sec * 1.0e9 + (double)now.tv_nsec;
+#endif
+}
+
+static void benchFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   Bench *bench;
+   Measure measure;
+   TA_RetCode retCode;
+
+   bench = (Bench *)opaqueData;
+
+   if( bench->funcName && (strcmp( bench->funcName, funcInfo->name ) != 0) )
+      return;
+
+   retCode = measureFunc( bench, funcInfo, -1, 0, &measure );
+   if( retCode != TA_SUCCESS )
+   {
+      fprintf( stderr, "\n%s failed [%d]\n", funcInfo->name, retCode );
+      bench->failed = 1;
+      return;
+   }
+
+   writeResult( bench, funcInfo, &measure );
+}
+
+static TA_RetCode measureFunc( const Bench *bench,
+                               const TA_FuncInfo *funcInfo,
+                               int optInIndex,
+                               TA_Integer optInValue,
+                               Measure *measure )
+{
+   double sample[BENCH_MAX_REPS];
+   TA_ParamHolder *params;
+   TA_Integer nbBar;
+   TA_RetCode retCode;
+   unsigned int i;
+   double elapsed;
+
+   nbBar = bench->series->nbBar;
+   memset( measure, 0, sizeof(Measure) );
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* All optional inputs are left to their default, except
+    * optInIndex when it is not negative.
+    */
+   retCode = TA_SUCCESS;
+   if( optInIndex >= 0 )
+      retCode = TA_SetOptInputParamInteger( params, (unsigned int)optInIndex, optInValue );
+   if( retCode == TA_SUCCESS )
+      retCode = setupParams( bench->series, funcInfo, params, &measure->bytesPerBar );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_GetLookback( params, &measure->lookback );
+
+   /* Warmup (also touches all the output pages), then find
+    * how many calls are needed for a measurable sample.
+    */
+   measure->nbLoop = 1;
+   if( retCode == TA_SUCCESS )
+      timeCalls( params, nbBar, 1, &retCode );
+   if( retCode == TA_SUCCESS )
+   {
+      elapsed = timeCalls( params, nbBar, 1, &retCode );
+      if( elapsed < BENCH_MIN_SAMPLE_NS )
+         measure->nbLoop = (unsigned int)(BENCH_MIN_SAMPLE_NS/(elapsed > 1.0? elapsed : 1.0)) + 1;
+   }
+
+   startCounters( bench );
+   for( i=0; (i < bench->nbRep) && (retCode == TA_SUCCESS); i++ )
+      measure->sample[i] = timeCalls( params, nbBar, measure->nbLoop, &retCode ) / ((double)measure->nbLoop*(double)nbBar);
+   stopCounters( bench, (double)bench->nbRep*(double)measure->nbLoop*(double)nbBar, measure );
+
+   TA_ParamHolderFree( params );
+
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   measure->nbSample = bench->nbRep;
+   memcpy( sample, measure->sample, sizeof(double)*bench->nbRep );
+   measure->nsPerBar = median( sample, bench->nbRep );
+   measure->nsPerBarMin = sample[0];
+   measure->nsPerBarMax = sample[bench->nbRep-1];
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode setupParams( const Series *series,
+                               const TA_FuncInfo *funcInfo,
+                               TA_ParamHolder *params,
+                               double *bytesPerBar )
+{
+   const TA_Real *realInput[4];
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   unsigned int i, nbReal, bit;
+   double bytes;
+
+   /* The real inputs are mapped in this order (the second input
+    * of functions like CORREL or BETA must differ from the first).
+    */
+   realInput[0] = series->close;
+   realInput[1] = series->open;
+   realInput[2] = series->high;
+   realInput[3] = series->low;
+
+   bytes = 0.0;
+   nbReal = 0;
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         retCode = TA_SetInputParamPricePtr( params, i,
+                                             series->open, series->high,
+                                             series->low, series->close,
+                                             series->volume, series->volume );
+         for( bit=TA_IN_PRICE_OPEN; bit <= TA_IN_PRICE_OPENINTEREST; bit <<= 1 )
+         {
+            if( inputInfo->flags & bit )
+               bytes += sizeof(TA_Real);
+         }
+         break;
+      case TA_Input_Real:
+         retCode = TA_SetInputParamRealPtr( params, i, realInput[nbReal++ & 3] );
+         bytes += sizeof(TA_Real);
+         break;
+      default:
+         retCode = TA_BAD_PARAM;
+         break;
+      }
+
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      bytes += (outputInfo->type == TA_Output_Integer)? sizeof(TA_Integer) : sizeof(TA_Real);
+   }
+
+   *bytesPerBar = bytes;
+
+   return TA_AllocOutputParam( params, 0, series->nbBar-1 );
+}
+
+static double timeCalls( const TA_ParamHolder *params,
+                         TA_Integer nbBar,
+                         unsigned int nbLoop,
+                         TA_RetCode *retCode )
+{
+   TA_Integer outBegIdx, outNbElement;
+   unsigned int i;
+   double start;
+
+   start = clockNs();
+   for( i=0; i < nbLoop; i++ )
+   {
+      *retCode = TA_CallFunc( params, 0, nbBar-1, &outBegIdx, &outNbElement );
+      if( *retCode != TA_SUCCESS )
+         break;
+   }
+
+   return clockNs() - start;
+}
+
+static int compareDouble( const void *a, const void *b )
+{
+   double da = *(const double *)a;
+   double db = *(const double *)b;
+
+   return (da > db) - (da < db);
+}
+
+static void writeResult( Bench *bench,
+                         const TA_FuncInfo *funcInfo,
+                         const Measure *measure )
+{
+   Result *result;
+   unsigned int i;
+
+   if( bench->csvFile )
+   {
+      fprintf( bench->csvFile, "%s,%s,%s,%d,%d,%u,%u,%.4f,%.4f,%.4f,%.0f",
+               funcInfo->name, funcInfo->group, seriesName[bench->kind],
+               bench->series->nbBar, measure->lookback, bench->nbRep,
+               measure->nbLoop, measure->nsPerBar, measure->nsPerBarMin,
+               measure->nsPerBarMax, measure->bytesPerBar );
+      if( bench->hwCounters )
+         writeCounters( bench->csvFile, measure, 0 );
+      fprintf( bench->csvFile, "\n" );
+      fflush( bench->csvFile );
+   }
+
+   if( bench->jsonFile )
+   {
+      fprintf( bench->jsonFile, "%s\n    { \"function\": \"%s\", \"group\": \"%s\", \"series\": \"%s\", "
+                                "\"bars\": %d, \"lookback\": %d, \"reps\": %u, \"loops\": %u, "
+                                "\"ns_per_bar\": %.4f, \"ns_per_bar_min\": %.4f, \"ns_per_bar_max\": %.4f, "
+                                "\"bytes_per_bar\": %.0f, \"samples\": [",
+               bench->nbResult? "," : "",
+               funcInfo->name, funcInfo->group, seriesName[bench->kind],
+               bench->series->nbBar, measure->lookback, bench->nbRep,
+               measure->nbLoop, measure->nsPerBar, measure->nsPerBarMin,
+               measure->nsPerBarMax, measure->bytesPerBar );
+      for( i=0; i < measure->nbSample; i++ )
+         fprintf( bench->jsonFile, "%s%.4f", i? ", " : "", measure->sample[i] );
+      fprintf( bench->jsonFile, "]" );
+      if( bench->hwCounters )
+         writeCounters( bench->jsonFile, measure, 1 );
+      fprintf( bench->jsonFile, " }" );
+   }
+
+   /* Kept for the comparison with the baseline. */
+   if( bench->baseline )
+   {
+      if( bench->nbResult == bench->maxResult )
+      {
+         bench->maxResult = bench->maxResult? 2*bench->maxResult : 256;
+         result = (Result *)realloc( bench->result, sizeof(Result)*bench->maxResult );
+         if( !result )
+         {
+            fprintf( stderr, "\nOut of memory\n" );
+            bench->failed = 1;
+            return;
+         }
+         bench->result = result;
+      }
+
+      result = &bench->result[bench->nbResult];
+      strncpy( result->funcName, funcInfo->name, BENCH_MAX_NAME-1 );
+      result->funcName[BENCH_MAX_NAME-1] = '\0';
+      strcpy( result->seriesName, seriesName[bench->kind] );
+      result->nbBar = bench->series->nbBar;
+      result->measure = *measure;
+   }
+
+   bench->nbResult++;
+}
+
+static int loadBaseline( Bench *bench, const char *fileName )
+{
+   FILE *file;
+   char *text, *object, *end, *value, *next;
+   long size;
+   unsigned int nbObject;
+   Result *baseline;
+   Measure *measure;
+
+   /* Read a JSON file written by ta_bench (-json). Only the
+    * members needed for the comparison are used.
+    */
+   file = fopen( fileName, "rb" );
+   if( !file )
+   {
+      fprintf( stderr, "Cannot open [%s]\n", fileName );
+      return 0;
+   }
+
+   fseek( file, 0, SEEK_END );
+   size = ftell( file );
+   fseek( file, 0, SEEK_SET );
+   text = (char *)malloc( (size_t)size+1 );
+   if( !text || (size <= 0) || (fread( text, 1, (size_t)size, file ) != (size_t)size) )
+   {
+      fprintf( stderr, "Cannot read [%s]\n", fileName );
+      free( text );
+      fclose( file );
+      return 0;
+   }
+   text[size] = '\0';
+   fclose( file );
+
+   object = strstr( text, "\"results\"" );
+   nbObject = 0;
+   for( value = object; value && (value = strchr( value, '{' )) != NULL; value++ )
+      nbObject++;
+
+   bench->baseline = (Result *)calloc( nbObject? nbObject : 1, sizeof(Result) );
+   if( !object || !bench->baseline )
+   {
+      fprintf( stderr, "No results in [%s]\n", fileName );
+      free( text );
+      return 0;
+   }
+
+   while( (object = strchr( object, '{' )) != NULL )
+   {
+      end = strchr( object, '}' );
+      if( !end )
+         break;
+
+      baseline = &bench->baseline[bench->nbBaseline];
+      measure = &baseline->measure;
+      value = (char *)findKey( object, end, "bars" );
+      if( value )
+         baseline->nbBar = (TA_Integer)strtol( value, NULL, 10 );
+      value = (char *)findKey( object, end, "ns_per_bar" );
+      if( value )
+         measure->nsPerBar = strtod( value, NULL );
+
+      value = (char *)findKey( object, end, "samples" );
+      if( value && (*value == '[') )
+      {
+         value++;
+         while( measure->nbSample < BENCH_MAX_REPS )
+         {
+            measure->sample[measure->nbSample] = strtod( value, &next );
+            if( next == value )
+               break;
+            measure->nbSample++;
+            value = next;
+            while( (*value == ',') || (*value == ' ') )
+               value++;
+         }
+      }
+
+      if( readString( findKey( object, end, "function" ), baseline->funcName, BENCH_MAX_NAME ) &&
+          readString( findKey( object, end, "series" ), baseline->seriesName, BENCH_MAX_NAME ) &&
+          (baseline->nbBar > 0) && (measure->nbSample > 0) )
+         bench->nbBaseline++;
+      else
+         memset( baseline, 0, sizeof(Result) );
+
+      object = end+1;
+   }
+
+   free( text );
+
+   if( bench->nbBaseline == 0 )
+   {
+      fprintf( stderr, "No results with samples in [%s]\n", fileName );
+      return 0;
+   }
+
+   return 1;
+}
+
+static const char *findKey( const char *object, const char *end, const char *key )
+{
+   size_t len = strlen( key );
+   const char *pos;
+
+   /* Return the value following "key": within the object. */
+   for( pos = object; pos && (pos < end); pos++ )
+   {
+      pos = strchr( pos, '"' );
+      if( !pos || (pos >= end) )
+         return NULL;
+
+      if( (strncmp( pos+1, key, len ) == 0) && (pos[len+1] == '"') )
+      {
+         pos += len+2;
+         while( (*pos == ' ') || (*pos == ':') )
+            pos++;
+         return pos;
+      }
+
+      /* Skip the rest of this string. */
+      pos = strchr( pos+1, '"' );
+   }
+
+   return NULL;
+}
+
+static int readString( const char *value, char *str, size_t size )
+{
+   size_t i;
+
+   if( !value || (*value != '"') )
+      return 0;
+
+   for( i=0, value++; (*value != '"') && (*value != '\0') && (i < size-1); i++ )
+      str[i] = *value++;
+   str[i] = '\0';
+
+   return *value == '"';
+}
+
+static const Result *findBaseline( const Bench *bench, const Result *current )
+{
+   unsigned int i;
+
+   for( i=0; i < bench->nbBaseline; i++ )
+   {
+      if( (bench->baseline[i].nbBar == current->nbBar) &&
+          (strcmp( bench->baseline[i].funcName, current->funcName ) == 0) &&
+          (strcmp( bench->baseline[i].seriesName, current->seriesName ) == 0) )
+         return &bench->baseline[i];
+   }
+
+   return NULL;
+}
+
+static void bootstrapRatio( const Measure *current,
+                            const Measure *baseline,
+                            Comparison *comparison )
+{
+   static double ratio[BENCH_NB_BOOTSTRAP];
+   double buffer[BENCH_MAX_REPS];
+   double tail;
+   unsigned int i;
+
+   /* Percentile bootstrap of the ratio of the medians: the
+    * repetitions of each run are resampled with replacement.
+    */
+   for( i=0; i < BENCH_NB_BOOTSTRAP; i++ )
+      ratio[i] = resampleMedian( current, buffer ) / resampleMedian( baseline, buffer );
+
+   qsort( ratio, BENCH_NB_BOOTSTRAP, sizeof(double), compareDouble );
+   tail = (1.0-BENCH_CONFIDENCE)/2.0;
+   comparison->low  = ratio[(unsigned int)(tail*(BENCH_NB_BOOTSTRAP-1))];
+   comparison->high = ratio[(unsigned int)((1.0-tail)*(BENCH_NB_BOOTSTRAP-1))];
+   comparison->ratio = current->nsPerBar / baseline->nsPerBar;
+}
+
+static double resampleMedian( const Measure *measure, double *buffer )
+{
+   unsigned int i;
+
+   for( i=0; i < measure->nbSample; i++ )
+      buffer[i] = measure->sample[(unsigned int)(randomUniform()*measure->nbSample)];
+
+   return median( buffer, measure->nbSample );
+}
+
+static double median( double *value, unsigned int nbValue )
+{
+   /* Note: value is sorted in place. */
+   qsort( value, nbValue, sizeof(double), compareDouble );
+   if( nbValue & 1 )
+      return value[nbValue/2];
+
+   return (value[nbValue/2-1]+value[nbValue/2])/2.0;
+}
+
+static int compareRegression( const void *a, const void *b )
+{
+   /* Worst first, by the lower bound of the interval. */
+   return compareDouble( &((const Comparison *)b)->low,
+                         &((const Comparison *)a)->low );
+}
+
+static int compareBaseline( const Bench *bench )
+{
+   Comparison *regression;
+   Comparison comparison;
+   unsigned int i, nbRegression, nbImproved, nbMissing;
+
+   regression = (Comparison *)malloc( sizeof(Comparison)*(bench->nbResult? bench->nbResult : 1) );
+   if( !regression )
+   {
+      fprintf( stderr, "Out of memory\n" );
+      return 0;
+   }
+
+   /* Same resampling from one run to the other. */
+   randomState = 0x2545F4914F6CDD1DULL;
+
+   nbRegression = 0;
+   nbImproved = 0;
+   nbMissing = 0;
+   for( i=0; i < bench->nbResult; i++ )
+   {
+      comparison.current = &bench->result[i];
+      comparison.baseline = findBaseline( bench, comparison.current );
+      if( !comparison.baseline || (comparison.baseline->measure.nsPerBar <= 0.0) )
+      {
+         nbMissing++;
+         continue;
+      }
+
+      bootstrapRatio( &comparison.current->measure, &comparison.baseline->measure, &comparison );
+      if( comparison.low > 1.0+bench->threshold )
+         regression[nbRegression++] = comparison;
+      else if( comparison.high < 1.0/(1.0+bench->threshold) )
+         nbImproved++;
+   }
+
+   printf( "\nCompared %u results with the baseline (%u not in the baseline).\n",
+           bench->nbResult-nbMissing, nbMissing );
+   printf( "%u faster, %u slower by more than %g%% (%g%% confidence).\n",
+           nbImproved, nbRegression, 100.0*bench->threshold, 100.0*BENCH_CONFIDENCE );
+
+   if( nbRegression )
+   {
+      qsort( regression, nbRegression, sizeof(Comparison), compareRegression );
+
+      printf( "\nRegressions, worst first:\n" );
+      printf( "%-20s %-15s %10s %12s %12s %7s %17s\n",
+              "function", "series", "bars", "baseline", "current", "ratio", "interval" );
+      for( i=0; i < nbRegression; i++ )
+      {
+         printf( "%-20s %-15s %10d %12.4f %12.4f %7.2f [%6.2f, %6.2f]\n",
+                 regression[i].current->funcName,
+                 regression[i].current->seriesName,
+                 regression[i].current->nbBar,
+                 regression[i].baseline->measure.nsPerBar,
+                 regression[i].current->measure.nsPerBar,
+                 regression[i].ratio, regression[i].low, regression[i].high );
+      }
+   }
+
+   free( regression );
+
+   return nbRegression == 0;
+}
+
+static void sweepFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   const TA_OptInputParameterInfo *optInfo;
+   const TA_IntegerRange *range;
+   Bench *bench;
+   Sweep sweep;
+   TA_RetCode retCode;
+   TA_Integer period;
+   unsigned int i, j;
+   size_t len;
+
+   bench = (Bench *)opaqueData;
+
+   if( bench->funcName && (strcmp( bench->funcName, funcInfo->name ) != 0) )
+      return;
+
+   /* Every integer optional input named "...Period" is swept. */
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInfo );
+      len = strlen( optInfo->paramName );
+      if( (optInfo->type != TA_OptInput_IntegerRange) ||
+          (len < 6) || (strcmp( &optInfo->paramName[len-6], "Period" ) != 0) )
+         continue;
+
+      range = (const TA_IntegerRange *)optInfo->dataSet;
+      memset( &sweep, 0, sizeof(sweep) );
+      for( j=0; j < sizeof(periodList)/sizeof(periodList[0]); j++ )
+      {
+         /* The period must leave most of the bars as output. */
+         period = periodList[j];
+         if( (period < range->min) || (period > range->max) ||
+             (period > bench->series->nbBar/10) )
+            continue;
+
+         retCode = measureFunc( bench, funcInfo, (int)i, period, &sweep.measure[sweep.nbPoint] );
+         if( retCode != TA_SUCCESS )
+         {
+            fprintf( stderr, "\n%s failed [%d] for %s=%d\n", funcInfo->name, retCode, optInfo->paramName, period );
+            bench->failed = 1;
+            return;
+         }
+         sweep.period[sweep.nbPoint++] = period;
+      }
+
+      if( sweep.nbPoint < 2 )
+         continue;
+
+      fitSweep( &sweep );
+      writeSweep( bench, funcInfo, optInfo, &sweep );
+
+      bench->nbSwept++;
+      if( sweep.superConstant )
+      {
+         bench->nbFlagged++;
+         fprintf( bench->reportFile, "   %s %s: cost per bar grows as period^%.2f (x%.1f from %d to %d)\n",
+                  funcInfo->name, optInfo->paramName, sweep.exponent, sweep.ratio,
+                  sweep.period[0], sweep.period[sweep.nbPoint-1] );
+         fflush( bench->reportFile );
+      }
+   }
+}
+
+static void fitSweep( Sweep *sweep )
+{
+   double x, y, sumX, sumY, sumXX, sumXY, n;
+   unsigned int i;
+
+   /* Least squares of log(cost) = exponent*log(period) + c */
+   sumX = sumY = sumXX = sumXY = 0.0;
+   for( i=0; i < sweep->nbPoint; i++ )
+   {
+      x = log( (double)sweep->period[i] );
+      y = log( sweep->measure[i].nsPerBar > 0.0? sweep->measure[i].nsPerBar : 1.0e-6 );
+      sumX  += x;
+      sumY  += y;
+      sumXX += x*x;
+      sumXY += x*y;
+   }
+
+   n = (double)sweep->nbPoint;
+   sweep->exponent = (n*sumXY - sumX*sumY) / (n*sumXX - sumX*sumX);
+   sweep->ratio = sweep->measure[sweep->nbPoint-1].nsPerBar / sweep->measure[0].nsPerBar;
+   sweep->superConstant = (sweep->exponent > BENCH_FLAG_EXPONENT) &&
+                          (sweep->ratio > BENCH_FLAG_RATIO);
+}
+
+static void writeSweep( Bench *bench,
+                        const TA_FuncInfo *funcInfo,
+                        const TA_OptInputParameterInfo *optInfo,
+                        const Sweep *sweep )
+{
+   const Measure *measure;
+   unsigned int i;
+
+   if( bench->csvFile )
+   {
+      for( i=0; i < sweep->nbPoint; i++ )
+      {
+         measure = &sweep->measure[i];
+         fprintf( bench->csvFile, "%s,%s,%s,%d,%s,%d,%d,%u,%u,%.4f,%.4f,%.4f,%.3f,%d\n",
+                  funcInfo->name, funcInfo->group, seriesName[bench->kind],
+                  bench->series->nbBar, optInfo->paramName, sweep->period[i],
+                  measure->lookback, bench->nbRep, measure->nbLoop,
+                  measure->nsPerBar, measure->nsPerBarMin, measure->nsPerBarMax,
+                  sweep->exponent, sweep->superConstant );
+      }
+      fflush( bench->csvFile );
+   }
+
+   if( bench->jsonFile )
+   {
+      fprintf( bench->jsonFile, "%s\n    { \"function\": \"%s\", \"group\": \"%s\", \"series\": \"%s\", "
+                                "\"bars\": %d, \"opt_input\": \"%s\", \"exponent\": %.3f, "
+                                "\"ratio\": %.3f, \"super_constant\": %s, \"points\": [",
+               bench->nbResult? "," : "",
+               funcInfo->name, funcInfo->group, seriesName[bench->kind],
+               bench->series->nbBar, optInfo->paramName, sweep->exponent,
+               sweep->ratio, sweep->superConstant? "true" : "false" );
+      for( i=0; i < sweep->nbPoint; i++ )
+      {
+         measure = &sweep->measure[i];
+         fprintf( bench->jsonFile, "%s\n        { \"period\": %d, \"lookback\": %d, \"loops\": %u, "
+                                   "\"ns_per_bar\": %.4f, \"ns_per_bar_min\": %.4f, \"ns_per_bar_max\": %.4f }",
+                  i? "," : "", sweep->period[i], measure->lookback, measure->nbLoop,
+                  measure->nsPerBar, measure->nsPerBarMin, measure->nsPerBarMax );
+      }
+      fprintf( bench->jsonFile, " ] }" );
+   }
+
+   bench->nbResult++;
+}
+
+static void latencyFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   Latency latency[LATENCY_NB];
+   Bench *bench;
+   TA_ParamHolder *params;
+   TA_Integer nbBar, lookback;
+   TA_RetCode retCode;
+   double bytesPerBar, *sample;
+   unsigned int i;
+   int path;
+
+   bench = (Bench *)opaqueData;
+   sample = bench->latencySample;
+   nbBar = bench->series->nbBar;
+
+   if( bench->funcName && (strcmp( bench->funcName, funcInfo->name ) != 0) )
+      return;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &params );
+   if( retCode != TA_SUCCESS )
+   {
+      fprintf( stderr, "\n%s failed [%d]\n", funcInfo->name, retCode );
+      bench->failed = 1;
+      return;
+   }
+
+   retCode = setupParams( bench->series, funcInfo, params, &bytesPerBar );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_GetLookback( params, &lookback );
+
+   for( path=0; (path < LATENCY_NB) && (retCode == TA_SUCCESS); path++ )
+   {
+      retCode = latencyCalls( params, funcInfo, nbBar, (LatencyPath)path, BENCH_LATENCY_WARMUP, sample );
+      if( retCode == TA_SUCCESS )
+         retCode = latencyCalls( params, funcInfo, nbBar, (LatencyPath)path, BENCH_LATENCY_CALLS, sample );
+      if( retCode != TA_SUCCESS )
+         break;
+
+      for( i=0; i < BENCH_LATENCY_CALLS; i++ )
+      {
+         sample[i] -= bench->clockOverhead;
+         if( sample[i] < 0.0 )
+            sample[i] = 0.0;
+      }
+      qsort( sample, BENCH_LATENCY_CALLS, sizeof(double), compareDouble );
+      latency[path].p50  = percentile( sample, BENCH_LATENCY_CALLS, 0.50 );
+      latency[path].p99  = percentile( sample, BENCH_LATENCY_CALLS, 0.99 );
+      latency[path].p999 = percentile( sample, BENCH_LATENCY_CALLS, 0.999 );
+      latency[path].max  = sample[BENCH_LATENCY_CALLS-1];
+   }
+
+   TA_ParamHolderFree( params );
+
+   if( retCode != TA_SUCCESS )
+   {
+      fprintf( stderr, "\n%s failed [%d]\n", funcInfo->name, retCode );
+      bench->failed = 1;
+      return;
+   }
+
+   writeLatency( bench, funcInfo, lookback, latency );
+}
+
+static TA_RetCode latencyCalls( const TA_ParamHolder *params,
+                                const TA_FuncInfo *funcInfo,
+                                TA_Integer nbBar,
+                                LatencyPath path,
+                                unsigned int nbCall,
+                                double *sample )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+   TA_FrameFunction function;
+   TA_Integer startIdx, outBegIdx, outNbElement;
+   TA_RetCode retCode;
+   unsigned int i;
+   double start;
+
+   /* The frame is what TA_CallFunc calls once the
+    * parameters are validated.
+    */
+   paramHolderPriv = (const TA_ParamHolderPriv *)params->hiddenData;
+   function = ((const TA_FuncDef *)funcInfo->handle)->function;
+
+   retCode = TA_SUCCESS;
+   for( i=0; i < nbCall; i++ )
+   {
+      startIdx = nbBar-1-(TA_Integer)(i%BENCH_LATENCY_WINDOW);
+      start = clockNs();
+      if( path == LATENCY_DIRECT )
+         retCode = (*function)( paramHolderPriv, startIdx, nbBar-1, &outBegIdx, &outNbElement );
+      else
+         retCode = TA_CallFunc( params, startIdx, nbBar-1, &outBegIdx, &outNbElement );
+      sample[i] = clockNs() - start;
+
+      if( retCode != TA_SUCCESS )
+         break;
+   }
+
+   return retCode;
+}
+
+/* Median of two consecutive reads of the clock. */
+static double measureClockOverhead( double *sample )
+{
+   unsigned int i;
+   double start;
+
+   for( i=0; i < BENCH_LATENCY_CALLS; i++ )
+   {
+      start = clockNs();
+      sample[i] = clockNs() - start;
+   }
+
+   return median( sample, BENCH_LATENCY_CALLS );
+}
+
+/* Nearest rank of sorted values. */
+static double percentile( const double *sorted, unsigned int nbValue, double p )
+{
+   unsigned int rank;
+
+   rank = (unsigned int)ceil( p*(double)nbValue );
+   if( rank < 1 )
+      rank = 1;
+   if( rank > nbValue )
+      rank = nbValue;
+
+   return sorted[rank-1];
+}
+
+static void writeLatency( Bench *bench,
+                          const TA_FuncInfo *funcInfo,
+                          TA_Integer lookback,
+                          const Latency *latency )
+{
+   int path;
+
+   for( path=0; path < LATENCY_NB; path++ )
+   {
+      if( bench->csvFile )
+      {
+         fprintf( bench->csvFile, "%s,%s,%s,%d,%d,%s,%u,%.1f,%.1f,%.1f,%.1f\n",
+                  funcInfo->name, funcInfo->group, seriesName[bench->kind],
+                  bench->series->nbBar, lookback, latencyPathName[path],
+                  BENCH_LATENCY_CALLS, latency[path].p50, latency[path].p99,
+                  latency[path].p999, latency[path].max );
+      }
+
+      if( bench->jsonFile )
+      {
+         fprintf( bench->jsonFile, "%s\n    { \"function\": \"%s\", \"group\": \"%s\", \"series\": \"%s\", "
+                                   "\"bars\": %d, \"lookback\": %d, \"path\": \"%s\", \"calls\": %u, "
+                                   "\"p50_ns\": %.1f, \"p99_ns\": %.1f, \"p999_ns\": %.1f, \"max_ns\": %.1f }",
+                  bench->nbResult? "," : "",
+                  funcInfo->name, funcInfo->group, seriesName[bench->kind],
+                  bench->series->nbBar, lookback, latencyPathName[path],
+                  BENCH_LATENCY_CALLS, latency[path].p50, latency[path].p99,
+                  latency[path].p999, latency[path].max );
+      }
+
+      bench->nbResult++;
+   }
+
+   if( bench->csvFile )
+      fflush( bench->csvFile );
+}
+
+static int openCounters( Bench *bench )
+{
+#ifdef __linux__
+   struct perf_event_attr attr;
+   int i, nbOpened;
+
+   nbOpened = 0;
+   for( i=0; i < COUNTER_NB; i++ )
+   {
+      memset( &attr, 0, sizeof(attr) );
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      switch( (CounterKind)i )
+      {
+      case COUNTER_CYCLES:
+         attr.config = PERF_COUNT_HW_CPU_CYCLES;
+         break;
+      case COUNTER_INSTRUCTIONS:
+         attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+         break;
+      case COUNTER_L1D_MISSES:
+         attr.type   = PERF_TYPE_HW_CACHE;
+         attr.config = PERF_COUNT_HW_CACHE_L1D |
+                       (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+         break;
+      case COUNTER_LLC_MISSES:
+         attr.config = PERF_COUNT_HW_CACHE_MISSES;
+         break;
+      default:
+         attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+         break;
+      }
+
+      /* User space of this thread only (allowed with the default
+       * perf_event_paranoid). The counters can be multiplexed, the
+       * times are read to scale them.
+       */
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED|PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      bench->counterFd[i] = (int)syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+      if( bench->counterFd[i] < 0 )
+      {
+         fprintf( stderr, "Counter %s not available.\n", counterName[i] );
+         bench->counterFd[i] = -1;
+      }
+      else
+         nbOpened++;
+   }
+
+   return nbOpened;
+#else
+   (void)bench;
+   return 0;
+#endif
+}
+
+static void closeCounters( Bench *bench )
+{
+#ifdef __linux__
+   int i;
+
+   for( i=0; i < COUNTER_NB; i++ )
+   {
+      if( bench->counterFd[i] >= 0 )
+         close( bench->counterFd[i] );
+      bench->counterFd[i] = -1;
+   }
+#else
+   (void)bench;
+#endif
+}
+
+static void startCounters( const Bench *bench )
+{
+#ifdef __linux__
+   int i;
+
+   for( i=0; i < COUNTER_NB; i++ )
+   {
+      if( bench->counterFd[i] >= 0 )
+      {
+         ioctl( bench->counterFd[i], PERF_EVENT_IOC_RESET, 0 );
+         ioctl( bench->counterFd[i], PERF_EVENT_IOC_ENABLE, 0 );
+      }
+   }
+#else
+   (void)bench;
+#endif
+}
+
+static void stopCounters( const Bench *bench, double nbBar, Measure *measure )
+{
+   int i;
+#ifdef __linux__
+   unsigned long long value[3]; /* Count, time enabled, time running. */
+
+   for( i=0; i < COUNTER_NB; i++ )
+   {
+      measure->counter[i] = -1.0;
+      if( bench->counterFd[i] < 0 )
+         continue;
+
+      ioctl( bench->counterFd[i], PERF_EVENT_IOC_DISABLE, 0 );
+      if( (read( bench->counterFd[i], value, sizeof(value) ) == (ssize_t)sizeof(value)) &&
+          (value[2] != 0) && (nbBar > 0.0) )
+      {
+         measure->counter[i] = (double)value[0]*((double)value[1]/(double)value[2])/nbBar;
+      }
+   }
+#else
+   (void)bench;
+   (void)nbBar;
+   for( i=0; i < COUNTER_NB; i++ )
+      measure->counter[i] = -1.0;
+#endif
+}
+
+/* Comma separated (CSV) or "counters" object (JSON), empty
+ * or null when not counted.
+ */
+static void writeCounters( FILE *file, const Measure *measure, int isJson )
+{
+   double ipc;
+   int i;
+
+   ipc = -1.0;
+   if( (measure->counter[COUNTER_CYCLES] > 0.0) && (measure->counter[COUNTER_INSTRUCTIONS] >= 0.0) )
+      ipc = measure->counter[COUNTER_INSTRUCTIONS]/measure->counter[COUNTER_CYCLES];
+
+   if( isJson )
+   {
+      fprintf( file, ", \"counters\": { \"ipc\": " );
+      if( ipc >= 0.0 )
+         fprintf( file, "%.3f", ipc );
+      else
+         fprintf( file, "null" );
+
+      for( i=0; i < COUNTER_NB; i++ )
+      {
+         fprintf( file, ", \"%s_per_bar\": ", counterName[i] );
+         if( measure->counter[i] >= 0.0 )
+            fprintf( file, "%.4f", measure->counter[i] );
+         else
+            fprintf( file, "null" );
+      }
+      fprintf( file, " }" );
+   }
+   else
+   {
+      fprintf( file, "," );
+      if( ipc >= 0.0 )
+         fprintf( file, "%.3f", ipc );
+
+      for( i=0; i < COUNTER_NB; i++ )
+      {
+         fprintf( file, "," );
+         if( measure->counter[i] >= 0.0 )
+            fprintf( file, "%.4f", measure->counter[i] );
+      }
+   }
+}
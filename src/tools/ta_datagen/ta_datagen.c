@@ -0,0 +1,560 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ */
+
+/* Description:
+ *    Synthetic market data for ta_regtest and ta_bench (see
+ *    ta_datagen.h).
+ *
+ *    The random numbers come from a xorshift64* generator and the
+ *    Box-Muller transform, both fully specified here, so the bars do
+ *    not depend on the rand() of the platform.
+ *
+ *    A random number is drawn only for the features in use: adding a
+ *    feature changes the bars, but the bars of the additive models
+ *    without anomaly stay the ones ta_bench always used.
+ */
+
+/**** Headers ****/
+#if !defined(WIN32) && !defined(_POSIX_C_SOURCE)
+   #define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef WIN32
+   #include <windows.h>
+#else
+   #include <fcntl.h>
+   #include <unistd.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+#endif
+
+#include "ta_datagen.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#ifndef NAN
+   #define NAN (0.0/0.0)
+#endif
+
+#define DATAGEN_FILE_MAGIC  0x4E474454 /* "TDGN" */
+#define DATAGEN_HEADER_SIZE 256        /* Keep the bars 64 bytes aligned. */
+
+typedef struct
+{
+   unsigned int    magic;
+   int             nbBar;
+   TA_DataGenParam param;
+} DataGenHeader;
+
+typedef struct
+{
+   void  *base;
+   size_t size;
+#ifdef WIN32
+   HANDLE file;
+   HANDLE mapping;
+#else
+   int    file;
+#endif
+} DataGenMapping;
+
+typedef struct
+{
+   unsigned long long randomState;
+   TA_Real prevClose;
+   int     volatileRegime;
+   int     nanLeft;
+   int     constantLeft;
+} DataGenState;
+
+/**** Local functions declarations.    ****/
+static void generateBar( const TA_DataGenParam *param, DataGenState *state,
+                         int nbBar, int i, TA_Real bar[5] );
+static double randomUniform( DataGenState *state );
+static double randomGaussian( DataGenState *state );
+static int isValidParam( const TA_DataGenParam *param );
+static int isSameParam( const TA_DataGenParam *param1,
+                        const TA_DataGenParam *param2 );
+static int mapFile( const char *fileName, size_t size,
+                    DataGenMapping *mapping, int *isNewFile );
+static void unmapFile( DataGenMapping *mapping );
+
+/**** Local variables definitions.     ****/
+static const char *modelName[TA_DATAGEN_NB_MODEL] =
+{
+   "trending",
+   "mean_reverting",
+   "random_walk",
+   "constant",
+   "descending",
+   "gbm",
+   "jump_diffusion",
+   "regime_switching"
+};
+
+/**** Global functions definitions.   ****/
+void TA_DataGenDefault( TA_DataGenParam *param, TA_DataGenModel model )
+{
+   memset( param, 0, sizeof(TA_DataGenParam) );
+
+   param->model      = model;
+   param->seed       = 0x9E3779B97F4A7C15ULL + (unsigned long long)model;
+   param->startPrice = 100.0;
+
+   switch( model )
+   {
+   case TA_DATAGEN_TRENDING:
+      param->drift      = 0.05;
+      param->volatility = 0.5;
+      break;
+   case TA_DATAGEN_MEAN_REVERTING:
+      /* Fraction of the distance to startPrice recovered at each bar. */
+      param->drift      = 0.1;
+      param->volatility = 1.0;
+      break;
+   case TA_DATAGEN_RANDOM_WALK:
+      param->volatility = 1.0;
+      break;
+   case TA_DATAGEN_GBM:
+   case TA_DATAGEN_JUMP_DIFFUSION:
+   case TA_DATAGEN_REGIME_SWITCHING:
+      param->drift      = 0.0002;
+      param->volatility = 0.01;
+      break;
+   default:
+      break;
+   }
+
+   param->jumpProb          = 0.01;
+   param->jumpMean          = -0.02;
+   param->jumpStdDev        = 0.05;
+   param->regimeSwitchProb  = 0.005;
+   param->regimeVolFactor   = 3.0;
+   param->gapStdDev         = 0.02;
+   param->nanHoleLength     = 10;
+   param->constantRunLength = 50;
+}
+
+int TA_DataGenerate( const TA_DataGenParam *param,
+                     int      nbBar,
+                     TA_Real *open,
+                     TA_Real *high,
+                     TA_Real *low,
+                     TA_Real *close,
+                     TA_Real *volume )
+{
+   DataGenState state;
+   TA_Real bar[5];
+   int i;
+
+   if( !param || (nbBar < 0) || !isValidParam( param ) )
+      return 0;
+
+   memset( &state, 0, sizeof(state) );
+   state.randomState = param->seed? param->seed : 1; /* Never zero. */
+   state.prevClose   = param->startPrice;
+
+   for( i=0; i < nbBar; i++ )
+   {
+      generateBar( param, &state, nbBar, i, bar );
+      if( open )   open[i]   = bar[0];
+      if( high )   high[i]   = bar[1];
+      if( low )    low[i]    = bar[2];
+      if( close )  close[i]  = bar[3];
+      if( volume ) volume[i] = bar[4];
+   }
+
+   return 1;
+}
+
+int TA_DataGenMapFile( const char *fileName,
+                       const TA_DataGenParam *param,
+                       int nbBar,
+                       TA_DataGenSeries *series )
+{
+   DataGenMapping *mapping;
+   DataGenHeader *header;
+   TA_Real *bars;
+   int isNewFile;
+
+   if( !series )
+      return 0;
+   memset( series, 0, sizeof(TA_DataGenSeries) );
+
+   if( !fileName || !param || (nbBar < 0) || !isValidParam( param ) )
+      return 0;
+
+   mapping = (DataGenMapping *)malloc( sizeof(DataGenMapping) );
+   if( !mapping )
+      return 0;
+
+   if( !mapFile( fileName, DATAGEN_HEADER_SIZE + 5*sizeof(TA_Real)*(size_t)nbBar,
+                 mapping, &isNewFile ) )
+   {
+      free( mapping );
+      return 0;
+   }
+
+   header = (DataGenHeader *)mapping->base;
+   bars   = (TA_Real *)((char *)mapping->base + DATAGEN_HEADER_SIZE);
+
+   series->nbBar      = nbBar;
+   series->open       = bars;
+   series->high       = bars + nbBar;
+   series->low        = bars + 2*(size_t)nbBar;
+   series->close      = bars + 3*(size_t)nbBar;
+   series->volume     = bars + 4*(size_t)nbBar;
+   series->hiddenData = mapping;
+
+   if( isNewFile ||
+       (header->magic != DATAGEN_FILE_MAGIC) ||
+       (header->nbBar != nbBar) ||
+       !isSameParam( &header->param, param ) )
+   {
+      /* The magic number is written last, an interrupted generation
+       * is done again next time.
+       */
+      header->magic = 0;
+      TA_DataGenerate( param, nbBar, series->open, series->high,
+                       series->low, series->close, series->volume );
+      header->nbBar = nbBar;
+      header->param = *param;
+      header->magic = DATAGEN_FILE_MAGIC;
+   }
+
+   return 1;
+}
+
+void TA_DataGenUnmapFile( TA_DataGenSeries *series )
+{
+   if( series && series->hiddenData )
+   {
+      unmapFile( (DataGenMapping *)series->hiddenData );
+      free( series->hiddenData );
+      memset( series, 0, sizeof(TA_DataGenSeries) );
+   }
+}
+
+const char *TA_DataGenModelName( TA_DataGenModel model )
+{
+   if( ((int)model < 0) || (model >= TA_DATAGEN_NB_MODEL) )
+      return "";
+
+   return modelName[model];
+}
+
+TA_DataGenModel TA_DataGenFindModel( const char *name )
+{
+   int i;
+
+   for( i=0; i < TA_DATAGEN_NB_MODEL; i++ )
+   {
+      if( name && (strcmp( name, modelName[i] ) == 0) )
+         return (TA_DataGenModel)i;
+   }
+
+   return TA_DATAGEN_NB_MODEL;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Bar 'i' of 'nbBar' as open, high, low, close and volume. */
+static void generateBar( const TA_DataGenParam *param, DataGenState *state,
+                         int nbBar, int i, TA_Real bar[5] )
+{
+   TA_Real open, close, range, sigma, logReturn, x;
+   int isMultiplicative, isNaN, sessionBar;
+
+   isMultiplicative = (param->model >= TA_DATAGEN_GBM);
+   sessionBar = (param->barsPerSession > 0)? i % param->barsPerSession : -1;
+
+   /* Open at the previous close, unless the session opens with a gap. */
+   open = state->prevClose;
+   if( (sessionBar == 0) && (i > 0) && (param->gapProb > 0.0) &&
+       (randomUniform( state ) < param->gapProb) )
+      open *= exp( param->gapStdDev*randomGaussian( state ) );
+
+   if( (state->nanLeft == 0) && (param->nanHoleProb > 0.0) &&
+       (randomUniform( state ) < param->nanHoleProb) )
+      state->nanLeft = param->nanHoleLength;
+
+   if( (state->constantLeft == 0) && (param->constantRunProb > 0.0) &&
+       (randomUniform( state ) < param->constantRunProb) )
+      state->constantLeft = param->constantRunLength;
+
+   sigma = param->volatility;
+   if( state->constantLeft > 0 )
+   {
+      state->constantLeft--;
+      close = open;
+      range = 0.0;
+   }
+   else if( isMultiplicative )
+   {
+      if( (param->model == TA_DATAGEN_REGIME_SWITCHING) &&
+          (randomUniform( state ) < param->regimeSwitchProb) )
+         state->volatileRegime = !state->volatileRegime;
+
+      if( state->volatileRegime )
+         sigma *= param->regimeVolFactor;
+
+      logReturn = param->drift - 0.5*sigma*sigma + sigma*randomGaussian( state );
+      if( (param->model == TA_DATAGEN_JUMP_DIFFUSION) &&
+          (randomUniform( state ) < param->jumpProb) )
+         logReturn += param->jumpMean + param->jumpStdDev*randomGaussian( state );
+
+      close = open*exp( logReturn );
+      range = 0.5*sigma*fabs( randomGaussian( state ) );
+   }
+   else
+   {
+      switch( param->model )
+      {
+      case TA_DATAGEN_TRENDING:
+      case TA_DATAGEN_RANDOM_WALK:
+         close = open + param->drift + param->volatility*randomGaussian( state );
+         break;
+      case TA_DATAGEN_MEAN_REVERTING:
+         close = open + param->drift*(param->startPrice-open) + param->volatility*randomGaussian( state );
+         break;
+      case TA_DATAGEN_DESCENDING:
+         /* The highest value is always the oldest of the period. */
+         close = 1.0 + (TA_Real)(nbBar-i);
+         break;
+      default:
+         close = param->startPrice;
+         break;
+      }
+
+      /* Keep the prices positive (LN, LOG10 etc.). */
+      if( close < 1.0 )
+         close = 2.0 - close;
+
+      if( (param->model == TA_DATAGEN_CONSTANT) || (param->model == TA_DATAGEN_DESCENDING) )
+         range = 0.0;
+      else
+         range = 0.25*fabs( randomGaussian( state ) );
+   }
+
+   bar[0] = open;
+   bar[3] = close;
+   if( isMultiplicative )
+   {
+      bar[1] = (open > close? open : close)*exp( range );
+      bar[2] = (open < close? open : close)*exp( -range );
+   }
+   else
+   {
+      bar[1] = (open > close? open : close) + range;
+      bar[2] = (open < close? open : close) - range;
+   }
+
+   if( param->model == TA_DATAGEN_CONSTANT )
+      bar[4] = 1000.0;
+   else
+      bar[4] = 1000.0 + 100.0*fabs( randomGaussian( state ) );
+
+   /* U-shaped intraday volume: 3 times more at the open and close. */
+   if( (sessionBar >= 0) && (param->barsPerSession > 1) )
+   {
+      x = (TA_Real)sessionBar/(TA_Real)(param->barsPerSession-1) - 0.5;
+      bar[4] *= 1.0 + 8.0*x*x;
+   }
+
+   state->prevClose = close;
+
+   /* The path goes on under a hole. */
+   isNaN = (state->nanLeft > 0);
+   if( isNaN )
+   {
+      state->nanLeft--;
+      bar[0] = bar[1] = bar[2] = bar[3] = bar[4] = NAN;
+   }
+}
+
+static double randomUniform( DataGenState *state )
+{
+   /* xorshift64*, in ]0,1[ */
+   state->randomState ^= state->randomState >> 12;
+   state->randomState ^= state->randomState << 25;
+   state->randomState ^= state->randomState >> 27;
+   return ((double)((state->randomState * 0x2545F4914F6CDD1DULL) >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static double randomGaussian( DataGenState *state )
+{
+   /* Box-Muller. */
+   return sqrt( -2.0*log( randomUniform( state ) ) ) * cos( 6.283185307179586*randomUniform( state ) );
+}
+
+static int isValidParam( const TA_DataGenParam *param )
+{
+   if( ((int)param->model < 0) || (param->model >= TA_DATAGEN_NB_MODEL) )
+      return 0;
+
+   if( !(param->startPrice > 0.0) || !(param->volatility >= 0.0) ||
+       (param->barsPerSession < 0) ||
+       (param->nanHoleLength < 0) || (param->constantRunLength < 0) )
+      return 0;
+
+   return 1;
+}
+
+static int isSameParam( const TA_DataGenParam *param1,
+                        const TA_DataGenParam *param2 )
+{
+   /* Field by field, the padding is undefined. */
+   return (param1->model             == param2->model) &&
+          (param1->seed              == param2->seed) &&
+          (param1->startPrice        == param2->startPrice) &&
+          (param1->drift             == param2->drift) &&
+          (param1->volatility        == param2->volatility) &&
+          (param1->jumpProb          == param2->jumpProb) &&
+          (param1->jumpMean          == param2->jumpMean) &&
+          (param1->jumpStdDev        == param2->jumpStdDev) &&
+          (param1->regimeSwitchProb  == param2->regimeSwitchProb) &&
+          (param1->regimeVolFactor   == param2->regimeVolFactor) &&
+          (param1->barsPerSession    == param2->barsPerSession) &&
+          (param1->gapProb           == param2->gapProb) &&
+          (param1->gapStdDev         == param2->gapStdDev) &&
+          (param1->nanHoleProb       == param2->nanHoleProb) &&
+          (param1->nanHoleLength     == param2->nanHoleLength) &&
+          (param1->constantRunProb   == param2->constantRunProb) &&
+          (param1->constantRunLength == param2->constantRunLength);
+}
+
+#ifdef WIN32
+static int mapFile( const char *fileName, size_t size,
+                    DataGenMapping *mapping, int *isNewFile )
+{
+   LARGE_INTEGER fileSize;
+
+   mapping->size = size;
+   mapping->file = CreateFileA( fileName, GENERIC_READ|GENERIC_WRITE, FILE_SHARE_READ,
+                                NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL );
+   if( mapping->file == INVALID_HANDLE_VALUE )
+      return 0;
+
+   *isNewFile = !GetFileSizeEx( mapping->file, &fileSize ) ||
+                ((unsigned long long)fileSize.QuadPart != (unsigned long long)size);
+
+   /* Also sets the size of the file. */
+   mapping->mapping = CreateFileMappingA( mapping->file, NULL, PAGE_READWRITE,
+                                          (DWORD)((unsigned long long)size >> 32),
+                                          (DWORD)(size & 0xFFFFFFFF), NULL );
+   if( !mapping->mapping )
+   {
+      CloseHandle( mapping->file );
+      return 0;
+   }
+
+   mapping->base = MapViewOfFile( mapping->mapping, FILE_MAP_ALL_ACCESS, 0, 0, size );
+   if( !mapping->base )
+   {
+      CloseHandle( mapping->mapping );
+      CloseHandle( mapping->file );
+      return 0;
+   }
+
+   return 1;
+}
+
+static void unmapFile( DataGenMapping *mapping )
+{
+   UnmapViewOfFile( mapping->base );
+   CloseHandle( mapping->mapping );
+   CloseHandle( mapping->file );
+}
+#else
+static int mapFile( const char *fileName, size_t size,
+                    DataGenMapping *mapping, int *isNewFile )
+{
+   struct stat fileStat;
+
+   mapping->size = size;
+   mapping->file = open( fileName, O_RDWR|O_CREAT, 0644 );
+   if( mapping->file < 0 )
+      return 0;
+
+   *isNewFile = (fstat( mapping->file, &fileStat ) != 0) ||
+                ((size_t)fileStat.st_size != size);
+
+   if( *isNewFile && (ftruncate( mapping->file, (off_t)size ) != 0) )
+   {
+      close( mapping->file );
+      return 0;
+   }
+
+   mapping->base = mmap( NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, mapping->file, 0 );
+   if( mapping->base == MAP_FAILED )
+   {
+      close( mapping->file );
+      return 0;
+   }
+
+   return 1;
+}
+
+static void unmapFile( DataGenMapping *mapping )
+{
+   munmap( mapping->base, mapping->size );
+   close( mapping->file );
+}
+#endif
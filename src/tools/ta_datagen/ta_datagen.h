@@ -0,0 +1,163 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_DATAGEN_H
+#define TA_DATAGEN_H
+
+/* Synthetic market data, for the tests and the benchmarks.
+ *
+ * The same parameters (including the seed) always produce the same
+ * bars, on every platform, so a failure or a measurement can be
+ * reproduced. The bars are written directly into the caller buffers,
+ * or into a file mapped in memory for the series too large to be
+ * generated at every run.
+ *
+ * Example:
+ *     TA_DataGenParam param;
+ *
+ *     TA_DataGenDefault( &param, TA_DATAGEN_JUMP_DIFFUSION );
+ *     param.seed = 1234;
+ *     param.barsPerSession = 390;  <- One minute bars, with gaps.
+ *     param.gapProb = 0.5;
+ *     TA_DataGenerate( &param, nbBar, open, high, low, close, volume );
+ */
+
+#ifndef TA_LIBC_H
+   #include "ta_libc.h"
+#endif
+
+typedef enum
+{
+   /* Additive models, the price moves by about 1.0 per bar. */
+   TA_DATAGEN_TRENDING,
+   TA_DATAGEN_MEAN_REVERTING,   /* Pulled toward startPrice. */
+   TA_DATAGEN_RANDOM_WALK,
+   TA_DATAGEN_CONSTANT,         /* Every price is startPrice. */
+   TA_DATAGEN_DESCENDING,       /* A new low at every bar. */
+
+   /* Multiplicative models, 'drift' and 'volatility' are for the
+    * logarithm of the price.
+    */
+   TA_DATAGEN_GBM,              /* Geometric brownian motion. */
+   TA_DATAGEN_JUMP_DIFFUSION,   /* GBM with random jumps (Merton). */
+   TA_DATAGEN_REGIME_SWITCHING, /* GBM alternating calm/volatile regimes. */
+
+   TA_DATAGEN_NB_MODEL
+} TA_DataGenModel;
+
+typedef struct
+{
+   TA_DataGenModel model;
+   unsigned long long seed;
+
+   double startPrice;
+   double drift;      /* Per bar. */
+   double volatility; /* Per bar. */
+
+   /* TA_DATAGEN_JUMP_DIFFUSION: probability of a jump at each bar
+    * and normal distribution of the jumps (in log).
+    */
+   double jumpProb;
+   double jumpMean;
+   double jumpStdDev;
+
+   /* TA_DATAGEN_REGIME_SWITCHING: probability of changing regime at
+    * each bar, and volatility multiplier of the volatile regime.
+    */
+   double regimeSwitchProb;
+   double regimeVolFactor;
+
+   /* Intraday bars when not zero: the volume follows a U-shape over
+    * each session, and a session may open with a gap from the
+    * previous close (normal distribution in log).
+    */
+   int    barsPerSession;
+   double gapProb;
+   double gapStdDev;
+
+   /* Anomalies: at each bar, the probability to start a run of NaN
+    * (all the fields) or a run of constant prices (zero range).
+    */
+   double nanHoleProb;
+   int    nanHoleLength;
+   double constantRunProb;
+   int    constantRunLength;
+} TA_DataGenParam;
+
+/* Bars in a file mapped in memory. */
+typedef struct
+{
+   int nbBar;
+   TA_Real *open;
+   TA_Real *high;
+   TA_Real *low;
+   TA_Real *close;
+   TA_Real *volume;
+
+   void *hiddenData;
+} TA_DataGenSeries;
+
+/* Default parameters for a model (no gap and no anomaly). */
+void TA_DataGenDefault( TA_DataGenParam *param, TA_DataGenModel model );
+
+/* Write nbBar bars. Any of the outputs can be NULL. Return 0 when
+ * the parameters are invalid.
+ */
+int TA_DataGenerate( const TA_DataGenParam *param,
+                     int      nbBar,
+                     TA_Real *open,
+                     TA_Real *high,
+                     TA_Real *low,
+                     TA_Real *close,
+                     TA_Real *volume );
+
+/* Map the file with the bars of these parameters, the bars are first
+ * generated when the file does not exist or was made with different
+ * parameters. Return 0 on failure.
+ *
+ * TA_DataGenUnmapFile must be called once the bars are no longer
+ * needed. The file is kept for the next time.
+ */
+int  TA_DataGenMapFile  ( const char *fileName,
+                          const TA_DataGenParam *param,
+                          int nbBar,
+                          TA_DataGenSeries *series );
+void TA_DataGenUnmapFile( TA_DataGenSeries *series );
+
+/* Name of a model ("gbm", "jump_diffusion" etc.), and the reverse.
+ * TA_DataGenFindModel returns TA_DATAGEN_NB_MODEL when not found.
+ */
+const char *TA_DataGenModelName( TA_DataGenModel model );
+TA_DataGenModel TA_DataGenFindModel( const char *name );
+
+#endif
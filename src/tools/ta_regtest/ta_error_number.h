@@ -223,6 +223,34 @@ typedef enum
   TA_ABS_TST_FAIL_STARTEND_ZERO         = 617,
   TA_ABS_TST_FAIL_FUNCTION_DESC_SMALL   = 618,
   TA_ABS_TST_FAIL_FUNCTION_DESC_LARGE   = 619,
+  TA_ABS_TST_FAIL_PARALLEL_CALL         = 620,
+  TA_ABS_TST_FAIL_PARALLEL_RANGE        = 621,
+  TA_ABS_TST_FAIL_PARALLEL_VALUE        = 622,
+  TA_ABS_TST_FAIL_SCRATCH_CALL          = 623,
+  TA_ABS_TST_FAIL_SCRATCH_ALLOC         = 624,
+  TA_ABS_TST_FAIL_SCRATCH_VALUE         = 625,
+  TA_ABS_TST_FAIL_NAME_LOOKUP           = 626,
+  TA_ABS_TST_FAIL_CACHED_TABLE          = 627,
+  TA_ABS_TST_FAIL_PARAM_HOLDER_INIT     = 628,
+  TA_ABS_TST_FAIL_PARAM_HOLDER_CLONE    = 629,
+  TA_ABS_TST_FAIL_STRIDED_CALL          = 630,
+  TA_ABS_TST_FAIL_STRIDED_VALUE         = 631,
+  TA_ABS_TST_FAIL_PLAN_CALL             = 632,
+  TA_ABS_TST_FAIL_PLAN_VALUE            = 633,
+  TA_ABS_TST_FAIL_PLAN_STATS            = 634,
+  TA_ABS_TST_FAIL_BATCH_CALL            = 635,
+  TA_ABS_TST_FAIL_BATCH_VALUE           = 636,
+  TA_ABS_TST_FAIL_CALL64                = 637,
+  TA_ABS_TST_FAIL_CALL64_VALUE          = 638,
+  TA_ABS_TST_FAIL_ALLOC_OUTPUT          = 639,
+  TA_ABS_TST_FAIL_ALLOC_OUTPUT_VALUE    = 640,
+  TA_ABS_TST_FAIL_META                  = 641,
+  TA_ABS_TST_FAIL_META_LOOKBACK         = 642,
+  TA_ABS_TST_FAIL_STATS                 = 643,
+  TA_ABS_TST_FAIL_STATS_COUNT           = 644,
+  TA_ABS_TST_FAIL_TRACE                 = 645,
+  TA_ABS_TST_FAIL_TRACE_EVENT           = 646,
+  TA_ABS_TST_FAIL_STRICT_ALLOC          = 647,
 
   /* Error code related to internal tests. */
   TA_INTERNAL_CIRC_BUFF_FAIL_0      = 700,
@@ -237,6 +265,10 @@ typedef enum
   TA_INTERNAL_TIMESTAMP_TEST_FAILED = 709,
   TA_INTERNAL_PSEUDORANDOM_UINT32   = 710,
   TA_INTERNAL_PSEUDORANDOM_DOUBLE   = 711,
+  TA_INTERNAL_CONTEXT_BAD_PARAM     = 712,
+  TA_INTERNAL_CONTEXT_CALL_FAILED   = 713,
+  TA_INTERNAL_CONTEXT_BAD_VALUE     = 714,
+  TA_INTERNAL_CONTEXT_THREAD_POOL   = 715,
 
   /* Error code related to CSI data source tests. */
   TA_CSI_ADDDATASOURCE_FAILED    = 800,
@@ -281,6 +313,34 @@ typedef enum
   TA_TEST_FAIL_BUG1359452_4  = 2004,
   TA_TEST_FAIL_BUG1359452_5  = 2005,
 
+  /* Error code for test in test_panel.c */
+  TA_PANEL_TST_BAD_PARAM     = 2100,
+  TA_PANEL_TST_CALL_FAILED   = 2101,
+  TA_PANEL_TST_BAD_RANGE     = 2102,
+  TA_PANEL_TST_BAD_VALUE     = 2103,
+  TA_PANEL_TST_THREAD_POOL   = 2104,
+
+  /* Error code for test in test_bundle.c */
+  TA_BUNDLE_TST_BAD_PARAM    = 2200,
+  TA_BUNDLE_TST_CALL_FAILED  = 2201,
+  TA_BUNDLE_TST_BAD_RANGE    = 2202,
+  TA_BUNDLE_TST_BAD_VALUE    = 2203,
+
+  /* Error code for test in test_large.c */
+  TA_LARGE_TST_BAD_PARAM     = 2300,
+  TA_LARGE_TST_CALL_FAILED   = 2301,
+  TA_LARGE_TST_BAD_RANGE     = 2302,
+  TA_LARGE_TST_BAD_VALUE     = 2303,
+  TA_LARGE_TST_DATAGEN       = 2304,
+  TA_LARGE_TST_MAP_FILE      = 2305,
+
+  /* Error code for test in test_diff.c */
+  TA_DIFF_TST_BAD_PARAM      = 2400,
+  TA_DIFF_TST_CALL_FAILED    = 2401,
+  TA_DIFF_TST_REF_FAILED     = 2402,
+  TA_DIFF_TST_BAD_RANGE      = 2403,
+  TA_DIFF_TST_BAD_VALUE      = 2404,
+
   TA_LAST_VALID_ERROR = 0xFFFF
 } ErrorNumber;
 #endif
@@ -0,0 +1,906 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Frozen copies of the scalar implementations of the functions
+ *     having optimized variants (panel, sweep, bundle, plan, parallel
+ *     chunks) or being candidates for an optimized rewrite.
+ *
+ *     The arithmetic is kept in the same order as in the original
+ *     functions, so the results are identical to the bit. When a
+ *     function of the library is rewritten, the code here must NOT be
+ *     changed: test_diff.c compares the new code against it.
+ *
+ *     The parameters are not validated (test_diff.c passes only
+ *     valid ones), and the inputs are always double.
+ */
+
+/**** Headers ****/
+#include <stdlib.h>
+#include <math.h>
+
+#include "ta_ref.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+/* None */
+
+/**** Local functions declarations.    ****/
+static TA_RetCode refEMA( int startIdx, int endIdx, const double inReal[],
+                          int optInTimePeriod, double optInK_1,
+                          int *outBegIdx, int *outNBElement, double outReal[] );
+
+static void refStdDevUsingPrecalcMA( const double inReal[],
+                                     const double inMovAvg[],
+                                     int inMovAvgBegIdx,
+                                     int inMovAvgNbElement,
+                                     int timePeriod,
+                                     double output[] );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_REF_SMA( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   lookbackTotal = (optInTimePeriod-1);
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   *outNBElement = outIdx;
+   *outBegIdx    = startIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_EMA( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   return refEMA( startIdx, endIdx, inReal, optInTimePeriod,
+                  PER_TO_K( optInTimePeriod ),
+                  outBegIdx, outNBElement, outReal );
+}
+
+TA_RetCode TA_REF_RSI( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   int outIdx, today, lookbackTotal, unstablePeriod, i;
+   double prevGain, prevLoss, prevValue, savePrevValue;
+   double tempValue1, tempValue2;
+
+   *outBegIdx = 0;
+   *outNBElement = 0;
+
+   unstablePeriod = (int)TA_GetUnstablePeriod( TA_FUNC_UNST_RSI );
+   lookbackTotal = optInTimePeriod + unstablePeriod;
+   if( TA_GetCompatibility() == TA_COMPATIBILITY_METASTOCK )
+      lookbackTotal--;
+
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   outIdx = 0;
+
+   if( optInTimePeriod == 1 )
+   {
+      *outBegIdx = startIdx;
+      i = (endIdx-startIdx)+1;
+      *outNBElement = i;
+      for( outIdx=0; outIdx < i; outIdx++ )
+         outReal[outIdx] = inReal[startIdx+outIdx];
+      return TA_SUCCESS;
+   }
+
+   today = startIdx-lookbackTotal;
+   prevValue = inReal[today];
+
+   /* The additional first output of Metastock. */
+   if( (unstablePeriod == 0) &&
+       (TA_GetCompatibility() == TA_COMPATIBILITY_METASTOCK) )
+   {
+      savePrevValue = prevValue;
+      prevGain = 0.0;
+      prevLoss = 0.0;
+      for( i=optInTimePeriod; i > 0; i-- )
+      {
+         tempValue1 = inReal[today++];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+      }
+
+      tempValue1 = prevLoss/optInTimePeriod;
+      tempValue2 = prevGain/optInTimePeriod;
+      tempValue1 = tempValue2+tempValue1;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100*(tempValue2/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+
+      if( today > endIdx )
+      {
+         *outBegIdx    = startIdx;
+         *outNBElement = outIdx;
+         return TA_SUCCESS;
+      }
+
+      today -= optInTimePeriod;
+      prevValue = savePrevValue;
+   }
+
+   prevGain = 0.0;
+   prevLoss = 0.0;
+   today++;
+   for( i=optInTimePeriod; i > 0; i-- )
+   {
+      tempValue1 = inReal[today++];
+      tempValue2 = tempValue1 - prevValue;
+      prevValue  = tempValue1;
+      if( tempValue2 < 0 )
+         prevLoss -= tempValue2;
+      else
+         prevGain += tempValue2;
+   }
+
+   prevLoss /= optInTimePeriod;
+   prevGain /= optInTimePeriod;
+
+   if( today > startIdx )
+   {
+      tempValue1 = prevGain+prevLoss;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100.0*(prevGain/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+   }
+   else
+   {
+      /* Skip the unstable period. */
+      while( today < startIdx )
+      {
+         tempValue1 = inReal[today];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+
+         prevLoss *= (optInTimePeriod-1);
+         prevGain *= (optInTimePeriod-1);
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+
+         prevLoss /= optInTimePeriod;
+         prevGain /= optInTimePeriod;
+
+         today++;
+      }
+   }
+
+   while( today <= endIdx )
+   {
+      tempValue1 = inReal[today++];
+      tempValue2 = tempValue1 - prevValue;
+      prevValue  = tempValue1;
+
+      prevLoss *= (optInTimePeriod-1);
+      prevGain *= (optInTimePeriod-1);
+      if( tempValue2 < 0 )
+         prevLoss -= tempValue2;
+      else
+         prevGain += tempValue2;
+
+      prevLoss /= optInTimePeriod;
+      prevGain /= optInTimePeriod;
+      tempValue1 = prevGain+prevLoss;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100.0*(prevGain/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_VAR( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod, double optInNbDev,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double tempReal, periodTotal1, periodTotal2, meanValue1, meanValue2;
+   int i, outIdx, trailingIdx, nbInitialElementNeeded;
+
+   (void)optInNbDev;
+
+   nbInitialElementNeeded = (optInTimePeriod-1);
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   periodTotal1 = 0;
+   periodTotal2 = 0;
+   trailingIdx = startIdx-nbInitialElementNeeded;
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx ) {
+         tempReal = inReal[i++];
+         periodTotal1 += tempReal;
+         tempReal *= tempReal;
+         periodTotal2 += tempReal;
+      }
+   }
+
+   outIdx = 0;
+   do
+   {
+      tempReal = inReal[i++];
+      periodTotal1 += tempReal;
+      tempReal *= tempReal;
+      periodTotal2 += tempReal;
+
+      meanValue1 = periodTotal1 / optInTimePeriod;
+      meanValue2 = periodTotal2 / optInTimePeriod;
+
+      tempReal = inReal[trailingIdx++];
+      periodTotal1 -= tempReal;
+      tempReal *= tempReal;
+      periodTotal2 -= tempReal;
+
+      outReal[outIdx++] = meanValue2-meanValue1*meanValue1;
+   } while( i <= endIdx );
+
+   *outNBElement = outIdx;
+   *outBegIdx = startIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_STDDEV( int startIdx, int endIdx, const double inReal[],
+                          int optInTimePeriod, double optInNbDev,
+                          int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double tempReal;
+   int i;
+
+   TA_REF_VAR( startIdx, endIdx, inReal, optInTimePeriod, 1.0,
+               outBegIdx, outNBElement, outReal );
+
+   if( optInNbDev != 1.0 )
+   {
+      for( i=0; i < *outNBElement; i++ )
+      {
+         tempReal = outReal[i];
+         if( !TA_IS_ZERO_OR_NEG(tempReal) )
+            outReal[i] = sqrt(tempReal) * optInNbDev;
+         else
+            outReal[i] = (double)0.0;
+      }
+   }
+   else
+   {
+      for( i=0; i < *outNBElement; i++ )
+      {
+         tempReal = outReal[i];
+         if( !TA_IS_ZERO_OR_NEG(tempReal) )
+            outReal[i] = sqrt(tempReal);
+         else
+            outReal[i] = (double)0.0;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_BBANDS( int startIdx, int endIdx, const double inReal[],
+                          int optInTimePeriod, double optInNbDevUp,
+                          double optInNbDevDn, TA_MAType optInMAType,
+                          int *outBegIdx, int *outNBElement,
+                          double outRealUpperBand[],
+                          double outRealMiddleBand[],
+                          double outRealLowerBand[] )
+{
+   double tempReal, tempReal2;
+   double *tempBuffer2;
+   int i;
+
+   /* The outputs must not overlap the input. */
+   tempBuffer2 = outRealUpperBand;
+
+   if( optInMAType == TA_MAType_SMA )
+   {
+      TA_REF_SMA( startIdx, endIdx, inReal, optInTimePeriod,
+                  outBegIdx, outNBElement, outRealMiddleBand );
+      if( *outNBElement == 0 )
+         return TA_SUCCESS;
+
+      refStdDevUsingPrecalcMA( inReal, outRealMiddleBand,
+                               *outBegIdx, *outNBElement,
+                               optInTimePeriod, tempBuffer2 );
+   }
+   else if( optInMAType == TA_MAType_EMA )
+   {
+      /* The MA of a period of 1 is the input itself. */
+      if( optInTimePeriod == 1 )
+         return TA_BAD_PARAM;
+
+      TA_REF_EMA( startIdx, endIdx, inReal, optInTimePeriod,
+                  outBegIdx, outNBElement, outRealMiddleBand );
+      if( *outNBElement == 0 )
+         return TA_SUCCESS;
+
+      TA_REF_STDDEV( *outBegIdx, endIdx, inReal, optInTimePeriod, 1.0,
+                     outBegIdx, outNBElement, tempBuffer2 );
+   }
+   else
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_BAD_PARAM;
+   }
+
+   if( optInNbDevUp == optInNbDevDn )
+   {
+      if(  optInNbDevUp == 1.0 )
+      {
+         for( i=0; i < *outNBElement; i++ )
+         {
+            tempReal  = tempBuffer2[i];
+            tempReal2 = outRealMiddleBand[i];
+            outRealUpperBand[i] = tempReal2 + tempReal;
+            outRealLowerBand[i] = tempReal2 - tempReal;
+         }
+      }
+      else
+      {
+         for( i=0; i < *outNBElement; i++ )
+         {
+            tempReal  = tempBuffer2[i] * optInNbDevUp;
+            tempReal2 = outRealMiddleBand[i];
+            outRealUpperBand[i] = tempReal2 + tempReal;
+            outRealLowerBand[i] = tempReal2 - tempReal;
+         }
+      }
+   }
+   else if( optInNbDevUp == 1.0 )
+   {
+      for( i=0; i < *outNBElement; i++ )
+      {
+         tempReal  = tempBuffer2[i];
+         tempReal2 = outRealMiddleBand[i];
+         outRealUpperBand[i] = tempReal2 + tempReal;
+         outRealLowerBand[i] = tempReal2 - (tempReal * optInNbDevDn);
+      }
+   }
+   else if( optInNbDevDn == 1.0 )
+   {
+      for( i=0; i < *outNBElement; i++ )
+      {
+         tempReal  = tempBuffer2[i];
+         tempReal2 = outRealMiddleBand[i];
+         outRealLowerBand[i] = tempReal2 - tempReal;
+         outRealUpperBand[i] = tempReal2 + (tempReal * optInNbDevUp);
+      }
+   }
+   else
+   {
+      for( i=0; i < *outNBElement; i++ )
+      {
+         tempReal  = tempBuffer2[i];
+         tempReal2 = outRealMiddleBand[i];
+         outRealUpperBand[i] = tempReal2 + (tempReal * optInNbDevUp);
+         outRealLowerBand[i] = tempReal2 - (tempReal * optInNbDevDn);
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_MACD( int startIdx, int endIdx, const double inReal[],
+                        int optInFastPeriod, int optInSlowPeriod,
+                        int optInSignalPeriod,
+                        int *outBegIdx, int *outNBElement,
+                        double outMACD[], double outMACDSignal[],
+                        double outMACDHist[] )
+{
+   double *slowEMABuffer, *fastEMABuffer;
+   double k1, k2;
+   int tempInteger, outBegIdx1, outNbElement1, outBegIdx2, outNbElement2;
+   int lookbackTotal, lookbackSignal, unstablePeriod;
+   int i;
+
+   *outBegIdx = 0;
+   *outNBElement = 0;
+
+   if( optInSlowPeriod < optInFastPeriod )
+   {
+       tempInteger     = optInSlowPeriod;
+       optInSlowPeriod = optInFastPeriod;
+       optInFastPeriod = tempInteger;
+   }
+
+   k1 = PER_TO_K(optInSlowPeriod);
+   k2 = PER_TO_K(optInFastPeriod);
+
+   unstablePeriod = (int)TA_GetUnstablePeriod( TA_FUNC_UNST_EMA );
+   lookbackSignal = optInSignalPeriod - 1 + unstablePeriod;
+   lookbackTotal  = lookbackSignal + optInSlowPeriod - 1 + unstablePeriod;
+
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   tempInteger = (endIdx-startIdx)+1+lookbackSignal;
+   fastEMABuffer = (double *)malloc( sizeof(double)*tempInteger );
+   slowEMABuffer = (double *)malloc( sizeof(double)*tempInteger );
+   if( !fastEMABuffer || !slowEMABuffer )
+   {
+      free( fastEMABuffer );
+      free( slowEMABuffer );
+      return TA_ALLOC_ERR;
+   }
+
+   tempInteger = startIdx-lookbackSignal;
+   refEMA( tempInteger, endIdx, inReal, optInSlowPeriod, k1,
+           &outBegIdx1, &outNbElement1, slowEMABuffer );
+   refEMA( tempInteger, endIdx, inReal, optInFastPeriod, k2,
+           &outBegIdx2, &outNbElement2, fastEMABuffer );
+
+   for( i=0; i < outNbElement1; i++ )
+      fastEMABuffer[i] = fastEMABuffer[i] - slowEMABuffer[i];
+
+   for( i=0; i < (endIdx-startIdx)+1; i++ )
+      outMACD[i] = fastEMABuffer[lookbackSignal+i];
+
+   refEMA( 0, outNbElement1-1, fastEMABuffer, optInSignalPeriod,
+           PER_TO_K(optInSignalPeriod),
+           &outBegIdx2, &outNbElement2, outMACDSignal );
+
+   free( fastEMABuffer );
+   free( slowEMABuffer );
+
+   for( i=0; i < outNbElement2; i++ )
+      outMACDHist[i] = outMACD[i]-outMACDSignal[i];
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outNbElement2;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_TRANGE( int startIdx, int endIdx, const double inHigh[],
+                          const double inLow[], const double inClose[],
+                          int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   int today, outIdx;
+   double val2, val3, greatest;
+   double tempCY, tempLT, tempHT;
+
+   if( startIdx < 1 )
+      startIdx = 1;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   outIdx = 0;
+   today = startIdx;
+   while( today <= endIdx )
+   {
+      tempLT = inLow[today];
+      tempHT = inHigh[today];
+      tempCY = inClose[today-1];
+      greatest = tempHT - tempLT;
+
+      val2 = fabs( tempCY - tempHT );
+      if( val2 > greatest )
+         greatest = val2;
+
+      val3 = fabs( tempCY - tempLT  );
+      if( val3 > greatest )
+         greatest = val3;
+
+      outReal[outIdx++] = greatest;
+      today++;
+   }
+
+   *outNBElement = outIdx;
+   *outBegIdx    = startIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_ATR( int startIdx, int endIdx, const double inHigh[],
+                       const double inLow[], const double inClose[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   int today, outIdx, lookbackTotal, nbATR;
+   int outBegIdx1, outNbElement1;
+   double prevATR, prevATRTemp[1];
+   double *tempBuffer;
+
+   *outBegIdx = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = optInTimePeriod + (int)TA_GetUnstablePeriod( TA_FUNC_UNST_ATR );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   if( optInTimePeriod <= 1 )
+      return TA_REF_TRANGE( startIdx, endIdx, inHigh, inLow, inClose,
+                            outBegIdx, outNBElement, outReal );
+
+   tempBuffer = (double *)malloc( sizeof(double)*(lookbackTotal+(endIdx-startIdx)+1) );
+   if( !tempBuffer )
+      return TA_ALLOC_ERR;
+
+   TA_REF_TRANGE( (startIdx-lookbackTotal+1), endIdx, inHigh, inLow, inClose,
+                  &outBegIdx1, &outNbElement1, tempBuffer );
+
+   /* The first ATR is the SMA of the first 'period' true ranges. */
+   TA_REF_SMA( optInTimePeriod-1, optInTimePeriod-1, tempBuffer, optInTimePeriod,
+               &outBegIdx1, &outNbElement1, prevATRTemp );
+   prevATR = prevATRTemp[0];
+
+   today = optInTimePeriod;
+   outIdx = (int)TA_GetUnstablePeriod( TA_FUNC_UNST_ATR );
+   while( outIdx != 0 )
+   {
+      prevATR *= optInTimePeriod - 1;
+      prevATR += tempBuffer[today++];
+      prevATR /= optInTimePeriod;
+      outIdx--;
+   }
+
+   outIdx = 1;
+   outReal[0] = prevATR;
+
+   nbATR = (endIdx - startIdx)+1;
+   while( --nbATR != 0 )
+   {
+      prevATR *= optInTimePeriod - 1;
+      prevATR += tempBuffer[today++];
+      prevATR /= optInTimePeriod;
+      outReal[outIdx++] = prevATR;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   free( tempBuffer );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_MAX( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double highest, tmp;
+   int outIdx, nbInitialElementNeeded;
+   int trailingIdx, today, i, highestIdx;
+
+   nbInitialElementNeeded = (optInTimePeriod-1);
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   outIdx = 0;
+   today       = startIdx;
+   trailingIdx = startIdx-nbInitialElementNeeded;
+   highestIdx  = -1;
+   highest     = 0.0;
+
+   while( today <= endIdx )
+   {
+      tmp = inReal[today];
+
+      if( highestIdx < trailingIdx )
+      {
+        highestIdx = trailingIdx;
+        highest = inReal[highestIdx];
+        i = highestIdx;
+        while( ++i<=today )
+        {
+           tmp = inReal[i];
+           if( tmp > highest )
+           {
+              highestIdx = i;
+              highest = tmp;
+           }
+        }
+      }
+      else if( tmp >= highest )
+      {
+        highestIdx = today;
+        highest = tmp;
+      }
+
+      outReal[outIdx++] = highest;
+      trailingIdx++;
+      today++;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_REF_MIN( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double lowest, tmp;
+   int outIdx, nbInitialElementNeeded;
+   int trailingIdx, lowestIdx, today, i;
+
+   nbInitialElementNeeded = (optInTimePeriod-1);
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   outIdx = 0;
+   today       = startIdx;
+   trailingIdx = startIdx-nbInitialElementNeeded;
+   lowestIdx   = -1;
+   lowest      = 0.0;
+
+   while( today <= endIdx )
+   {
+      tmp = inReal[today];
+
+      if( lowestIdx < trailingIdx )
+      {
+        lowestIdx = trailingIdx;
+        lowest = inReal[lowestIdx];
+        i = lowestIdx;
+        while( ++i<=today )
+        {
+           tmp = inReal[i];
+           if( tmp < lowest )
+           {
+              lowestIdx = i;
+              lowest = tmp;
+           }
+        }
+      }
+      else if( tmp <= lowest )
+      {
+        lowestIdx = today;
+        lowest = tmp;
+      }
+
+      outReal[outIdx++] = lowest;
+      trailingIdx++;
+      today++;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode refEMA( int startIdx, int endIdx, const double inReal[],
+                          int optInTimePeriod, double optInK_1,
+                          int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   lookbackTotal = optInTimePeriod - 1 + (int)TA_GetUnstablePeriod( TA_FUNC_UNST_EMA );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   *outBegIdx = startIdx;
+
+   /* The seed is the SMA of the first period, or
+    * the first value of the input with Metastock.
+    */
+   if( TA_GetCompatibility() == TA_COMPATIBILITY_DEFAULT )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+   }
+
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+static void refStdDevUsingPrecalcMA( const double inReal[],
+                                     const double inMovAvg[],
+                                     int inMovAvgBegIdx,
+                                     int inMovAvgNbElement,
+                                     int timePeriod,
+                                     double output[] )
+{
+   double tempReal, periodTotal2, meanValue2;
+   int outIdx;
+   int startSum, endSum;
+
+   startSum = 1+inMovAvgBegIdx-timePeriod;
+   endSum = inMovAvgBegIdx;
+
+   periodTotal2 = 0;
+   for( outIdx = startSum; outIdx < endSum; outIdx++)
+   {
+      tempReal = inReal[outIdx];
+      tempReal *= tempReal;
+      periodTotal2 += tempReal;
+   }
+
+   for( outIdx=0; outIdx < inMovAvgNbElement; outIdx++, startSum++, endSum++ )
+   {
+      tempReal = inReal[endSum];
+      tempReal *= tempReal;
+      periodTotal2 += tempReal;
+      meanValue2 = periodTotal2/timePeriod;
+
+      tempReal = inReal[startSum];
+      tempReal *= tempReal;
+      periodTotal2 -= tempReal;
+
+      tempReal = inMovAvg[outIdx];
+      tempReal *= tempReal;
+      meanValue2 -= tempReal;
+
+      if( !TA_IS_ZERO_OR_NEG(meanValue2) )
+         output[outIdx] = sqrt(meanValue2);
+      else
+         output[outIdx] = (double)0.0;
+   }
+}
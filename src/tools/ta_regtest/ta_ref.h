@@ -0,0 +1,66 @@
+#ifndef TA_REF_H
+#define TA_REF_H
+
+#ifndef TA_LIBC_H
+   #include "ta_libc.h"
+#endif
+
+/* Frozen reference implementations (see ta_ref.c).
+ *
+ * Same parameters and outputs as the TA_XXX function of the same
+ * name, without the parameter validation.
+ */
+TA_RetCode TA_REF_SMA( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_EMA( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_RSI( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_VAR( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod, double optInNbDev,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_STDDEV( int startIdx, int endIdx, const double inReal[],
+                          int optInTimePeriod, double optInNbDev,
+                          int *outBegIdx, int *outNBElement, double outReal[] );
+
+/* Only the SMA and EMA are supported for optInMAType. */
+TA_RetCode TA_REF_BBANDS( int startIdx, int endIdx, const double inReal[],
+                          int optInTimePeriod, double optInNbDevUp,
+                          double optInNbDevDn, TA_MAType optInMAType,
+                          int *outBegIdx, int *outNBElement,
+                          double outRealUpperBand[],
+                          double outRealMiddleBand[],
+                          double outRealLowerBand[] );
+
+TA_RetCode TA_REF_MACD( int startIdx, int endIdx, const double inReal[],
+                        int optInFastPeriod, int optInSlowPeriod,
+                        int optInSignalPeriod,
+                        int *outBegIdx, int *outNBElement,
+                        double outMACD[], double outMACDSignal[],
+                        double outMACDHist[] );
+
+TA_RetCode TA_REF_TRANGE( int startIdx, int endIdx, const double inHigh[],
+                          const double inLow[], const double inClose[],
+                          int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_ATR( int startIdx, int endIdx, const double inHigh[],
+                       const double inLow[], const double inClose[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_MAX( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+TA_RetCode TA_REF_MIN( int startIdx, int endIdx, const double inReal[],
+                       int optInTimePeriod,
+                       int *outBegIdx, int *outNBElement, double outReal[] );
+
+#endif
@@ -38,6 +38,7 @@
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
  *  AB       Anatoliy Belsky
+ *  AG       Agent
  *
  *
  * Change history:
@@ -49,6 +50,10 @@
  *  122506 MF   Add MININDEX,MAXINDEX,MINMAX and MINMAXINDEX.
  *  101812 AB   Add AVGDEV.
  *  101912 AB   Add IMI.
+ *  101926 AG   Add the panel functions test.
+ *  101926 AG   Add the bundle functions test.
+ *  101926 AG   Add the test on large generated series.
+ *  101926 AG   Add the differential test (-d).
  */
 
 /* Description:
@@ -77,6 +82,7 @@ double timeInProfiledCall;
 double worstProfiledCall;
 int insufficientClockPrecision;
 int doExtensiveProfiling;
+int doDiffReport;
 
 /**** Local declarations.              ****/
 /* None */
@@ -103,6 +109,7 @@ int main( int argc, char **argv )
    worstProfiledCall = 0.0;
    nbProfiledCall = 0;
    doExtensiveProfiling = 0;
+   doDiffReport = 0;
 
    printf( "\n" );
    printf( "ta_regtest V%s - Regression Tests of TA-Lib code\n", TA_GetVersionString() );
@@ -115,6 +122,11 @@ int main( int argc, char **argv )
 	   {
 		   doExtensiveProfiling = 1;
 	   }
+	   else if( (argv[1][0] == '-') && (argv[1][1] == 'd') && (argv[1][2] == '\0'))
+	   {
+		   /* Print the errors of the optimized paths (see test_diff.c). */
+		   doDiffReport = 1;
+	   }
 	   else
 	   {
 		   printUsage();
@@ -257,13 +269,17 @@ static ErrorNumber testTAFunction_ALL( void )
    DO_TEST( test_func_stddev,   "STDDEV,VAR" );
    DO_TEST( test_func_avgdev,   "AVGDEV" );
    DO_TEST( test_func_bbands,   "BBANDS" );
+   DO_TEST( test_func_panel,    "SMA,EMA,RSI Panel" );
+   DO_TEST( test_func_bundle,   "DMI,BBANDS,MACD Bundle" );
+   DO_TEST( test_func_large,    "All functions on large generated series" );
+   DO_TEST( test_func_diff,     "Optimized paths vs frozen reference" );
 
    return TA_TEST_PASS; /* All tests succeeded. */
 }
 
 static void printUsage(void)
 {
-      printf( "Usage: ta_regtest [-p]\n" );
+      printf( "Usage: ta_regtest [-p|-d]\n" );
       printf( "\n" );
       printf( "   No parameter needed for regression testing.\n" );
       printf( "\n" );
@@ -277,6 +293,8 @@ static void printUsage(void)
       printf( "    -p Only generate profiling data on stdout. This is\n" );
       printf( "       intended only for the TA-Lib developers. It is\n" );
       printf( "       not further documented for general use.\n" );
+      printf( "    -d Print the maximum error of each optimized path\n" );
+      printf( "       compared to the reference implementation.\n" );
       printf( "\n" );
       printf( "   On success, the exit code is 0.\n" );
       printf( "   On failure, the exit code is a number that can be\n" );
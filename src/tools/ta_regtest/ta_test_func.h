@@ -23,5 +23,9 @@ ErrorNumber test_func_1in_1out( TA_History *history );
 ErrorNumber test_func_1in_2out( TA_History *history );
 ErrorNumber test_func_avgdev  ( TA_History *history );
 ErrorNumber test_func_imi     ( TA_History *history );
+ErrorNumber test_func_panel   ( TA_History *history );
+ErrorNumber test_func_bundle  ( TA_History *history );
+ErrorNumber test_func_large   ( TA_History *history );
+ErrorNumber test_func_diff    ( TA_History *history );
 
 #endif
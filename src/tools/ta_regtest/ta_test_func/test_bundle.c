@@ -0,0 +1,655 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *  101926 AG   Add TA_BBANDS_Bundle and TA_MACD_Bundle.
+ *  101926 AG   Test the MACD bundle with a signal period of 1.
+ *
+ */
+
+/* Description:
+ *     Test the bundle functions (TA_DMI_Bundle, TA_BBANDS_Bundle and
+ *     TA_MACD_Bundle).
+ *
+ *     Each output of a bundle must be identical to the output of
+ *     the corresponding function called with the same range, once
+ *     aligned on the outBegIdx of the bundle.
+ *
+ *     The tests cover a startIdx within and past the lookback (where
+ *     the functions do not all start at the same bar), the unstable
+ *     periods and various subsets of outputs.
+ *
+ *     The derived outputs of TA_BBANDS_Bundle (%B and bandwidth) are
+ *     checked against the same formula applied to TA_BBANDS.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_bundle.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_DMI_OUTPUT 10
+#define ALL_DMI_OUTPUT ((1<<NB_DMI_OUTPUT)-1)
+
+typedef struct
+{
+   TA_Integer    startIdx;
+   TA_Integer    optInTimePeriod;
+   TA_FuncUnstId unstableId;
+   unsigned int  unstablePeriod;
+   unsigned int  outputMask; /* Bit set for each output requested. */
+} TA_BundleTest;
+
+typedef struct
+{
+   TA_Integer   startIdx;
+   TA_Integer   optInTimePeriod;
+   TA_Real      optInNbDevUp;
+   TA_Real      optInNbDevDn;
+   TA_MAType    optInMAType;
+} TA_BBandsBundleTest;
+
+typedef struct
+{
+   TA_Integer   startIdx;
+   TA_Integer   optInFastPeriod;
+   TA_Integer   optInSlowPeriod;
+   TA_Integer   optInSignalPeriod;
+   unsigned int unstablePeriod;
+} TA_MACDBundleTest;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_BundleTest *test );
+
+static ErrorNumber do_test_bbands( const TA_History *history,
+                                   const TA_BBandsBundleTest *test );
+
+static ErrorNumber do_test_macd( const TA_History *history,
+                                 const TA_MACDBundleTest *test );
+
+static ErrorNumber checkOutput( const char   *name,
+                                const double *out,
+                                int           outBegIdx,
+                                int           outNBElement,
+                                const double *expected,
+                                int           expBegIdx,
+                                int           expNbElement,
+                                double        tolerance );
+
+static ErrorNumber do_test_bbands( const TA_History *history,
+                                   const TA_BBandsBundleTest *test )
+{
+   double      *buffer, *out[7], *expected[3], *expDev;
+   int          outBegIdx, outNBElement, expBegIdx, expNbElement;
+   int          devBegIdx, devNbElement;
+   int          endIdx, i, j;
+   double       upper, lower, tolerance;
+   TA_RetCode   retCode;
+   ErrorNumber  retValue;
+
+   endIdx = history->nbBars-1;
+   buffer = TA_Malloc( sizeof(double)*history->nbBars*11 );
+   if( !buffer )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   for( i=0; i < 7; i++ )
+      out[i] = &buffer[history->nbBars*i];
+   for( i=0; i < 3; i++ )
+      expected[i] = &buffer[history->nbBars*(7+i)];
+   expDev = &buffer[history->nbBars*10];
+
+   retValue = TA_TEST_PASS;
+
+   /* All outputs, then only the derived outputs (the bands
+    * and the deviation are then in a temporary buffer).
+    */
+   for( j=0; (j < 2) && (retValue == TA_TEST_PASS); j++ )
+   {
+      retCode = TA_BBANDS_Bundle( test->startIdx, endIdx, history->close,
+                                  test->optInTimePeriod, test->optInNbDevUp,
+                                  test->optInNbDevDn, test->optInMAType,
+                                  &outBegIdx, &outNBElement,
+                                  j? NULL : out[0], j? NULL : out[1], j? NULL : out[2],
+                                  j? NULL : out[3], j? NULL : out[4], out[5], out[6] );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: BBANDS bundle call retCode=%d\n", retCode );
+         retValue = TA_BUNDLE_TST_CALL_FAILED;
+         break;
+      }
+
+      retCode = TA_BBANDS( test->startIdx, endIdx, history->close,
+                           test->optInTimePeriod, test->optInNbDevUp,
+                           test->optInNbDevDn, test->optInMAType,
+                           &expBegIdx, &expNbElement,
+                           expected[0], expected[1], expected[2] );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: BBANDS call retCode=%d\n", retCode );
+         retValue = TA_BUNDLE_TST_CALL_FAILED;
+         break;
+      }
+
+      if( j == 0 )
+      {
+         retValue = checkOutput( "BBANDS Upper", out[0], outBegIdx, outNBElement,
+                                 expected[0], expBegIdx, expNbElement, 0.0 );
+         if( retValue == TA_TEST_PASS )
+            retValue = checkOutput( "BBANDS Middle", out[1], outBegIdx, outNBElement,
+                                    expected[1], expBegIdx, expNbElement, 0.0 );
+         if( retValue == TA_TEST_PASS )
+            retValue = checkOutput( "BBANDS Lower", out[2], outBegIdx, outNBElement,
+                                    expected[2], expBegIdx, expNbElement, 0.0 );
+
+         /* The deviation starts its running sums at outBegIdx. With
+          * the SMA, it is derived from the middle band instead.
+          */
+         tolerance = (test->optInMAType == TA_MAType_SMA)? 1e-6 : 0.0;
+         if( retValue == TA_TEST_PASS )
+         {
+            retCode = TA_STDDEV( outBegIdx, endIdx, history->close,
+                                 test->optInTimePeriod, 1.0,
+                                 &devBegIdx, &devNbElement, expDev );
+            retValue = checkOutput( "BBANDS StdDev", out[3], outBegIdx, outNBElement,
+                                    expDev, devBegIdx, devNbElement, tolerance );
+         }
+         if( retValue == TA_TEST_PASS )
+         {
+            retCode = TA_VAR( outBegIdx, endIdx, history->close,
+                              test->optInTimePeriod, 1.0,
+                              &devBegIdx, &devNbElement, expDev );
+            retValue = checkOutput( "BBANDS Variance", out[4], outBegIdx, outNBElement,
+                                    expDev, devBegIdx, devNbElement, tolerance );
+         }
+      }
+
+      /* %B and bandwidth from the bands of TA_BBANDS. */
+      for( i=0; (i < expNbElement) && (retValue == TA_TEST_PASS); i++ )
+      {
+         upper = expected[0][i];
+         lower = expected[2][i];
+         expected[0][i] = (upper-lower == 0.0)? 0.0 :
+                          (history->close[expBegIdx+i]-lower)/(upper-lower);
+         expected[2][i] = (expected[1][i] == 0.0)? 0.0 : (upper-lower)/expected[1][i];
+      }
+      if( retValue == TA_TEST_PASS )
+         retValue = checkOutput( "BBANDS PercentB", out[5], outBegIdx, outNBElement,
+                                 expected[0], expBegIdx, expNbElement, 0.0 );
+      if( retValue == TA_TEST_PASS )
+         retValue = checkOutput( "BBANDS Bandwidth", out[6], outBegIdx, outNBElement,
+                                 expected[2], expBegIdx, expNbElement, 0.0 );
+   }
+
+   TA_Free( buffer );
+   return retValue;
+}
+
+static ErrorNumber do_test_macd( const TA_History *history,
+                                 const TA_MACDBundleTest *test )
+{
+   double      *buffer, *out[5], *expected[3];
+   int          outBegIdx, outNBElement, expBegIdx, expNbElement;
+   int          endIdx, i, fastPeriod, slowPeriod, emaStartIdx;
+   TA_RetCode   retCode;
+   ErrorNumber  retValue;
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_EMA, test->unstablePeriod );
+
+   endIdx = history->nbBars-1;
+   buffer = TA_Malloc( sizeof(double)*history->nbBars*8 );
+   if( !buffer )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   for( i=0; i < 5; i++ )
+      out[i] = &buffer[history->nbBars*i];
+   for( i=0; i < 3; i++ )
+      expected[i] = &buffer[history->nbBars*(5+i)];
+
+   retCode = TA_MACD_Bundle( test->startIdx, endIdx, history->close,
+                             test->optInFastPeriod, test->optInSlowPeriod,
+                             test->optInSignalPeriod, &outBegIdx, &outNBElement,
+                             out[0], out[1], out[2], out[3], out[4] );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_Free( buffer );
+      printf( "Fail: MACD bundle call retCode=%d\n", retCode );
+      return TA_BUNDLE_TST_CALL_FAILED;
+   }
+
+   retCode = TA_MACD( test->startIdx, endIdx, history->close,
+                      test->optInFastPeriod, test->optInSlowPeriod,
+                      test->optInSignalPeriod, &expBegIdx, &expNbElement,
+                      expected[0], expected[1], expected[2] );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_Free( buffer );
+      printf( "Fail: MACD call retCode=%d\n", retCode );
+      return TA_BUNDLE_TST_CALL_FAILED;
+   }
+
+   retValue = checkOutput( "MACD", out[0], outBegIdx, outNBElement,
+                           expected[0], expBegIdx, expNbElement, 0.0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkOutput( "MACD Signal", out[1], outBegIdx, outNBElement,
+                              expected[1], expBegIdx, expNbElement, 0.0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkOutput( "MACD Hist", out[2], outBegIdx, outNBElement,
+                              expected[2], expBegIdx, expNbElement, 0.0 );
+
+   /* The EMA lines start at the MACD outBegIdx, moved back
+    * by the lookback of the signal (none for a period of 1).
+    */
+   fastPeriod = test->optInFastPeriod;
+   slowPeriod = test->optInSlowPeriod;
+   if( slowPeriod < fastPeriod )
+   {
+      fastPeriod = test->optInSlowPeriod;
+      slowPeriod = test->optInFastPeriod;
+   }
+   emaStartIdx = outBegIdx-(TA_MACD_Lookback( fastPeriod, slowPeriod, test->optInSignalPeriod )
+                            -TA_EMA_Lookback( slowPeriod ));
+
+   if( (retValue == TA_TEST_PASS) && (outNBElement != 0) )
+   {
+      retCode = TA_EMA( emaStartIdx, endIdx, history->close, fastPeriod,
+                        &expBegIdx, &expNbElement, expected[0] );
+      retValue = checkOutput( "MACD FastEMA", out[3], outBegIdx, outNBElement,
+                              expected[0], expBegIdx, expNbElement, 0.0 );
+   }
+   if( (retValue == TA_TEST_PASS) && (outNBElement != 0) )
+   {
+      retCode = TA_EMA( emaStartIdx, endIdx, history->close, slowPeriod,
+                        &expBegIdx, &expNbElement, expected[0] );
+      retValue = checkOutput( "MACD SlowEMA", out[4], outBegIdx, outNBElement,
+                              expected[0], expBegIdx, expNbElement, 0.0 );
+   }
+
+   TA_Free( buffer );
+   return retValue;
+}
+
+/* Compare a bundle output with the output of a function
+ * aligned on the outBegIdx of the bundle.
+ */
+static ErrorNumber checkOutput( const char   *name,
+                                const double *out,
+                                int           outBegIdx,
+                                int           outNBElement,
+                                const double *expected,
+                                int           expBegIdx,
+                                int           expNbElement,
+                                double        tolerance )
+{
+   int j, offset;
+
+   offset = outBegIdx-expBegIdx;
+   if( (offset < 0) || (outNBElement != expNbElement-offset) )
+   {
+      printf( "Fail: %s outBegIdx=%d(%d) outNBElement=%d(%d)\n",
+              name, outBegIdx, expBegIdx, outNBElement, expNbElement );
+      return TA_BUNDLE_TST_BAD_RANGE;
+   }
+
+   for( j=0; j < outNBElement; j++ )
+   {
+      if( (tolerance == 0.0)? (out[j] != expected[j+offset]) :
+          (fabs(out[j]-expected[j+offset]) > tolerance) )
+      {
+         printf( "Fail: %s value[%d]=%g (expected %g)\n",
+                 name, j, out[j], expected[j+offset] );
+         return TA_BUNDLE_TST_BAD_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static TA_RetCode callSingle( int           theOutput,
+                              int           startIdx,
+                              int           endIdx,
+                              const TA_History *history,
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double       *outReal );
+
+/**** Local variables definitions.     ****/
+static const char *outputName[NB_DMI_OUTPUT] =
+{
+   "TRANGE", "PLUS_DM", "MINUS_DM", "PLUS_DI", "MINUS_DI",
+   "DX", "ADX", "ADXR", "ATR", "NATR"
+};
+
+static TA_BundleTest tableTest[] =
+{
+   {   0,  14, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   {   0,   2, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   {   0,  30, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   {   0, 200, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   {   0,  14, TA_FUNC_UNST_ALL,  10, ALL_DMI_OUTPUT },
+   {   0,  14, TA_FUNC_UNST_ADX,  20, ALL_DMI_OUTPUT },
+   {  20,  14, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   { 100,  14, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   { 100,   2, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   { 100,  30, TA_FUNC_UNST_ALL,   5, ALL_DMI_OUTPUT },
+   { 100,  14, TA_FUNC_UNST_NATR, 30, ALL_DMI_OUTPUT },
+   { 251,  14, TA_FUNC_UNST_ALL,   0, ALL_DMI_OUTPUT },
+   {   0,  14, TA_FUNC_UNST_ALL,   0, 0x001 },
+   {   0,  14, TA_FUNC_UNST_ALL,   0, 0x080 },
+   {   0,  14, TA_FUNC_UNST_ALL,   0, 0x318 },
+   {  50,  14, TA_FUNC_UNST_ALL,   0, 0x0C6 },
+   {  50,   5, TA_FUNC_UNST_DX,    7, 0x2A1 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_BundleTest))
+
+static TA_BBandsBundleTest tableBBandsTest[] =
+{
+   {   0, 20, 2.0, 2.0, TA_MAType_SMA   },
+   {   0,  2, 1.0, 1.0, TA_MAType_SMA   },
+   {  50, 20, 1.0, 2.5, TA_MAType_SMA   },
+   {   0, 20, 2.0, 2.0, TA_MAType_EMA   },
+   {  30, 10, 1.5, 1.0, TA_MAType_WMA   },
+   {   0, 14, 2.0, 2.0, TA_MAType_T3    },
+   {   0,  5, 2.0, 2.0, TA_MAType_KAMA  },
+   {   0, 20, 2.0, 2.0, TA_MAType_MAMA  }
+};
+
+#define NB_BBANDS_TEST (sizeof(tableBBandsTest)/sizeof(TA_BBandsBundleTest))
+
+static TA_MACDBundleTest tableMACDTest[] =
+{
+   {   0, 12, 26,  9,  0 },
+   {   0, 26, 12,  9,  0 },
+   {   0,  2,  3,  2,  0 },
+   { 100, 12, 26,  9,  0 },
+   {   0, 12, 26,  9, 30 },
+   { 240,  5, 35, 20,  0 },
+   {   0, 12, 26,  1,  0 },
+   { 100, 12, 26,  1, 30 }
+};
+
+#define NB_MACD_TEST (sizeof(tableMACDTest)/sizeof(TA_MACDBundleTest))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_bundle( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   int outBeg, outNb;
+   double out[10];
+
+   /* Parameter validation. */
+   retCode = TA_DMI_Bundle( -1, 9, history->high, history->low, history->close, 14,
+                            &outBeg, &outNb, out, NULL, NULL, NULL, NULL,
+                            NULL, NULL, NULL, NULL, NULL );
+   if( retCode != TA_OUT_OF_RANGE_START_INDEX )
+   {
+      printf( "%s Failed negative startIdx (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+   retCode = TA_DMI_Bundle( 5, 4, history->high, history->low, history->close, 14,
+                            &outBeg, &outNb, out, NULL, NULL, NULL, NULL,
+                            NULL, NULL, NULL, NULL, NULL );
+   if( retCode != TA_OUT_OF_RANGE_END_INDEX )
+   {
+      printf( "%s Failed bad endIdx (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+   retCode = TA_DMI_Bundle( 0, 9, history->high, history->low, history->close, 1,
+                            &outBeg, &outNb, out, NULL, NULL, NULL, NULL,
+                            NULL, NULL, NULL, NULL, NULL );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "%s Failed bad period (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+   retCode = TA_DMI_Bundle( 0, 9, history->high, NULL, history->close, 14,
+                            &outBeg, &outNb, out, NULL, NULL, NULL, NULL,
+                            NULL, NULL, NULL, NULL, NULL );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "%s Failed NULL input (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+   retCode = TA_DMI_Bundle( 0, 9, history->high, history->low, history->close, 14,
+                            &outBeg, &outNb, NULL, NULL, NULL, NULL, NULL,
+                            NULL, NULL, NULL, NULL, NULL );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "%s Failed no output (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i] );
+
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+      if( retValue != 0 )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   retCode = TA_BBANDS_Bundle( 0, 9, history->close, 20, 2.0, 2.0, TA_MAType_SMA,
+                               &outBeg, &outNb, NULL, NULL, NULL, NULL, NULL, NULL, NULL );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "%s Failed BBANDS no output (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+
+   for( i=0; i < NB_BBANDS_TEST; i++ )
+   {
+      retValue = do_test_bbands( history, &tableBBandsTest[i] );
+      if( retValue != 0 )
+      {
+         printf( "%s Failed BBANDS Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   retCode = TA_MACD_Bundle( 0, 9, history->close, 12, 26, 0,
+                             &outBeg, &outNb, out, NULL, NULL, NULL, NULL );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "%s Failed MACD bad signal period (%d)\n", __FILE__, retCode );
+      return TA_BUNDLE_TST_BAD_PARAM;
+   }
+
+   for( i=0; i < NB_MACD_TEST; i++ )
+   {
+      retValue = do_test_macd( history, &tableMACDTest[i] );
+
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+      if( retValue != 0 )
+      {
+         printf( "%s Failed MACD Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_BundleTest *test )
+{
+   double      *out[NB_DMI_OUTPUT];
+   double      *expected;
+   int          outBegIdx, outNBElement;
+   int          expBegIdx, expNbElement;
+   int          endIdx, i;
+   TA_RetCode   retCode;
+   ErrorNumber  retValue;
+
+   TA_SetUnstablePeriod( test->unstableId, test->unstablePeriod );
+
+   endIdx   = history->nbBars-1;
+   expected = TA_Malloc( sizeof(double)*history->nbBars );
+   if( !expected )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   for( i=0; i < NB_DMI_OUTPUT; i++ )
+   {
+      out[i] = NULL;
+      if( test->outputMask & (1<<i) )
+         out[i] = TA_Malloc( sizeof(double)*history->nbBars );
+   }
+
+   retValue = TA_TEST_PASS;
+
+   retCode = TA_DMI_Bundle( test->startIdx, endIdx,
+                            history->high, history->low, history->close,
+                            test->optInTimePeriod, &outBegIdx, &outNBElement,
+                            out[0], out[1], out[2], out[3], out[4],
+                            out[5], out[6], out[7], out[8], out[9] );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: Bundle call retCode=%d\n", retCode );
+      retValue = TA_BUNDLE_TST_CALL_FAILED;
+   }
+
+   for( i=0; (i < NB_DMI_OUTPUT) && (retValue == TA_TEST_PASS); i++ )
+   {
+      if( !out[i] )
+         continue;
+
+      retCode = callSingle( i, test->startIdx, endIdx, history,
+                            test->optInTimePeriod, &expBegIdx, &expNbElement, expected );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: %s call retCode=%d\n", outputName[i], retCode );
+         retValue = TA_BUNDLE_TST_CALL_FAILED;
+         break;
+      }
+
+      /* The bundle starts at the largest lookback, which
+       * can be past endIdx for some outputs of a long period.
+       */
+      if( outNBElement == 0 )
+      {
+         if( outBegIdx != 0 )
+         {
+            printf( "Fail: %s empty output with outBegIdx=%d\n",
+                    outputName[i], outBegIdx );
+            retValue = TA_BUNDLE_TST_BAD_RANGE;
+         }
+         continue;
+      }
+
+      retValue = checkOutput( outputName[i], out[i], outBegIdx, outNBElement,
+                              expected, expBegIdx, expNbElement, 0.0 );
+   }
+
+   for( i=0; i < NB_DMI_OUTPUT; i++ )
+   {
+      if( out[i] )
+         TA_Free( out[i] );
+   }
+   TA_Free( expected );
+   return retValue;
+}
+
+static TA_RetCode callSingle( int           theOutput,
+                              int           startIdx,
+                              int           endIdx,
+                              const TA_History *history,
+                              int           optInTimePeriod,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double       *outReal )
+{
+   const double *high  = history->high;
+   const double *low   = history->low;
+   const double *close = history->close;
+
+   switch( theOutput )
+   {
+   case 0: return TA_TRANGE( startIdx, endIdx, high, low, close,
+                             outBegIdx, outNBElement, outReal );
+   case 1: return TA_PLUS_DM( startIdx, endIdx, high, low, optInTimePeriod,
+                              outBegIdx, outNBElement, outReal );
+   case 2: return TA_MINUS_DM( startIdx, endIdx, high, low, optInTimePeriod,
+                               outBegIdx, outNBElement, outReal );
+   case 3: return TA_PLUS_DI( startIdx, endIdx, high, low, close, optInTimePeriod,
+                              outBegIdx, outNBElement, outReal );
+   case 4: return TA_MINUS_DI( startIdx, endIdx, high, low, close, optInTimePeriod,
+                               outBegIdx, outNBElement, outReal );
+   case 5: return TA_DX( startIdx, endIdx, high, low, close, optInTimePeriod,
+                         outBegIdx, outNBElement, outReal );
+   case 6: return TA_ADX( startIdx, endIdx, high, low, close, optInTimePeriod,
+                          outBegIdx, outNBElement, outReal );
+   case 7: return TA_ADXR( startIdx, endIdx, high, low, close, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal );
+   case 8: return TA_ATR( startIdx, endIdx, high, low, close, optInTimePeriod,
+                          outBegIdx, outNBElement, outReal );
+   case 9: return TA_NATR( startIdx, endIdx, high, low, close, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal );
+   }
+
+   return TA_BAD_PARAM;
+}
@@ -0,0 +1,1125 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Differential test of the optimized paths against the frozen
+ *     reference implementations of ta_ref.c (TA_REF_XXX).
+ *
+ *     For each function, random cases are generated: synthetic series
+ *     from ta_datagen, random optional inputs, unstable period,
+ *     compatibility and range. Each case is evaluated by all the paths
+ *     available for the function:
+ *
+ *        direct   - TA_XXX on the range, then on a random split of it.
+ *        abstract - TA_CallFunc.
+ *        parallel - TA_CallFuncParallel (chunks).
+ *        call64   - TA_CallFunc64.
+ *        plan     - TA_PlanExecute, along with a BBANDS sharing its nodes.
+ *        batch    - TA_CallFuncBatch (sweep and panel grouping).
+ *        panel    - TA_XXX_Panel.
+ *        sweep    - TA_SMA_Sweep.
+ *        bundle   - TA_BBANDS_Bundle, TA_MACD_Bundle and TA_DMI_Bundle.
+ *
+ *     Every output must be within the tolerance of the reference. By
+ *     default the values must be identical, the exceptions are listed
+ *     in tableTolerance (a value fails only when its ULP, relative and
+ *     absolute errors all exceed the tolerance).
+ *
+ *     With "ta_regtest -d", the maximum absolute, relative and ULP
+ *     errors of each function and path are printed.
+ *
+ *     The cases are the same from one run to the other (fixed seed),
+ *     a failing case is printed with all its parameters.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_memory.h"
+#include "ta_panel.h"
+#include "ta_bundle.h"
+#include "ta_datagen.h"
+#include "ta_ref.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+extern int doDiffReport;
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_BAR          4000
+#define NB_DATA         4
+#define NB_CASE         24
+#define NB_OUT_BUFFER   9
+#define NB_BATCH        3
+#define NB_PANEL_SERIES 5
+#define DIFF_SEED       0x2545F4914F6CDD1DULL
+
+typedef enum
+{
+   DIFF_SMA,
+   DIFF_EMA,
+   DIFF_RSI,
+   DIFF_VAR,
+   DIFF_STDDEV,
+   DIFF_BBANDS,
+   DIFF_MACD,
+   DIFF_TRANGE,
+   DIFF_ATR,
+   DIFF_MAX,
+   DIFF_MIN,
+   NB_DIFF_FUNC
+} TA_DiffFunc;
+
+typedef enum
+{
+   DIFF_DIRECT,
+   DIFF_ABSTRACT,
+   DIFF_PARALLEL,
+   DIFF_CALL64,
+   DIFF_PLAN,
+   DIFF_BATCH,
+   DIFF_PANEL,
+   DIFF_SWEEP,
+   DIFF_BUNDLE,
+   NB_DIFF_PATH
+} TA_DiffPath;
+
+typedef struct
+{
+   const double *open;
+   const double *high;
+   const double *low;
+   const double *close;
+   const double *volume;
+} TA_DiffData;
+
+typedef struct
+{
+   TA_DiffFunc        func;
+   unsigned int       caseId;
+   const TA_DiffData *data;
+   const double      *inReal; /* One of the fields of 'data'. */
+   int                startIdx;
+   int                endIdx;
+   int                optInTimePeriod; /* Also the fast period of MACD. */
+   int                optInPeriod2;    /* Slow period of MACD. */
+   int                optInPeriod3;    /* Signal period of MACD. */
+   double             optInNbDevUp;    /* Also the nbDev of VAR/STDDEV. */
+   double             optInNbDevDn;
+   TA_MAType          optInMAType;
+   unsigned int       unstablePeriod;
+   TA_Compatibility   compatibility;
+} TA_DiffCase;
+
+typedef struct
+{
+   const char  *name;
+   unsigned int nbOutput;
+   int          isPrice; /* High, Low, Close instead of a real input. */
+} TA_DiffFuncInfo;
+
+typedef struct
+{
+   unsigned int nbCall;
+   unsigned int nbValue;
+   double       maxAbsErr;
+   double       maxRelErr;
+   double       maxUlpErr;
+} TA_DiffStat;
+
+typedef struct
+{
+   TA_DiffFunc func;
+   TA_DiffPath path;
+   double      maxUlp;
+   double      maxRel;
+   double      maxAbs;
+} TA_DiffTolerance;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_DiffCase *test, double *out[], double *ref[] );
+
+static ErrorNumber checkDirect  ( const TA_DiffCase *test, double *out[], double *ref[] );
+static ErrorNumber checkAbstract( const TA_DiffCase *test, double *out[], double *ref[] );
+static ErrorNumber checkPlan    ( const TA_DiffCase *test, double *out[], double *ref[] );
+static ErrorNumber checkBatch   ( const TA_DiffCase *test, double *out[], double *ref[] );
+static ErrorNumber checkPanel   ( const TA_DiffCase *test, double *out[], double *ref[] );
+static ErrorNumber checkSweep   ( const TA_DiffCase *test, double *out[], double *ref[] );
+static ErrorNumber checkBundle  ( const TA_DiffCase *test, double *out[], double *ref[] );
+
+static TA_RetCode callFunc( const TA_DiffCase *test, int isRef,
+                            int *outBegIdx, int *outNBElement,
+                            double *const out[] );
+
+static TA_RetCode allocParams( const TA_DiffCase *test,
+                               double *const out[],
+                               TA_ParamHolder **params );
+
+static ErrorNumber compareWithRef( const TA_DiffCase *test, TA_DiffPath path,
+                                   TA_RetCode retCode,
+                                   int outBegIdx, int outNBElement,
+                                   double *const out[], double *ref[] );
+
+static ErrorNumber compareOutput( const TA_DiffCase *test, TA_DiffPath path,
+                                  unsigned int outputIdx,
+                                  int outBegIdx, int outNBElement, const double *out,
+                                  int refBegIdx, int refNBElement, const double *ref );
+
+static const TA_DiffTolerance *findTolerance( TA_DiffFunc func, TA_DiffPath path );
+static double ulpDistance( double a, double b );
+static void fillNaN( double *out[], unsigned int nbBuffer );
+static void printCase( const TA_DiffCase *test, TA_DiffPath path );
+static void printReport( void );
+
+static void randomCase( TA_DiffCase *test, TA_DiffFunc func,
+                        unsigned int caseId, const TA_DiffData *data );
+static int randomPeriod( void );
+static unsigned int randomInt( unsigned int n );
+static double randomReal( void );
+
+/**** Local variables definitions.     ****/
+static const TA_DiffFuncInfo tableFunc[NB_DIFF_FUNC] =
+{
+   { "SMA",    1, 0 },
+   { "EMA",    1, 0 },
+   { "RSI",    1, 0 },
+   { "VAR",    1, 0 },
+   { "STDDEV", 1, 0 },
+   { "BBANDS", 3, 0 },
+   { "MACD",   3, 0 },
+   { "TRANGE", 1, 1 },
+   { "ATR",    1, 1 },
+   { "MAX",    1, 0 },
+   { "MIN",    1, 0 }
+};
+
+static const char *pathName[NB_DIFF_PATH] =
+{
+   "direct",
+   "abstract",
+   "parallel",
+   "call64",
+   "plan",
+   "batch",
+   "panel",
+   "sweep",
+   "bundle"
+};
+
+/* The paths not listed must give identical values. */
+static const TA_DiffTolerance tableTolerance[] =
+{
+   /* The running sums restart at each chunk (see TA_CallFuncParallel). */
+   { DIFF_SMA,    DIFF_PARALLEL, 64.0, 1e-12, 1e-9 },
+   { DIFF_VAR,    DIFF_PARALLEL, 64.0, 1e-9,  1e-6 },
+   { DIFF_STDDEV, DIFF_PARALLEL, 64.0, 1e-9,  1e-3 },
+   { DIFF_BBANDS, DIFF_PARALLEL, 64.0, 1e-9,  1e-3 },
+
+   /* With the SMA, the deviation is derived from the
+    * middle band (see TA_BBANDS_Bundle).
+    */
+   { DIFF_VAR,    DIFF_BUNDLE,   64.0, 1e-9,  1e-6 },
+   { DIFF_STDDEV, DIFF_BUNDLE,   64.0, 1e-9,  1e-3 }
+};
+
+#define NB_TOLERANCE (sizeof(tableTolerance)/sizeof(TA_DiffTolerance))
+
+static const TA_DiffTolerance exactTolerance = { NB_DIFF_FUNC, NB_DIFF_PATH, 0.0, 0.0, 0.0 };
+
+static TA_DiffStat diffStat[NB_DIFF_FUNC][NB_DIFF_PATH];
+
+static unsigned long long randomState;
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_diff( TA_History *history )
+{
+   TA_DataGenParam param;
+   TA_DiffData data[NB_DATA];
+   TA_DiffCase test;
+   TA_Real *buffer, *series;
+   double *out[NB_OUT_BUFFER], *ref[NB_OUT_BUFFER];
+   ErrorNumber retValue;
+   int i, func;
+
+   (void)history;
+
+   buffer = TA_Malloc( sizeof(TA_Real)*NB_BAR*(NB_DATA*5+NB_OUT_BUFFER*2) );
+   if( !buffer )
+      return TA_DIFF_TST_BAD_PARAM;
+
+   for( i=0; i < NB_OUT_BUFFER; i++ )
+   {
+      out[i] = &buffer[NB_BAR*(NB_DATA*5+i)];
+      ref[i] = &buffer[NB_BAR*(NB_DATA*5+NB_OUT_BUFFER+i)];
+   }
+
+   /* Intraday gaps, jumps, volatility regimes with constant
+    * runs and a mean-reverting additive series.
+    */
+   for( i=0; i < NB_DATA; i++ )
+   {
+      switch( i )
+      {
+      case 0:
+         TA_DataGenDefault( &param, TA_DATAGEN_GBM );
+         param.barsPerSession = 390;
+         param.gapProb        = 0.25;
+         break;
+      case 1:
+         TA_DataGenDefault( &param, TA_DATAGEN_JUMP_DIFFUSION );
+         break;
+      case 2:
+         TA_DataGenDefault( &param, TA_DATAGEN_REGIME_SWITCHING );
+         param.constantRunProb = 0.002;
+         break;
+      default:
+         TA_DataGenDefault( &param, TA_DATAGEN_MEAN_REVERTING );
+         break;
+      }
+
+      series = &buffer[NB_BAR*5*i];
+      TA_DataGenerate( &param, NB_BAR, series, series+NB_BAR, series+NB_BAR*2,
+                       series+NB_BAR*3, series+NB_BAR*4 );
+      data[i].open   = series;
+      data[i].high   = series+NB_BAR;
+      data[i].low    = series+NB_BAR*2;
+      data[i].close  = series+NB_BAR*3;
+      data[i].volume = series+NB_BAR*4;
+   }
+
+   memset( diffStat, 0, sizeof(diffStat) );
+   randomState = DIFF_SEED;
+
+   retValue = TA_TEST_PASS;
+   for( func=0; (func < NB_DIFF_FUNC) && (retValue == TA_TEST_PASS); func++ )
+   {
+      for( i=0; (i < NB_CASE) && (retValue == TA_TEST_PASS); i++ )
+      {
+         randomCase( &test, (TA_DiffFunc)func, (unsigned int)i, &data[i%NB_DATA] );
+         TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, test.unstablePeriod );
+         TA_SetCompatibility( test.compatibility );
+         retValue = do_test( &test, out, ref );
+      }
+   }
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   if( doDiffReport )
+      printReport();
+
+   TA_Free( buffer );
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   ErrorNumber retValue;
+
+   retValue = checkDirect( test, out, ref );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkAbstract( test, out, ref );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkPlan( test, out, ref );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBatch( test, out, ref );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkPanel( test, out, ref );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkSweep( test, out, ref );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBundle( test, out, ref );
+
+   return retValue;
+}
+
+static ErrorNumber checkDirect( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_DiffCase split;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int outBegIdx, outNBElement, idx[4], i;
+
+   fillNaN( out, tableFunc[test->func].nbOutput );
+   retCode = callFunc( test, 0, &outBegIdx, &outNBElement, out );
+   retValue = compareWithRef( test, DIFF_DIRECT, retCode, outBegIdx, outNBElement, out, ref );
+
+   /* The same range in three consecutive calls. */
+   if( test->endIdx-test->startIdx < 2 )
+      return retValue;
+
+   idx[0] = test->startIdx;
+   idx[1] = test->startIdx+(int)randomInt( (unsigned int)(test->endIdx-test->startIdx-1) );
+   idx[2] = idx[1]+1+(int)randomInt( (unsigned int)(test->endIdx-idx[1]-1) );
+   idx[3] = test->endIdx+1;
+
+   split = *test;
+   for( i=0; (i < 3) && (retValue == TA_TEST_PASS); i++ )
+   {
+      split.startIdx = idx[i];
+      split.endIdx   = idx[i+1]-1;
+      fillNaN( out, tableFunc[test->func].nbOutput );
+      retCode = callFunc( &split, 0, &outBegIdx, &outNBElement, out );
+      retValue = compareWithRef( &split, DIFF_DIRECT, retCode, outBegIdx, outNBElement, out, ref );
+   }
+
+   return retValue;
+}
+
+static ErrorNumber checkAbstract( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_ParamHolder *params;
+   TA_Integer outBegIdx, outNBElement;
+   TA_Integer64 outBegIdx64, outNBElement64;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   unsigned int nbOutput;
+
+   nbOutput = tableFunc[test->func].nbOutput;
+
+   retCode = allocParams( test, out, &params );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFail: %s allocParams retCode=%d\n", tableFunc[test->func].name, retCode );
+      return TA_DIFF_TST_BAD_PARAM;
+   }
+
+   fillNaN( out, nbOutput );
+   retCode = TA_CallFunc( params, test->startIdx, test->endIdx, &outBegIdx, &outNBElement );
+   retValue = compareWithRef( test, DIFF_ABSTRACT, retCode, outBegIdx, outNBElement, out, ref );
+
+   if( retValue == TA_TEST_PASS )
+   {
+      fillNaN( out, nbOutput );
+      retCode = TA_CallFuncParallel( params, test->startIdx, test->endIdx, &outBegIdx, &outNBElement, 2 );
+      retValue = compareWithRef( test, DIFF_PARALLEL, retCode, outBegIdx, outNBElement, out, ref );
+   }
+
+   if( retValue == TA_TEST_PASS )
+   {
+      fillNaN( out, nbOutput );
+      retCode = TA_CallFunc64( params, test->startIdx, test->endIdx, &outBegIdx64, &outNBElement64 );
+      retValue = compareWithRef( test, DIFF_CALL64, retCode, (int)outBegIdx64, (int)outNBElement64, out, ref );
+   }
+
+   TA_ParamHolderFree( params );
+   return retValue;
+}
+
+static ErrorNumber checkPlan( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_DiffCase bbands;
+   TA_ParamHolder *params[2];
+   TA_CallResult result[2];
+   TA_Plan *plan;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+
+   /* A BBANDS on the same input shares its MA and VAR
+    * nodes with the SMA, EMA, VAR and STDDEV.
+    */
+   bbands = *test;
+   bbands.func         = DIFF_BBANDS;
+   bbands.optInMAType  = (test->func == DIFF_EMA)? TA_MAType_EMA : TA_MAType_SMA;
+   bbands.optInNbDevUp = 2.0;
+   bbands.optInNbDevDn = 2.0;
+
+   params[0] = NULL;
+   params[1] = NULL;
+   plan = NULL;
+   retCode = allocParams( test, out, &params[0] );
+   if( retCode == TA_SUCCESS )
+      retCode = allocParams( &bbands, &out[3], &params[1] );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_PlanAlloc( &plan );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_PlanAdd( plan, params[0], test->startIdx, test->endIdx );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_PlanAdd( plan, params[1], test->startIdx, test->endIdx );
+
+   fillNaN( out, 6 );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_PlanExecute( plan, result, NULL );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFail: %s plan retCode=%d\n", tableFunc[test->func].name, retCode );
+      retValue = TA_DIFF_TST_CALL_FAILED;
+   }
+   else
+   {
+      retValue = compareWithRef( test, DIFF_PLAN, result[0].retCode,
+                                 result[0].outBegIdx, result[0].outNbElement, out, ref );
+      if( retValue == TA_TEST_PASS )
+         retValue = compareWithRef( &bbands, DIFF_PLAN, result[1].retCode,
+                                    result[1].outBegIdx, result[1].outNbElement, &out[3], ref );
+   }
+
+   if( plan )
+      TA_PlanFree( plan );
+   if( params[0] )
+      TA_ParamHolderFree( params[0] );
+   if( params[1] )
+      TA_ParamHolderFree( params[1] );
+
+   return retValue;
+}
+
+static ErrorNumber checkBatch( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_DiffCase batch[NB_BATCH];
+   TA_ParamHolder *params[NB_BATCH];
+   TA_CallRange range[NB_BATCH];
+   TA_CallResult result[NB_BATCH];
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   unsigned int i, nbOutput;
+
+   /* SMA with many periods (grouped in a sweep), the other
+    * functions on many inputs (the EMA and RSI starting at zero
+    * are grouped in a panel).
+    */
+   nbOutput = tableFunc[test->func].nbOutput;
+   retCode = TA_SUCCESS;
+   for( i=0; i < NB_BATCH; i++ )
+   {
+      batch[i] = *test;
+      if( test->func == DIFF_SMA )
+      {
+         batch[i].optInTimePeriod = (i == 0)? test->optInTimePeriod :
+                                    (i == 1)? test->optInPeriod2 : test->optInPeriod3;
+      }
+      else
+      {
+         batch[i].inReal = (i == 0)? test->data->close :
+                           (i == 1)? test->data->open : test->data->high;
+         if( (test->func == DIFF_EMA) || (test->func == DIFF_RSI) )
+            batch[i].startIdx = 0;
+      }
+      range[i].startIdx = batch[i].startIdx;
+      range[i].endIdx   = batch[i].endIdx;
+
+      params[i] = NULL;
+      if( retCode == TA_SUCCESS )
+         retCode = allocParams( &batch[i], &out[i*nbOutput], &params[i] );
+   }
+
+   fillNaN( out, NB_BATCH*nbOutput );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFuncBatch( (const TA_ParamHolder *const *)params, NB_BATCH, range, result );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFail: %s batch retCode=%d\n", tableFunc[test->func].name, retCode );
+      retValue = TA_DIFF_TST_CALL_FAILED;
+   }
+   else
+   {
+      retValue = TA_TEST_PASS;
+      for( i=0; (i < NB_BATCH) && (retValue == TA_TEST_PASS); i++ )
+         retValue = compareWithRef( &batch[i], DIFF_BATCH, result[i].retCode,
+                                    result[i].outBegIdx, result[i].outNbElement,
+                                    &out[i*nbOutput], ref );
+   }
+
+   for( i=0; i < NB_BATCH; i++ )
+   {
+      if( params[i] )
+         TA_ParamHolderFree( params[i] );
+   }
+
+   return retValue;
+}
+
+static ErrorNumber checkPanel( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_DiffCase series[NB_PANEL_SERIES];
+   const double *inReal[NB_PANEL_SERIES];
+   int inLength[NB_PANEL_SERIES], outBegIdx[NB_PANEL_SERIES], outNBElement[NB_PANEL_SERIES];
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int i, offset;
+
+   if( (test->func != DIFF_SMA) && (test->func != DIFF_EMA) && (test->func != DIFF_RSI) )
+      return TA_TEST_PASS;
+
+   /* Series of random lengths, including an empty one and
+    * one too short for any output.
+    */
+   for( i=0; i < NB_PANEL_SERIES; i++ )
+   {
+      offset = (int)randomInt( NB_BAR/2 );
+      series[i] = *test;
+      series[i].inReal   = test->inReal+offset;
+      series[i].startIdx = 0;
+      if( i == 0 )
+         series[i].endIdx = -1;
+      else if( i == 1 )
+         series[i].endIdx = (int)randomInt( (unsigned int)test->optInTimePeriod )-1;
+      else
+         series[i].endIdx = (int)randomInt( (unsigned int)(NB_BAR-offset) );
+      inReal[i]   = series[i].inReal;
+      inLength[i] = series[i].endIdx+1;
+   }
+
+   fillNaN( out, NB_PANEL_SERIES );
+   switch( test->func )
+   {
+   case DIFF_SMA:
+      retCode = TA_SMA_Panel( NB_PANEL_SERIES, inLength, inReal, test->optInTimePeriod,
+                              outBegIdx, outNBElement, out );
+      break;
+   case DIFF_EMA:
+      retCode = TA_EMA_Panel( NB_PANEL_SERIES, inLength, inReal, test->optInTimePeriod,
+                              outBegIdx, outNBElement, out );
+      break;
+   default:
+      retCode = TA_RSI_Panel( NB_PANEL_SERIES, inLength, inReal, test->optInTimePeriod,
+                              outBegIdx, outNBElement, out );
+      break;
+   }
+
+   retValue = TA_TEST_PASS;
+   for( i=0; (i < NB_PANEL_SERIES) && (retValue == TA_TEST_PASS); i++ )
+      retValue = compareWithRef( &series[i], DIFF_PANEL, retCode,
+                                 outBegIdx[i], outNBElement[i], &out[i], ref );
+
+   return retValue;
+}
+
+static ErrorNumber checkSweep( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_DiffCase sweep[NB_BATCH];
+   int period[NB_BATCH], outBegIdx[NB_BATCH], outNBElement[NB_BATCH];
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int i;
+
+   if( test->func != DIFF_SMA )
+      return TA_TEST_PASS;
+
+   period[0] = test->optInTimePeriod;
+   period[1] = test->optInPeriod2;
+   period[2] = test->optInPeriod3;
+
+   fillNaN( out, NB_BATCH );
+   retCode = TA_SMA_Sweep( test->startIdx, test->endIdx, test->inReal,
+                           NB_BATCH, period, outBegIdx, outNBElement, out );
+
+   retValue = TA_TEST_PASS;
+   for( i=0; (i < NB_BATCH) && (retValue == TA_TEST_PASS); i++ )
+   {
+      sweep[i] = *test;
+      sweep[i].optInTimePeriod = period[i];
+      retValue = compareWithRef( &sweep[i], DIFF_SWEEP, retCode,
+                                 outBegIdx[i], outNBElement[i], &out[i], ref );
+   }
+
+   return retValue;
+}
+
+static ErrorNumber checkBundle( const TA_DiffCase *test, double *out[], double *ref[] )
+{
+   TA_DiffCase part;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement;
+
+   fillNaN( out, 5 );
+   switch( test->func )
+   {
+   case DIFF_BBANDS:
+      retCode = TA_BBANDS_Bundle( test->startIdx, test->endIdx, test->inReal,
+                                  test->optInTimePeriod, test->optInNbDevUp,
+                                  test->optInNbDevDn, test->optInMAType,
+                                  &outBegIdx, &outNBElement,
+                                  out[0], out[1], out[2], out[3], out[4], NULL, NULL );
+      retValue = compareWithRef( test, DIFF_BUNDLE, retCode, outBegIdx, outNBElement, out, ref );
+      if( (retValue != TA_TEST_PASS) || (outNBElement == 0) )
+         return retValue;
+
+      /* The deviation and variance of the bands. */
+      part = *test;
+      part.func         = DIFF_STDDEV;
+      part.startIdx     = outBegIdx;
+      part.optInNbDevUp = 1.0;
+      retValue = compareWithRef( &part, DIFF_BUNDLE, retCode, outBegIdx, outNBElement, &out[3], ref );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+
+      part.func = DIFF_VAR;
+      return compareWithRef( &part, DIFF_BUNDLE, retCode, outBegIdx, outNBElement, &out[4], ref );
+
+   case DIFF_MACD:
+      retCode = TA_MACD_Bundle( test->startIdx, test->endIdx, test->inReal,
+                                test->optInTimePeriod, test->optInPeriod2, test->optInPeriod3,
+                                &outBegIdx, &outNBElement,
+                                out[0], out[1], out[2], out[3], out[4] );
+      retValue = compareWithRef( test, DIFF_BUNDLE, retCode, outBegIdx, outNBElement, out, ref );
+      if( (retValue != TA_TEST_PASS) || (outNBElement == 0) )
+         return retValue;
+
+      /* The EMA start where the MACD starts them, before the signal. */
+      part = *test;
+      part.func = DIFF_EMA;
+      part.startIdx = outBegIdx-(test->optInPeriod3-1+(int)test->unstablePeriod);
+      part.optInTimePeriod = (test->optInTimePeriod < test->optInPeriod2)? test->optInTimePeriod : test->optInPeriod2;
+      retCode = TA_REF_EMA( part.startIdx, part.endIdx, part.inReal, part.optInTimePeriod,
+                            &refBegIdx, &refNBElement, ref[0] );
+      retValue = compareOutput( &part, DIFF_BUNDLE, 0, outBegIdx, outNBElement, out[3],
+                                outBegIdx, outNBElement, ref[0]+(outBegIdx-refBegIdx) );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+
+      part.optInTimePeriod = (test->optInTimePeriod < test->optInPeriod2)? test->optInPeriod2 : test->optInTimePeriod;
+      retCode = TA_REF_EMA( part.startIdx, part.endIdx, part.inReal, part.optInTimePeriod,
+                            &refBegIdx, &refNBElement, ref[0] );
+      return compareOutput( &part, DIFF_BUNDLE, 0, outBegIdx, outNBElement, out[4],
+                            outBegIdx, outNBElement, ref[0]+(outBegIdx-refBegIdx) );
+
+   case DIFF_TRANGE:
+   case DIFF_ATR:
+      retCode = TA_DMI_Bundle( test->startIdx, test->endIdx,
+                               test->data->high, test->data->low, test->data->close,
+                               test->optInTimePeriod, &outBegIdx, &outNBElement,
+                               (test->func == DIFF_TRANGE)? out[0] : NULL,
+                               NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                               (test->func == DIFF_ATR)? out[0] : NULL,
+                               NULL );
+      return compareWithRef( test, DIFF_BUNDLE, retCode, outBegIdx, outNBElement, out, ref );
+
+   default:
+      break;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Call the function of the library (isRef == 0) or its reference. */
+static TA_RetCode callFunc( const TA_DiffCase *test, int isRef,
+                            int *outBegIdx, int *outNBElement,
+                            double *const out[] )
+{
+   const TA_DiffData *data = test->data;
+
+   switch( test->func )
+   {
+   case DIFF_SMA:
+      return (isRef? TA_REF_SMA : TA_SMA)( test->startIdx, test->endIdx, test->inReal,
+                                           test->optInTimePeriod,
+                                           outBegIdx, outNBElement, out[0] );
+   case DIFF_EMA:
+      return (isRef? TA_REF_EMA : TA_EMA)( test->startIdx, test->endIdx, test->inReal,
+                                           test->optInTimePeriod,
+                                           outBegIdx, outNBElement, out[0] );
+   case DIFF_RSI:
+      return (isRef? TA_REF_RSI : TA_RSI)( test->startIdx, test->endIdx, test->inReal,
+                                           test->optInTimePeriod,
+                                           outBegIdx, outNBElement, out[0] );
+   case DIFF_VAR:
+      return (isRef? TA_REF_VAR : TA_VAR)( test->startIdx, test->endIdx, test->inReal,
+                                           test->optInTimePeriod, test->optInNbDevUp,
+                                           outBegIdx, outNBElement, out[0] );
+   case DIFF_STDDEV:
+      return (isRef? TA_REF_STDDEV : TA_STDDEV)( test->startIdx, test->endIdx, test->inReal,
+                                                 test->optInTimePeriod, test->optInNbDevUp,
+                                                 outBegIdx, outNBElement, out[0] );
+   case DIFF_BBANDS:
+      return (isRef? TA_REF_BBANDS : TA_BBANDS)( test->startIdx, test->endIdx, test->inReal,
+                                                 test->optInTimePeriod, test->optInNbDevUp,
+                                                 test->optInNbDevDn, test->optInMAType,
+                                                 outBegIdx, outNBElement,
+                                                 out[0], out[1], out[2] );
+   case DIFF_MACD:
+      return (isRef? TA_REF_MACD : TA_MACD)( test->startIdx, test->endIdx, test->inReal,
+                                             test->optInTimePeriod, test->optInPeriod2,
+                                             test->optInPeriod3,
+                                             outBegIdx, outNBElement,
+                                             out[0], out[1], out[2] );
+   case DIFF_TRANGE:
+      return (isRef? TA_REF_TRANGE : TA_TRANGE)( test->startIdx, test->endIdx,
+                                                 data->high, data->low, data->close,
+                                                 outBegIdx, outNBElement, out[0] );
+   case DIFF_ATR:
+      return (isRef? TA_REF_ATR : TA_ATR)( test->startIdx, test->endIdx,
+                                           data->high, data->low, data->close,
+                                           test->optInTimePeriod,
+                                           outBegIdx, outNBElement, out[0] );
+   case DIFF_MAX:
+      return (isRef? TA_REF_MAX : TA_MAX)( test->startIdx, test->endIdx, test->inReal,
+                                           test->optInTimePeriod,
+                                           outBegIdx, outNBElement, out[0] );
+   case DIFF_MIN:
+      return (isRef? TA_REF_MIN : TA_MIN)( test->startIdx, test->endIdx, test->inReal,
+                                           test->optInTimePeriod,
+                                           outBegIdx, outNBElement, out[0] );
+   default:
+      break;
+   }
+
+   return TA_BAD_PARAM;
+}
+
+static TA_RetCode allocParams( const TA_DiffCase *test,
+                               double *const out[],
+                               TA_ParamHolder **params )
+{
+   const TA_FuncHandle *handle;
+   const TA_DiffData *data;
+   TA_RetCode retCode;
+   unsigned int i;
+
+   data = test->data;
+   *params = NULL;
+
+   retCode = TA_GetFuncHandle( tableFunc[test->func].name, &handle );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ParamHolderAlloc( handle, params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( tableFunc[test->func].isPrice )
+      retCode = TA_SetInputParamPricePtr( *params, 0, data->open, data->high, data->low,
+                                          data->close, data->volume, data->volume );
+   else
+      retCode = TA_SetInputParamRealPtr( *params, 0, test->inReal );
+
+   switch( test->func )
+   {
+   case DIFF_TRANGE:
+      break;
+   case DIFF_VAR:
+   case DIFF_STDDEV:
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 0, test->optInTimePeriod );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamReal( *params, 1, test->optInNbDevUp );
+      break;
+   case DIFF_BBANDS:
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 0, test->optInTimePeriod );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamReal( *params, 1, test->optInNbDevUp );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamReal( *params, 2, test->optInNbDevDn );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 3, (TA_Integer)test->optInMAType );
+      break;
+   case DIFF_MACD:
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 0, test->optInTimePeriod );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 1, test->optInPeriod2 );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 2, test->optInPeriod3 );
+      break;
+   default:
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetOptInputParamInteger( *params, 0, test->optInTimePeriod );
+      break;
+   }
+
+   for( i=0; (i < tableFunc[test->func].nbOutput) && (retCode == TA_SUCCESS); i++ )
+      retCode = TA_SetOutputParamRealPtr( *params, i, out[i] );
+
+   if( retCode != TA_SUCCESS )
+   {
+      TA_ParamHolderFree( *params );
+      *params = NULL;
+   }
+
+   return retCode;
+}
+
+static ErrorNumber compareWithRef( const TA_DiffCase *test, TA_DiffPath path,
+                                   TA_RetCode retCode,
+                                   int outBegIdx, int outNBElement,
+                                   double *const out[], double *ref[] )
+{
+   ErrorNumber retValue;
+   int refBegIdx, refNBElement;
+   unsigned int i;
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFail: retCode=%d\n", retCode );
+      printCase( test, path );
+      return TA_DIFF_TST_CALL_FAILED;
+   }
+
+   retCode = callFunc( test, 1, &refBegIdx, &refNBElement, ref );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFail: Reference retCode=%d\n", retCode );
+      printCase( test, path );
+      return TA_DIFF_TST_REF_FAILED;
+   }
+
+   retValue = TA_TEST_PASS;
+   for( i=0; (i < tableFunc[test->func].nbOutput) && (retValue == TA_TEST_PASS); i++ )
+      retValue = compareOutput( test, path, i, outBegIdx, outNBElement, out[i],
+                                refBegIdx, refNBElement, ref[i] );
+
+   return retValue;
+}
+
+static ErrorNumber compareOutput( const TA_DiffCase *test, TA_DiffPath path,
+                                  unsigned int outputIdx,
+                                  int outBegIdx, int outNBElement, const double *out,
+                                  int refBegIdx, int refNBElement, const double *ref )
+{
+   const TA_DiffTolerance *tolerance;
+   TA_DiffStat *stat;
+   double absErr, relErr, ulpErr, magnitude;
+   int i;
+
+   if( (outBegIdx != refBegIdx) || (outNBElement != refNBElement) )
+   {
+      printf( "\nFail: outBegIdx=%d outNBElement=%d, reference outBegIdx=%d outNBElement=%d\n",
+              outBegIdx, outNBElement, refBegIdx, refNBElement );
+      printCase( test, path );
+      return TA_DIFF_TST_BAD_RANGE;
+   }
+
+   stat = &diffStat[test->func][path];
+   tolerance = findTolerance( test->func, path );
+
+   stat->nbCall++;
+   for( i=0; i < outNBElement; i++ )
+   {
+      if( isnan( out[i] ) && isnan( ref[i] ) )
+         continue;
+
+      absErr = fabs( out[i]-ref[i] );
+      magnitude = fabs( out[i] ) > fabs( ref[i] )? fabs( out[i] ) : fabs( ref[i] );
+      relErr = (magnitude > 0.0)? absErr/magnitude : 0.0;
+      ulpErr = ulpDistance( out[i], ref[i] );
+
+      /* A NaN is an infinite error. */
+      if( isnan( absErr ) )
+      {
+         absErr = HUGE_VAL;
+         relErr = HUGE_VAL;
+      }
+
+      stat->nbValue++;
+      if( absErr > stat->maxAbsErr ) stat->maxAbsErr = absErr;
+      if( relErr > stat->maxRelErr ) stat->maxRelErr = relErr;
+      if( ulpErr > stat->maxUlpErr ) stat->maxUlpErr = ulpErr;
+
+      if( (ulpErr > tolerance->maxUlp) &&
+          (relErr > tolerance->maxRel) &&
+          (absErr > tolerance->maxAbs) )
+      {
+         printf( "\nFail: Output %u at index %d is %.17g, reference is %.17g (%g ULP)\n",
+                 outputIdx, outBegIdx+i, out[i], ref[i], ulpErr );
+         printCase( test, path );
+         return TA_DIFF_TST_BAD_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static const TA_DiffTolerance *findTolerance( TA_DiffFunc func, TA_DiffPath path )
+{
+   unsigned int i;
+
+   for( i=0; i < NB_TOLERANCE; i++ )
+   {
+      if( (tableTolerance[i].func == func) && (tableTolerance[i].path == path) )
+         return &tableTolerance[i];
+   }
+
+   return &exactTolerance;
+}
+
+/* Number of representable doubles between a and b. */
+static double ulpDistance( double a, double b )
+{
+   TA_Integer64 ia, ib;
+   unsigned long long diff;
+
+   if( a == b )
+      return 0.0;
+   if( isnan( a ) || isnan( b ) )
+      return HUGE_VAL;
+
+   /* Map the sign and magnitude of the doubles on a
+    * monotonic integer scale.
+    */
+   memcpy( &ia, &a, sizeof(ia) );
+   memcpy( &ib, &b, sizeof(ib) );
+   if( ia < 0 )
+      ia = (-9223372036854775807LL-1) - ia;
+   if( ib < 0 )
+      ib = (-9223372036854775807LL-1) - ib;
+
+   diff = (ia > ib)? (unsigned long long)ia - (unsigned long long)ib :
+                     (unsigned long long)ib - (unsigned long long)ia;
+
+   return (double)diff;
+}
+
+/* Values not written by a call are then detected. */
+static void fillNaN( double *out[], unsigned int nbBuffer )
+{
+   unsigned int i;
+   int j;
+
+   for( i=0; i < nbBuffer; i++ )
+   {
+      for( j=0; j < NB_BAR; j++ )
+         out[i][j] = sqrt( -1.0 );
+   }
+}
+
+static void printCase( const TA_DiffCase *test, TA_DiffPath path )
+{
+   printf( "      %s (%s), case %u\n", tableFunc[test->func].name, pathName[path], test->caseId );
+   printf( "      range [%d,%d], periods %d/%d/%d, nbDev %g/%g, MAType %d\n",
+           test->startIdx, test->endIdx, test->optInTimePeriod, test->optInPeriod2,
+           test->optInPeriod3, test->optInNbDevUp, test->optInNbDevDn, (int)test->optInMAType );
+   printf( "      unstable period %u, compatibility %d\n",
+           test->unstablePeriod, (int)test->compatibility );
+}
+
+static void printReport( void )
+{
+   const TA_DiffStat *stat;
+   int func, path;
+
+   printf( "\n\n   %-8s %-9s %6s %9s %12s %12s %10s\n",
+           "Function", "Path", "Calls", "Values", "Max abs", "Max rel", "Max ULP" );
+
+   for( func=0; func < NB_DIFF_FUNC; func++ )
+   {
+      for( path=0; path < NB_DIFF_PATH; path++ )
+      {
+         stat = &diffStat[func][path];
+         if( stat->nbCall == 0 )
+            continue;
+
+         printf( "   %-8s %-9s %6u %9u %12.3e %12.3e %10.0f\n",
+                 tableFunc[func].name, pathName[path], stat->nbCall, stat->nbValue,
+                 stat->maxAbsErr, stat->maxRelErr, stat->maxUlpErr );
+      }
+   }
+
+   printf( "%50s  ", "" );
+}
+
+static void randomCase( TA_DiffCase *test, TA_DiffFunc func,
+                        unsigned int caseId, const TA_DiffData *data )
+{
+   memset( test, 0, sizeof(TA_DiffCase) );
+   test->func   = func;
+   test->caseId = caseId;
+   test->data   = data;
+   test->inReal = data->close;
+
+   test->optInTimePeriod = randomPeriod();
+   test->optInPeriod2    = randomPeriod();
+   test->optInPeriod3    = randomPeriod();
+
+   switch( randomInt( 3 ) )
+   {
+   case 0:  test->optInNbDevUp = 1.0; break;
+   case 1:  test->optInNbDevUp = 2.0; break;
+   default: test->optInNbDevUp = 0.5+2.5*randomReal(); break;
+   }
+   test->optInNbDevDn = randomInt( 2 )? test->optInNbDevUp : 0.5+2.5*randomReal();
+   test->optInMAType  = randomInt( 2 )? TA_MAType_SMA : TA_MAType_EMA;
+
+   test->unstablePeriod = randomInt( 2 )? 0 : randomInt( 50 );
+   test->compatibility  = randomInt( 4 )? TA_COMPATIBILITY_DEFAULT : TA_COMPATIBILITY_METASTOCK;
+
+   /* Often the whole series, sometimes a small range. */
+   test->startIdx = randomInt( 3 )? (int)randomInt( NB_BAR/2 ) : 0;
+   test->endIdx   = randomInt( 2 )? NB_BAR-1 : test->startIdx+(int)randomInt( (unsigned int)(NB_BAR-test->startIdx) );
+}
+
+/* Mostly short periods, sometimes long ones. */
+static int randomPeriod( void )
+{
+   if( randomInt( 8 ) == 0 )
+      return 2+(int)randomInt( 999 );
+
+   return 2+(int)randomInt( 49 );
+}
+
+static unsigned int randomInt( unsigned int n )
+{
+   unsigned int value;
+
+   if( n == 0 )
+      return 0;
+
+   value = (unsigned int)(randomReal()*n);
+   return (value < n)? value : n-1;
+}
+
+static double randomReal( void )
+{
+   /* xorshift64*, in ]0,1[ */
+   randomState ^= randomState >> 12;
+   randomState ^= randomState << 25;
+   randomState ^= randomState >> 27;
+   return ((double)((randomState * 0x2545F4914F6CDD1DULL) >> 11) + 0.5) / 9007199254740992.0;
+}
@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  AB       Anatoliy Belsky
+ *  AG       Agent
  *
  *
  * Change history:
@@ -43,6 +44,7 @@
  *  MMDDYY BY   Description
  *  -------------------------------------------------------------------
  *  112400 AB   First version.
+ *  101926 AG   Add the period without body.
  *
  */
 
@@ -98,6 +100,7 @@ typedef struct
 /**** Local functions declarations.    ****/
 static ErrorNumber do_test( const TA_History *history,
                             const TA_Test *test );
+static ErrorNumber test_no_body( void );
 
 /**** Local variables definitions.     ****/
 
@@ -143,11 +146,57 @@ ErrorNumber test_func_imi( TA_History *history )
    /* Re-initialize all the unstable period to zero. */
    TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
 
+   retValue = test_no_body();
+   if( retValue != 0 )
+   {
+      printf( "%s Failed no body test (Code=%d)\n", __FILE__, retValue );
+      return retValue;
+   }
+
    /* All test succeed. */
    return TA_TEST_PASS;
 }
 
 /**** Local functions definitions.     ****/
+
+/* Open equal to close over the whole period: no gain and no
+ * loss, the output must be zero (not 0/0).
+ */
+static ErrorNumber test_no_body( void )
+{
+   TA_Real open[20], close[20], out[20];
+   TA_Integer outBegIdx, outNbElement;
+   TA_RetCode retCode;
+   int i;
+
+   /* Bars 0 to 9 have a body, bars 10 to 19 do not (the
+    * prices still move from one bar to the other).
+    */
+   for( i=0; i < 20; i++ )
+   {
+      open[i]  = 100.0+i;
+      close[i] = (i < 10)? open[i]+((i&1)? 1.0 : -0.5) : open[i];
+   }
+
+   retCode = TA_IMI( 0, 19, open, close, 5, &outBegIdx, &outNbElement, out );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+   if( outBegIdx != 4 )
+      return TA_TESTUTIL_TFRR_BAD_BEGIDX;
+   if( outNbElement != 16 )
+      return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+
+   /* The periods ending at bar 14 and after have no body. */
+   for( i=0; i < outNbElement; i++ )
+   {
+      if( (i+outBegIdx >= 14) && (out[i] != 0.0) )
+         return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+      if( (i+outBegIdx < 10) && ((out[i] <= 0.0) || (out[i] >= 100.0)) )
+         return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+   }
+
+   return TA_TEST_PASS;
+}
 static TA_RetCode rangeTestFunction( TA_Integer    startIdx,
                                      TA_Integer    endIdx,
                                      TA_Real      *outputBuffer,
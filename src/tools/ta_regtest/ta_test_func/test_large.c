@@ -0,0 +1,382 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Call all the TA functions on large synthetic series from
+ *     ta_datagen (geometric brownian motion, jumps, volatility
+ *     regimes, intraday gaps and constant runs).
+ *
+ *     Each function is called through the abstract interface with its
+ *     default optional inputs on the whole series. It must succeed,
+ *     start its output at its lookback and produce only finite values
+ *     (except the math transforms, like ACOS, undefined for most prices).
+ *
+ *     The functions are also called on a series with NaN holes, where
+ *     only the success of the call is verified.
+ *
+ *     The generator itself must be deterministic, and a series mapped
+ *     from a file must be identical to the one generated in memory.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_memory.h"
+#include "ta_datagen.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_BAR    100000
+#define FILE_NAME "ta_regtest_datagen.dat"
+
+typedef struct
+{
+   const char *name;
+   TA_Real    *open;
+   TA_Real    *high;
+   TA_Real    *low;
+   TA_Real    *close;
+   TA_Real    *volume;
+   int         nbBar;
+   int         withNaN;
+   ErrorNumber retValue;
+} TA_LargeTest;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber test_datagen( const TA_DataGenParam *param,
+                                 TA_Real *buffer );
+
+static ErrorNumber do_test( TA_LargeTest *test );
+
+static void testFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+
+static TA_RetCode setupParams( const TA_LargeTest *test,
+                               const TA_FuncInfo *funcInfo,
+                               TA_ParamHolder *params );
+
+static void setParam( TA_DataGenParam *param, TA_DataGenModel model );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_large( TA_History *history )
+{
+   TA_DataGenParam param;
+   TA_LargeTest test;
+   TA_Real *buffer;
+   ErrorNumber retValue;
+   int i;
+
+   (void)history;
+
+   /* Room for two series. */
+   buffer = TA_Malloc( sizeof(TA_Real)*NB_BAR*10 );
+   if( !buffer )
+      return TA_LARGE_TST_BAD_PARAM;
+
+   memset( &test, 0, sizeof(test) );
+   test.open   = &buffer[0];
+   test.high   = &buffer[NB_BAR];
+   test.low    = &buffer[NB_BAR*2];
+   test.close  = &buffer[NB_BAR*3];
+   test.volume = &buffer[NB_BAR*4];
+   test.nbBar  = NB_BAR;
+
+   setParam( &param, TA_DATAGEN_JUMP_DIFFUSION );
+   retValue = test_datagen( &param, buffer );
+
+   for( i=TA_DATAGEN_GBM; (i <= TA_DATAGEN_REGIME_SWITCHING) && (retValue == TA_TEST_PASS); i++ )
+   {
+      setParam( &param, (TA_DataGenModel)i );
+      TA_DataGenerate( &param, NB_BAR, test.open, test.high,
+                       test.low, test.close, test.volume );
+      test.name = TA_DataGenModelName( (TA_DataGenModel)i );
+      test.withNaN = 0;
+      retValue = do_test( &test );
+   }
+
+   if( retValue == TA_TEST_PASS )
+   {
+      setParam( &param, TA_DATAGEN_RANDOM_WALK );
+      param.nanHoleProb = 0.001;
+      TA_DataGenerate( &param, NB_BAR, test.open, test.high,
+                       test.low, test.close, test.volume );
+      test.name = "nan_holes";
+      test.withNaN = 1;
+      retValue = do_test( &test );
+   }
+
+   TA_Free( buffer );
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber test_datagen( const TA_DataGenParam *param,
+                                 TA_Real *buffer )
+{
+   TA_DataGenSeries series;
+   TA_Real *out[2];
+   int i, j;
+
+   out[0] = buffer;
+   out[1] = &buffer[NB_BAR*5];
+
+   /* Same series from one call to the other. */
+   for( i=0; i < 2; i++ )
+   {
+      if( !TA_DataGenerate( param, NB_BAR, out[i], out[i]+NB_BAR, out[i]+NB_BAR*2,
+                            out[i]+NB_BAR*3, out[i]+NB_BAR*4 ) )
+      {
+         printf( "Fail: TA_DataGenerate\n" );
+         return TA_LARGE_TST_BAD_PARAM;
+      }
+   }
+
+   if( memcmp( out[0], out[1], sizeof(TA_Real)*NB_BAR*5 ) != 0 )
+   {
+      printf( "Fail: TA_DataGenerate is not deterministic\n" );
+      return TA_LARGE_TST_DATAGEN;
+   }
+
+   for( i=0; i < NB_BAR; i++ )
+   {
+      if( !(out[0][NB_BAR+i] >= out[0][i]) || !(out[0][NB_BAR+i] >= out[0][NB_BAR*3+i]) ||
+          !(out[0][NB_BAR*2+i] <= out[0][i]) || !(out[0][NB_BAR*2+i] <= out[0][NB_BAR*3+i]) ||
+          !(out[0][NB_BAR*2+i] > 0.0) || !(out[0][NB_BAR*4+i] > 0.0) )
+      {
+         printf( "Fail: Bad bar at index %d\n", i );
+         return TA_LARGE_TST_DATAGEN;
+      }
+   }
+
+   /* Generated in the file the first time, reused the second time. */
+   remove( FILE_NAME );
+   for( j=0; j < 2; j++ )
+   {
+      if( !TA_DataGenMapFile( FILE_NAME, param, NB_BAR, &series ) )
+      {
+         printf( "Fail: TA_DataGenMapFile [%s]\n", FILE_NAME );
+         remove( FILE_NAME );
+         return TA_LARGE_TST_MAP_FILE;
+      }
+
+      if( (memcmp( series.open,   out[0],          sizeof(TA_Real)*NB_BAR ) != 0) ||
+          (memcmp( series.high,   out[0]+NB_BAR,   sizeof(TA_Real)*NB_BAR ) != 0) ||
+          (memcmp( series.low,    out[0]+NB_BAR*2, sizeof(TA_Real)*NB_BAR ) != 0) ||
+          (memcmp( series.close,  out[0]+NB_BAR*3, sizeof(TA_Real)*NB_BAR ) != 0) ||
+          (memcmp( series.volume, out[0]+NB_BAR*4, sizeof(TA_Real)*NB_BAR ) != 0) )
+      {
+         printf( "Fail: Mapped series differs (pass %d)\n", j );
+         TA_DataGenUnmapFile( &series );
+         remove( FILE_NAME );
+         return TA_LARGE_TST_MAP_FILE;
+      }
+
+      TA_DataGenUnmapFile( &series );
+   }
+
+   remove( FILE_NAME );
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber do_test( TA_LargeTest *test )
+{
+   test->retValue = TA_TEST_PASS;
+   TA_ForEachFunc( testFunc, test );
+   return test->retValue;
+}
+
+static void testFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   TA_LargeTest *test;
+   TA_ParamHolder *params;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_Integer outBegIdx, outNbElement, lookback;
+   TA_Real *outReal;
+   TA_RetCode retCode;
+   unsigned int i;
+   int j, checkFinite;
+
+   test = (TA_LargeTest *)opaqueData;
+   if( test->retValue != TA_TEST_PASS )
+      return;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &params );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: %s TA_ParamHolderAlloc retCode=%d\n", funcInfo->name, retCode );
+      test->retValue = TA_LARGE_TST_BAD_PARAM;
+      return;
+   }
+
+   retCode = setupParams( test, funcInfo, params );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_GetLookback( params, &lookback );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: %s setup retCode=%d\n", funcInfo->name, retCode );
+      test->retValue = TA_LARGE_TST_BAD_PARAM;
+      TA_ParamHolderFree( params );
+      return;
+   }
+
+   retCode = TA_CallFunc( params, 0, test->nbBar-1, &outBegIdx, &outNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: %s on %s retCode=%d\n", funcInfo->name, test->name, retCode );
+      test->retValue = TA_LARGE_TST_CALL_FAILED;
+      TA_ParamHolderFree( params );
+      return;
+   }
+
+   if( test->withNaN )
+   {
+      TA_ParamHolderFree( params );
+      return;
+   }
+
+   if( (outBegIdx != lookback) || (outNbElement != test->nbBar-lookback) )
+   {
+      printf( "Fail: %s on %s outBegIdx=%d outNbElement=%d (lookback=%d)\n",
+              funcInfo->name, test->name, outBegIdx, outNbElement, lookback );
+      test->retValue = TA_LARGE_TST_BAD_RANGE;
+      TA_ParamHolderFree( params );
+      return;
+   }
+
+   checkFinite = (strcmp( funcInfo->group, "Math Transform" ) != 0);
+   for( i=0; checkFinite && (i < funcInfo->nbOutput); i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type != TA_Output_Real )
+         continue;
+
+      TA_GetOutputParamRealPtr( params, i, &outReal );
+      for( j=0; j < outNbElement; j++ )
+      {
+         if( !isfinite( outReal[j] ) )
+         {
+            printf( "Fail: %s on %s output %u is %g at index %d\n",
+                    funcInfo->name, test->name, i, outReal[j], outBegIdx+j );
+            test->retValue = TA_LARGE_TST_BAD_VALUE;
+            break;
+         }
+      }
+   }
+
+   TA_ParamHolderFree( params );
+}
+
+static TA_RetCode setupParams( const TA_LargeTest *test,
+                               const TA_FuncInfo *funcInfo,
+                               TA_ParamHolder *params )
+{
+   const TA_Real *realInput[4];
+   const TA_InputParameterInfo *inputInfo;
+   TA_RetCode retCode;
+   unsigned int i, nbReal;
+
+   /* Same mapping as ta_bench (the second input of
+    * functions like CORREL or BETA must differ from the first).
+    */
+   realInput[0] = test->close;
+   realInput[1] = test->open;
+   realInput[2] = test->high;
+   realInput[3] = test->low;
+
+   nbReal = 0;
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         retCode = TA_SetInputParamPricePtr( params, i,
+                                             test->open, test->high,
+                                             test->low, test->close,
+                                             test->volume, test->volume );
+         break;
+      case TA_Input_Real:
+         retCode = TA_SetInputParamRealPtr( params, i, realInput[nbReal++ & 3] );
+         break;
+      default:
+         retCode = TA_BAD_PARAM;
+         break;
+      }
+
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   return TA_AllocOutputParam( params, 0, test->nbBar-1 );
+}
+
+static void setParam( TA_DataGenParam *param, TA_DataGenModel model )
+{
+   /* Sessions of 390 one minute bars, opening with
+    * a gap one time out of four.
+    */
+   TA_DataGenDefault( param, model );
+   param->barsPerSession  = 390;
+   param->gapProb         = 0.25;
+   param->constantRunProb = 0.0002;
+}
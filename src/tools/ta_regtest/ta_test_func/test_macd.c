@@ -132,6 +132,12 @@ static TA_Test tableTest[] =
                                                           0, -2.7071,  /* Signal */
                                                           0, (-1.9738)-(-2.7071) }, /* Histogram */
 
+   /* Signal period of 1: no signal lookback, the signal is the MACD. */
+   { 1, TA_MACD_TEST, 0, 251, 12, 26, 1, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,  25, 252-25,
+                                                          8, -1.9738,  /* MACD */
+                                                          8, -1.9738,  /* Signal */
+                                                          8, 0.0 }, /* Histogram */
+
    /***********************/
    /*   MACD - METASTOCK  */
    /***********************/
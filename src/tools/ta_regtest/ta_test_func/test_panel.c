@@ -0,0 +1,382 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *  AG       Agent
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101926 AG   First version.
+ *  101926 AG   Repeat the tests with an executor and the thread pool.
+ *
+ */
+
+/* Description:
+ *     Test the panel functions (TA_SMA_Panel, TA_EMA_Panel, TA_RSI_Panel).
+ *
+ *     The output of each series of a panel must be identical to
+ *     the output of the single series function called on the
+ *     whole range of that series.
+ *
+ *     The tests are repeated with a custom executor (running the
+ *     tasks in reverse order) and with the TA-Lib thread pool.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_panel.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_SERIES 9
+
+typedef enum {
+TA_SMA_PANEL_TEST,
+TA_EMA_PANEL_TEST,
+TA_RSI_PANEL_TEST } TA_PanelTestId;
+
+typedef struct
+{
+   TA_PanelTestId   theFunction;
+   TA_Integer       optInTimePeriod;
+   unsigned int     unstablePeriod;
+   TA_Compatibility compatibility;
+} TA_PanelTest;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_PanelTest *test );
+
+static TA_RetCode callPanel( TA_PanelTestId      theFunction,
+                             int                 nSeries,
+                             const int           inLength[],
+                             const double *const inReal[],
+                             int                 optInTimePeriod,
+                             int                 outBegIdx[],
+                             int                 outNBElement[],
+                             double *const       outReal[] );
+
+static void reverseExecutor( void       *executorData,
+                             int         nbTask,
+                             TA_TaskFunc taskFunc,
+                             void       *taskData );
+
+static TA_RetCode callSingle( TA_PanelTestId theFunction,
+                              int            endIdx,
+                              const double  *inReal,
+                              int            optInTimePeriod,
+                              int           *outBegIdx,
+                              int           *outNBElement,
+                              double        *outReal );
+
+/**** Local variables definitions.     ****/
+static TA_PanelTest tableTest[] =
+{
+   { TA_SMA_PANEL_TEST,  2,  0, TA_COMPATIBILITY_DEFAULT   },
+   { TA_SMA_PANEL_TEST, 30,  0, TA_COMPATIBILITY_DEFAULT   },
+   { TA_EMA_PANEL_TEST,  2,  0, TA_COMPATIBILITY_DEFAULT   },
+   { TA_EMA_PANEL_TEST, 14,  0, TA_COMPATIBILITY_DEFAULT   },
+   { TA_EMA_PANEL_TEST, 14, 25, TA_COMPATIBILITY_DEFAULT   },
+   { TA_EMA_PANEL_TEST, 14,  0, TA_COMPATIBILITY_METASTOCK },
+   { TA_EMA_PANEL_TEST, 14, 25, TA_COMPATIBILITY_METASTOCK },
+   { TA_RSI_PANEL_TEST,  2,  0, TA_COMPATIBILITY_DEFAULT   },
+   { TA_RSI_PANEL_TEST, 14,  0, TA_COMPATIBILITY_DEFAULT   },
+   { TA_RSI_PANEL_TEST, 14, 25, TA_COMPATIBILITY_DEFAULT   },
+   { TA_RSI_PANEL_TEST, 14,  0, TA_COMPATIBILITY_METASTOCK },
+   { TA_RSI_PANEL_TEST, 14, 25, TA_COMPATIBILITY_METASTOCK }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_PanelTest))
+
+/* Length of each series. Includes series too short to
+ * produce an output, an empty series and enough series
+ * to use more than one block of lanes.
+ */
+static const int seriesLength[NB_SERIES] = { 252, 250, 40, 10, 0, 200, 240, 17, 100 };
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_panel( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   int len, outBeg, outNb, executorMode;
+   const double *in;
+   double *out;
+   TA_ThreadPool *pool;
+
+   /* Parameter validation. */
+   len = 10;
+   in  = history->close;
+   out = TA_Malloc( sizeof(double)*len );
+   retCode = TA_RSI_Panel( -1, &len, &in, 14, &outBeg, &outNb, &out );
+   if( retCode != TA_BAD_PARAM )
+   {
+      TA_Free( out );
+      printf( "%s Failed negative nSeries (%d)\n", __FILE__, retCode );
+      return TA_PANEL_TST_BAD_PARAM;
+   }
+   retCode = TA_RSI_Panel( 1, &len, &in, 1, &outBeg, &outNb, &out );
+   if( retCode != TA_BAD_PARAM )
+   {
+      TA_Free( out );
+      printf( "%s Failed bad period (%d)\n", __FILE__, retCode );
+      return TA_PANEL_TST_BAD_PARAM;
+   }
+   retCode = TA_SMA_Panel( 1, &len, NULL, 14, &outBeg, &outNb, &out );
+   TA_Free( out );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "%s Failed NULL input (%d)\n", __FILE__, retCode );
+      return TA_PANEL_TST_BAD_PARAM;
+   }
+
+   retCode = TA_ThreadPoolAlloc( 4, 0, &pool );
+   if( (retCode != TA_SUCCESS) && (retCode != TA_NOT_SUPPORTED) )
+   {
+      printf( "%s Failed TA_ThreadPoolAlloc (%d)\n", __FILE__, retCode );
+      return TA_PANEL_TST_THREAD_POOL;
+   }
+
+   /* Do all the tests without executor, with a custom
+    * executor and with the thread pool (if supported).
+    */
+   for( executorMode=0; executorMode < 3; executorMode++ )
+   {
+      switch( executorMode )
+      {
+      case 0: TA_SetExecutor( NULL, NULL ); break;
+      case 1: TA_SetExecutor( reverseExecutor, NULL ); break;
+      case 2:
+         if( !pool )
+            continue;
+         TA_SetExecutor( TA_ThreadPoolExecutor, pool );
+         break;
+      }
+
+      for( i=0; i < NB_TEST; i++ )
+      {
+         retValue = do_test( history, &tableTest[i] );
+
+         TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+         TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+         if( retValue != 0 )
+         {
+            TA_SetExecutor( NULL, NULL );
+            TA_ThreadPoolFree( pool );
+            printf( "%s Failed Test #%d Executor #%d (Code=%d)\n", __FILE__,
+                    i, executorMode, retValue );
+            return retValue;
+         }
+      }
+   }
+
+   TA_SetExecutor( NULL, NULL );
+   if( TA_ThreadPoolFree( pool ) != TA_SUCCESS )
+   {
+      printf( "%s Failed TA_ThreadPoolFree\n", __FILE__ );
+      return TA_PANEL_TST_THREAD_POOL;
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_PanelTest *test )
+{
+   const double *in[NB_SERIES];
+   double       *out[NB_SERIES];
+   double       *expected;
+   int           outBegIdx[NB_SERIES], outNBElement[NB_SERIES];
+   int           expBegIdx, expNbElement;
+   int           i, j, inPlace;
+   TA_RetCode    retCode;
+   ErrorNumber   retValue;
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, test->unstablePeriod );
+   TA_SetCompatibility( test->compatibility );
+
+   expected = TA_Malloc( sizeof(double)*history->nbBars );
+   if( !expected )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   retValue = TA_TEST_PASS;
+
+   /* Do the test twice: with distinct output buffers, then
+    * with the output written over the input.
+    */
+   for( inPlace=0; (inPlace < 2) && (retValue == TA_TEST_PASS); inPlace++ )
+   {
+      for( i=0; i < NB_SERIES; i++ )
+      {
+         out[i] = TA_Malloc( sizeof(double)*history->nbBars );
+         /* Each series starts at a different bar of the history. */
+         memcpy( out[i], &history->close[i], sizeof(double)*(history->nbBars-i) );
+         in[i] = inPlace? out[i] : &history->close[i];
+      }
+
+      retCode = callPanel( test->theFunction, NB_SERIES, seriesLength, in,
+                           test->optInTimePeriod, outBegIdx, outNBElement, out );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: Panel call retCode=%d\n", retCode );
+         retValue = TA_PANEL_TST_CALL_FAILED;
+      }
+
+      for( i=0; (i < NB_SERIES) && (retValue == TA_TEST_PASS); i++ )
+      {
+         expBegIdx = expNbElement = 0;
+         if( seriesLength[i] > 0 )
+         {
+            retCode = callSingle( test->theFunction, seriesLength[i]-1, &history->close[i],
+                                  test->optInTimePeriod, &expBegIdx, &expNbElement, expected );
+            if( retCode != TA_SUCCESS )
+            {
+               printf( "Fail: Single call retCode=%d\n", retCode );
+               retValue = TA_PANEL_TST_CALL_FAILED;
+               break;
+            }
+         }
+
+         if( (outBegIdx[i] != expBegIdx) || (outNBElement[i] != expNbElement) )
+         {
+            printf( "Fail: Series #%d outBegIdx=%d(%d) outNBElement=%d(%d)\n",
+                    i, outBegIdx[i], expBegIdx, outNBElement[i], expNbElement );
+            retValue = TA_PANEL_TST_BAD_RANGE;
+            break;
+         }
+
+         for( j=0; j < expNbElement; j++ )
+         {
+            if( out[i][j] != expected[j] )
+            {
+               printf( "Fail: Series #%d value[%d]=%g (expected %g) inPlace=%d\n",
+                       i, j, out[i][j], expected[j], inPlace );
+               retValue = TA_PANEL_TST_BAD_VALUE;
+               break;
+            }
+         }
+      }
+
+      for( i=0; i < NB_SERIES; i++ )
+         TA_Free( out[i] );
+   }
+
+   TA_Free( expected );
+   return retValue;
+}
+
+static TA_RetCode callPanel( TA_PanelTestId      theFunction,
+                             int                 nSeries,
+                             const int           inLength[],
+                             const double *const inReal[],
+                             int                 optInTimePeriod,
+                             int                 outBegIdx[],
+                             int                 outNBElement[],
+                             double *const       outReal[] )
+{
+   switch( theFunction )
+   {
+   case TA_SMA_PANEL_TEST:
+      return TA_SMA_Panel( nSeries, inLength, inReal, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal );
+   case TA_EMA_PANEL_TEST:
+      return TA_EMA_Panel( nSeries, inLength, inReal, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal );
+   case TA_RSI_PANEL_TEST:
+      return TA_RSI_Panel( nSeries, inLength, inReal, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal );
+   }
+
+   return TA_BAD_PARAM;
+}
+
+static void reverseExecutor( void       *executorData,
+                             int         nbTask,
+                             TA_TaskFunc taskFunc,
+                             void       *taskData )
+{
+   int i;
+
+   (void)executorData;
+
+   for( i=nbTask-1; i >= 0; i-- )
+      taskFunc( taskData, i );
+}
+
+static TA_RetCode callSingle( TA_PanelTestId theFunction,
+                              int            endIdx,
+                              const double  *inReal,
+                              int            optInTimePeriod,
+                              int           *outBegIdx,
+                              int           *outNBElement,
+                              double        *outReal )
+{
+   switch( theFunction )
+   {
+   case TA_SMA_PANEL_TEST:
+      return TA_SMA( 0, endIdx, inReal, optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case TA_EMA_PANEL_TEST:
+      return TA_EMA( 0, endIdx, inReal, optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case TA_RSI_PANEL_TEST:
+      return TA_RSI( 0, endIdx, inReal, optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   }
+
+   return TA_BAD_PARAM;
+}
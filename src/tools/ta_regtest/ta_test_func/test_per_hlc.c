@@ -48,6 +48,8 @@
  *  021106 MF   Add tests for ULTOSC.
  *  042206 MF   Add tests for NATR
  *  120507 MF   Add tests for ACCBANDS
+ *  101926 AG   Range test of NATR, test NATR past its lookback and
+ *              with a zero close.
  *
  */
 
@@ -119,6 +121,7 @@ typedef struct
 /**** Local functions declarations.    ****/
 static ErrorNumber do_test( const TA_History *history,
                             const TA_Test *test );
+static ErrorNumber test_natr_close( const TA_History *history );
 
 /**** Local variables definitions.     ****/
 
@@ -132,12 +135,9 @@ static TA_Test tableTest[] =
    /****************/
    /* NATR TEST    */
    /****************/
-   /* TODO Analyze further why NATR requires a very large unstable period.
-    * for now, just disable range testing.
-    */
    { 0, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,       0,  3.9321, 14,  252-14 },
    { 0, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,       1,  3.7576, 14,  252-14 },
-   { 0, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,  252-15,  3.0229, 14,  252-14 },
+   { 1, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,  252-15,  3.0229, 14,  252-14 },
 
    /****************/
    /* ULTOSC TEST  */
@@ -232,11 +232,70 @@ ErrorNumber test_func_per_hlc( TA_History *history )
    /* Re-initialize all the unstable period to zero. */
    TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
 
+   retValue = test_natr_close( history );
+   if( retValue != 0 )
+   {
+      printf( "Failed NATR close test (Code=%d)\n", retValue );
+      return retValue;
+   }
+
    /* All test succeed. */
    return TA_TEST_PASS;
 }
 
 /**** Local functions definitions.     ****/
+
+/* NATR is the ATR over the close of the same bar, also when
+ * startIdx is past the lookback. A zero close gives zero.
+ */
+static ErrorNumber test_natr_close( const TA_History *history )
+{
+   TA_Real atr[100], natr[100], close[100];
+   TA_Integer outBegIdx, outNbElement, atrBegIdx, atrNbElement;
+   TA_RetCode retCode;
+   int i;
+
+   retCode = TA_NATR( 100, 199, history->high, history->low, history->close, 14,
+                      &outBegIdx, &outNbElement, natr );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ATR( 100, 199, history->high, history->low, history->close, 14,
+                        &atrBegIdx, &atrNbElement, atr );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+   if( (outBegIdx != 100) || (atrBegIdx != 100) )
+      return TA_TESTUTIL_TFRR_BAD_BEGIDX;
+   if( (outNbElement != 100) || (atrNbElement != 100) )
+      return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+
+   for( i=0; i < 100; i++ )
+   {
+      if( natr[i] != (atr[i]/history->close[100+i])*100.0 )
+         return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+   }
+
+   /* Same bars, starting at zero, with a zero close at bar 50. */
+   memcpy( close, &history->close[100], sizeof(close) );
+   close[50] = 0.0;
+   for( i=0; i < 100; i++ )
+      natr[i] = -1.0;
+   retCode = TA_NATR( 14, 99, &history->high[100], &history->low[100], close, 14,
+                      &outBegIdx, &outNbElement, natr );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+   if( outBegIdx != 14 )
+      return TA_TESTUTIL_TFRR_BAD_BEGIDX;
+   if( outNbElement != 86 )
+      return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+   if( natr[50-14] != 0.0 )
+      return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+   for( i=0; i < outNbElement; i++ )
+   {
+      if( (i != 50-14) && (natr[i] <= 0.0) )
+         return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+   }
+
+   return TA_TEST_PASS;
+}
 static TA_RetCode rangeTestFunction( TA_Integer    startIdx,
                                      TA_Integer    endIdx,
                                      TA_Real      *outputBuffer,
@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
+ *  AG       Agent
  *
  *
  * Change history:
@@ -48,6 +49,20 @@
  *  062504 MF   Add test_default_calls.
  *  110206 AC   Change volume and open interest to double
  *  082607 MF   Add profiling feature.
+ *  101926 AG   Add test_parallel_calls.
+ *  101926 AG   Add test_scratch_calls.
+ *  101926 AG   Add test_lookup_tables.
+ *  101926 AG   Add test_param_holder.
+ *  101926 AG   Add test_strided_calls.
+ *  101926 AG   Add test_plan_calls.
+ *  101926 AG   Add test_batch_calls.
+ *  101926 AG   Add test_calls64.
+ *  101926 AG   Add test_alloc_output.
+ *  101926 AG   Add test_meta.
+ *  101926 AG   Add test_stats.
+ *  101926 AG   Add test_trace.
+ *  101926 AG   Add test_strict_alloc.
+ *  101926 AG   Share the TA_ForEachFunc callback (checkAllFunc).
  */
 
 /* Description:
@@ -66,9 +81,11 @@
 #endif
 
 #include <stdio.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <math.h>
 #include "ta_test_priv.h"
 
 /**** External functions declarations. ****/
@@ -102,13 +119,82 @@ typedef enum
 	PROFILING_100
 } ProfilingType;
 
+/* Check done by checkAllFunc for each function. */
+typedef ErrorNumber (*FuncCheck)( const TA_FuncInfo *funcInfo );
+
+typedef struct
+{
+   FuncCheck   check;
+   const char *label;
+   ErrorNumber errorNumber;
+} FuncCheckData;
+
 /**** Local functions declarations.    ****/
 static ErrorNumber testLookback(TA_ParamHolder *paramHolder );
+static ErrorNumber test_lookup_tables(void);
+static ErrorNumber test_param_holder(void);
+static ErrorNumber callBBands( TA_ParamHolder *params, double *out );
+static ErrorNumber compareStringTable( const TA_StringTable *table1,
+                                       const TA_StringTable *table2 );
+static void countFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static ErrorNumber checkAllFunc( FuncCheck check, const char *label );
+static void checkFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
 static ErrorNumber test_default_calls(void);
 static ErrorNumber callWithDefaults( const char *funcName,
 									 const double *input,
 									 const int *input_int, int size );
 static ErrorNumber callAndProfile( const char *funcName, ProfilingType type );
+static ErrorNumber test_parallel_calls(void);
+static ErrorNumber callParallel( const TA_FuncInfo *funcInfo );
+static ErrorNumber test_scratch_calls(void);
+static ErrorNumber callScratch( const char *funcName, TA_Context *context );
+static ErrorNumber checkScratchCall( TA_ParamHolder *paramHolder,
+                                     const TA_FuncInfo *funcInfo,
+                                     TA_Context *context );
+static ErrorNumber test_strided_calls(void);
+static ErrorNumber callStrided( const TA_FuncInfo *funcInfo );
+static void setStridedInput( TA_ParamHolder *paramHolder,
+                             const TA_FuncHandle *handle,
+                             unsigned int step );
+static ErrorNumber checkStridedCall( TA_ParamHolder *paramHolder,
+                                     TA_ParamHolder *stridedHolder,
+                                     const TA_FuncInfo *funcInfo,
+                                     int startIdx, int endIdx,
+                                     int nbThread );
+static ErrorNumber test_plan_calls(void);
+static ErrorNumber test_plan_overlap(void);
+static ErrorNumber test_batch_calls(void);
+static ErrorNumber test_calls64(void);
+static ErrorNumber checkCall64( const char *name, TA_RetCode retCode,
+                                TA_Integer64 outBegIdx, TA_Integer64 outNbElement,
+                                TA_RetCode expRetCode,
+                                int expBegIdx, int expNbElement );
+static ErrorNumber test_alloc_output(void);
+static ErrorNumber callAllocOutput( const TA_FuncInfo *funcInfo );
+static ErrorNumber checkAllocOutput( TA_ParamHolder *paramHolder,
+                                     TA_ParamHolder *allocHolder,
+                                     const TA_FuncInfo *funcInfo,
+                                     int startIdx, int endIdx );
+static ErrorNumber test_meta(void);
+static ErrorNumber checkMetaFunc( const TA_FuncInfo *funcInfo );
+static ErrorNumber checkMetaLookback( const TA_MetaHeader *header,
+                                      const TA_MetaFunc *func,
+                                      const TA_FuncInfo *funcInfo );
+static int compareNoCase( const char *s1, const char *s2 );
+static ErrorNumber test_stats(void);
+static ErrorNumber test_trace(void);
+static ErrorNumber test_strict_alloc(void);
+#if defined( TA_STATS )
+static int strictAllocHook( const TA_FuncHandle *handle, size_t size, void *userData );
+#endif
+#if defined( TA_TRACE )
+static void traceEnter( const TA_TraceCall *call, void *userData );
+static void traceExit ( const TA_TraceCall *call, TA_RetCode retCode,
+                        void *userData );
+#endif
+static void *countingMalloc ( void *allocatorData, size_t size );
+static void *countingRealloc( void *allocatorData, void *ptr, size_t size );
+static void  countingFree   ( void *allocatorData, void *ptr );
 
 /**** Local variables definitions.     ****/
 static double inputNegData[100];
@@ -126,6 +212,53 @@ static int    inputRandomData_int[2000];
 static double output[10][2000];
 static int    output_int[10][2000];
 
+#define PARALLEL_INPUT_SIZE 5000
+static double parallelInput[PARALLEL_INPUT_SIZE];
+static int    parallelInput_int[PARALLEL_INPUT_SIZE];
+static double paramHolderInput[100];
+
+/* Same price bars in 5 arrays and as records of 'step' values
+ * (time, open, high, low, close, volume, ...).
+ */
+#define STRIDED_NB_FIELD 5
+static double stridedField[STRIDED_NB_FIELD][PARALLEL_INPUT_SIZE];
+static double stridedBar[8*PARALLEL_INPUT_SIZE];
+static double parallelOutput[2][10][PARALLEL_INPUT_SIZE];
+static int    parallelOutput_int[2][10][PARALLEL_INPUT_SIZE];
+
+/* A call added to a TA_Plan, the optional inputs are in order. */
+typedef struct
+{
+   const char *name;
+   double optIn[4];
+   unsigned int step; /* Strided input when not zero. */
+   int startIdx;
+   int endIdx;
+} PlanCall;
+
+#define PLAN_NB_CALL    27
+#define BATCH_NB_CALL   19
+#define PLAN_INPUT_SIZE 2000
+static double planOutput[PLAN_NB_CALL][3][PLAN_INPUT_SIZE];
+
+static ErrorNumber setPlanCall( const PlanCall *planCall,
+                                TA_ParamHolder **paramHolder,
+                                double out[3][PLAN_INPUT_SIZE] );
+static ErrorNumber checkPlanCall( const PlanCall *planCall,
+                                  TA_ParamHolder *paramHolder,
+                                  const TA_CallResult *result,
+                                  double out[3][PLAN_INPUT_SIZE] );
+
+/* Counts the calls to the allocator. */
+typedef struct
+{
+   int nbMalloc;
+   int nbFree;
+} AllocatorCount;
+
+static AllocatorCount scratchCount;
+static AllocatorCount globalCount;
+
 /**** Global functions definitions.   ****/
 ErrorNumber test_abstract( void )
 {
@@ -172,6 +305,22 @@ ErrorNumber test_abstract( void )
       return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
    }
 
+   /* Verify the name lookup and the immutable tables. */
+   retValue = test_lookup_tables();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "test_lookup_tables() failed [%d]\n", retValue );
+      return retValue;
+   }
+
+   /* Verify TA_ParamHolderInit/TA_ParamHolderClone. */
+   retValue = test_param_holder();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "test_param_holder() failed [%d]\n", retValue );
+      return retValue;
+   }
+
    retValue = freeLib();
    if( retValue != TA_TEST_PASS )
       return retValue;
@@ -188,6 +337,83 @@ ErrorNumber test_abstract( void )
       return retValue;
    }
 
+   retValue = test_parallel_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract parallel call failed\n" );
+      return retValue;
+   }
+
+   retValue = test_scratch_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract scratch call failed\n" );
+      return retValue;
+   }
+
+   retValue = test_strided_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract strided call failed\n" );
+      return retValue;
+   }
+
+   retValue = test_plan_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract plan call failed\n" );
+      return retValue;
+   }
+
+   retValue = test_batch_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract batch call failed\n" );
+      return retValue;
+   }
+
+   retValue = test_calls64();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract 64 bits call failed\n" );
+      return retValue;
+   }
+
+   retValue = test_alloc_output();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract output allocation failed\n" );
+      return retValue;
+   }
+
+   retValue = test_meta();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract metadata failed\n" );
+      return retValue;
+   }
+
+   retValue = test_stats();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract statistics failed\n" );
+      return retValue;
+   }
+
+   retValue = test_trace();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract tracing failed\n" );
+      return retValue;
+   }
+
+   retValue = test_strict_alloc();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract strict allocation failed\n" );
+      return retValue;
+   }
+
    retValue = freeLib();
    if( retValue != TA_TEST_PASS )
       return retValue;
@@ -296,6 +522,293 @@ static ErrorNumber testLookback( TA_ParamHolder *paramHolder )
   return TA_TEST_PASS;
 }
 
+static void countFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   (void)funcInfo;
+   (*(unsigned int *)opaqueData)++;
+}
+
+/* Call 'check' for all functions, until one fails. The
+ * 'label' identifies the test in the failure message.
+ */
+static ErrorNumber checkAllFunc( FuncCheck check, const char *label )
+{
+   FuncCheckData data;
+
+   data.check       = check;
+   data.label       = label;
+   data.errorNumber = TA_TEST_PASS;
+   TA_ForEachFunc( checkFunc, &data );
+
+   return data.errorNumber;
+}
+
+static void checkFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   FuncCheckData *data;
+
+   data = (FuncCheckData *)opaqueData;
+   if( data->errorNumber != TA_TEST_PASS )
+      return;
+
+   data->errorNumber = data->check( funcInfo );
+   if( data->errorNumber != TA_TEST_PASS )
+      printf( "Failed for [%s] %s\n", funcInfo->name, data->label );
+}
+
+static ErrorNumber compareStringTable( const TA_StringTable *table1,
+                                       const TA_StringTable *table2 )
+{
+   unsigned int i;
+
+   if( table1->size != table2->size )
+      return TA_ABS_TST_FAIL_CACHED_TABLE;
+
+   for( i=0; i < table1->size; i++ )
+   {
+      if( strcmp( table1->string[i], table2->string[i] ) != 0 )
+         return TA_ABS_TST_FAIL_CACHED_TABLE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber test_lookup_tables( void )
+{
+   static const char *notFound[] = { "RS", "RSIX", "ZZZ", "_RSI", "1RSI", "CDL" };
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   TA_StringTable *groupTable, *funcTable;
+   const TA_StringTable *groupTableGet, *funcTableGet;
+   const TA_FuncHandle *handle, *handleNoCase;
+   const TA_FuncInfo *funcInfo;
+   unsigned int i, j, k, nbFunc, nbFuncInGroups;
+   char name[64];
+
+   retCode = TA_GroupTableAlloc( &groupTable );
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_CACHED_TABLE;
+
+   retCode = TA_GroupTableGet( &groupTableGet );
+   if( (retCode != TA_SUCCESS) || (groupTableGet->size == 0) )
+   {
+      TA_GroupTableFree( groupTable );
+      return TA_ABS_TST_FAIL_CACHED_TABLE;
+   }
+
+   retValue = compareStringTable( groupTable, groupTableGet );
+
+   /* Every function of every group must be found by name, with any case. */
+   nbFuncInGroups = 0;
+   for( i=0; (i < groupTable->size) && (retValue == TA_TEST_PASS); i++ )
+   {
+      retCode = TA_FuncTableAlloc( groupTable->string[i], &funcTable );
+      if( retCode != TA_SUCCESS )
+      {
+         retValue = TA_ABS_TST_FAIL_CACHED_TABLE;
+         break;
+      }
+
+      retCode = TA_FuncTableGet( groupTable->string[i], &funcTableGet );
+      if( retCode != TA_SUCCESS )
+         retValue = TA_ABS_TST_FAIL_CACHED_TABLE;
+      else
+         retValue = compareStringTable( funcTable, funcTableGet );
+
+      for( j=0; (j < funcTable->size) && (retValue == TA_TEST_PASS); j++ )
+      {
+         retCode = TA_GetFuncHandle( funcTable->string[j], &handle );
+         if( (retCode != TA_SUCCESS) ||
+             (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) ||
+             (strcmp( funcInfo->name, funcTable->string[j] ) != 0) )
+         {
+            printf( "TA_GetFuncHandle failed for [%s]\n", funcTable->string[j] );
+            retValue = TA_ABS_TST_FAIL_NAME_LOOKUP;
+            break;
+         }
+
+         /* Same lookup in lower case, and with the case alternating. */
+         for( k=0; funcTable->string[j][k] && (k < sizeof(name)-1); k++ )
+            name[k] = (char)tolower( (unsigned char)funcTable->string[j][k] );
+         name[k] = '\0';
+         retCode = TA_GetFuncHandle( name, &handleNoCase );
+         if( (retCode != TA_SUCCESS) || (handleNoCase != handle) )
+         {
+            printf( "TA_GetFuncHandle failed for [%s]\n", name );
+            retValue = TA_ABS_TST_FAIL_NAME_LOOKUP;
+            break;
+         }
+
+         for( k=0; name[k]; k += 2 )
+            name[k] = (char)toupper( (unsigned char)name[k] );
+         retCode = TA_GetFuncHandle( name, &handleNoCase );
+         if( (retCode != TA_SUCCESS) || (handleNoCase != handle) )
+         {
+            printf( "TA_GetFuncHandle failed for [%s]\n", name );
+            retValue = TA_ABS_TST_FAIL_NAME_LOOKUP;
+            break;
+         }
+      }
+
+      nbFuncInGroups += funcTable->size;
+      TA_FuncTableFree( funcTable );
+   }
+
+   TA_GroupTableFree( groupTable );
+
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All the functions belong to a group. */
+   nbFunc = 0;
+   TA_ForEachFunc( countFunc, &nbFunc );
+   if( nbFunc != nbFuncInGroups )
+   {
+      printf( "Function count mismatch [%u != %u]\n", nbFunc, nbFuncInGroups );
+      return TA_ABS_TST_FAIL_CACHED_TABLE;
+   }
+
+   /* Unknown names and bad parameters. */
+   for( i=0; i < sizeof(notFound)/sizeof(notFound[0]); i++ )
+   {
+      retCode = TA_GetFuncHandle( notFound[i], &handle );
+      if( (retCode != TA_FUNC_NOT_FOUND) || (handle != NULL) )
+      {
+         printf( "TA_GetFuncHandle found [%s]\n", notFound[i] );
+         return TA_ABS_TST_FAIL_NAME_LOOKUP;
+      }
+   }
+
+   if( (TA_GetFuncHandle( "", &handle ) != TA_BAD_PARAM) ||
+       (TA_GetFuncHandle( NULL, &handle ) != TA_BAD_PARAM) ||
+       (TA_FuncTableGet( "Unknown Group", &funcTableGet ) != TA_GROUP_NOT_FOUND) ||
+       (TA_FuncTableGet( NULL, &funcTableGet ) != TA_BAD_PARAM) ||
+       (TA_GroupTableGet( NULL ) != TA_BAD_PARAM) )
+   {
+      return TA_ABS_TST_FAIL_NAME_LOOKUP;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Call BBANDS on 100 values of paramHolderInput. The
+ * 3 outputs are written one after the other in 'out'.
+ */
+static ErrorNumber callBBands( TA_ParamHolder *params, double *out )
+{
+   TA_Integer outBegIdx, outNbElement;
+   unsigned int i;
+
+   if( TA_SetInputParamRealPtr( params, 0, paramHolderInput ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+
+   for( i=0; i < 3; i++ )
+   {
+      if( TA_SetOutputParamRealPtr( params, i, &out[i*100] ) != TA_SUCCESS )
+         return TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+   }
+
+   if( TA_CallFunc( params, 0, 99, &outBegIdx, &outNbElement ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber test_param_holder( void )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params, *placed, *clone, *placedClone;
+   size_t size;
+   char buffer[2048];
+   char cloneBuffer[2048];
+   int i;
+
+   for( i=0; i < 100; i++ )
+      paramHolderInput[i] = 100.0 + 10.0*sin( (double)i/5.0 ) + (double)(i%7);
+
+   memset( output, 0, sizeof(output) );
+   retValue = TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+   params = clone = NULL;
+
+   if( (TA_GetFuncHandle( "BBANDS", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderSize( handle, &size ) != TA_SUCCESS) ||
+       (size+3 > sizeof(buffer)) )
+      return TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+
+   /* The whole holder is a single allocation. */
+   memset( &globalCount, 0, sizeof(globalCount) );
+   if( TA_SetAllocator( countingMalloc, countingRealloc, countingFree, &globalCount ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+   retCode = TA_ParamHolderAlloc( handle, &params );
+   if( (retCode != TA_SUCCESS) || (globalCount.nbMalloc != 1) )
+      goto done;
+
+   if( (TA_SetOptInputParamInteger( params, 0, 10 ) != TA_SUCCESS) ||
+       (TA_SetOptInputParamReal( params, 1, 1.5 ) != TA_SUCCESS) )
+      goto done;
+
+   retValue = callBBands( params, output[0] );
+   if( retValue != TA_TEST_PASS )
+      goto done;
+
+   /* An allocated clone keeps the settings, independently of the original. */
+   retValue = TA_ABS_TST_FAIL_PARAM_HOLDER_CLONE;
+   retCode = TA_ParamHolderClone( params, NULL, 0, &clone );
+   if( (retCode != TA_SUCCESS) || (globalCount.nbMalloc != 2) )
+      goto done;
+
+   if( (callBBands( clone, output[1] ) != TA_TEST_PASS) ||
+       (memcmp( output[0], output[1], 300*sizeof(double) ) != 0) )
+      goto done;
+
+   if( (TA_SetOptInputParamReal( clone, 1, 3.0 ) != TA_SUCCESS) ||
+       (callBBands( clone, output[1] ) != TA_TEST_PASS) ||
+       (callBBands( params, output[2] ) != TA_TEST_PASS) ||
+       (memcmp( output[0], output[2], 300*sizeof(double) ) != 0) ||
+       (memcmp( output[0], output[1], 300*sizeof(double) ) == 0) )
+      goto done;
+
+   /* Placed in a misaligned buffer, with the default values. */
+   retValue = TA_ABS_TST_FAIL_PARAM_HOLDER_INIT;
+   if( (TA_ParamHolderInit( handle, &buffer[1], size-1, &placed ) != TA_BAD_PARAM) ||
+       (TA_ParamHolderInit( handle, &buffer[1], size, &placed ) != TA_SUCCESS) )
+      goto done;
+
+   if( (TA_SetOptInputParamInteger( placed, 0, 10 ) != TA_SUCCESS) ||
+       (TA_SetOptInputParamReal( placed, 1, 1.5 ) != TA_SUCCESS) ||
+       (callBBands( placed, output[3] ) != TA_TEST_PASS) ||
+       (memcmp( output[0], output[3], 300*sizeof(double) ) != 0) )
+      goto done;
+
+   /* A clone placed in a buffer, then invalidated by TA_ParamHolderFree. */
+   retValue = TA_ABS_TST_FAIL_PARAM_HOLDER_CLONE;
+   if( (TA_ParamHolderClone( placed, &cloneBuffer[3], size, &placedClone ) != TA_SUCCESS) ||
+       (callBBands( placedClone, output[4] ) != TA_TEST_PASS) ||
+       (memcmp( output[0], output[4], 300*sizeof(double) ) != 0) ||
+       (TA_ParamHolderFree( placedClone ) != TA_SUCCESS) ||
+       (TA_ParamHolderFree( placed ) != TA_SUCCESS) ||
+       (TA_ParamHolderClone( placed, NULL, 0, &placedClone ) != TA_INVALID_PARAM_HOLDER) )
+      goto done;
+
+   /* Nothing allocated for the placed holders. */
+   if( globalCount.nbMalloc != 2 )
+      goto done;
+
+   retValue = TA_TEST_PASS;
+
+done:
+   TA_ParamHolderFree( clone );
+   TA_ParamHolderFree( params );
+   TA_SetAllocator( NULL, NULL, NULL, NULL );
+
+   if( (retValue == TA_TEST_PASS) && (globalCount.nbMalloc != globalCount.nbFree) )
+      retValue = TA_ABS_TST_FAIL_PARAM_HOLDER_CLONE;
+
+   return retValue;
+}
+
 /* Some processings are a bit different for functions under
  * the Math Operator and Math Transform category.
  */
@@ -786,3 +1299,1877 @@ static ErrorNumber callAndProfile( const char *funcName, ProfilingType type )
 
    return TA_TEST_PASS;
 }
+
+/* Verify that TA_CallFuncParallel gives the same output
+ * than TA_CallFunc for all functions.
+ */
+static ErrorNumber test_parallel_calls(void)
+{
+   unsigned int i;
+   double tempDouble;
+
+   for( i=0; i < PARALLEL_INPUT_SIZE; i++ )
+   {
+      /* Keep the input range within ]0..1[ */
+      tempDouble = (double)rand() / ((double)(RAND_MAX)+(double)(1));
+      while( (tempDouble <= 0.0) || (tempDouble >= 1.0) )
+         tempDouble = (double)rand() / ((double)(RAND_MAX)+(double)(1));
+      parallelInput[i] = tempDouble;
+      parallelInput_int[i] = (int)(tempDouble*100.0);
+   }
+
+   return checkAllFunc( callParallel, "parallel call" );
+}
+
+static ErrorNumber callParallel( const TA_FuncInfo *funcInfo )
+{
+   TA_ParamHolder *paramHolder;
+   const TA_FuncHandle *handle;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+
+   TA_RetCode retCode;
+   unsigned int i;
+   int j, k;
+   int outBegIdx[2], outNbElement[2];
+   double diff, tolerance;
+
+   retCode = TA_GetFuncHandle( funcInfo->name, &handle );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't get the function handle [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+   }
+
+   retCode = TA_ParamHolderAlloc( handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( handle, i, &inputInfo );
+      switch(inputInfo->type)
+      {
+      case TA_Input_Price:
+         TA_SetInputParamPricePtr( paramHolder, i,
+             inputInfo->flags&TA_IN_PRICE_OPEN?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_HIGH?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_LOW?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_CLOSE?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_VOLUME?parallelInput:NULL, NULL );
+         break;
+      case TA_Input_Real:
+         TA_SetInputParamRealPtr( paramHolder, i, parallelInput );
+         break;
+      case TA_Input_Integer:
+         TA_SetInputParamIntegerPtr( paramHolder, i, parallelInput_int );
+         break;
+      }
+   }
+
+   /* k==0 is the reference (TA_CallFunc), k==1 is TA_CallFuncParallel. */
+   for( k=0; k < 2; k++ )
+   {
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         TA_GetOutputParameterInfo( handle, i, &outputInfo );
+         switch(outputInfo->type)
+         {
+         case TA_Output_Real:
+            TA_SetOutputParamRealPtr(paramHolder,i,&parallelOutput[k][i][0]);
+            for( j=0; j < PARALLEL_INPUT_SIZE; j++ )
+               parallelOutput[k][i][j] = TA_REAL_MIN;
+            break;
+         case TA_Output_Integer:
+            TA_SetOutputParamIntegerPtr(paramHolder,i,&parallelOutput_int[k][i][0]);
+            for( j=0; j < PARALLEL_INPUT_SIZE; j++ )
+               parallelOutput_int[k][i][j] = TA_INTEGER_MIN;
+            break;
+         }
+      }
+
+      if( k == 0 )
+         retCode = TA_CallFunc( paramHolder, 10, PARALLEL_INPUT_SIZE-1,
+                                &outBegIdx[k], &outNbElement[k] );
+      else
+         retCode = TA_CallFuncParallel( paramHolder, 10, PARALLEL_INPUT_SIZE-1,
+                                        &outBegIdx[k], &outNbElement[k], 4 );
+
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Call #%d failed [%d]\n", k, retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_PARALLEL_CALL;
+      }
+   }
+
+   if( (outBegIdx[0] != outBegIdx[1]) || (outNbElement[0] != outNbElement[1]) )
+   {
+      printf( "Parallel range mismatch outBegIdx=%d(%d) outNbElement=%d(%d)\n",
+              outBegIdx[1], outBegIdx[0], outNbElement[1], outNbElement[0] );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_PARALLEL_RANGE;
+   }
+
+   /* A running sum restarting at each chunk may
+    * cause a difference in the last few bits.
+    */
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo );
+      for( j=0; j < outNbElement[0]; j++ )
+      {
+         if( outputInfo->type == TA_Output_Integer )
+            diff = (parallelOutput_int[0][i][j] != parallelOutput_int[1][i][j])? 1.0 : 0.0;
+         else
+         {
+            diff = fabs( parallelOutput[0][i][j] - parallelOutput[1][i][j] );
+            if( isnan(parallelOutput[0][i][j]) && isnan(parallelOutput[1][i][j]) )
+               diff = 0.0;
+            tolerance = 1e-8*fabs( parallelOutput[0][i][j] );
+            if( tolerance < 1e-8 )
+               tolerance = 1e-8;
+            if( diff <= tolerance )
+               diff = 0.0;
+         }
+
+         if( diff != 0.0 )
+         {
+            printf( "Parallel output[%d][%d] mismatch\n", i, j );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_PARALLEL_VALUE;
+         }
+      }
+   }
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+typedef struct
+{
+   TA_Context *context;
+   ErrorNumber errorNumber;
+} ScratchTest;
+
+static void testScratch( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ScratchTest *scratchTest;
+
+   scratchTest = (ScratchTest *)opaqueData;
+   if( scratchTest->errorNumber != TA_TEST_PASS )
+      return;
+
+   scratchTest->errorNumber = callScratch( funcInfo->name, scratchTest->context );
+   if( scratchTest->errorNumber != TA_TEST_PASS )
+      printf( "Failed for [%s] scratch call\n", funcInfo->name );
+}
+
+/* Verify that all functions give the same output when their
+ * temporary buffers are taken from a scratch buffer, and that
+ * a scratch buffer of TA_GetScratchSize avoids all allocations.
+ */
+static ErrorNumber test_scratch_calls(void)
+{
+   ScratchTest scratchTest;
+   TA_RetCode retCode;
+
+   /* Everything else allocated by TA-Lib goes to another allocator. */
+   memset( &globalCount, 0, sizeof(globalCount) );
+   retCode = TA_SetAllocator( countingMalloc, countingRealloc, countingFree, &globalCount );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_SetAllocator failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_SCRATCH_CALL;
+   }
+
+   retCode = TA_ContextAlloc( &scratchTest.context );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ContextAlloc failed [%d]\n", retCode );
+      TA_SetAllocator( NULL, NULL, NULL, NULL );
+      return TA_ABS_TST_FAIL_SCRATCH_CALL;
+   }
+
+   memset( &scratchCount, 0, sizeof(scratchCount) );
+   retCode = TA_ContextSetAllocator( scratchTest.context, countingMalloc,
+                                     countingRealloc, countingFree, &scratchCount );
+   if( (retCode != TA_SUCCESS) ||
+       (TA_ContextSetAllocator( scratchTest.context, countingMalloc, NULL, NULL, NULL ) != TA_BAD_PARAM) )
+   {
+      printf( "TA_ContextSetAllocator failed [%d]\n", retCode );
+      TA_ContextFree( scratchTest.context );
+      TA_SetAllocator( NULL, NULL, NULL, NULL );
+      return TA_ABS_TST_FAIL_SCRATCH_CALL;
+   }
+
+   scratchTest.errorNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testScratch, &scratchTest );
+
+   TA_ContextFree( scratchTest.context );
+   TA_SetAllocator( NULL, NULL, NULL, NULL );
+
+   if( (scratchTest.errorNumber == TA_TEST_PASS) &&
+       ((scratchCount.nbMalloc != scratchCount.nbFree) ||
+        (globalCount.nbMalloc != globalCount.nbFree) ||
+        (globalCount.nbMalloc == 0)) )
+   {
+      printf( "Allocator mismatch malloc=%d free=%d, malloc=%d free=%d\n",
+              scratchCount.nbMalloc, scratchCount.nbFree,
+              globalCount.nbMalloc, globalCount.nbFree );
+      return TA_ABS_TST_FAIL_SCRATCH_ALLOC;
+   }
+
+   return scratchTest.errorNumber;
+}
+
+static ErrorNumber callScratch( const char *funcName, TA_Context *context )
+{
+   TA_ParamHolder *paramHolder;
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   ErrorNumber errNumber;
+   TA_RetCode retCode;
+   unsigned int i;
+   int hasMAType;
+
+   retCode = TA_GetFuncHandle( funcName, &handle );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't get the function handle [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+   }
+
+   retCode = TA_ParamHolderAlloc( handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   TA_GetFuncInfo( handle, &funcInfo );
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( handle, i, &inputInfo );
+      switch(inputInfo->type)
+      {
+      case TA_Input_Price:
+         TA_SetInputParamPricePtr( paramHolder, i,
+             inputInfo->flags&TA_IN_PRICE_OPEN?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_HIGH?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_LOW?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_CLOSE?parallelInput:NULL,
+             inputInfo->flags&TA_IN_PRICE_VOLUME?parallelInput:NULL, NULL );
+         break;
+      case TA_Input_Real:
+         TA_SetInputParamRealPtr( paramHolder, i, parallelInput );
+         break;
+      case TA_Input_Integer:
+         TA_SetInputParamIntegerPtr( paramHolder, i, parallelInput_int );
+         break;
+      }
+   }
+
+   errNumber = checkScratchCall( paramHolder, funcInfo, context );
+
+   /* Again with moving averages having temporary buffers of their own. */
+   hasMAType = 0;
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( handle, i, &optInputInfo );
+      if( strstr( optInputInfo->paramName, "MAType" ) )
+      {
+         TA_SetOptInputParamInteger( paramHolder, i, TA_MAType_TEMA );
+         hasMAType = 1;
+      }
+   }
+
+   if( (errNumber == TA_TEST_PASS) && hasMAType )
+      errNumber = checkScratchCall( paramHolder, funcInfo, context );
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( (retCode != TA_SUCCESS) && (errNumber == TA_TEST_PASS) )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return errNumber;
+}
+
+static ErrorNumber checkScratchCall( TA_ParamHolder *paramHolder,
+                                     const TA_FuncInfo *funcInfo,
+                                     TA_Context *context )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   void *scratch;
+   size_t scratchSize;
+   unsigned int i;
+   int j, k, nbMalloc;
+   int outBegIdx[2], outNbElement[2];
+
+   /* k==0 is the reference, k==1 uses the scratch buffer. */
+   scratch = NULL;
+   scratchSize = 0;
+   nbMalloc = 0;
+   for( k=0; k < 2; k++ )
+   {
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+         switch(outputInfo->type)
+         {
+         case TA_Output_Real:
+            TA_SetOutputParamRealPtr(paramHolder,i,&parallelOutput[k][i][0]);
+            for( j=0; j < PARALLEL_INPUT_SIZE; j++ )
+               parallelOutput[k][i][j] = TA_REAL_MIN;
+            break;
+         case TA_Output_Integer:
+            TA_SetOutputParamIntegerPtr(paramHolder,i,&parallelOutput_int[k][i][0]);
+            for( j=0; j < PARALLEL_INPUT_SIZE; j++ )
+               parallelOutput_int[k][i][j] = TA_INTEGER_MIN;
+            break;
+         }
+      }
+
+      if( k == 1 )
+      {
+         retCode = TA_GetScratchSize( paramHolder, 10, PARALLEL_INPUT_SIZE-1, &scratchSize );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "TA_GetScratchSize failed [%d]\n", retCode );
+            return TA_ABS_TST_FAIL_SCRATCH_CALL;
+         }
+
+         if( scratchSize )
+         {
+            scratch = malloc( scratchSize+16 );
+            if( !scratch )
+               return TA_ABS_TST_FAIL_SCRATCH_ALLOC;
+         }
+         /* Misaligned on purpose. */
+         TA_ContextSetScratch( context, scratch? (char *)scratch+1 : NULL,
+                               scratchSize+15 );
+         TA_SetParamHolderContext( paramHolder, context );
+         nbMalloc = scratchCount.nbMalloc;
+      }
+
+      retCode = TA_CallFunc( paramHolder, 10, PARALLEL_INPUT_SIZE-1,
+                             &outBegIdx[k], &outNbElement[k] );
+
+      if( k == 1 )
+      {
+         nbMalloc = scratchCount.nbMalloc - nbMalloc;
+         if( TA_ContextGetScratchPeak( context ) != scratchSize )
+            nbMalloc = -1;
+         TA_SetParamHolderContext( paramHolder, NULL );
+         TA_ContextSetScratch( context, NULL, 0 );
+         free( scratch );
+      }
+
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Call #%d failed [%d]\n", k, retCode );
+         return TA_ABS_TST_FAIL_SCRATCH_CALL;
+      }
+   }
+
+   if( nbMalloc != 0 )
+   {
+      printf( "Scratch call did %d allocation(s) (-1 for peak mismatch)\n", nbMalloc );
+      return TA_ABS_TST_FAIL_SCRATCH_ALLOC;
+   }
+
+   if( (outBegIdx[0] != outBegIdx[1]) || (outNbElement[0] != outNbElement[1]) )
+   {
+      printf( "Scratch range mismatch outBegIdx=%d(%d) outNbElement=%d(%d)\n",
+              outBegIdx[1], outBegIdx[0], outNbElement[1], outNbElement[0] );
+      return TA_ABS_TST_FAIL_SCRATCH_VALUE;
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         j = memcmp( parallelOutput_int[0][i], parallelOutput_int[1][i], sizeof(int)*outNbElement[0] );
+      else
+         j = memcmp( parallelOutput[0][i], parallelOutput[1][i], sizeof(double)*outNbElement[0] );
+
+      if( j != 0 )
+      {
+         printf( "Scratch output[%d] mismatch\n", i );
+         return TA_ABS_TST_FAIL_SCRATCH_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Verify that inputs read from records (TA_SetInputParamPriceStride
+ * and TA_SetInputParamRealStride) gives exactly the same output than
+ * contiguous arrays, for all functions.
+ */
+static ErrorNumber test_strided_calls(void)
+{
+   TA_ParamHolder *paramHolder;
+   const TA_FuncHandle *handle;
+   unsigned int i, k;
+
+   for( i=0; i < PARALLEL_INPUT_SIZE; i++ )
+   {
+      for( k=0; k < STRIDED_NB_FIELD; k++ )
+         stridedField[k][i] = 10.0 + (k+1)*parallelInput[(i+k*13)%PARALLEL_INPUT_SIZE];
+   }
+
+   /* Only multiple of sizeof(TA_Real) are allowed. */
+   if( (TA_GetFuncHandle( "SMA", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &paramHolder ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_STRIDED_CALL;
+
+   if( (TA_SetInputParamRealStride( paramHolder, 0, stridedBar, 12 ) != TA_BAD_PARAM) ||
+       (TA_SetInputParamRealStride( paramHolder, 0, stridedBar, 0 ) != TA_BAD_PARAM) ||
+       (TA_SetInputParamRealStride( paramHolder, 0, stridedBar, 48 ) != TA_SUCCESS) )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_STRIDED_CALL;
+   }
+   TA_ParamHolderFree( paramHolder );
+
+   return checkAllFunc( callStrided, "strided call" );
+}
+
+/* Set all the inputs from the records when 'step' is not zero,
+ * else from the contiguous arrays.
+ */
+static void setStridedInput( TA_ParamHolder *paramHolder,
+                             const TA_FuncHandle *handle,
+                             unsigned int step )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_FuncInfo *funcInfo;
+   const double *field[STRIDED_NB_FIELD];
+   unsigned int i, k;
+   size_t stride;
+
+   stride = step*sizeof(double);
+   for( k=0; k < STRIDED_NB_FIELD; k++ )
+      field[k] = step? &stridedBar[1+k] : stridedField[k];
+
+   TA_GetFuncInfo( handle, &funcInfo );
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( handle, i, &inputInfo );
+      switch(inputInfo->type)
+      {
+      case TA_Input_Price:
+         #define FIELD(flag,k) (inputInfo->flags&(flag)?field[k]:NULL)
+         if( step )
+            TA_SetInputParamPriceStride( paramHolder, i,
+                FIELD(TA_IN_PRICE_OPEN,0), FIELD(TA_IN_PRICE_HIGH,1),
+                FIELD(TA_IN_PRICE_LOW,2), FIELD(TA_IN_PRICE_CLOSE,3),
+                FIELD(TA_IN_PRICE_VOLUME,4), NULL, stride );
+         else
+            TA_SetInputParamPricePtr( paramHolder, i,
+                FIELD(TA_IN_PRICE_OPEN,0), FIELD(TA_IN_PRICE_HIGH,1),
+                FIELD(TA_IN_PRICE_LOW,2), FIELD(TA_IN_PRICE_CLOSE,3),
+                FIELD(TA_IN_PRICE_VOLUME,4), NULL );
+         #undef FIELD
+         break;
+      case TA_Input_Real:
+         /* Second real input (BETA, CORREL...) uses another field. */
+         if( step )
+            TA_SetInputParamRealStride( paramHolder, i, field[3-i], stride );
+         else
+            TA_SetInputParamRealPtr( paramHolder, i, field[3-i] );
+         break;
+      case TA_Input_Integer:
+         TA_SetInputParamIntegerPtr( paramHolder, i, parallelInput_int );
+         break;
+      }
+   }
+}
+
+static ErrorNumber callStrided( const TA_FuncInfo *funcInfo )
+{
+   static const unsigned int stepList[] = { 6, 8, 7 };
+   TA_ParamHolder *paramHolder, *stridedHolder;
+   const TA_FuncHandle *handle;
+   ErrorNumber errNumber;
+   unsigned int i, k, step;
+
+   if( TA_GetFuncHandle( funcInfo->name, &handle ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+
+   if( TA_ParamHolderAlloc( handle, &paramHolder ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+
+   if( TA_ParamHolderAlloc( handle, &stridedHolder ) != TA_SUCCESS )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   setStridedInput( paramHolder, handle, 0 );
+
+   errNumber = TA_TEST_PASS;
+   for( i=0; (i < sizeof(stepList)/sizeof(stepList[0])) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      /* Build the records with the same values than the arrays. */
+      step = stepList[i];
+      memset( stridedBar, 0, sizeof(stridedBar) );
+      for( k=0; k < PARALLEL_INPUT_SIZE*STRIDED_NB_FIELD; k++ )
+         stridedBar[(k/STRIDED_NB_FIELD)*step+1+(k%STRIDED_NB_FIELD)] = stridedField[k%STRIDED_NB_FIELD][k/STRIDED_NB_FIELD];
+
+      setStridedInput( stridedHolder, handle, step );
+
+      /* Whole range, a range far from the start, and in parallel. */
+      errNumber = checkStridedCall( paramHolder, stridedHolder, funcInfo,
+                                    0, PARALLEL_INPUT_SIZE-1, 1 );
+      if( errNumber == TA_TEST_PASS )
+         errNumber = checkStridedCall( paramHolder, stridedHolder, funcInfo,
+                                       3000, 3999, 1 );
+      if( errNumber == TA_TEST_PASS )
+         errNumber = checkStridedCall( paramHolder, stridedHolder, funcInfo,
+                                       0, PARALLEL_INPUT_SIZE-1, 4 );
+   }
+
+   TA_ParamHolderFree( stridedHolder );
+   TA_ParamHolderFree( paramHolder );
+
+   return errNumber;
+}
+
+static ErrorNumber checkStridedCall( TA_ParamHolder *paramHolder,
+                                     TA_ParamHolder *stridedHolder,
+                                     const TA_FuncInfo *funcInfo,
+                                     int startIdx, int endIdx,
+                                     int nbThread )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   TA_ParamHolder *holder[2];
+   TA_RetCode retCode[2];
+   int outBegIdx[2], outNbElement[2];
+   unsigned int i, j;
+   int cmp;
+
+   holder[0] = paramHolder;
+   holder[1] = stridedHolder;
+
+   for( j=0; j < 2; j++ )
+   {
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+         if( outputInfo->type == TA_Output_Integer )
+            TA_SetOutputParamIntegerPtr( holder[j], i, parallelOutput_int[j][i] );
+         else
+            TA_SetOutputParamRealPtr( holder[j], i, parallelOutput[j][i] );
+      }
+
+      retCode[j] = TA_CallFuncParallel( holder[j], startIdx, endIdx,
+                                        &outBegIdx[j], &outNbElement[j], nbThread );
+   }
+
+   if( (retCode[0] != retCode[1]) ||
+       ((retCode[0] == TA_SUCCESS) &&
+        ((outBegIdx[0] != outBegIdx[1]) || (outNbElement[0] != outNbElement[1]))) )
+   {
+      printf( "Strided call mismatch [%d,%d] [%d,%d] [%d,%d]\n",
+              retCode[0], retCode[1], outBegIdx[0], outBegIdx[1],
+              outNbElement[0], outNbElement[1] );
+      return TA_ABS_TST_FAIL_STRIDED_CALL;
+   }
+
+   if( retCode[0] != TA_SUCCESS )
+      return TA_TEST_PASS;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         cmp = memcmp( parallelOutput_int[0][i], parallelOutput_int[1][i], sizeof(int)*outNbElement[0] );
+      else
+         cmp = memcmp( parallelOutput[0][i], parallelOutput[1][i], sizeof(double)*outNbElement[0] );
+
+      if( cmp != 0 )
+      {
+         printf( "Strided output[%d] mismatch (range %d..%d)\n", i, startIdx, endIdx );
+         return TA_ABS_TST_FAIL_STRIDED_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber test_plan_calls(void)
+{
+   /* Many calls sharing their MA and variances, some identical,
+    * some with strided inputs and some that must fail.
+    */
+   static const PlanCall planCall[PLAN_NB_CALL] =
+   {
+      { "MACD",   {12,26,9,0},   0,    0, 1999 },
+      { "MACD",   {12,26,9,0},   0,    0, 1999 },
+      { "EMA",    {12,0,0,0},    0,    0, 1999 },
+      { "EMA",    {26,0,0,0},    0,    0, 1999 },
+      { "SMA",    {20,0,0,0},    0,    0, 1999 },
+      { "MA",     {20,0,0,0},    0,    0, 1999 },
+      { "MA",     {20,1,0,0},    0,    0, 1999 },
+      { "BBANDS", {20,2,2,0},    0,    0, 1999 },
+      { "BBANDS", {20,2,1.5,1},  0,    0, 1999 },
+      { "BBANDS", {20,1,1,1},    0,   10, 1999 },
+      { "STDDEV", {20,1,0,0},    0,    0, 1999 },
+      { "STDDEV", {20,2,0,0},    0,    0, 1999 },
+      { "VAR",    {20,1,0,0},    0,    0, 1999 },
+      { "VAR",    {20,3,0,0},    0,    0, 1999 },
+      { "MA",     {10,8,0,0},    0,    0, 1999 },
+      { "T3",     {10,0.7,0,0},  0,    0, 1999 },
+      { "MA",     {15,7,0,0},    0,    0, 1999 },
+      { "MA",     {1,0,0,0},     0,  100, 1999 },
+      { "STDDEV", {20,1,0,0},    6,    0, 1999 },
+      { "BBANDS", {20,2,2,1},    6,    0, 1999 },
+      { "BBANDS", {20,2,2,0},    6,    0, 1999 },
+      { "BBANDS", {9,1,2,3},     0,  500, 1800 },
+      { "RSI",    {14,0,0,0},    0,  100, 1500 },
+      { "RSI",    {14,0,0,0},    0,  100, 1500 },
+      { "ATR",    {14,0,0,0},    0,    0, 1999 },
+      { "MINMAXINDEX", {30,0,0,0}, 0,  0, 1999 },
+      { "SMA",    {20,0,0,0},    0,   10,    5 }
+   };
+
+   TA_ParamHolder *paramHolder[PLAN_NB_CALL];
+   TA_CallResult result[PLAN_NB_CALL];
+   TA_PlanStats stats;
+   TA_Plan *plan;
+   ErrorNumber errNumber;
+   unsigned int i, k, nbBuffer;
+
+   memset( stridedBar, 0, sizeof(stridedBar) );
+   for( k=0; k < PARALLEL_INPUT_SIZE*STRIDED_NB_FIELD; k++ )
+      stridedBar[(k/STRIDED_NB_FIELD)*6+1+(k%STRIDED_NB_FIELD)] = stridedField[k%STRIDED_NB_FIELD][k/STRIDED_NB_FIELD];
+
+   if( TA_PlanAlloc( &plan ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PLAN_CALL;
+
+   errNumber = TA_TEST_PASS;
+   for( i=0; i < PLAN_NB_CALL; i++ )
+      paramHolder[i] = NULL;
+
+   for( i=0; (i < PLAN_NB_CALL) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      errNumber = setPlanCall( &planCall[i], &paramHolder[i], planOutput[i] );
+      if( (errNumber == TA_TEST_PASS) &&
+          (TA_PlanAdd( plan, paramHolder[i], planCall[i].startIdx, planCall[i].endIdx ) != TA_SUCCESS) )
+         errNumber = TA_ABS_TST_FAIL_PLAN_CALL;
+   }
+
+   /* Twice, the second time re-using the buffers of the first. */
+   nbBuffer = 0;
+   for( k=0; (k < 2) && (errNumber == TA_TEST_PASS); k++ )
+   {
+      memset( planOutput, 0, sizeof(planOutput) );
+      if( TA_PlanExecute( plan, result, &stats ) != TA_SUCCESS )
+      {
+         errNumber = TA_ABS_TST_FAIL_PLAN_CALL;
+         break;
+      }
+
+      for( i=0; (i < PLAN_NB_CALL) && (errNumber == TA_TEST_PASS); i++ )
+         errNumber = checkPlanCall( &planCall[i], paramHolder[i], &result[i], planOutput[i] );
+
+      if( (errNumber == TA_TEST_PASS) &&
+          ((stats.nbRequest != PLAN_NB_CALL) ||
+           (stats.nbComputed+8 > stats.nbKernel) ||
+           (stats.nbBuffer == 0) ||
+           (k && (stats.nbBuffer != nbBuffer))) )
+      {
+         printf( "Unexpected plan stats %u %u %u %u\n", stats.nbRequest,
+                 stats.nbKernel, stats.nbComputed, stats.nbBuffer );
+         errNumber = TA_ABS_TST_FAIL_PLAN_STATS;
+      }
+      nbBuffer = stats.nbBuffer;
+   }
+
+   for( i=0; i < PLAN_NB_CALL; i++ )
+      TA_ParamHolderFree( paramHolder[i] );
+   TA_PlanFree( plan );
+
+   if( errNumber != TA_TEST_PASS )
+      return errNumber;
+
+   return test_plan_overlap();
+}
+
+static ErrorNumber test_plan_overlap(void)
+{
+   static const PlanCall smaCall = { "SMA", {5,0,0,0}, 0, 0, 999 };
+   TA_ParamHolder *paramHolder[2];
+   TA_CallResult result[2];
+   TA_PlanStats stats;
+   TA_Plan *plan;
+   ErrorNumber errNumber;
+   int outBegIdx, outNbElement;
+
+   /* The second SMA reads the output of the first one, nothing can
+    * be shared and the calls must be done in order.
+    */
+   paramHolder[0] = paramHolder[1] = NULL;
+   errNumber = setPlanCall( &smaCall, &paramHolder[0], planOutput[0] );
+   if( errNumber == TA_TEST_PASS )
+      errNumber = setPlanCall( &smaCall, &paramHolder[1], planOutput[1] );
+
+   plan = NULL;
+   if( (errNumber == TA_TEST_PASS) &&
+       ((TA_SetInputParamRealPtr( paramHolder[1], 0, planOutput[0][0] ) != TA_SUCCESS) ||
+        (TA_PlanAlloc( &plan ) != TA_SUCCESS) ||
+        (TA_PlanAdd( plan, paramHolder[0], 0, 999 ) != TA_SUCCESS) ||
+        (TA_PlanAdd( plan, paramHolder[1], 0, 999 ) != TA_SUCCESS) ||
+        (TA_PlanExecute( plan, result, &stats ) != TA_SUCCESS)) )
+      errNumber = TA_ABS_TST_FAIL_PLAN_CALL;
+
+   if( (errNumber == TA_TEST_PASS) &&
+       ((stats.nbComputed != 2) || (stats.nbKernel != 2)) )
+      errNumber = TA_ABS_TST_FAIL_PLAN_STATS;
+
+   if( errNumber == TA_TEST_PASS )
+   {
+      TA_SetOutputParamRealPtr( paramHolder[1], 0, planOutput[2][0] );
+      if( (TA_CallFunc( paramHolder[1], 0, 999, &outBegIdx, &outNbElement ) != TA_SUCCESS) ||
+          (result[1].retCode != TA_SUCCESS) ||
+          (outBegIdx != result[1].outBegIdx) || (outNbElement != result[1].outNbElement) ||
+          memcmp( planOutput[1][0], planOutput[2][0], sizeof(double)*outNbElement ) )
+         errNumber = TA_ABS_TST_FAIL_PLAN_VALUE;
+   }
+
+   TA_ParamHolderFree( paramHolder[0] );
+   TA_ParamHolderFree( paramHolder[1] );
+   TA_PlanFree( plan );
+
+   return errNumber;
+}
+
+static ErrorNumber test_batch_calls(void)
+{
+   /* SMA on the same range (sweep), SMA/EMA/RSI starting at zero
+    * (panels), and calls that are done one by one.
+    */
+   static const PlanCall batchCall[BATCH_NB_CALL] =
+   {
+      { "SMA",    {5,0,0,0},     0,    0, 1999 },
+      { "SMA",    {20,0,0,0},    0,    0, 1999 },
+      { "SMA",    {200,0,0,0},   0,    0, 1999 },
+      { "SMA",    {2,0,0,0},     0,    0, 1999 },
+      { "SMA",    {10,0,0,0},    0,  100, 1500 },
+      { "SMA",    {30,0,0,0},    0,  100, 1500 },
+      { "EMA",    {12,0,0,0},    0,    0, 1999 },
+      { "EMA",    {12,0,0,0},    0,    0, 1000 },
+      { "EMA",    {26,0,0,0},    0,    0, 1999 },
+      { "RSI",    {14,0,0,0},    0,    0, 1999 },
+      { "RSI",    {14,0,0,0},    0,    0,  700 },
+      { "RSI",    {14,0,0,0},    0,  100, 1500 },
+      { "SMA",    {20,0,0,0},    6,    0, 1999 },
+      { "SMA",    {1,0,0,0},     0,    0, 1999 },
+      { "MACD",   {12,26,9,0},   0,    0, 1999 },
+      { "BBANDS", {20,2,2,0},    0,   10, 1999 },
+      { "ATR",    {14,0,0,0},    0,    0, 1999 },
+      { "SMA",    {20,0,0,0},    0,   10,    5 },
+      { "EMA",    {3000,0,0,0},  0,    0, 1999 }
+   };
+
+   TA_ParamHolder *paramHolder[BATCH_NB_CALL+1];
+   TA_CallRange range[BATCH_NB_CALL+1];
+   TA_CallResult result[BATCH_NB_CALL+1];
+   ErrorNumber errNumber;
+   unsigned int i;
+
+   memset( stridedBar, 0, sizeof(stridedBar) );
+   for( i=0; i < PARALLEL_INPUT_SIZE*STRIDED_NB_FIELD; i++ )
+      stridedBar[(i/STRIDED_NB_FIELD)*6+1+(i%STRIDED_NB_FIELD)] = stridedField[i%STRIDED_NB_FIELD][i/STRIDED_NB_FIELD];
+
+   errNumber = TA_TEST_PASS;
+   for( i=0; i <= BATCH_NB_CALL; i++ )
+      paramHolder[i] = NULL;
+
+   for( i=0; (i < BATCH_NB_CALL) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      errNumber = setPlanCall( &batchCall[i], &paramHolder[i], planOutput[i] );
+      range[i].startIdx = batchCall[i].startIdx;
+      range[i].endIdx   = batchCall[i].endIdx;
+   }
+
+   /* The last call has no parameters and must fail alone. */
+   range[BATCH_NB_CALL].startIdx = 0;
+   range[BATCH_NB_CALL].endIdx   = 1999;
+
+   if( errNumber == TA_TEST_PASS )
+   {
+      memset( planOutput, 0, sizeof(planOutput) );
+      if( (TA_CallFuncBatch( (const TA_ParamHolder *const *)paramHolder, BATCH_NB_CALL+1,
+                             range, result ) != TA_SUCCESS) ||
+          (result[BATCH_NB_CALL].retCode != TA_BAD_PARAM) )
+         errNumber = TA_ABS_TST_FAIL_BATCH_CALL;
+   }
+
+   for( i=0; (i < BATCH_NB_CALL) && (errNumber == TA_TEST_PASS); i++ )
+      errNumber = checkPlanCall( &batchCall[i], paramHolder[i], &result[i], planOutput[i] );
+
+   /* The second SMA reads the output of the first one, the calls
+    * must be done in order. The third is the second one done alone.
+    */
+   for( i=0; (i < 3) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      TA_ParamHolderFree( paramHolder[i] );
+      paramHolder[i] = NULL;
+      errNumber = setPlanCall( &batchCall[0], &paramHolder[i], planOutput[i] );
+      range[i].startIdx = 0;
+      range[i].endIdx   = 999;
+   }
+
+   if( errNumber == TA_TEST_PASS )
+   {
+      TA_SetInputParamRealPtr( paramHolder[1], 0, planOutput[0][0] );
+      TA_SetInputParamRealPtr( paramHolder[2], 0, planOutput[0][0] );
+      if( (TA_CallFuncBatch( (const TA_ParamHolder *const *)paramHolder, 3,
+                             range, result ) != TA_SUCCESS) ||
+          (result[1].retCode != TA_SUCCESS) ||
+          (result[1].outBegIdx != result[2].outBegIdx) ||
+          (result[1].outNbElement != result[2].outNbElement) )
+         errNumber = TA_ABS_TST_FAIL_BATCH_CALL;
+      else if( memcmp( planOutput[1][0], planOutput[2][0], sizeof(double)*result[1].outNbElement ) )
+         errNumber = TA_ABS_TST_FAIL_BATCH_VALUE;
+   }
+
+   for( i=0; i <= BATCH_NB_CALL; i++ )
+      TA_ParamHolderFree( paramHolder[i] );
+
+   return errNumber;
+}
+
+static ErrorNumber test_calls64(void)
+{
+   const double *open, *high, *low, *close;
+   double (*out32)[PARALLEL_INPUT_SIZE], (*out64)[PARALLEL_INPUT_SIZE];
+   TA_ParamHolder *paramHolder[2];
+   const TA_FuncHandle *handle;
+   TA_Integer64 outBegIdx64, outNbElement64;
+   TA_RetCode retCode, retCode64;
+   ErrorNumber errNumber;
+   int outBegIdx, outNbElement;
+   unsigned int i;
+
+   /* Inputs of test_strided_calls. */
+   open  = stridedField[0];
+   high  = stridedField[1];
+   low   = stridedField[2];
+   close = stridedField[3];
+   out32 = parallelOutput[0];
+   out64 = parallelOutput[1];
+
+   /* Same outputs than the TA_Integer functions. */
+   retCode   = TA_SMA( 100, 4999, close, 20, &outBegIdx, &outNbElement, out32[0] );
+   retCode64 = TA_SMA_64( 100, 4999, close, 20, &outBegIdx64, &outNbElement64, out64[0] );
+   errNumber = checkCall64( "SMA", retCode64, outBegIdx64, outNbElement64, retCode, outBegIdx, outNbElement );
+   if( (errNumber == TA_TEST_PASS) && memcmp( out32[0], out64[0], sizeof(double)*outNbElement ) )
+      errNumber = TA_ABS_TST_FAIL_CALL64_VALUE;
+
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode   = TA_ADX( 0, 4999, high, low, close, 14, &outBegIdx, &outNbElement, out32[0] );
+      retCode64 = TA_ADX_64( 0, 4999, high, low, close, 14, &outBegIdx64, &outNbElement64, out64[0] );
+      errNumber = checkCall64( "ADX", retCode64, outBegIdx64, outNbElement64, retCode, outBegIdx, outNbElement );
+      if( (errNumber == TA_TEST_PASS) && memcmp( out32[0], out64[0], sizeof(double)*outNbElement ) )
+         errNumber = TA_ABS_TST_FAIL_CALL64_VALUE;
+   }
+
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode   = TA_BBANDS( 10, 4000, close, 20, 2.0, 1.5, TA_MAType_EMA, &outBegIdx, &outNbElement,
+                             out32[0], out32[1], out32[2] );
+      retCode64 = TA_BBANDS_64( 10, 4000, close, 20, 2.0, 1.5, TA_MAType_EMA, &outBegIdx64, &outNbElement64,
+                                out64[0], out64[1], out64[2] );
+      errNumber = checkCall64( "BBANDS", retCode64, outBegIdx64, outNbElement64, retCode, outBegIdx, outNbElement );
+      for( i=0; (i < 3) && (errNumber == TA_TEST_PASS); i++ )
+      {
+         if( memcmp( out32[i], out64[i], sizeof(double)*outNbElement ) )
+            errNumber = TA_ABS_TST_FAIL_CALL64_VALUE;
+      }
+   }
+
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode   = TA_MINMAXINDEX( 2000, 4999, open, 30, &outBegIdx, &outNbElement,
+                                  parallelOutput_int[0][0], parallelOutput_int[0][1] );
+      retCode64 = TA_MINMAXINDEX_64( 2000, 4999, open, 30, &outBegIdx64, &outNbElement64,
+                                     parallelOutput_int[1][0], parallelOutput_int[1][1] );
+      errNumber = checkCall64( "MINMAXINDEX", retCode64, outBegIdx64, outNbElement64, retCode, outBegIdx, outNbElement );
+      if( (errNumber == TA_TEST_PASS) &&
+          (memcmp( parallelOutput_int[0][0], parallelOutput_int[1][0], sizeof(int)*outNbElement ) ||
+           memcmp( parallelOutput_int[0][1], parallelOutput_int[1][1], sizeof(int)*outNbElement )) )
+         errNumber = TA_ABS_TST_FAIL_CALL64_VALUE;
+   }
+
+   /* Errors are the same as the TA_Integer functions. */
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode64 = TA_SMA_64( -1, 100, close, 20, &outBegIdx64, &outNbElement64, out64[0] );
+      errNumber = checkCall64( "SMA", retCode64, outBegIdx64, outNbElement64, TA_OUT_OF_RANGE_START_INDEX, 0, 0 );
+   }
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode64 = TA_SMA_64( 100, 99, close, 20, &outBegIdx64, &outNbElement64, out64[0] );
+      errNumber = checkCall64( "SMA", retCode64, outBegIdx64, outNbElement64, TA_OUT_OF_RANGE_END_INDEX, 0, 0 );
+   }
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode64 = TA_SMA_64( 0, 100, close, 1, &outBegIdx64, &outNbElement64, out64[0] );
+      errNumber = checkCall64( "SMA", retCode64, outBegIdx64, outNbElement64, TA_BAD_PARAM, 0, 0 );
+   }
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode64 = TA_ADX_64( 0, 100, high, NULL, close, 14, &outBegIdx64, &outNbElement64, out64[0] );
+      errNumber = checkCall64( "ADX", retCode64, outBegIdx64, outNbElement64, TA_BAD_PARAM, 0, 0 );
+   }
+   if( errNumber == TA_TEST_PASS )
+   {
+      retCode64 = TA_SMA_64( 0, 100, close, 20, &outBegIdx64, &outNbElement64, NULL );
+      errNumber = checkCall64( "SMA", retCode64, outBegIdx64, outNbElement64, TA_BAD_PARAM, 0, 0 );
+   }
+
+   /* Strided inputs through the abstract interface. */
+   if( errNumber == TA_TEST_PASS )
+   {
+      memset( stridedBar, 0, sizeof(stridedBar) );
+      for( i=0; i < PARALLEL_INPUT_SIZE*STRIDED_NB_FIELD; i++ )
+         stridedBar[(i/STRIDED_NB_FIELD)*8+1+(i%STRIDED_NB_FIELD)] = stridedField[i%STRIDED_NB_FIELD][i/STRIDED_NB_FIELD];
+
+      if( (TA_GetFuncHandle( "STOCH", &handle ) != TA_SUCCESS) ||
+          (TA_ParamHolderAlloc( handle, &paramHolder[0] ) != TA_SUCCESS) )
+         return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+      if( TA_ParamHolderAlloc( handle, &paramHolder[1] ) != TA_SUCCESS )
+      {
+         TA_ParamHolderFree( paramHolder[0] );
+         return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+      }
+
+      setStridedInput( paramHolder[0], handle, 0 );
+      setStridedInput( paramHolder[1], handle, 8 );
+      for( i=0; i < 2; i++ )
+      {
+         TA_SetOutputParamRealPtr( paramHolder[0], i, out32[i] );
+         TA_SetOutputParamRealPtr( paramHolder[1], i, out64[i] );
+      }
+
+      retCode   = TA_CallFunc( paramHolder[0], 1000, 4999, &outBegIdx, &outNbElement );
+      retCode64 = TA_CallFunc64( paramHolder[1], 1000, 4999, &outBegIdx64, &outNbElement64 );
+      errNumber = checkCall64( "STOCH", retCode64, outBegIdx64, outNbElement64, retCode, outBegIdx, outNbElement );
+      for( i=0; (i < 2) && (errNumber == TA_TEST_PASS); i++ )
+      {
+         if( memcmp( out32[i], out64[i], sizeof(double)*outNbElement ) )
+            errNumber = TA_ABS_TST_FAIL_CALL64_VALUE;
+      }
+
+      TA_ParamHolderFree( paramHolder[1] );
+      TA_ParamHolderFree( paramHolder[0] );
+   }
+
+   if( errNumber == TA_ABS_TST_FAIL_CALL64_VALUE )
+      printf( "64 bits call output mismatch\n" );
+
+   return errNumber;
+}
+
+static ErrorNumber checkCall64( const char *name, TA_RetCode retCode,
+                                TA_Integer64 outBegIdx, TA_Integer64 outNbElement,
+                                TA_RetCode expRetCode,
+                                int expBegIdx, int expNbElement )
+{
+   if( (retCode != expRetCode) ||
+       (outBegIdx != expBegIdx) || (outNbElement != expNbElement) )
+   {
+      printf( "64 bits call mismatch for %s [%d,%d] [%lld,%d] [%lld,%d]\n", name,
+              retCode, expRetCode, outBegIdx, expBegIdx, outNbElement, expNbElement );
+      return TA_ABS_TST_FAIL_CALL64;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Verify TA_GetOutputSize and the outputs allocated with
+ * TA_AllocOutputParam, for all functions.
+ */
+static ErrorNumber test_alloc_output(void)
+{
+   ErrorNumber errNumber;
+   TA_ParamHolder *paramHolder, *clone;
+   const TA_FuncHandle *handle;
+   TA_Integer outputSize;
+   TA_Real *out, *cloneOut;
+   TA_Integer *outInt;
+   int outBegIdx, outNbElement;
+
+   if( (TA_GetFuncHandle( "SMA", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &paramHolder ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+
+   TA_SetInputParamRealPtr( paramHolder, 0, paramHolderInput );
+   TA_SetOptInputParamInteger( paramHolder, 0, 10 );
+
+   errNumber = TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+
+   /* Invalid ranges and an output not yet set. */
+   if( (TA_GetOutputSize( paramHolder, -1, 10, &outputSize ) != TA_OUT_OF_RANGE_START_INDEX) ||
+       (TA_GetOutputSize( paramHolder, 10, 9, &outputSize ) != TA_OUT_OF_RANGE_END_INDEX) ||
+       (TA_GetOutputSize( paramHolder, 0, 99, NULL ) != TA_BAD_PARAM) ||
+       (TA_AllocOutputParam( NULL, 0, 99 ) != TA_BAD_PARAM) ||
+       (TA_GetOutputParamRealPtr( paramHolder, 0, &out ) != TA_OUTPUT_NOT_ALL_INITIALIZE) ||
+       (TA_GetOutputParamRealPtr( paramHolder, 1, &out ) != TA_BAD_PARAM) ||
+       (TA_GetOutputParamIntegerPtr( paramHolder, 0, &outInt ) != TA_INVALID_PARAM_HOLDER_TYPE) )
+      goto done;
+
+   /* Entirely in the lookback, and partially. */
+   if( (TA_GetOutputSize( paramHolder, 0, 8, &outputSize ) != TA_SUCCESS) || (outputSize != 0) ||
+       (TA_GetOutputSize( paramHolder, 0, 99, &outputSize ) != TA_SUCCESS) || (outputSize != 91) ||
+       (TA_GetOutputSize( paramHolder, 50, 99, &outputSize ) != TA_SUCCESS) || (outputSize != 50) )
+      goto done;
+
+   /* Re-allocating replaces the previous outputs, a clone
+    * shares them without owning them.
+    */
+   if( (TA_AllocOutputParam( paramHolder, 0, 8 ) != TA_SUCCESS) ||
+       (TA_AllocOutputParam( paramHolder, 0, 99 ) != TA_SUCCESS) ||
+       (TA_GetOutputParamRealPtr( paramHolder, 0, &out ) != TA_SUCCESS) ||
+       (TA_ParamHolderClone( paramHolder, NULL, 0, &clone ) != TA_SUCCESS) )
+      goto done;
+
+   if( (TA_GetOutputParamRealPtr( clone, 0, &cloneOut ) != TA_SUCCESS) ||
+       (cloneOut != out) ||
+       (TA_ParamHolderFree( clone ) != TA_SUCCESS) )
+      goto done;
+
+   if( (TA_CallFunc( paramHolder, 0, 99, &outBegIdx, &outNbElement ) != TA_SUCCESS) ||
+       (outBegIdx != 9) || (outNbElement != 91) )
+      goto done;
+
+   errNumber = checkAllFunc( callAllocOutput, "output allocation" );
+
+done:
+   TA_ParamHolderFree( paramHolder );
+   return errNumber;
+}
+
+static ErrorNumber callAllocOutput( const TA_FuncInfo *funcInfo )
+{
+   TA_ParamHolder *paramHolder, *allocHolder;
+   const TA_FuncHandle *handle;
+   ErrorNumber errNumber;
+
+   if( TA_GetFuncHandle( funcInfo->name, &handle ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+
+   if( TA_ParamHolderAlloc( handle, &paramHolder ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+
+   if( TA_ParamHolderAlloc( handle, &allocHolder ) != TA_SUCCESS )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   setStridedInput( paramHolder, handle, 0 );
+   setStridedInput( allocHolder, handle, 0 );
+
+   /* Whole range, a range far from the start, and a range
+    * within the lookback of most functions.
+    */
+   errNumber = checkAllocOutput( paramHolder, allocHolder, funcInfo,
+                                 0, PARALLEL_INPUT_SIZE-1 );
+   if( errNumber == TA_TEST_PASS )
+      errNumber = checkAllocOutput( paramHolder, allocHolder, funcInfo,
+                                    3000, 3999 );
+   if( errNumber == TA_TEST_PASS )
+      errNumber = checkAllocOutput( paramHolder, allocHolder, funcInfo,
+                                    0, 3 );
+
+   TA_ParamHolderFree( allocHolder );
+   TA_ParamHolderFree( paramHolder );
+
+   return errNumber;
+}
+
+static ErrorNumber checkAllocOutput( TA_ParamHolder *paramHolder,
+                                     TA_ParamHolder *allocHolder,
+                                     const TA_FuncInfo *funcInfo,
+                                     int startIdx, int endIdx )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode[2];
+   int outBegIdx[2], outNbElement[2];
+   TA_Integer outputSize;
+   TA_Real *out;
+   TA_Integer *outInt;
+   const void *ptr;
+   unsigned int i;
+   int cmp;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         TA_SetOutputParamIntegerPtr( paramHolder, i, parallelOutput_int[0][i] );
+      else
+         TA_SetOutputParamRealPtr( paramHolder, i, parallelOutput[0][i] );
+   }
+
+   if( (TA_GetOutputSize( allocHolder, startIdx, endIdx, &outputSize ) != TA_SUCCESS) ||
+       (TA_AllocOutputParam( allocHolder, startIdx, endIdx ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+
+   retCode[0] = TA_CallFunc( paramHolder, startIdx, endIdx, &outBegIdx[0], &outNbElement[0] );
+   retCode[1] = TA_CallFunc( allocHolder, startIdx, endIdx, &outBegIdx[1], &outNbElement[1] );
+
+   if( (retCode[0] != retCode[1]) ||
+       ((retCode[0] == TA_SUCCESS) &&
+        ((outBegIdx[0] != outBegIdx[1]) ||
+         (outNbElement[0] != outNbElement[1]) ||
+         (outNbElement[0] != outputSize))) )
+   {
+      printf( "Output size mismatch [%d,%d] [%d,%d] [%d,%d,%d]\n",
+              retCode[0], retCode[1], outBegIdx[0], outBegIdx[1],
+              outNbElement[0], outNbElement[1], outputSize );
+      return TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+   }
+
+   if( retCode[0] != TA_SUCCESS )
+      return TA_TEST_PASS;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+      {
+         if( TA_GetOutputParamIntegerPtr( allocHolder, i, &outInt ) != TA_SUCCESS )
+            return TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+         ptr = outInt;
+         cmp = memcmp( parallelOutput_int[0][i], outInt, sizeof(int)*outNbElement[0] );
+      }
+      else
+      {
+         if( TA_GetOutputParamRealPtr( allocHolder, i, &out ) != TA_SUCCESS )
+            return TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+         ptr = out;
+         cmp = memcmp( parallelOutput[0][i], out, sizeof(double)*outNbElement[0] );
+      }
+
+      if( ((size_t)ptr % 64) != 0 )
+      {
+         printf( "Output[%d] not aligned\n", i );
+         return TA_ABS_TST_FAIL_ALLOC_OUTPUT;
+      }
+
+      if( cmp != 0 )
+      {
+         printf( "Allocated output[%d] mismatch (range %d..%d)\n", i, startIdx, endIdx );
+         return TA_ABS_TST_FAIL_ALLOC_OUTPUT_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Verify that the binary description (ta_meta.h) is the
+ * same as the TA_FuncInfo of all functions.
+ */
+static ErrorNumber test_meta(void)
+{
+   static double blob[64]; /* 8 bytes aligned. */
+   const TA_MetaHeader *header, *checked;
+   const TA_MetaFunc *func;
+   unsigned int i, nbFunc;
+   char name[16];
+
+   header = TA_MetaGet();
+   if( !header )
+   {
+      printf( "TA_MetaGet failed\n" );
+      return TA_ABS_TST_FAIL_META;
+   }
+
+   nbFunc = 0;
+   TA_ForEachFunc( countFunc, &nbFunc );
+   if( (header->nbFunc != nbFunc) ||
+       (TA_MetaCheck( header, header->size, &checked ) != TA_SUCCESS) ||
+       (checked != header) )
+      return TA_ABS_TST_FAIL_META;
+
+   /* Sorted case-insensitive, for TA_MetaFindFunc. */
+   for( i=1; i < header->nbFunc; i++ )
+   {
+      if( compareNoCase( TA_MetaString( header, TA_MetaGetFunc( header, i-1 )->name ),
+                         TA_MetaString( header, TA_MetaGetFunc( header, i )->name ) ) >= 0 )
+         return TA_ABS_TST_FAIL_META;
+   }
+
+   strcpy( name, "bBaNdS" );
+   func = TA_MetaFindFunc( header, name );
+   if( !func || (strcmp( TA_MetaString( header, func->name ), "BBANDS" ) != 0) ||
+       TA_MetaFindFunc( header, "BBAND" ) ||
+       TA_MetaGetFunc( header, header->nbFunc ) ||
+       TA_MetaGetGroup( header, header->nbGroup ) ||
+       TA_MetaGetOptInput( header, func, func->nbOptInput ) ||
+       (strcmp( TA_MetaString( header, header->size ), "" ) != 0) )
+      return TA_ABS_TST_FAIL_META;
+
+   /* Invalid blobs. */
+   memcpy( blob, header, sizeof(blob) );
+   if( (TA_MetaCheck( NULL, header->size, &checked ) != TA_BAD_PARAM) ||
+       (TA_MetaCheck( (const char *)header+4, header->size, &checked ) != TA_BAD_PARAM) ||
+       (TA_MetaCheck( header, header->size-1, &checked ) != TA_BAD_OBJECT) ||
+       (TA_MetaCheck( blob, sizeof(blob), &checked ) != TA_BAD_OBJECT) ||
+       (checked != NULL) )
+      return TA_ABS_TST_FAIL_META;
+
+   memset( (char *)blob+offsetof(TA_MetaHeader,magic), 0, sizeof(unsigned int) );
+   if( TA_MetaCheck( blob, header->size, &checked ) != TA_BAD_OBJECT )
+      return TA_ABS_TST_FAIL_META;
+
+   return checkAllFunc( checkMetaFunc, "metadata" );
+}
+
+static ErrorNumber checkMetaFunc( const TA_FuncInfo *funcInfo )
+{
+   const TA_MetaHeader *header;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   const TA_IntegerRange *integerRange;
+   const TA_IntegerList *integerList;
+   const TA_RealRange *realRange;
+   const TA_MetaFunc *func;
+   const TA_MetaInput *input;
+   const TA_MetaOptInput *optInput;
+   const TA_MetaOutput *output;
+   const TA_MetaListItem *item;
+   unsigned int i, j;
+
+   #define META_CHECK(cond) { if( !(cond) ) { printf( "Metadata mismatch line %d\n", __LINE__ ); return TA_ABS_TST_FAIL_META; } }
+
+   header = TA_MetaGet();
+   func = TA_MetaFindFunc( header, funcInfo->name );
+   META_CHECK( func != NULL );
+   META_CHECK( strcmp( TA_MetaString( header, func->name ), funcInfo->name ) == 0 );
+   META_CHECK( strcmp( TA_MetaString( header, func->camelCaseName ), funcInfo->camelCaseName ) == 0 );
+   META_CHECK( strcmp( TA_MetaString( header, func->hint ), funcInfo->hint ) == 0 );
+   META_CHECK( strcmp( TA_MetaGetGroup( header, func->group ), funcInfo->group ) == 0 );
+   META_CHECK( func->flags == (unsigned int)funcInfo->flags );
+   META_CHECK( (func->nbInput == funcInfo->nbInput) &&
+               (func->nbOptInput == funcInfo->nbOptInput) &&
+               (func->nbOutput == funcInfo->nbOutput) );
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      input = TA_MetaGetInput( header, func, i );
+      META_CHECK( input != NULL );
+      META_CHECK( strcmp( TA_MetaString( header, input->name ), inputInfo->paramName ) == 0 );
+      META_CHECK( (input->type == (unsigned int)inputInfo->type) &&
+                  (input->flags == (unsigned int)inputInfo->flags) );
+   }
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputInfo );
+      optInput = TA_MetaGetOptInput( header, func, i );
+      META_CHECK( optInput != NULL );
+      META_CHECK( strcmp( TA_MetaString( header, optInput->name ), optInputInfo->paramName ) == 0 );
+      META_CHECK( strcmp( TA_MetaString( header, optInput->displayName ), optInputInfo->displayName ) == 0 );
+      META_CHECK( (optInput->type == (unsigned int)optInputInfo->type) &&
+                  (optInput->flags == (unsigned int)optInputInfo->flags) &&
+                  (optInput->defaultValue == optInputInfo->defaultValue) );
+
+      switch( optInputInfo->type )
+      {
+      case TA_OptInput_RealRange:
+         realRange = (const TA_RealRange *)optInputInfo->dataSet;
+         META_CHECK( (optInput->min == realRange->min) &&
+                     (optInput->max == realRange->max) &&
+                     (optInput->precision == realRange->precision) &&
+                     (optInput->suggestedIncrement == realRange->suggested_increment) );
+         break;
+      case TA_OptInput_IntegerRange:
+         integerRange = (const TA_IntegerRange *)optInputInfo->dataSet;
+         META_CHECK( (optInput->min == integerRange->min) &&
+                     (optInput->max == integerRange->max) &&
+                     (optInput->suggestedIncrement == integerRange->suggested_increment) );
+         break;
+      case TA_OptInput_IntegerList:
+         integerList = (const TA_IntegerList *)optInputInfo->dataSet;
+         META_CHECK( optInput->nbListItem == integerList->nbElement );
+         for( j=0; j < integerList->nbElement; j++ )
+         {
+            item = TA_MetaGetListItem( header, optInput, j );
+            META_CHECK( item && (item->value == integerList->data[j].value) );
+            META_CHECK( strcmp( TA_MetaString( header, item->string ), integerList->data[j].string ) == 0 );
+         }
+         break;
+      default:
+         break;
+      }
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      output = TA_MetaGetOutput( header, func, i );
+      META_CHECK( output != NULL );
+      META_CHECK( strcmp( TA_MetaString( header, output->name ), outputInfo->paramName ) == 0 );
+      META_CHECK( (output->type == (unsigned int)outputInfo->type) &&
+                  (output->flags == (unsigned int)outputInfo->flags) );
+   }
+
+   #undef META_CHECK
+
+   return checkMetaLookback( header, func, funcInfo );
+}
+
+/* The lookback formula must give the same value as TA_GetLookback,
+ * for many periods and with an unstable period.
+ */
+static ErrorNumber checkMetaLookback( const TA_MetaHeader *header,
+                                      const TA_MetaFunc *func,
+                                      const TA_FuncInfo *funcInfo )
+{
+   static const int periodList[] = { 0, 1, 2, 5, 13, 99 };
+   static const int unstableList[] = { 0, 7 };
+   const TA_MetaOptInput *optInput;
+   TA_ParamHolder *paramHolder;
+   TA_Integer lookback, expected, period;
+   unsigned int i, j;
+   ErrorNumber errNumber;
+
+   if( func->lookbackId == TA_META_LOOKBACK_OTHER )
+      return TA_TEST_PASS;
+
+   if( TA_ParamHolderAlloc( funcInfo->handle, &paramHolder ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+
+   errNumber = TA_TEST_PASS;
+   optInput = TA_MetaGetOptInput( header, func, func->lookbackOptIn );
+   for( i=0; (i < sizeof(periodList)/sizeof(periodList[0])) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      expected = func->lookbackOffset;
+      if( func->lookbackId == TA_META_LOOKBACK_LINEAR )
+      {
+         period = (TA_Integer)optInput->min + periodList[i];
+         if( period > (TA_Integer)optInput->max )
+            break;
+         TA_SetOptInputParamInteger( paramHolder, func->lookbackOptIn, period );
+         expected += func->lookbackScale*period;
+      }
+
+      for( j=0; j < sizeof(unstableList)/sizeof(unstableList[0]); j++ )
+      {
+         TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, unstableList[j] );
+         if( (TA_GetLookback( paramHolder, &lookback ) != TA_SUCCESS) ||
+             (lookback != expected+((func->flags&TA_FUNC_FLG_UNST_PER)? unstableList[j] : 0)) )
+         {
+            printf( "Lookback formula gives %d instead of %d\n", expected, lookback );
+            errNumber = TA_ABS_TST_FAIL_META_LOOKBACK;
+         }
+      }
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   }
+
+   TA_ParamHolderFree( paramHolder );
+
+   return errNumber;
+}
+
+static int compareNoCase( const char *s1, const char *s2 )
+{
+   int c1, c2;
+
+   do
+   {
+      c1 = toupper( (unsigned char)*s1++ );
+      c2 = toupper( (unsigned char)*s2++ );
+   } while( c1 && (c1 == c2) );
+
+   return c1 - c2;
+}
+
+#if defined( TA_STATS )
+#define STATS_NB_ROUND 3
+#define STATS_NB_TASK  4
+static void statsTask( void *taskData, int taskIdx )
+{
+   int outBegIdx, outNBElement;
+
+   (void)taskData;
+   TA_SMA( 0, 99, inputRandomData, 10, &outBegIdx, &outNBElement, output[taskIdx] );
+}
+#endif
+
+static ErrorNumber test_stats(void)
+{
+   TA_StatsTable *table;
+#if !defined( TA_STATS )
+   /* Counters are not compiled in. */
+   if( (TA_ResetStats() != TA_NOT_SUPPORTED) ||
+       (TA_GetStats( &table ) != TA_NOT_SUPPORTED) )
+      return TA_ABS_TST_FAIL_STATS;
+   return TA_TEST_PASS;
+#else
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *paramHolder;
+   TA_ThreadPool *pool;
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement;
+   unsigned int i, j;
+
+   retCode = TA_ResetStats();
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_STATS;
+
+   /* One direct call and one through the abstract interface. */
+   retCode = TA_SMA( 0, 99, inputRandomData, 10,
+                     &outBegIdx, &outNBElement, output[0] );
+   if( (retCode != TA_SUCCESS) || (outNBElement != 91) )
+      return TA_ABS_TST_FAIL_STATS;
+
+   if( (TA_GetFuncHandle( "SMA", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &paramHolder ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_STATS;
+
+   retCode = TA_SetInputParamRealPtr( paramHolder, 0, inputRandomData );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_SetOptInputParamInteger( paramHolder, 0, 10 );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_SetOutputParamRealPtr( paramHolder, 0, output[0] );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFunc( paramHolder, 0, 49, &outBegIdx, &outNBElement );
+   TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_STATS;
+
+   retCode = TA_GetStats( &table );
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_STATS;
+
+   /* Only SMA was called since the reset. */
+   for( i=0; i < table->size; i++ )
+   {
+      if( table->stats[i].handle != handle )
+         continue;
+      if( (table->stats[i].nbCall != 2) ||
+          (table->stats[i].nbElement != 91+41) ||
+          (table->stats[i].nbNanoSec < 0) )
+         break;
+   }
+
+   if( (table->size != 1) || (i != table->size) )
+   {
+      printf( "TA_GetStats unexpected counters\n" );
+      TA_StatsTableFree( table );
+      return TA_ABS_TST_FAIL_STATS_COUNT;
+   }
+
+   if( (TA_StatsTableFree( table ) != TA_SUCCESS) ||
+       (TA_ResetStats() != TA_SUCCESS) ||
+       (TA_GetStats( &table ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_STATS;
+
+   i = table->size;
+   TA_StatsTableFree( table );
+   if( i != 0 )
+      return TA_ABS_TST_FAIL_STATS_COUNT;
+
+   /* The counts of the threads which exited are kept (their
+    * blocks are taken over by the next threads).
+    */
+   for( j=0; j < STATS_NB_ROUND; j++ )
+   {
+      retCode = TA_ThreadPoolAlloc( 2, 0, &pool );
+      if( retCode == TA_SUCCESS )
+      {
+         TA_ThreadPoolExecutor( pool, STATS_NB_TASK, statsTask, NULL );
+         TA_ThreadPoolFree( pool );
+      }
+      else if( retCode == TA_NOT_SUPPORTED )
+      {
+         for( i=0; i < STATS_NB_TASK; i++ )
+            statsTask( NULL, i );
+      }
+      else
+         return TA_ABS_TST_FAIL_STATS;
+   }
+
+   if( TA_GetStats( &table ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_STATS;
+   if( (table->size != 1) || (table->stats[0].handle != handle) ||
+       (table->stats[0].nbCall != STATS_NB_ROUND*STATS_NB_TASK) )
+   {
+      printf( "TA_GetStats lost the counts of exited threads\n" );
+      TA_StatsTableFree( table );
+      return TA_ABS_TST_FAIL_STATS_COUNT;
+   }
+   TA_StatsTableFree( table );
+
+   return TA_TEST_PASS;
+#endif
+}
+
+#if defined( TA_TRACE )
+#define TRACE_MAX_EVENT 32
+typedef struct
+{
+   int enter;
+   const char *name;
+   int startIdx;
+   unsigned int depth;
+} TraceEvent;
+
+typedef struct
+{
+   unsigned int nbEvent;
+   TraceEvent event[TRACE_MAX_EVENT];
+} TraceLog;
+
+static void traceEnter( const TA_TraceCall *call, void *userData )
+{
+   TraceLog *log = (TraceLog *)userData;
+
+   if( log->nbEvent < TRACE_MAX_EVENT )
+   {
+      log->event[log->nbEvent].enter    = 1;
+      log->event[log->nbEvent].name     = call->name;
+      log->event[log->nbEvent].startIdx = call->startIdx;
+      log->event[log->nbEvent].depth    = call->depth;
+   }
+   log->nbEvent++;
+}
+
+static void traceExit( const TA_TraceCall *call, TA_RetCode retCode,
+                       void *userData )
+{
+   TraceLog *log = (TraceLog *)userData;
+
+   if( log->nbEvent < TRACE_MAX_EVENT )
+   {
+      log->event[log->nbEvent].enter    = 0;
+      log->event[log->nbEvent].name     = call->name;
+      log->event[log->nbEvent].startIdx = retCode == TA_SUCCESS? call->startIdx : -1;
+      log->event[log->nbEvent].depth    = call->depth;
+   }
+   log->nbEvent++;
+}
+#endif
+
+static ErrorNumber test_trace(void)
+{
+#if !defined( TA_TRACE )
+   /* Hooks are not compiled in. */
+   if( TA_SetTraceHooks( NULL, NULL, NULL ) != TA_NOT_SUPPORTED )
+      return TA_ABS_TST_FAIL_TRACE;
+   return TA_TEST_PASS;
+#else
+   static TraceLog log;
+   const TraceEvent *event;
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement;
+   unsigned int i, nbIntEma;
+
+   memset( &log, 0, sizeof(log) );
+   if( TA_SetTraceHooks( traceEnter, traceExit, &log ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_TRACE;
+
+   retCode = TA_MACD( 50, 199, inputRandomData, 12, 26, 9,
+                      &outBegIdx, &outNBElement,
+                      output[0], output[1], output[2] );
+   TA_SetTraceHooks( NULL, NULL, NULL );
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_TRACE;
+
+   /* MACD (depth 0) encloses the INT_EMA sub-calls (depth 1). */
+   if( (log.nbEvent < 4) || (log.nbEvent > TRACE_MAX_EVENT) ||
+       (log.nbEvent%2 != 0) )
+      return TA_ABS_TST_FAIL_TRACE_EVENT;
+
+   event = &log.event[0];
+   if( !event->enter || strcmp( event->name, "MACD" ) ||
+       (event->startIdx != 50) || (event->depth != 0) )
+      return TA_ABS_TST_FAIL_TRACE_EVENT;
+
+   event = &log.event[log.nbEvent-1];
+   if( event->enter || strcmp( event->name, "MACD" ) ||
+       (event->startIdx != 50) || (event->depth != 0) )
+      return TA_ABS_TST_FAIL_TRACE_EVENT;
+
+   nbIntEma = 0;
+   for( i=1; i < log.nbEvent-1; i += 2 )
+   {
+      event = &log.event[i];
+      if( !event->enter || event[1].enter || (event->depth != 1) ||
+          (event[1].depth != 1) || strcmp( event->name, event[1].name ) ||
+          (event[1].startIdx < 0) )
+         return TA_ABS_TST_FAIL_TRACE_EVENT;
+      if( strcmp( event->name, "INT_EMA" ) == 0 )
+         nbIntEma++;
+   }
+
+   /* Fast, slow and signal periods. */
+   if( nbIntEma != 3 )
+      return TA_ABS_TST_FAIL_TRACE_EVENT;
+
+   /* No more calls to the hooks once removed. */
+   log.nbEvent = 0;
+   retCode = TA_SMA( 0, 99, inputRandomData, 10,
+                     &outBegIdx, &outNBElement, output[0] );
+   if( (retCode != TA_SUCCESS) || (log.nbEvent != 0) )
+      return TA_ABS_TST_FAIL_TRACE_EVENT;
+
+   return TA_TEST_PASS;
+#endif
+}
+
+#if defined( TA_STATS )
+typedef struct
+{
+   int nbCall;
+   int allow;
+   const TA_FuncHandle *handle;
+} StrictAllocLog;
+
+static int strictAllocHook( const TA_FuncHandle *handle, size_t size, void *userData )
+{
+   StrictAllocLog *log = (StrictAllocLog *)userData;
+
+   (void)size;
+   log->nbCall++;
+   log->handle = handle;
+
+   return log->allow;
+}
+#endif
+
+static ErrorNumber test_strict_alloc(void)
+{
+#if !defined( TA_STATS )
+   if( TA_SetStrictAlloc( 1, NULL, NULL ) != TA_NOT_SUPPORTED )
+      return TA_ABS_TST_FAIL_STRICT_ALLOC;
+   return TA_TEST_PASS;
+#else
+   /* CCI keeps up to 30 values on the stack, more are allocated. */
+   #define CCI_CALL(period) TA_CCI( 0, 199, inputRandomData, inputRandomData, \
+                                    inputRandomData, period, &outBegIdx, \
+                                    &outNBElement, output[0] )
+   static double scratch[512];
+   StrictAllocLog log;
+   const TA_FuncHandle *handle, *smaHandle;
+   TA_ParamHolder *paramHolder;
+   TA_StatsTable *table;
+   TA_Context *context;
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement;
+   ErrorNumber errNumber;
+
+   if( TA_GetFuncHandle( "CCI", &handle ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_STRICT_ALLOC;
+
+   /* Accounting of the heap allocation. */
+   TA_ResetStats();
+   if( (CCI_CALL(20) != TA_SUCCESS) || (CCI_CALL(50) != TA_SUCCESS) ||
+       (TA_GetStats( &table ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_STRICT_ALLOC;
+
+   errNumber = TA_TEST_PASS;
+   if( (table->size != 1) || (table->stats[0].handle != handle) ||
+       (table->stats[0].nbAlloc != 1) || (table->stats[0].nbHeapAlloc != 1) ||
+       (table->stats[0].maxLiveByte != (TA_Integer64)(50*sizeof(double))) )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+   TA_StatsTableFree( table );
+   if( errNumber != TA_TEST_PASS )
+      return errNumber;
+
+   /* Strided input, gathered by TA_CallFunc. */
+   if( (TA_GetFuncHandle( "SMA", &smaHandle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( smaHandle, &paramHolder ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_STRICT_ALLOC;
+   TA_SetInputParamRealStride( paramHolder, 0, inputRandomData, 2*sizeof(double) );
+   TA_SetOptInputParamInteger( paramHolder, 0, 10 );
+   TA_SetOutputParamRealPtr( paramHolder, 0, output[0] );
+
+   /* Denied without a hook, also in the entry points which
+    * are not a TA function.
+    */
+   memset( &log, 0, sizeof(log) );
+   TA_SetStrictAlloc( 1, NULL, NULL );
+   if( (CCI_CALL(20) != TA_SUCCESS) || (CCI_CALL(50) != TA_ALLOC_FORBIDDEN) )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+   if( TA_MACD_Bundle( 0, 199, inputRandomData, 12, 26, 9, &outBegIdx, &outNBElement,
+                       output[0], NULL, NULL, NULL, NULL ) != TA_ALLOC_FORBIDDEN )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+   if( TA_CallFunc( paramHolder, 0, 199, &outBegIdx, &outNBElement ) != TA_ALLOC_FORBIDDEN )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+
+   /* Allowed or denied by the hook. */
+   TA_SetStrictAlloc( 1, strictAllocHook, &log );
+   log.allow = 1;
+   if( (CCI_CALL(50) != TA_SUCCESS) || (log.nbCall != 1) || (log.handle != handle) )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+   log.allow = 0;
+   if( (CCI_CALL(50) != TA_ALLOC_FORBIDDEN) || (log.nbCall != 2) )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+   if( (TA_CallFunc( paramHolder, 0, 199, &outBegIdx, &outNBElement ) != TA_ALLOC_FORBIDDEN) ||
+       (log.nbCall != 3) || (log.handle != smaHandle) )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+
+   /* Allocation free with a scratch buffer. */
+   retCode = TA_ContextAlloc( &context );
+   if( retCode == TA_SUCCESS )
+   {
+      TA_ContextSetScratch( context, scratch, sizeof(scratch) );
+      TA_SetThreadContext( context );
+      if( (CCI_CALL(50) != TA_SUCCESS) || (log.nbCall != 3) )
+         errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+      TA_SetThreadContext( NULL );
+      TA_ContextFree( context );
+   }
+   else
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+
+   TA_SetStrictAlloc( 0, NULL, NULL );
+   if( (CCI_CALL(50) != TA_SUCCESS) ||
+       (TA_CallFunc( paramHolder, 0, 199, &outBegIdx, &outNBElement ) != TA_SUCCESS) )
+      errNumber = TA_ABS_TST_FAIL_STRICT_ALLOC;
+   TA_ParamHolderFree( paramHolder );
+
+   return errNumber;
+   #undef CCI_CALL
+#endif
+}
+
+static ErrorNumber setPlanCall( const PlanCall *planCall,
+                                TA_ParamHolder **paramHolder,
+                                double out[3][PLAN_INPUT_SIZE] )
+{
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int i;
+
+   if( (TA_GetFuncHandle( planCall->name, &handle ) != TA_SUCCESS) ||
+       (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) )
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+
+   if( TA_ParamHolderAlloc( handle, paramHolder ) != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+
+   setStridedInput( *paramHolder, handle, planCall->step );
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( handle, i, &optInputInfo );
+      if( optInputInfo->type == TA_OptInput_RealRange )
+         TA_SetOptInputParamReal( *paramHolder, i, planCall->optIn[i] );
+      else
+         TA_SetOptInputParamInteger( *paramHolder, i, (TA_Integer)planCall->optIn[i] );
+   }
+
+   /* Integer outputs are stored in the same buffers. */
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         TA_SetOutputParamIntegerPtr( *paramHolder, i, (int *)out[i] );
+      else
+         TA_SetOutputParamRealPtr( *paramHolder, i, out[i] );
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber checkPlanCall( const PlanCall *planCall,
+                                  TA_ParamHolder *paramHolder,
+                                  const TA_CallResult *result,
+                                  double out[3][PLAN_INPUT_SIZE] )
+{
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   int outBegIdx, outNbElement;
+   unsigned int i;
+   size_t size;
+
+   TA_GetFuncHandle( planCall->name, &handle );
+   TA_GetFuncInfo( handle, &funcInfo );
+
+   /* Same call, done alone. */
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         TA_SetOutputParamIntegerPtr( paramHolder, i, parallelOutput_int[0][i] );
+      else
+         TA_SetOutputParamRealPtr( paramHolder, i, parallelOutput[0][i] );
+   }
+
+   retCode = TA_CallFunc( paramHolder, planCall->startIdx, planCall->endIdx,
+                          &outBegIdx, &outNbElement );
+
+   if( (retCode != result->retCode) ||
+       ((retCode == TA_SUCCESS) &&
+        ((outBegIdx != result->outBegIdx) || (outNbElement != result->outNbElement))) )
+   {
+      printf( "Plan call mismatch for %s [%d,%d] [%d,%d] [%d,%d]\n", planCall->name,
+              retCode, result->retCode, outBegIdx, result->outBegIdx,
+              outNbElement, result->outNbElement );
+      return TA_ABS_TST_FAIL_PLAN_CALL;
+   }
+
+   for( i=0; (retCode == TA_SUCCESS) && (i < funcInfo->nbOutput); i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo );
+      size = (outputInfo->type == TA_Output_Integer)? sizeof(int) : sizeof(double);
+      if( memcmp( out[i], outputInfo->type == TA_Output_Integer? (void *)parallelOutput_int[0][i] : (void *)parallelOutput[0][i],
+                  size*outNbElement ) != 0 )
+      {
+         printf( "Plan output[%d] mismatch for %s\n", i, planCall->name );
+         return TA_ABS_TST_FAIL_PLAN_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void *countingMalloc( void *allocatorData, size_t size )
+{
+   ((AllocatorCount *)allocatorData)->nbMalloc++;
+   return malloc( size );
+}
+
+static void *countingRealloc( void *allocatorData, void *ptr, size_t size )
+{
+   (void)allocatorData;
+   return realloc( ptr, size );
+}
+
+static void countingFree( void *allocatorData, void *ptr )
+{
+   ((AllocatorCount *)allocatorData)->nbFree++;
+   free( ptr );
+}
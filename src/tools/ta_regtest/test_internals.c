@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       Agent
  *
  *
  * Change history:
@@ -47,6 +48,7 @@
  *  080605 MF   Add tests for pseudo-random generator.
  *  091705 MF   Add tests for TA_AddTimeToTimestamp (Fix#1293953).
  *  110906 MF   Remove pseudo-random to eliminate dependencies.
+ *  101926 AG   Add tests for TA_Context.
  */
 
 /* Description:
@@ -59,6 +61,7 @@
 /**** Headers ****/
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #include "ta_test_priv.h"
 #include "ta_memory.h"
@@ -76,10 +79,37 @@
 /* None */
 
 /**** Local declarations.              ****/
-/* None */
+#define CONTEXT_TST_NB_BAR  300
+#define CONTEXT_TST_NB_TASK 8
+#define CONTEXT_TST_PERIOD  14
+
+/* RSI values calculated with a given set of settings. */
+typedef struct
+{
+   TA_RetCode retCode;
+   TA_Integer outBegIdx;
+   TA_Integer outNbElement;
+   TA_Real    out[CONTEXT_TST_NB_BAR];
+} ContextTstResult;
+
+/* Tasks alternating between two contexts. */
+typedef struct
+{
+   const TA_Context *context[2];
+   const TA_Real    *in;
+   ContextTstResult  result[CONTEXT_TST_NB_TASK];
+} ContextTstJob;
 
 /**** Local functions declarations.    ****/
 static ErrorNumber testCircularBuffer( void );
+static ErrorNumber testContext( void );
+static ErrorNumber doTestContext( TA_Context *context[2], const TA_Real *in );
+static void contextTstRSI( const TA_Real *in, ContextTstResult *result );
+static void contextTstTask( void *taskData, int taskIdx );
+static void unboundExecutor( void *executorData, int nbTask,
+                             TA_TaskFunc taskFunc, void *taskData );
+static int isSameResult( const ContextTstResult *result1,
+                         const ContextTstResult *result2 );
 
 static TA_RetCode circBufferFillFrom0ToSize( int size, int *buffer );
 
@@ -104,6 +134,13 @@ ErrorNumber test_internals( void )
       return retValue;
    }
 
+   retValue = testContext();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Context tests (%d)\n", retValue );
+      return retValue;
+   }
+
    return TA_TEST_PASS; /* Success. */
 }
 
@@ -229,6 +266,312 @@ static ErrorNumber testCircularBuffer( void )
    return TA_TEST_PASS; /* Success. */
 }
 
+static ErrorNumber testContext( void )
+{
+   TA_Context *context[2];
+   TA_Real in[CONTEXT_TST_NB_BAR];
+   ErrorNumber retValue;
+   int i;
+
+   retValue = allocLib();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Can't initialize the library\n" );
+      return retValue;
+   }
+
+   for( i=0; i < CONTEXT_TST_NB_BAR; i++ )
+      in[i] = 100.0 + 10.0*sin(i*0.1) + (double)(i%7);
+
+   context[0] = NULL;
+   context[1] = NULL;
+   if( (TA_ContextAlloc( &context[0] ) != TA_SUCCESS) ||
+       (TA_ContextAlloc( &context[1] ) != TA_SUCCESS) )
+   {
+      printf( "\nFailed: TA_ContextAlloc\n" );
+      TA_ContextFree( context[0] );
+      freeLib();
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+   }
+
+   retValue = doTestContext( context, in );
+
+   TA_SetThreadContext( NULL );
+   TA_SetExecutor( NULL, NULL );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   if( (TA_ContextFree( context[0] ) != TA_SUCCESS) ||
+       (TA_ContextFree( context[1] ) != TA_SUCCESS) )
+   {
+      printf( "\nFailed: TA_ContextFree\n" );
+      if( retValue == TA_TEST_PASS )
+         retValue = TA_INTERNAL_CONTEXT_CALL_FAILED;
+   }
+
+   if( retValue != TA_TEST_PASS )
+   {
+      freeLib();
+      return retValue;
+   }
+
+   return freeLib();
+}
+
+static ErrorNumber doTestContext( TA_Context *context[2], const TA_Real *in )
+{
+   ContextTstResult expected[2];
+   ContextTstResult result;
+   ContextTstJob job;
+   TA_ThreadPool *pool;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params;
+   TA_RetCode retCode;
+   TA_Integer lookback;
+   const TA_Real *panelIn[CONTEXT_TST_NB_TASK];
+   TA_Real *panelOut[CONTEXT_TST_NB_TASK];
+   TA_Real panelBuffer[CONTEXT_TST_NB_TASK][CONTEXT_TST_NB_BAR];
+   int panelLength[CONTEXT_TST_NB_TASK];
+   int panelBegIdx[CONTEXT_TST_NB_TASK];
+   int panelNBElement[CONTEXT_TST_NB_TASK];
+   int i;
+
+   /* Parameters validation. */
+   if( (TA_ContextAlloc( NULL ) != TA_BAD_PARAM) ||
+       (TA_ContextSetUnstablePeriod( NULL, TA_FUNC_UNST_RSI, 1 ) != TA_BAD_PARAM) ||
+       (TA_ContextSetUnstablePeriod( context[0], (TA_FuncUnstId)(TA_FUNC_UNST_ALL+1), 1 ) != TA_BAD_PARAM) ||
+       (TA_ContextSetCompatibility( NULL, TA_COMPATIBILITY_METASTOCK ) != TA_BAD_PARAM) ||
+       (TA_ContextFree( NULL ) != TA_SUCCESS) )
+   {
+      printf( "\nFailed: Context parameters validation\n" );
+      return TA_INTERNAL_CONTEXT_BAD_PARAM;
+   }
+
+   /* Calculate the expected values with the global settings. */
+   TA_SetUnstablePeriod( TA_FUNC_UNST_RSI, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   contextTstRSI( in, &expected[0] );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_RSI, 20 );
+   TA_SetCompatibility( TA_COMPATIBILITY_METASTOCK );
+   contextTstRSI( in, &expected[1] );
+
+   if( (expected[0].retCode != TA_SUCCESS) ||
+       (expected[1].retCode != TA_SUCCESS) ||
+       (expected[0].outBegIdx == expected[1].outBegIdx) )
+   {
+      printf( "\nFailed: Context reference values\n" );
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+   }
+
+   /* Each context gets the settings of one of the reference, while
+    * the global settings are changed to something else.
+    */
+   if( (TA_ContextSetUnstablePeriod( context[0], TA_FUNC_UNST_ALL, 0 ) != TA_SUCCESS) ||
+       (TA_ContextSetCompatibility( context[0], TA_COMPATIBILITY_DEFAULT ) != TA_SUCCESS) ||
+       (TA_ContextSetUnstablePeriod( context[1], TA_FUNC_UNST_RSI, 20 ) != TA_SUCCESS) ||
+       (TA_ContextSetCompatibility( context[1], TA_COMPATIBILITY_METASTOCK ) != TA_SUCCESS) )
+   {
+      printf( "\nFailed: Context settings\n" );
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+   }
+   TA_SetUnstablePeriod( TA_FUNC_UNST_RSI, 5 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   if( (TA_ContextGetUnstablePeriod( context[1], TA_FUNC_UNST_RSI ) != 20) ||
+       (TA_ContextGetCompatibility( context[1] ) != TA_COMPATIBILITY_METASTOCK) ||
+       (TA_GetUnstablePeriod( TA_FUNC_UNST_RSI ) != 5) )
+   {
+      printf( "\nFailed: Context settings are not independent\n" );
+      return TA_INTERNAL_CONTEXT_BAD_VALUE;
+   }
+
+   /* Context bound to the calling thread. */
+   for( i=0; i < 2; i++ )
+   {
+      TA_SetThreadContext( context[i] );
+      contextTstRSI( in, &result );
+      if( (TA_GetThreadContext() != context[i]) ||
+          !isSameResult( &result, &expected[i] ) ||
+          (TA_RSI_Lookback( CONTEXT_TST_PERIOD ) != expected[i].outBegIdx) ||
+          (TA_GetUnstablePeriod( TA_FUNC_UNST_RSI ) != 5) )
+      {
+         printf( "\nFailed: Context %d bound to the thread\n", i );
+         return TA_INTERNAL_CONTEXT_BAD_VALUE;
+      }
+   }
+   TA_SetThreadContext( NULL );
+   if( TA_RSI_Lookback( CONTEXT_TST_PERIOD ) != CONTEXT_TST_PERIOD+5 )
+   {
+      printf( "\nFailed: Global settings after unbinding the context\n" );
+      return TA_INTERNAL_CONTEXT_BAD_VALUE;
+   }
+
+   /* Threads using different contexts concurrently. */
+   memset( &job, 0, sizeof(job) );
+   job.context[0] = context[0];
+   job.context[1] = context[1];
+   job.in = in;
+
+   retCode = TA_ThreadPoolAlloc( 4, 0, &pool );
+   if( retCode == TA_SUCCESS )
+   {
+      TA_ThreadPoolExecutor( pool, CONTEXT_TST_NB_TASK, contextTstTask, &job );
+   }
+   else if( retCode == TA_NOT_SUPPORTED )
+   {
+      pool = NULL;
+      for( i=0; i < CONTEXT_TST_NB_TASK; i++ )
+         contextTstTask( &job, i );
+   }
+   else
+   {
+      printf( "\nFailed: TA_ThreadPoolAlloc (%d)\n", retCode );
+      return TA_INTERNAL_CONTEXT_THREAD_POOL;
+   }
+
+   for( i=0; i < CONTEXT_TST_NB_TASK; i++ )
+   {
+      if( !isSameResult( &job.result[i], &expected[i%2] ) )
+      {
+         printf( "\nFailed: Context task %d\n", i );
+         TA_ThreadPoolFree( pool );
+         return TA_INTERNAL_CONTEXT_BAD_VALUE;
+      }
+   }
+
+   TA_ThreadPoolFree( pool );
+
+   /* The work submitted to the executor must use the context
+    * of the submitting thread, whatever thread executes it.
+    */
+   TA_SetExecutor( unboundExecutor, NULL );
+
+   for( i=0; i < CONTEXT_TST_NB_TASK; i++ )
+   {
+      panelIn[i]     = in;
+      panelOut[i]    = panelBuffer[i];
+      panelLength[i] = CONTEXT_TST_NB_BAR;
+   }
+
+   TA_SetThreadContext( context[1] );
+   memset( &result, 0, sizeof(result) );
+   result.retCode = TA_EMA( 0, CONTEXT_TST_NB_BAR-1, in, CONTEXT_TST_PERIOD,
+                            &result.outBegIdx, &result.outNbElement, result.out );
+   retCode = TA_EMA_Panel( CONTEXT_TST_NB_TASK, panelLength, panelIn, CONTEXT_TST_PERIOD,
+                           panelBegIdx, panelNBElement, panelOut );
+   TA_SetThreadContext( NULL );
+   TA_SetExecutor( NULL, NULL );
+
+   if( (retCode != TA_SUCCESS) || (result.retCode != TA_SUCCESS) )
+   {
+      printf( "\nFailed: TA_EMA_Panel with a context (%d)\n", retCode );
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+   }
+
+   for( i=0; i < CONTEXT_TST_NB_TASK; i++ )
+   {
+      if( (panelBegIdx[i] != result.outBegIdx) ||
+          (panelNBElement[i] != result.outNbElement) ||
+          memcmp( panelBuffer[i], result.out, sizeof(TA_Real)*panelNBElement[i] ) )
+      {
+         printf( "\nFailed: TA_EMA_Panel series %d with a context\n", i );
+         return TA_INTERNAL_CONTEXT_BAD_VALUE;
+      }
+   }
+
+   /* Context attached to a TA_ParamHolder. */
+   retCode = TA_GetFuncHandle( "RSI", &handle );
+   if( retCode != TA_SUCCESS )
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+
+   retCode = TA_ParamHolderAlloc( handle, &params );
+   if( retCode != TA_SUCCESS )
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+
+   memset( &result, 0, sizeof(result) );
+   TA_SetInputParamRealPtr( params, 0, in );
+   TA_SetOptInputParamInteger( params, 0, CONTEXT_TST_PERIOD );
+   TA_SetOutputParamRealPtr( params, 0, result.out );
+
+   if( (TA_SetParamHolderContext( NULL, context[1] ) != TA_BAD_PARAM) ||
+       (TA_SetParamHolderContext( params, context[1] ) != TA_SUCCESS) )
+   {
+      printf( "\nFailed: TA_SetParamHolderContext\n" );
+      TA_ParamHolderFree( params );
+      return TA_INTERNAL_CONTEXT_BAD_PARAM;
+   }
+
+   /* The context of the TA_ParamHolder has precedence. */
+   TA_SetThreadContext( context[0] );
+   retCode = TA_GetLookback( params, &lookback );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFunc( params, 0, CONTEXT_TST_NB_BAR-1,
+                             &result.outBegIdx, &result.outNbElement );
+   result.retCode = retCode;
+
+   if( (TA_GetThreadContext() != context[0]) ||
+       (lookback != expected[1].outBegIdx) ||
+       !isSameResult( &result, &expected[1] ) )
+   {
+      printf( "\nFailed: TA_CallFunc with a context (%d)\n", retCode );
+      TA_SetThreadContext( NULL );
+      TA_ParamHolderFree( params );
+      return TA_INTERNAL_CONTEXT_BAD_VALUE;
+   }
+   TA_SetThreadContext( NULL );
+
+   retCode = TA_ParamHolderFree( params );
+   if( retCode != TA_SUCCESS )
+      return TA_INTERNAL_CONTEXT_CALL_FAILED;
+
+   return TA_TEST_PASS;
+}
+
+static void contextTstRSI( const TA_Real *in, ContextTstResult *result )
+{
+   memset( result->out, 0, sizeof(result->out) );
+   result->retCode = TA_RSI( 0, CONTEXT_TST_NB_BAR-1, in, CONTEXT_TST_PERIOD,
+                             &result->outBegIdx, &result->outNbElement,
+                             result->out );
+}
+
+static void contextTstTask( void *taskData, int taskIdx )
+{
+   ContextTstJob *job;
+
+   job = (ContextTstJob *)taskData;
+
+   TA_SetThreadContext( job->context[taskIdx%2] );
+   contextTstRSI( job->in, &job->result[taskIdx] );
+   TA_SetThreadContext( NULL );
+}
+
+/* Execute the tasks like a thread not bound to any context would. */
+static void unboundExecutor( void *executorData, int nbTask,
+                             TA_TaskFunc taskFunc, void *taskData )
+{
+   const TA_Context *savedContext;
+   int i;
+
+   (void)executorData;
+
+   savedContext = TA_GetThreadContext();
+   TA_SetThreadContext( NULL );
+   for( i=nbTask-1; i >= 0; i-- )
+      taskFunc( taskData, i );
+   TA_SetThreadContext( savedContext );
+}
+
+static int isSameResult( const ContextTstResult *result1,
+                         const ContextTstResult *result2 )
+{
+   return (result1->retCode == TA_SUCCESS) &&
+          (result2->retCode == TA_SUCCESS) &&
+          (result1->outBegIdx == result2->outBegIdx) &&
+          (result1->outNbElement == result2->outNbElement) &&
+          !memcmp( result1->out, result2->out, sizeof(TA_Real)*result1->outNbElement );
+}
+
 /* This function is suppose to fill the buffer
  * with values going from 0 to 'size'.
  * The filling is done using the CIRCBUF macros.